@@ -8,6 +8,7 @@
 // enable posit arithmetic exceptions
 #define POSIT_THROW_ARITHMETIC_EXCEPTION 1
 #include <universal/posit/posit>
+#include <universal/fixpnt/fixpnt>
 
 /*
 
@@ -58,6 +59,23 @@ try {
 	}
 	cout << "Value is " << fir << endl;
 
+	// the same filter in 16-bit saturating fixed-point with 11 fraction bits, which leaves headroom for the
+	// partial sums and runs on the native integer arithmetic of fixpnt
+	using Fixed = fixpnt<nbits, 11, Saturating, uint16_t>;
+	vector<Fixed> qsinusoid(vecSize), qweights(vecSize);
+	for (size_t i = 0; i < vecSize; i++) {
+		qsinusoid[i] = sin((float(i) / float(vecSize)) * 2.0 * pi);
+		qweights[i] = 0.5f;
+	}
+	Fixed qfir;
+	qfir = 0.0f;
+	for (size_t i = 0; i < vecSize; i++) {
+		qfir += qsinusoid[i] * qweights[i];
+	}
+	cout << "Q-format value is " << qfir << endl;
+	// the fused dot product accumulates the exact products in a fixpnt_quire and rounds and saturates once
+	cout << "Q-format fdp is   " << fdp(qsinusoid, qweights) << endl;
+
 	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
 }
 catch (char const* msg) {
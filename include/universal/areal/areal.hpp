@@ -5,58 +5,84 @@
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <cassert>
+#include <cmath>
 #include <limits>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
 
 #include <universal/native/ieee-754.hpp>
 #include <universal/blockbin/blockbinary.hpp>
+#include <universal/blockbin/blocktriple.hpp>
+#include <universal/areal/exceptions.hpp>
 
 namespace sw {	namespace unum {
-		
+
+/*
+ An areal<nbits, es> is a sign-magnitude floating-point encoding with an uncertainty bit (ubit) in the least significant position:
+     sign | es exponent bits | fbits = nbits - 2 - es fraction bits | ubit
+ The exponent has a bias of 2^(es-1) - 1 and the exponent field 0 encodes the subnormals. The all-ones exponent field
+ encodes infinity when fraction and ubit are 0, and NaN otherwise.
+ An encoding with the ubit set represents the open interval between the value of the encoding and the next encoding
+ that is larger in magnitude: results that are not exact truncate toward zero and set the ubit, so that the exact
+ value is contained in the interval of the encoding. Arithmetic evaluates the operands at the value of their encoding
+ and marks the result as uncertain when either operand is uncertain.
+ */
+
 // Forward definitions
 template<size_t nbits, size_t es, typename bt> class areal;
 template<size_t nbits, size_t es, typename bt> areal<nbits,es,bt> abs(const areal<nbits,es,bt>& v);
 
-template<size_t nbits, size_t es, typename bt>
-void extract_fields(const blockbinary<nbits, bt>& raw_bits, bool& _sign, blockbinary<es, bt>& _exponent, blockbinary<nbits - es - 1, bt>& _fraction) {
-
-}
-
 // fill an areal object with mininum positive value
 template<size_t nbits, size_t es, typename bt>
 areal<nbits, es, bt>& minpos(areal<nbits, es, bt>& aminpos) {
-
-	return aminpos;
+	blockbinary<nbits, bt> raw;
+	raw.set(1);   // the smallest subnormal: the fraction lsb just above the ubit
+	return aminpos.setbits(raw);
 }
 // fill an areal object with maximum positive value
 template<size_t nbits, size_t es, typename bt>
 areal<nbits, es, bt>& maxpos(areal<nbits, es, bt>& amaxpos) {
-
-	return amaxpos;
+	// the largest normal exponent field with an all-ones fraction is one less than the infinity encoding without ubit
+	blockbinary<nbits, bt> raw, one(1);
+	raw.set_raw_bits(areal<nbits, es, bt>::MAX_EXP_FIELD);
+	raw <<= int(areal<nbits, es, bt>::fbits);
+	raw -= one;
+	raw <<= 1;
+	return amaxpos.setbits(raw);
 }
 // fill an areal object with mininum negative value
 template<size_t nbits, size_t es, typename bt>
 areal<nbits, es, bt>& minneg(areal<nbits, es, bt>& aminneg) {
-
-	return aminneg;
+	minpos(aminneg);
+	return aminneg = -aminneg;
 }
 // fill an areal object with maximum negative value
 template<size_t nbits, size_t es, typename bt>
 areal<nbits, es, bt>& maxneg(areal<nbits, es, bt>& amaxneg) {
-
-	return amaxneg;
+	maxpos(amaxneg);
+	return amaxneg = -amaxneg;
 }
 
 // template class representing a value in scientific notation, using a template size for the number of fraction bits
 template<size_t nbits, size_t es, typename bt = uint8_t>
 class areal {
 public:
-	static constexpr size_t fbits  = nbits - 1 - es;    // number of fraction bits excluding the hidden bit
+	static_assert(es > 1, "areal requires at least two exponent bits");
+	static_assert(es < 32, "areal exponent field is limited to 31 bits");
+	static_assert(nbits > es + 2, "areal requires at least one fraction bit");
+	static constexpr size_t fbits  = nbits - 2 - es;    // number of fraction bits excluding the hidden bit and the ubit
 	static constexpr size_t fhbits = fbits + 1;         // number of fraction bits including the hidden bit
 	static constexpr size_t abits = fhbits + 3;         // size of the addend
 	static constexpr size_t mbits = 2 * fhbits;         // size of the multiplier output
 	static constexpr size_t divbits = 3 * fhbits + 4;   // size of the divider output
 
-	areal() {}
+	static constexpr int EXP_BIAS = int((uint64_t(1) << (es - 1)) - 1);
+	static constexpr uint64_t MAX_EXP_FIELD = (uint64_t(1) << es) - 1;     // reserved for infinity and NaN
+	static constexpr int MAX_EXP = int(MAX_EXP_FIELD) - 1 - EXP_BIAS;      // scale of maxpos
+	static constexpr int MIN_EXP_NORMAL = 1 - EXP_BIAS;                     // scale of the smallest normal value
+
+	areal() : _bits() {}
 
 	areal(signed char initial_value)        { *this = initial_value; }
 	areal(short initial_value)              { *this = initial_value; }
@@ -68,6 +94,8 @@ public:
 	areal(long double initial_value)        { *this = initial_value; }
 	areal(const areal& rhs)                 { *this = rhs; }
 
+	areal& operator=(const areal&) = default;
+
 	// assignment operators
 	areal& operator=(signed char rhs) {
 		return *this = (long long)(rhs);
@@ -79,58 +107,85 @@ public:
 		return *this = (long long)(rhs);
 	}
 	areal& operator=(long long rhs) {
+		round(blocktriple<es, 63, bt>(rhs), false);
 		return *this;
 	}
 	areal& operator=(unsigned long long rhs) {
+		round(blocktriple<es, 63, bt>(rhs), false);
 		return *this;
 	}
 	areal& operator=(float rhs) {
-
-		return *this;
+		return convert_ieee754(rhs);
 	}
 	areal& operator=(double rhs) {
-
-		return *this;
+		return convert_ieee754(rhs);
 	}
 	areal& operator=(long double rhs) {
-
-		return *this;
+		return convert_ieee754(rhs);
 	}
 
 	// arithmetic operators
 	// prefix operator
-	areal operator-() const {				
-		return *this;
+	areal operator-() const {
+		areal negated(*this);
+		negated._bits.set(nbits - 1, !sign());
+		return negated;
 	}
 
 	areal& operator+=(const areal& rhs) {
+		blocktriple<es, abits + 1, bt> sum;
+		module_add<es, fbits, abits, bt>(normalize(), rhs.normalize(), sum);
+		round(sum, ubit() || rhs.ubit());
 		return *this;
 	}
 	areal& operator+=(double rhs) {
 		return *this += areal(rhs);
 	}
 	areal& operator-=(const areal& rhs) {
-
+		blocktriple<es, abits + 1, bt> difference;
+		module_subtract<es, fbits, abits, bt>(normalize(), rhs.normalize(), difference);
+		round(difference, ubit() || rhs.ubit());
 		return *this;
 	}
 	areal& operator-=(double rhs) {
-		return *this -= areal<nbits, es>(rhs);
+		return *this -= areal(rhs);
 	}
 	areal& operator*=(const areal& rhs) {
-
+		blocktriple<es, mbits, bt> product;
+		module_multiply<es, fbits, mbits, bt>(normalize(), rhs.normalize(), product);
+		round(product, ubit() || rhs.ubit());
 		return *this;
 	}
 	areal& operator*=(double rhs) {
-		return *this *= areal<nbits, es>(rhs);
+		return *this *= areal(rhs);
 	}
 	areal& operator/=(const areal& rhs) {
-
+#if AREAL_THROW_ARITHMETIC_EXCEPTION
+		if (rhs.iszero()) throw areal_divide_by_zero();
+#endif
+		blocktriple<es, divbits, bt> ratio;
+		module_divide<es, fbits, divbits, bt>(normalize(), rhs.normalize(), ratio);
+		round(ratio, ubit() || rhs.ubit());
 		return *this;
 	}
 	areal& operator/=(double rhs) {
-		return *this /= areal<nbits, es>(rhs);
+		return *this /= areal(rhs);
 	}
+	// move to the next encoding toward +infinity
 	areal& operator++() {
+		if (isnan() || (isinf() && !sign())) return *this;
+		if (sign()) {
+			if (iszero()) {
+				_bits.clear();
+				_bits.set(0);   // (0, minpos)
+			}
+			else {
+				--_bits;        // the magnitude is not zero: the sign bit is unaffected
+			}
+		}
+		else {
+			++_bits;
+		}
 		return *this;
 	}
 	areal operator++(int) {
@@ -138,7 +193,22 @@ public:
 		operator++();
 		return tmp;
 	}
+	// move to the next encoding toward -infinity
 	areal& operator--() {
+		if (isnan() || (isinf() && sign())) return *this;
+		if (sign()) {
+			++_bits;
+		}
+		else {
+			if (iszero()) {
+				_bits.clear();
+				_bits.set(nbits - 1);
+				_bits.set(0);   // (-minpos, 0)
+			}
+			else {
+				--_bits;
+			}
+		}
 		return *this;
 	}
 	areal operator--(int) {
@@ -148,33 +218,164 @@ public:
 	}
 
 	// modifiers
-	void reset() {	}
+	void reset() { _bits.clear(); }
+	void setzero() { _bits.clear(); }
+	void setinf(bool sign = false) {
+		_bits.clear();
+		blockbinary<nbits, bt> exponent;
+		exponent.set_raw_bits(MAX_EXP_FIELD);
+		exponent <<= int(fbits + 1);
+		_bits = exponent;
+		if (sign) _bits.set(nbits - 1);
+	}
+	void setnan() {
+		setinf(false);
+		_bits.set(0);
+	}
+	void setubit(bool v = true) { _bits.set(0, v); }
+	areal& setbits(const blockbinary<nbits, bt>& raw) {
+		_bits = raw;
+		return *this;
+	}
+	areal& set_raw_bits(uint64_t raw) {
+		_bits.set_raw_bits(raw);
+		return *this;
+	}
 
 	// selectors
-	inline bool isneg() const { return false; }
-	inline bool iszero() const { return false; }
-	inline bool isinf() const { return false; }
-	inline bool isnan() const { return false; }
-	inline bool sign() const { return false; }
-	inline int scale() const { return false; }
-	inline std::string get() const { return std::string("tbd"); }
-
+	inline bool isneg() const { return sign(); }
+	inline bool iszero() const { return magnitude().iszero(); }
+	inline bool isinf() const { return exponent_field() == MAX_EXP_FIELD && fraction().iszero() && !ubit(); }
+	inline bool isnan() const { return exponent_field() == MAX_EXP_FIELD && (!fraction().iszero() || ubit()); }
+	inline bool sign() const { return _bits.test(nbits - 1); }
+	inline bool ubit() const { return _bits.test(0); }
+	inline int scale() const { return normalize().scale(); }
+	inline uint64_t exponent_field() const {
+		// the exponent field sits just below the sign bit
+		using Exponent = blockbinary<es, bt>;
+		Exponent exponent(_bits >> int(fbits + 1));
+		uint64_t e = 0;
+		for (size_t i = 0; i < Exponent::nrBlocks; ++i) e |= uint64_t(exponent.block(i)) << (i * Exponent::bitsInBlock);
+		return e;
+	}
+	inline blockbinary<fbits, bt> fraction() const { return blockbinary<fbits, bt>(_bits >> 1); }
+	inline const blockbinary<nbits, bt>& getbits() const { return _bits; }
+	inline std::string get() const { return to_binary(_bits); }
 
 	long double to_long_double() const {
-		return 0.0l;
+		return normalize().to_long_double();
 	}
 	double to_double() const {
-		return 0.0;
+		return normalize().to_double();
 	}
 	float to_float() const {
-		return 0.0f;
+		return normalize().to_float();
 	}
 	// Maybe remove explicit
 	explicit operator long double() const { return to_long_double(); }
 	explicit operator double() const { return to_double(); }
 	explicit operator float() const { return to_float(); }
 
+	// the (sign, scale, fraction) triple of the value of the encoding, which is the lower bound of the magnitude of an uncertain encoding
+	blocktriple<es, fbits, bt> normalize() const {
+		blocktriple<es, fbits, bt> v;
+		if (isnan()) {
+			v.setnan();
+			return v;
+		}
+		if (isinf()) {
+			v.setinf(sign());
+			return v;
+		}
+		blockbinary<fbits, bt> f = fraction();
+		uint64_t e = exponent_field();
+		if (e == 0) {
+			if (f.iszero()) {
+				v.setzero(sign());
+				return v;
+			}
+			// subnormal: shift the most significant fraction bit into the hidden bit position
+			int shift = int(fbits) - f.msb();
+			f <<= shift;
+			v.set(sign(), MIN_EXP_NORMAL - shift, f, false, false, false);
+			return v;
+		}
+		v.set(sign(), int(e) - EXP_BIAS, f, false, false, false);
+		return v;
+	}
+
 private:
+	blockbinary<nbits, bt> _bits;
+
+	// the encoding without the sign bit
+	blockbinary<nbits, bt> magnitude() const {
+		blockbinary<nbits, bt> m(_bits);
+		m.reset(nbits - 1);
+		return m;
+	}
+
+	template<typename Real>
+	areal& convert_ieee754(Real rhs) {
+		constexpr int digits = std::numeric_limits<Real>::digits;
+		constexpr size_t srcbits = size_t(digits - 1 < 63 ? digits - 1 : 63);
+		round(blocktriple<es, srcbits, bt>(rhs), false);
+		return *this;
+	}
+
+	// truncate the triple toward zero, and mark the result as uncertain when bits were lost or the operands were uncertain
+	template<size_t ebits, size_t srcbits>
+	void round(const blocktriple<ebits, srcbits, bt>& v, bool uncertain) {
+		if (v.isnan()) {
+			setnan();
+			return;
+		}
+		bool s = v.sign();
+		if (v.isinf() && !uncertain) {
+			setinf(s);
+			return;
+		}
+		if (v.iszero()) {
+			_bits.clear();
+			if (s) _bits.set(nbits - 1);
+			if (uncertain) _bits.set(0);
+			return;
+		}
+		if (v.isinf() || v.scale() > MAX_EXP) {
+			// overflow: (maxpos, infinity)
+			maxpos(*this);
+			if (s) _bits.set(nbits - 1);
+			_bits.set(0);
+			return;
+		}
+		// work in the encoding without ubit: the hidden bit of a normal value is the lsb of the exponent field
+		constexpr size_t W = (srcbits + 2 > nbits + 1 ? srcbits + 2 : nbits + 1);
+		blockbinary<W, bt> encoding(v.significand());
+		int hpos = int(fbits);
+		int biased = v.scale() + EXP_BIAS;
+		if (biased < 1) {
+			// subnormal: the hidden bit moves into the fraction, and the exponent field is 0
+			hpos -= 1 - biased;
+			biased = 1;
+		}
+		int shift = hpos - int(srcbits);
+		bool inexact = false;
+		if (shift >= 0) {
+			encoding <<= shift;
+		}
+		else {
+			inexact = anyAfter(encoding, -shift - 1);
+			encoding >>= -shift;  // the significand is positive, so the arithmetic shift is a logical shift
+		}
+		// the hidden bit of a normal value adds 1 to the exponent field
+		blockbinary<W, bt> exponent;
+		exponent.set_raw_bits(uint64_t(biased - 1));
+		exponent <<= int(fbits);
+		encoding += exponent;
+		encoding <<= 1;
+		_bits = encoding;
+		if (s) _bits.set(nbits - 1);
+		if (inexact || uncertain) _bits.set(0);
+	}
 
 	// template parameters need names different from class template parameters (for gcc and clang)
 	template<size_t nnbits, size_t nes, typename nbt>
@@ -199,79 +400,111 @@ private:
 ////////////////////// operators
 template<size_t nnbits, size_t nes, typename nbt>
 inline std::ostream& operator<<(std::ostream& ostr, const areal<nnbits,nes,nbt>& v) {
-
-	return ostr;
+	return ostr << v.to_long_double();
 }
 
 template<size_t nnbits, size_t nes, typename nbt>
-inline std::istream& operator>>(std::istream& istr, const areal<nnbits,nes,nbt>& v) {
-	istr >> v._fraction;
+inline std::istream& operator>>(std::istream& istr, areal<nnbits,nes,nbt>& v) {
+	long double ld;
+	istr >> ld;
+	v = ld;
 	return istr;
 }
 
+// encodings are equal when their intervals are equal: NaN is unordered and the two exact zeros are equal
 template<size_t nnbits, size_t nes, typename nbt>
-inline bool operator==(const areal<nnbits,nes,nbt>& lhs, const areal<nnbits,nes,nbt>& rhs) { return false; }
+inline bool operator==(const areal<nnbits,nes,nbt>& lhs, const areal<nnbits,nes,nbt>& rhs) {
+	if (lhs.isnan() || rhs.isnan()) return false;
+	if (lhs.iszero() && rhs.iszero()) return true;
+	return lhs._bits == rhs._bits;
+}
 template<size_t nnbits, size_t nes, typename nbt>
 inline bool operator!=(const areal<nnbits,nes,nbt>& lhs, const areal<nnbits,nes,nbt>& rhs) { return !operator==(lhs, rhs); }
+// sign-magnitude order of the encodings: an uncertain encoding sits between its value and the next encoding
 template<size_t nnbits, size_t nes, typename nbt>
-inline bool operator< (const areal<nnbits,nes,nbt>& lhs, const areal<nnbits,nes,nbt>& rhs) { return false; }
+inline bool operator< (const areal<nnbits,nes,nbt>& lhs, const areal<nnbits,nes,nbt>& rhs) {
+	if (lhs.isnan() || rhs.isnan()) return false;
+	bool lhs_sign = lhs.sign(), rhs_sign = rhs.sign();
+	if (lhs_sign != rhs_sign) {
+		if (lhs.iszero() && rhs.iszero()) return false;
+		return lhs_sign;
+	}
+	// the magnitudes are positive 2's complement values
+	return lhs_sign ? (rhs.magnitude() < lhs.magnitude()) : (lhs.magnitude() < rhs.magnitude());
+}
 template<size_t nnbits, size_t nes, typename nbt>
 inline bool operator> (const areal<nnbits,nes,nbt>& lhs, const areal<nnbits,nes,nbt>& rhs) { return  operator< (rhs, lhs); }
 template<size_t nnbits, size_t nes, typename nbt>
-inline bool operator<=(const areal<nnbits,nes,nbt>& lhs, const areal<nnbits,nes,nbt>& rhs) { return !operator> (lhs, rhs); }
+inline bool operator<=(const areal<nnbits,nes,nbt>& lhs, const areal<nnbits,nes,nbt>& rhs) { return operator< (lhs, rhs) || operator==(lhs, rhs); }
 template<size_t nnbits, size_t nes, typename nbt>
-inline bool operator>=(const areal<nnbits,nes,nbt>& lhs, const areal<nnbits,nes,nbt>& rhs) { return !operator< (lhs, rhs); }
+inline bool operator>=(const areal<nnbits,nes,nbt>& lhs, const areal<nnbits,nes,nbt>& rhs) { return operator< (rhs, lhs) || operator==(lhs, rhs); }
 
 // posit - posit binary arithmetic operators
 // BINARY ADDITION
 template<size_t nbits, size_t es, typename bt>
 inline areal<nbits, es, bt> operator+(const areal<nbits, es, bt>& lhs, const areal<nbits, es, bt>& rhs) {
-	areal<nbits, es> sum(lhs);
+	areal<nbits, es, bt> sum(lhs);
 	sum += rhs;
 	return sum;
 }
 // BINARY SUBTRACTION
 template<size_t nbits, size_t es, typename bt>
 inline areal<nbits, es, bt> operator-(const areal<nbits, es, bt>& lhs, const areal<nbits, es, bt>& rhs) {
-	areal<nbits, es> diff(lhs);
+	areal<nbits, es, bt> diff(lhs);
 	diff -= rhs;
 	return diff;
 }
 // BINARY MULTIPLICATION
 template<size_t nbits, size_t es, typename bt>
 inline areal<nbits, es, bt> operator*(const areal<nbits, es, bt>& lhs, const areal<nbits, es, bt>& rhs) {
-	areal<nbits, es> mul(lhs);
+	areal<nbits, es, bt> mul(lhs);
 	mul *= rhs;
 	return mul;
 }
 // BINARY DIVISION
 template<size_t nbits, size_t es, typename bt>
 inline areal<nbits, es, bt> operator/(const areal<nbits, es, bt>& lhs, const areal<nbits, es, bt>& rhs) {
-	areal<nbits, es> ratio(lhs);
+	areal<nbits, es, bt> ratio(lhs);
 	ratio /= rhs;
 	return ratio;
 }
 
+// binary representation of the fields: sign.exponent.fraction.ubit
+template<size_t nbits, size_t es, typename bt>
+inline std::string to_binary(const areal<nbits, es, bt>& v) {
+	const blockbinary<nbits, bt>& raw = v.getbits();
+	std::stringstream s;
+	s << 'b' << (raw.test(nbits - 1) ? '1' : '0') << '.';
+	for (int i = int(nbits) - 2; i > int(areal<nbits, es, bt>::fbits); --i) s << (raw.test(size_t(i)) ? '1' : '0');
+	s << '.';
+	for (int i = int(areal<nbits, es, bt>::fbits); i > 0; --i) s << (raw.test(size_t(i)) ? '1' : '0');
+	s << '.' << (raw.test(0) ? '1' : '0');
+	return s.str();
+}
 
 template<size_t nbits, size_t es, typename bt>
 inline std::string components(const areal<nbits,es,bt>& v) {
 	std::stringstream s;
-	if (v.iszero()) {
-		s << " zero b" << std::setw(nbits) << v.fraction();
+	if (v.isnan()) {
+		s << "(nan)";
 		return s.str();
 	}
 	else if (v.isinf()) {
-		s << " infinite b" << std::setw(nbits) << v.fraction();
+		s << "(" << (v.sign() ? "-" : "+") << "inf)";
+		return s.str();
+	}
+	else if (v.iszero()) {
+		s << "(" << (v.sign() ? "-" : "+") << ",0," << to_binary(v.fraction()) << ')';
 		return s.str();
 	}
-	s << "(" << (v.sign() ? "-" : "+") << "," << v.scale() << "," << v.fraction() << ")";
+	s << "(" << (v.sign() ? "-" : "+") << "," << v.scale() << "," << to_binary(v.fraction()) << (v.ubit() ? ",u)" : ")");
 	return s.str();
 }
 
 /// Magnitude of a scientific notation value (equivalent to turning the sign bit off).
 template<size_t nbits, size_t es, typename bt>
-areal<nbits,es> abs(const areal<nbits,es,bt>& v) {
-	return areal<nbits,es>(false, v.scale(), v.fraction(), v.isZero());
+areal<nbits,es,bt> abs(const areal<nbits,es,bt>& v) {
+	return (v.sign() ? -v : v);
 }
 
 
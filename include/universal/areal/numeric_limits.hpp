@@ -14,25 +14,25 @@ public:
 	static constexpr bool is_specialized = true;
 	static constexpr AREAL min() { // return minimum value
 		AREAL aminpos;
-		return minpos<nbits,es,bt>(aminpos);
+		return sw::unum::minpos<nbits, es, bt>(aminpos);
 	} 
 	static constexpr AREAL max() { // return maximum value
 		AREAL amaxpos;
-		return maxpos<nbits, es, bt>(amaxpos);
+		return sw::unum::maxpos<nbits, es, bt>(amaxpos);
 	} 
 	static constexpr AREAL lowest() { // return most negative value
 		AREAL amaxneg;
-		return maxneg<nbits, es, bt>(amaxneg);
+		return sw::unum::maxneg<nbits, es, bt>(amaxneg);
 	} 
 	static constexpr AREAL epsilon() { // return smallest effective increment from 1.0
-		AREAL one{ 1.0f }, incr{ 1.0f };
-		return ++incr - one;
+		return AREAL(std::ldexp(1.0l, -int(AREAL::fbits)));
 	}
 	static constexpr AREAL round_error() { // return largest rounding error
-		return AREAL(0.5f);
+		return AREAL(1.0f);  // truncation toward zero
 	}
 	static constexpr AREAL denorm_min() {  // return minimum denormalized value
-		return AREAL(1.0f); 
+		AREAL aminpos;
+		return sw::unum::minpos<nbits, es, bt>(aminpos);
 	}
 	static constexpr AREAL infinity() { // return positive infinity
 		return AREAL(INFINITY); 
@@ -44,7 +44,7 @@ public:
 		return AREAL(NAN);
 	}
 
-	static constexpr int digits       = nbits - 1 - es + 1;
+	static constexpr int digits       = int(AREAL::fhbits);
 	static constexpr int digits10     = int(digits / 3.3);
 	static constexpr int max_digits10 = digits10;
 	static constexpr bool is_signed   = true;
@@ -52,18 +52,18 @@ public:
 	static constexpr bool is_exact    = false;
 	static constexpr int radix        = 2;
 
-	static constexpr int min_exponent   = -int(1 << (es - 1));
+	static constexpr int min_exponent   = AREAL::MIN_EXP_NORMAL + 1;
 	static constexpr int min_exponent10 = int(min_exponent / 3.3);
-	static constexpr int max_exponent   = int(1 << (es - 1));
+	static constexpr int max_exponent   = AREAL::MAX_EXP + 1;
 	static constexpr int max_exponent10 = int(max_exponent / 3.3);
 	static constexpr bool has_infinity  = true;
 	static constexpr bool has_quiet_NaN = true;
 	static constexpr bool has_signaling_NaN = true;
-	static constexpr float_denorm_style has_denorm = denorm_absent;
+	static constexpr float_denorm_style has_denorm = denorm_present;
 	static constexpr bool has_denorm_loss = false;
 
 	static constexpr bool is_iec559 = false;
-	static constexpr bool is_bounded = false;
+	static constexpr bool is_bounded = true;
 	static constexpr bool is_modulo = false;
 	static constexpr bool traps = false;
 	static constexpr bool tinyness_before = false;
@@ -190,6 +190,29 @@ Scalar norm2(const sw::unum::blas::vector<Scalar>& v) {
 	return sqrt(twoNorm);
 }
 
+// 1-norm of a vector expression, evaluated without materializing the vector
+template<typename E>
+typename E::value_type norm1(const sw::unum::blas::vector_expression<E>& v) {
+	const E& expr = v.self();
+	typename E::value_type oneNorm = 0;
+	for (size_t i = 0; i < expr.size(); ++i) {
+		oneNorm += abs(expr[i]);
+	}
+	return oneNorm;
+}
+
+// 2-norm of a vector expression, evaluated without materializing the vector
+template<typename E>
+typename E::value_type norm2(const sw::unum::blas::vector_expression<E>& v) {
+	const E& expr = v.self();
+	typename E::value_type twoNorm = 0;
+	for (size_t i = 0; i < expr.size(); ++i) {
+		typename E::value_type e = expr[i];
+		twoNorm += e * e;
+	}
+	return sqrt(twoNorm);
+}
+
 // specializations for STL vectors
 
 template<typename Ty>
@@ -7,6 +7,7 @@
 #include <iostream>
 #include <universal/blas/vector.hpp>
 #include <universal/blas/matrix.hpp>
+#include <universal/blas/fused_gemv.hpp>
 
 // compilation flags
 // BLAS_TRACE_ROUNDING_EVENTS
@@ -35,18 +36,18 @@ void matvec(sw::unum::blas::vector< sw::unum::posit<nbits, es> >& b, const sw::u
 	assert(A.cols() == size(x));
 	assert(size(b) == size(x));
 
-#if BLAS_TRACE_ROUNDING_EVENTS
+#if !BLAS_TRACE_ROUNDING_EVENTS
+	sw::unum::blas::fused_gemv<nbits, es, 30>(A, x, b);  // blocked, row-partitioned over threads, same capacity as quire<nbits, es>
+#else
 	unsigned errors = 0;
-#endif
 	size_t nr = size(b);
 	size_t nc = size(x);
 	for (size_t i = 0; i < nr; ++i) {
 		sw::unum::quire<nbits, es> q(0);
 		for (size_t j = 0; j < nc; ++j) {
-			q += sw::unum::quire_mul(A(i,j), x[j]);
+			q.fma(A(i,j), x[j]);
 		}
 		sw::unum::convert(q.to_value(), b[i]);     // one and only rounding step of the fused-dot product
-#if BLAS_TRACE_ROUNDING_EVENTS
 		sw::unum::quire<nbits, es> qdiff = q;
 		sw::unum::quire<nbits, es> qsum = b[i];
 		qdiff -= qsum;
@@ -59,9 +60,7 @@ void matvec(sw::unum::blas::vector< sw::unum::posit<nbits, es> >& b, const sw::u
 			convert(qdiff.to_value(), roundingError);
 			std::cout << "matvec b[" << i << "] = " << hex_format(b[i]) << " rounding error: " << hex_format(roundingError) << " " << roundingError << std::endl;
 		}
-#endif
 	}
-#if BLAS_TRACE_ROUNDING_EVENTS
 	if (errors) {
 		std::cout << "HPR-BLAS: tracing found " << errors << " rounding errors in matvec operation\n";
 	}
@@ -74,20 +73,20 @@ template<size_t nbits, size_t es>
 sw::unum::blas::vector< sw::unum::posit<nbits, es> > fmv(const sw::unum::blas::matrix< sw::unum::posit<nbits, es> >& A, const sw::unum::blas::vector< sw::unum::posit<nbits, es> >& x) {
 	// preconditions
 	assert(A.cols() == size(x));
-	sw::unum::blas::vector< sw::unum::posit<nbits, es> > b(size(x));
+	sw::unum::blas::vector< sw::unum::posit<nbits, es> > b(A.rows());
 
-#if BLAS_TRACE_ROUNDING_EVENTS
+#if !BLAS_TRACE_ROUNDING_EVENTS
+	sw::unum::blas::fused_gemv<nbits, es, 30>(A, x, b);  // blocked, row-partitioned over threads, same capacity as quire<nbits, es>
+#else
 	unsigned errors = 0;
-#endif
 	size_t nr = size(b);
 	size_t nc = size(x);
 	for (size_t i = 0; i < nr; ++i) {
 		sw::unum::quire<nbits, es> q(0);
 		for (size_t j = 0; j < nc; ++j) {
-			q += sw::unum::quire_mul(A(i,j), x[j]);
+			q.fma(A(i,j), x[j]);
 		}
 		sw::unum::convert(q.to_value(), b[i]);     // one and only rounding step of the fused-dot product
-#if BLAS_TRACE_ROUNDING_EVENTS
 		sw::unum::quire<nbits, es> qdiff = q;
 		sw::unum::quire<nbits, es> qsum = b[i];
 		qdiff -= qsum;
@@ -100,9 +99,7 @@ sw::unum::blas::vector< sw::unum::posit<nbits, es> > fmv(const sw::unum::blas::m
 			convert(qdiff.to_value(), roundingError);
 			std::cout << "matvec b[" << i << "] = " << hex_format(b[i]) << " rounding error: " << hex_format(roundingError) << " " << roundingError << std::endl;
 		}
-#endif
 	}
-#if BLAS_TRACE_ROUNDING_EVENTS
 	if (errors) {
 		std::cout << "Universal-BLAS: tracing found " << errors << " rounding errors in matvec operation\n";
 	}
@@ -0,0 +1,111 @@
+#pragma once
+// fused_gemm.hpp: cache-blocked, multithreaded fused matrix-matrix product for posits
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+#include <universal/blas/exceptions.hpp>
+
+namespace sw { namespace unum { namespace blas {
+
+template<typename Scalar> class matrix;
+
+// tile dimensions of the fused GEMM engine
+constexpr size_t FUSED_GEMM_TILE_M = 32;    // rows of C in a tile
+constexpr size_t FUSED_GEMM_TILE_N = 32;    // columns of C in a tile
+constexpr size_t FUSED_GEMM_TILE_K = 256;   // depth of a packed panel of A and B
+// products with fewer multiply-accumulates than this threshold run on the calling thread
+constexpr size_t FUSED_GEMM_PARALLEL_THRESHOLD = 64 * 64 * 64;
+
+// C = A * B with a fused dot product for each element of C
+//
+// The output is partitioned in tiles that the threads pick up from a shared counter, nrThreads = 0 selects
+// the hardware concurrency. A tile keeps one quire per element of C across all the k-panels, and the panels
+// of A and B are packed into contiguous buffers so that each dot product streams through memory with unit stride.
+// Every quire accumulates its products in the same order as the serial product, so the result is
+// bit-identical independent of the tiling and the number of threads.
+template<size_t nbits, size_t es, size_t capacity = 20>
+void fused_gemm(const matrix< posit<nbits, es> >& A, const matrix< posit<nbits, es> >& B, matrix< posit<nbits, es> >& C, unsigned nrThreads = 0) {
+	using Scalar = posit<nbits, es>;
+	using Quire  = quire<nbits, es, capacity>;
+	constexpr size_t TM = FUSED_GEMM_TILE_M;
+	constexpr size_t TN = FUSED_GEMM_TILE_N;
+	constexpr size_t TK = FUSED_GEMM_TILE_K;
+
+	if (A.cols() != B.rows()) throw matmul_incompatible_matrices(incompatible_matrices(A.rows(), A.cols(), B.rows(), B.cols(), "*").what());
+	size_t M = A.rows();
+	size_t N = B.cols();
+	size_t K = A.cols();
+	if (C.rows() != M || C.cols() != N) C.resize(M, N);
+	size_t tileRows = (M + TM - 1) / TM;
+	size_t tileCols = (N + TN - 1) / TN;
+	size_t nrTiles = tileRows * tileCols;
+	if (nrTiles == 0) return;
+
+	if (nrThreads == 0) nrThreads = std::thread::hardware_concurrency();
+	if (nrThreads == 0 || M * N * K < FUSED_GEMM_PARALLEL_THRESHOLD) nrThreads = 1;
+	if (nrThreads > nrTiles) nrThreads = unsigned(nrTiles);
+
+	std::atomic<size_t> nextTile(0);
+	std::vector<std::exception_ptr> errors(nrThreads);
+	auto worker = [&](unsigned t) {
+		try {
+			std::vector<Scalar> Ap(TM * TK), Bp(TN * TK);
+			std::vector<Quire> q(TM * TN);
+			for (size_t tile = nextTile++; tile < nrTiles; tile = nextTile++) {
+				size_t i0 = (tile / tileCols) * TM;
+				size_t j0 = (tile % tileCols) * TN;
+				size_t mc = std::min(TM, M - i0);
+				size_t nc = std::min(TN, N - j0);
+				for (auto& acc : q) acc.clear();
+				for (size_t k0 = 0; k0 < K; k0 += TK) {
+					size_t kc = std::min(TK, K - k0);
+					// pack the panel of A by rows and the panel of B by columns: both are contiguous in k
+					for (size_t i = 0; i < mc; ++i) {
+						for (size_t k = 0; k < kc; ++k) Ap[i * kc + k] = A(i0 + i, k0 + k);
+					}
+					for (size_t k = 0; k < kc; ++k) {
+						for (size_t j = 0; j < nc; ++j) Bp[j * kc + k] = B(k0 + k, j0 + j);
+					}
+					for (size_t i = 0; i < mc; ++i) {
+						const Scalar* a = &Ap[i * kc];
+						for (size_t j = 0; j < nc; ++j) {
+							const Scalar* b = &Bp[j * kc];
+							Quire& acc = q[i * nc + j];
+							for (size_t k = 0; k < kc; ++k) acc.fma(a[k], b[k]);
+						}
+					}
+				}
+				for (size_t i = 0; i < mc; ++i) {
+					for (size_t j = 0; j < nc; ++j) {
+						convert(q[i * nc + j].to_value(), C(i0 + i, j0 + j)); // one and only rounding step of the fused-dot product
+					}
+				}
+			}
+		}
+		catch (...) {
+			errors[t] = std::current_exception();
+		}
+	};
+
+	if (nrThreads == 1) {
+		worker(0);
+	}
+	else {
+		std::vector<std::thread> pool;
+		pool.reserve(nrThreads - 1);
+		for (unsigned t = 1; t < nrThreads; ++t) pool.emplace_back(worker, t);
+		worker(0);
+		for (auto& thread : pool) thread.join();
+	}
+	for (auto& error : errors) {
+		if (error) std::rethrow_exception(error);
+	}
+}
+
+}}} // namespace sw::unum::blas
@@ -0,0 +1,89 @@
+#pragma once
+// fused_gemv.hpp: blocked, row-partitioned parallel fused matrix-vector product for posits
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <vector>
+#include <thread>
+#include <exception>
+#include <algorithm>
+#include <universal/blas/exceptions.hpp>
+
+namespace sw { namespace unum { namespace blas {
+
+template<typename Scalar> class matrix;
+template<typename Scalar> class vector;
+
+// block dimensions of the fused GEMV engine
+constexpr size_t FUSED_GEMV_BLOCK_ROWS = 8;     // rows that share a loaded segment of x
+constexpr size_t FUSED_GEMV_BLOCK_COLS = 512;   // length of the segment of x
+// products with fewer multiply-accumulates than this threshold run on the calling thread
+constexpr size_t FUSED_GEMV_PARALLEL_THRESHOLD = 256 * 256;
+
+// b = A * x with a fused dot product for each row of A
+//
+// The rows are partitioned in contiguous ranges, one per thread, nrThreads = 0 selects the hardware concurrency.
+// Within a range, blocks of FUSED_GEMV_BLOCK_ROWS rows walk x in segments, so that each segment of x is reused
+// by all the rows of the block while it is hot in the cache. Each row accumulates its products in column order
+// in its own quire and is rounded once, so the result is identical to the serial fused matrix-vector product.
+template<size_t nbits, size_t es, size_t capacity = 20>
+void fused_gemv(const matrix< posit<nbits, es> >& A, const vector< posit<nbits, es> >& x, vector< posit<nbits, es> >& b, unsigned nrThreads = 0) {
+	using Quire = quire<nbits, es, capacity>;
+	constexpr size_t BR = FUSED_GEMV_BLOCK_ROWS;
+	constexpr size_t BC = FUSED_GEMV_BLOCK_COLS;
+
+	if (A.cols() != x.size()) throw matmul_incompatible_matrices(incompatible_matrices(A.rows(), A.cols(), x.size(), 1, "*").what());
+	size_t M = A.rows();
+	size_t N = A.cols();
+	if (b.size() != M) b.resize(M);
+	if (M == 0) return;
+
+	if (nrThreads == 0) nrThreads = std::thread::hardware_concurrency();
+	if (nrThreads == 0 || M * N < FUSED_GEMV_PARALLEL_THRESHOLD) nrThreads = 1;
+	if (nrThreads > M) nrThreads = unsigned(M);
+
+	std::vector<std::exception_ptr> errors(nrThreads);
+	auto worker = [&](unsigned t) {
+		try {
+			size_t first = (M * t) / nrThreads;
+			size_t last  = (M * (t + 1)) / nrThreads;
+			Quire q[BR];
+			for (size_t i0 = first; i0 < last; i0 += BR) {
+				size_t rows = std::min(BR, last - i0);
+				for (size_t r = 0; r < rows; ++r) q[r].clear();
+				for (size_t j0 = 0; j0 < N; j0 += BC) {
+					size_t cols = std::min(BC, N - j0);
+					auto xj = x.begin() + int64_t(j0);
+					for (size_t r = 0; r < rows; ++r) {
+						auto aij = A.begin() + int64_t((i0 + r) * N + j0);
+						Quire& acc = q[r];
+						for (size_t j = 0; j < cols; ++j) acc.fma(aij[j], xj[j]);
+					}
+				}
+				for (size_t r = 0; r < rows; ++r) {
+					convert(q[r].to_value(), b[i0 + r]); // one and only rounding step of the fused-dot product
+				}
+			}
+		}
+		catch (...) {
+			errors[t] = std::current_exception();
+		}
+	};
+
+	if (nrThreads == 1) {
+		worker(0);
+	}
+	else {
+		std::vector<std::thread> pool;
+		pool.reserve(nrThreads - 1);
+		for (unsigned t = 1; t < nrThreads; ++t) pool.emplace_back(worker, t);
+		worker(0);
+		for (auto& thread : pool) thread.join();
+	}
+	for (auto& error : errors) {
+		if (error) std::rethrow_exception(error);
+	}
+}
+
+}}} // namespace sw::unum::blas
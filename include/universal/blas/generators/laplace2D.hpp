@@ -27,4 +27,23 @@ void laplace2D(matrix<Scalar>& A, size_t m, size_t n) {
 	}
 }
 
+// generate a 2D square domain Laplacian difference equation matrix in compressed sparse row format
+template<typename Scalar>
+void laplace2D(sparse_matrix<Scalar>& A, size_t m, size_t n) {
+	A.resize(m*n, m*n);
+	A.reserve(5 * m * n);
+	Scalar four(4.0), minus_one(-1.0);
+	for (size_t i = 0; i < m; ++i) {
+		for (size_t j = 0; j < n; ++j) {
+			size_t row = i * n + j;
+			if (i > 0) A.push_back(row - n, minus_one);
+			if (j > 0) A.push_back(row - 1, minus_one);
+			A.push_back(row, four);
+			if (j < n - 1) A.push_back(row + 1, minus_one);
+			if (i < m - 1) A.push_back(row + n, minus_one);
+			A.finalize_row();
+		}
+	}
+}
+
 }}} // namespace sw::unum::blas
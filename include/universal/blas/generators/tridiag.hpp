@@ -38,4 +38,17 @@ void tridiag(matrix<Scalar>& A, size_t N, Scalar subdiag = Scalar(-1.0), Scalar
 	}
 }
 
+// generate a finite difference equation matrix for 1D problems in compressed sparse row format
+template<typename Scalar>
+void tridiag(sparse_matrix<Scalar>& A, size_t N, Scalar subdiag = Scalar(-1.0), Scalar diagonal = Scalar(2.0), Scalar superdiag = Scalar(-1.0)) {
+	A.resize(N, N);
+	A.reserve(3 * N);
+	for (size_t i = 0; i < N; ++i) {
+		if (i > 0) A.push_back(i - 1, subdiag);
+		A.push_back(i, diagonal);
+		if (i + 1 < N) A.push_back(i + 1, superdiag);
+		A.finalize_row();
+	}
+}
+
 }}} // namespace sw::unum::blas
@@ -10,6 +10,8 @@
 #include <map>
 #include <universal/blas/exceptions.hpp>
 #include <universal/posit/posit_fwd.hpp>
+#include <universal/blas/fused_gemm.hpp>
+#include <universal/blas/fused_gemv.hpp>
 
 namespace sw { namespace unum { namespace blas { 
 
@@ -140,6 +142,9 @@ public:
 	inline size_t rows() const { return _m; }
 	inline size_t cols() const { return _n; }
 	inline std::pair<size_t, size_t> size() const { return std::make_pair(_m, _n); }
+	// iterators over the row-major storage
+	typename std::vector<Scalar>::const_iterator begin() const noexcept { return data.begin(); }
+	typename std::vector<Scalar>::const_iterator end() const noexcept { return data.end(); }
 
 	// in-place transpose
 	matrix& transpose() {
@@ -267,13 +272,7 @@ template<size_t nbits, size_t es>
 vector< posit<nbits, es> > operator*(const matrix< posit<nbits, es> >& A, const vector< posit<nbits, es> >& x) {
 	constexpr size_t capacity = 20; // FDP for vectors < 1,048,576 elements
 	vector< posit<nbits, es> > b(A.rows());
-	for (size_t i = 0; i < A.rows(); ++i) {
-		quire<nbits, es, capacity> q;
-		for (size_t j = 0; j < A.cols(); ++j) {
-			q += quire_mul(A(i, j), x[j]);
-		}
-		convert(q.to_value(), b[i]); // one and only rounding step of the fused-dot product
-	}
+	fused_gemv<nbits, es, capacity>(A, x, b);
 	return b;
 }
 
@@ -300,20 +299,8 @@ matrix<Scalar> operator*(const matrix<Scalar>& A, const matrix<Scalar>& B) {
 template<size_t nbits, size_t es>
 matrix< posit<nbits, es> > operator*(const matrix< posit<nbits, es> >& A, const matrix< posit<nbits, es> >& B) {
 	constexpr size_t capacity = 20; // FDP for vectors < 1,048,576 elements
-	if (A.cols() != B.rows()) throw matmul_incompatible_matrices(incompatible_matrices(A.rows(), A.cols(), B.rows(), B.cols(), "*").what());
-	size_t rows = A.rows();
-	size_t cols = B.cols();
-	size_t dots = A.cols();
-	matrix< posit<nbits, es> > C(rows, cols);
-	for (size_t i = 0; i < rows; ++i) {
-		for (size_t j = 0; j < cols; ++j) {
-			quire<nbits, es, capacity> q;
-			for (size_t k = 0; k < dots; ++k) {
-				q += quire_mul(A(i, k), B(k, j));
-			}
-			convert(q.to_value(), C(i, j)); // one and only rounding step of the fused-dot product
-		}
-	}
+	matrix< posit<nbits, es> > C(A.rows(), B.cols());
+	fused_gemm<nbits, es, capacity>(A, B, C);
 	return C;
 }
 
@@ -31,6 +31,7 @@ size_t cg_dot_fdp(const Matrix& M, const Matrix& A, const Vector& b, Vector& x,
 	Vector zeta(size(b));
 	Vector p(size(b));
 	Vector q(size(b));
+	Vector x_1(size(b));
 	Scalar sigma_1{ 0 }, sigma_2{ 0 }, alpha{ 0 }, beta{ 0 };
 	rho = b;  // term is b - A * x, but if we use x(0) = 0 vector, rho = b is equivalent
 	size_t itr = 0;
@@ -49,7 +50,7 @@ size_t cg_dot_fdp(const Matrix& M, const Matrix& A, const Vector& b, Vector& x,
 		}
 		matvec(q, A, p);  // regular matrix-vector without quire
 		alpha = sigma_1 / sw::unum::fdp(p, q);
-		Vector x_1(x);
+		x_1 = x;  // copy into preallocated storage
 		x = x + alpha * p;
 		rho = rho - alpha * q;
 		// check for convergence of the system
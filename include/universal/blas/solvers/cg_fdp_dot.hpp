@@ -31,6 +31,7 @@ size_t cg_fdp_dot(const Matrix& M, const Matrix& A, const Vector& b, Vector& x,
 	Vector zeta(size(b));
 	Vector p(size(b));
 	Vector q(size(b));
+	Vector x_1(size(b));
 	Scalar sigma_1{ 0 }, sigma_2{ 0 }, alpha{ 0 }, beta{ 0 };
 	rho = b;  // term is b - A * x, but if we use x(0) = 0 vector, rho = b is equivalent
 	size_t itr = 0;
@@ -49,7 +50,7 @@ size_t cg_fdp_dot(const Matrix& M, const Matrix& A, const Vector& b, Vector& x,
 		}
 		q = A * p;  // adaptive matvec: native types use a direct FMA matvec, with posits use a FDP matvec, 
 		alpha = sigma_1 / dot(p, q);
-		Vector x_1(x);
+		x_1 = x;  // copy into preallocated storage
 		x = x + alpha * p;
 		rho = rho - alpha * q;
 		// check for convergence of the system
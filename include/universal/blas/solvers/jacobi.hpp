@@ -6,6 +6,7 @@
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <universal/posit/posit_fwd.hpp>
 #include <universal/blas/matrix.hpp>
+#include <universal/blas/sparse_matrix.hpp>
 
 namespace sw { namespace unum { namespace blas {
 
@@ -34,4 +35,31 @@ size_t Jacobi(const Matrix& A, const Vector& b, Vector& x, typename Matrix::valu
 	return itr;
 }
 
+// Jacobi for sparse matrices: the inner products only visit the nonzeros of each row
+template<typename Scalar, size_t MAX_ITERATIONS = 100>
+size_t Jacobi(const sparse_matrix<Scalar>& A, const vector<Scalar>& b, vector<Scalar>& x, Scalar tolerance = Scalar(0.00001)) {
+	Scalar residual = Scalar(std::numeric_limits<Scalar>::max());
+	size_t m = num_rows(A);
+	const std::vector<size_t>& rowptr = A.rowptr();
+	const std::vector<size_t>& colidx = A.colidx();
+	const std::vector<Scalar>& values = A.values();
+	size_t itr = 0;
+	while (residual > tolerance && itr < MAX_ITERATIONS) {
+		vector<Scalar> x_old = x;
+		for (size_t i = 0; i < m; ++i) {
+			Scalar sigma = 0, diagonal = 0;
+			for (size_t k = rowptr[i]; k < rowptr[i + 1]; ++k) {
+				size_t j = colidx[k];
+				if (i != j) sigma += values[k] * x(j); else diagonal = values[k];
+			}
+			x(i) = (b(i) - sigma) / diagonal;
+		}
+		residual = norm1(x_old - x);
+		std::cout << '[' << itr << "] " << std::setw(10) << x << "         residual " << residual << std::endl;
+		++itr;
+	}
+
+	return itr;
+}
+
 }}} // namespace sw::unum::blas
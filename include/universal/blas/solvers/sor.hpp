@@ -6,6 +6,7 @@
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <universal/posit/posit_fwd.hpp>
 #include <universal/blas/matrix.hpp>
+#include <universal/blas/sparse_matrix.hpp>
 
 namespace sw { namespace unum { namespace blas {
 
@@ -39,4 +40,34 @@ size_t sor(const Matrix& A, const Vector& b, Vector& x, typename Matrix::value_t
 	return itr;
 }
 
+// sor for sparse matrices: the inner products only visit the nonzeros of each row
+template<typename Scalar, size_t MAX_ITERATIONS = 100>
+size_t sor(const sparse_matrix<Scalar>& A, const vector<Scalar>& b, vector<Scalar>& x, Scalar w, Scalar tolerance = Scalar(0.00001)) {
+	Scalar residual = Scalar(std::numeric_limits<Scalar>::max());
+	size_t m = num_rows(A);
+	const std::vector<size_t>& rowptr = A.rowptr();
+	const std::vector<size_t>& colidx = A.colidx();
+	const std::vector<Scalar>& values = A.values();
+	size_t itr = 0;
+	while (residual > tolerance && itr < MAX_ITERATIONS) {
+		vector<Scalar> x_old = x;
+		// Gauss-Seidel step
+		for (size_t i = 0; i < m; ++i) {
+			Scalar sigma = 0, diagonal = 0;
+			for (size_t k = rowptr[i]; k < rowptr[i + 1]; ++k) {
+				size_t j = colidx[k];
+				if (j < i) sigma += values[k] * x(j);
+				else if (j > i) sigma += values[k] * x_old(j);
+				else diagonal = values[k];
+			}
+			x(i) = (1 - w) * x_old(i) + w * (b(i) - sigma) / diagonal;
+		}
+		residual = norm1(x_old - x);
+		++itr;
+	}
+	std::cout << "over-relaxation factor w is " << w << '\n';
+	std::cout << "final residual is " << residual << '\n';
+	return itr;
+}
+
 }}} // namespace sw::unum::blas
@@ -0,0 +1,176 @@
+#pragma once
+// sparse_matrix.hpp: super-simple sparse matrix class in compressed sparse row (CSR) format
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <universal/blas/exceptions.hpp>
+#include <universal/posit/posit_fwd.hpp>
+#include <universal/blas/vector.hpp>
+#include <universal/blas/matrix.hpp>
+
+namespace sw { namespace unum { namespace blas {
+
+// sparse matrix in compressed sparse row format
+// Rows are assembled in order: push_back(column, value) appends a nonzero to the current row,
+// and finalize_row() closes it. Columns within a row must be added in increasing order.
+template<typename Scalar>
+class sparse_matrix {
+public:
+	typedef Scalar									value_type;
+	typedef const value_type&						const_reference;
+	typedef value_type&								reference;
+	typedef typename std::vector<Scalar>::size_type size_type;
+
+	sparse_matrix() : _m{ 0 }, _n{ 0 }, _rowptr(1, 0) {}
+	sparse_matrix(size_t m, size_t n) : _m{ m }, _n{ n }, _rowptr(1, 0) {}
+	// compress a dense matrix, dropping the zero elements
+	explicit sparse_matrix(const matrix<Scalar>& A) : _m{ A.rows() }, _n{ A.cols() }, _rowptr(1, 0) {
+		for (size_t i = 0; i < _m; ++i) {
+			for (size_t j = 0; j < _n; ++j) {
+				Scalar a = A(i, j);
+				if (a != Scalar(0)) push_back(j, a);
+			}
+			finalize_row();
+		}
+	}
+
+	// element access: returns 0 for elements that are not stored
+	Scalar operator()(size_t i, size_t j) const {
+		auto first = _colidx.begin() + int64_t(_rowptr[i]);
+		auto last  = _colidx.begin() + int64_t(_rowptr[i + 1]);
+		auto it = std::lower_bound(first, last, j);
+		if (it != last && *it == j) return _values[size_t(it - _colidx.begin())];
+		return Scalar(0);
+	}
+
+	// modifiers
+	void clear() { _colidx.clear(); _values.clear(); _rowptr.assign(1, 0); }
+	void resize(size_t m, size_t n) { _m = m; _n = n; clear(); }
+	void reserve(size_t nnz) { _colidx.reserve(nnz); _values.reserve(nnz); _rowptr.reserve(_m + 1); }
+	// append a nonzero to the row that is being assembled
+	void push_back(size_t j, const Scalar& v) {
+		_colidx.push_back(j);
+		_values.push_back(v);
+	}
+	// close the row that is being assembled
+	void finalize_row() { _rowptr.push_back(_colidx.size()); }
+
+	// selectors
+	inline size_t rows() const { return _m; }
+	inline size_t cols() const { return _n; }
+	inline size_t nnz() const { return _values.size(); }
+	inline std::pair<size_t, size_t> size() const { return std::make_pair(_m, _n); }
+	// CSR arrays: row i occupies [rowptr[i], rowptr[i+1]) of colidx and values
+	inline const std::vector<size_t>& rowptr() const { return _rowptr; }
+	inline const std::vector<size_t>& colidx() const { return _colidx; }
+	inline const std::vector<Scalar>& values() const { return _values; }
+
+	// expand into a dense matrix
+	matrix<Scalar> dense() const {
+		matrix<Scalar> A(_m, _n);
+		for (size_t i = 0; i < _m; ++i) {
+			for (size_t k = _rowptr[i]; k < _rowptr[i + 1]; ++k) A(i, _colidx[k]) = _values[k];
+		}
+		return A;
+	}
+
+private:
+	size_t _m, _n; // m rows and n columns
+	std::vector<size_t> _rowptr;
+	std::vector<size_t> _colidx;
+	std::vector<Scalar> _values;
+};
+
+template<typename Scalar>
+inline size_t num_rows(const sparse_matrix<Scalar>& A) { return A.rows(); }
+template<typename Scalar>
+inline size_t num_cols(const sparse_matrix<Scalar>& A) { return A.cols(); }
+template<typename Scalar>
+inline std::pair<size_t, size_t> size(const sparse_matrix<Scalar>& A) { return A.size(); }
+
+// ostream operator: prints the nonzeros as (row, column) value triplets
+template<typename Scalar>
+std::ostream& operator<<(std::ostream& ostr, const sparse_matrix<Scalar>& A) {
+	auto width = ostr.width();
+	for (size_t i = 0; i < A.rows(); ++i) {
+		for (size_t k = A.rowptr()[i]; k < A.rowptr()[i + 1]; ++k) {
+			ostr << '(' << i << ", " << A.colidx()[k] << ") " << std::setw(width) << A.values()[k] << '\n';
+		}
+	}
+	return ostr;
+}
+
+// return the diagonal of the sparse matrix
+template<typename Scalar>
+vector<Scalar> diag(const sparse_matrix<Scalar>& A) {
+	size_t lowerbound = (A.rows() < A.cols()) ? A.rows() : A.cols();
+	vector<Scalar> v(lowerbound);
+	for (size_t i = 0; i < lowerbound; ++i) v[i] = A(i, i);
+	return v;
+}
+
+// sparse matrix-vector multiply: the nonzeros of a row are accumulated in column order
+template<typename Scalar>
+void spmv(vector<Scalar>& b, const sparse_matrix<Scalar>& A, const vector<Scalar>& x) {
+	if (A.cols() != size(x)) throw matmul_incompatible_matrices(incompatible_matrices(A.rows(), A.cols(), size(x), 1, "*").what());
+	if (size(b) != A.rows()) b.resize(A.rows());
+	const std::vector<size_t>& rowptr = A.rowptr();
+	const std::vector<size_t>& colidx = A.colidx();
+	const std::vector<Scalar>& values = A.values();
+	for (size_t i = 0; i < A.rows(); ++i) {
+		Scalar sum = Scalar(0);
+		for (size_t k = rowptr[i]; k < rowptr[i + 1]; ++k) {
+			sum += values[k] * x[colidx[k]];
+		}
+		b[i] = sum;
+	}
+}
+
+// fused sparse matrix-vector multiply for posits: one quire per row, and one rounding step per row
+template<size_t nbits, size_t es>
+void spmv(vector< posit<nbits, es> >& b, const sparse_matrix< posit<nbits, es> >& A, const vector< posit<nbits, es> >& x) {
+	constexpr size_t capacity = 20; // FDP for rows < 1,048,576 nonzeros
+	if (A.cols() != size(x)) throw matmul_incompatible_matrices(incompatible_matrices(A.rows(), A.cols(), size(x), 1, "*").what());
+	if (size(b) != A.rows()) b.resize(A.rows());
+	const std::vector<size_t>& rowptr = A.rowptr();
+	const std::vector<size_t>& colidx = A.colidx();
+	const std::vector< posit<nbits, es> >& values = A.values();
+	quire<nbits, es, capacity> q;
+	for (size_t i = 0; i < A.rows(); ++i) {
+		q.clear();
+		for (size_t k = rowptr[i]; k < rowptr[i + 1]; ++k) {
+			q.fma(values[k], x[colidx[k]]);
+		}
+		convert(q.to_value(), b[i]); // one and only rounding step of the fused-dot product
+	}
+}
+
+// sparse matrix-vector multiply
+template<typename Scalar>
+vector<Scalar> operator*(const sparse_matrix<Scalar>& A, const vector<Scalar>& x) {
+	vector<Scalar> b(A.rows());
+	spmv(b, A, x);
+	return b;
+}
+
+}}} // namespace sw::unum::blas
+
+// Matrix-vector product: b = A * x for sparse matrices, no quire for posit values
+template<typename Scalar>
+void matvec(sw::unum::blas::vector<Scalar>& b, const sw::unum::blas::sparse_matrix<Scalar>& A, const sw::unum::blas::vector<Scalar>& x) {
+	using size_type = typename sw::unum::blas::sparse_matrix<Scalar>::size_type;
+	const std::vector<size_t>& rowptr = A.rowptr();
+	const std::vector<size_t>& colidx = A.colidx();
+	const std::vector<Scalar>& values = A.values();
+	for (size_type i = 0; i < A.rows(); ++i) {
+		b[i] = Scalar(0);
+		for (size_t k = rowptr[i]; k < rowptr[i + 1]; ++k) {
+			b[i] += values[k] * x[colidx[k]];
+		}
+	}
+}
@@ -56,8 +56,77 @@
 
 namespace sw { namespace unum { namespace blas {
 
+// Expression templates
+// The arithmetic operators on vectors return lightweight expression objects that are evaluated
+// element by element when they are assigned to a vector. An update such as x = x + alpha * p
+// thus runs as a single pass over the data without allocating temporaries. Each element is
+// computed with the same sequence of rounded operations as the eager evaluation.
+template<typename E>
+class vector_expression {
+public:
+	const E& self() const { return static_cast<const E&>(*this); }
+	size_t size() const { return self().size(); }
+
+	// read-only iteration evaluates the elements on the fly
+	class const_iterator {
+	public:
+		const_iterator(const E* e, size_t i) : _e(e), _i(i) {}
+		auto operator*() const { return (*_e)[_i]; }
+		const_iterator& operator++() { ++_i; return *this; }
+		bool operator==(const const_iterator& rhs) const { return _i == rhs._i; }
+		bool operator!=(const const_iterator& rhs) const { return _i != rhs._i; }
+	private:
+		const E* _e;
+		size_t   _i;
+	};
+	const_iterator begin() const { return const_iterator(&self(), 0); }
+	const_iterator end() const { return const_iterator(&self(), self().size()); }
+};
+
+template<typename Scalar> class vector;
+
+// vectors are held by reference in an expression, sub-expressions are held by value
+template<typename E> struct vector_operand { using type = const E; };
+template<typename Scalar> struct vector_operand< vector<Scalar> > { using type = const vector<Scalar>&; };
+
+template<typename L, typename R>
+class vector_sum : public vector_expression< vector_sum<L, R> > {
+public:
+	using value_type = typename L::value_type;
+	vector_sum(const L& lhs, const R& rhs) : _lhs(lhs), _rhs(rhs) {}
+	size_t size() const { return _lhs.size(); }
+	value_type operator[](size_t i) const { return _lhs[i] + _rhs[i]; }
+private:
+	typename vector_operand<L>::type _lhs;
+	typename vector_operand<R>::type _rhs;
+};
+
+template<typename L, typename R>
+class vector_difference : public vector_expression< vector_difference<L, R> > {
+public:
+	using value_type = typename L::value_type;
+	vector_difference(const L& lhs, const R& rhs) : _lhs(lhs), _rhs(rhs) {}
+	size_t size() const { return _lhs.size(); }
+	value_type operator[](size_t i) const { return _lhs[i] - _rhs[i]; }
+private:
+	typename vector_operand<L>::type _lhs;
+	typename vector_operand<R>::type _rhs;
+};
+
+template<typename E>
+class vector_scaled : public vector_expression< vector_scaled<E> > {
+public:
+	using value_type = typename E::value_type;
+	vector_scaled(const value_type& alpha, const E& x) : _alpha(alpha), _x(x) {}
+	size_t size() const { return _x.size(); }
+	value_type operator[](size_t i) const { return _alpha * _x[i]; }
+private:
+	value_type                       _alpha;
+	typename vector_operand<E>::type _x;
+};
+
 template<typename Scalar>
-class vector {
+class vector : public vector_expression< vector<Scalar> > {
 public:
 	typedef Scalar                            value_type;
 	typedef const value_type&                 const_reference;
@@ -74,6 +143,11 @@ public:
 	vector(std::initializer_list<Scalar> iList) : data(iList) {}
 	vector(const vector& v) = default;
 	vector(vector&& v) = default;
+	template<typename E>
+	vector(const vector_expression<E>& e) : data(e.size()) {
+		const E& expr = e.self();
+		for (size_t i = 0; i < data.size(); ++i) data[i] = expr[i];
+	}
 
 	vector& operator=(const vector& v) = default;
 	vector& operator=(vector&& v) = default;
@@ -85,6 +159,16 @@ public:
 		return *this;
 	}
 
+	// evaluate an expression in a single pass: element i only depends on element i of the operands,
+	// so the vector may appear in the expression that is assigned to it
+	template<typename E>
+	vector& operator=(const vector_expression<E>& e) {
+		const E& expr = e.self();
+		if (data.size() != expr.size()) data.resize(expr.size());
+		for (size_t i = 0; i < data.size(); ++i) data[i] = expr[i];
+		return *this;
+	}
+
 // operators
 	vector& operator=(const Scalar& val) {
 		for (auto& v : data) v = val;
@@ -138,6 +222,24 @@ public:
 		}
 		return *this;
 	}
+	// element-wise add of an expression
+	template<typename E>
+	vector& operator+=(const vector_expression<E>& e) {
+		const E& expr = e.self();
+		for (size_t i = 0; i < size(); ++i) {
+			data[i] += expr[i];
+		}
+		return *this;
+	}
+	// element-wise subtract of an expression
+	template<typename E>
+	vector& operator-=(const vector_expression<E>& e) {
+		const E& expr = e.self();
+		for (size_t i = 0; i < size(); ++i) {
+			data[i] -= expr[i];
+		}
+		return *this;
+	}
 	// element-wise multiply
 	vector& operator*=(const vector<Scalar>& scaler) {
 		for (size_t i = 0; i < size(); ++i) {
@@ -244,49 +346,102 @@ inline std::string hex_format(const vector< sw::unum::posit<nbits, es> >& v) {
 	return ss.str();
 }
 
-template<typename Scalar>
-vector<Scalar> operator+(const vector<Scalar>& lhs, const vector<Scalar>& rhs) {
-	vector<Scalar> sum(lhs);
-	return sum += rhs;
+template<typename E>
+std::ostream& operator<<(std::ostream& ostr, const vector_expression<E>& e) {
+	auto width = ostr.width();
+	const E& expr = e.self();
+	for (size_t j = 0; j < expr.size(); ++j) ostr << std::setw(width) << expr[j] << " ";
+	return ostr;
 }
 
-template<typename Scalar>
-vector<Scalar> operator-(const vector<Scalar>& lhs, const vector<Scalar>& rhs) {
-	vector<Scalar> difference(lhs);
-	return difference -= rhs;
+// lazy element-wise sum
+template<typename L, typename R>
+vector_sum<L, R> operator+(const vector_expression<L>& lhs, const vector_expression<R>& rhs) {
+	return vector_sum<L, R>(lhs.self(), rhs.self());
+}
+
+// lazy element-wise difference
+template<typename L, typename R>
+vector_difference<L, R> operator-(const vector_expression<L>& lhs, const vector_expression<R>& rhs) {
+	return vector_difference<L, R>(lhs.self(), rhs.self());
 }
 
 // scale a vector through operator* overload
-template<typename Scalar>
-vector<Scalar> operator*(const Scalar& alpha, const vector<Scalar>& x) {
-	vector<Scalar> scaled(x);
-	return scaled *= alpha;
+template<typename E>
+vector_scaled<E> operator*(const typename E::value_type& alpha, const vector_expression<E>& x) {
+	return vector_scaled<E>(alpha, x.self());
 }
 
 // scale a vector through operator* overload
-template<typename Scalar>
-vector<Scalar> operator*(const vector<Scalar>& x, const Scalar& alpha) {
-	vector<Scalar> scaled(x);
-	return scaled *= alpha;
+template<typename E>
+vector_scaled<E> operator*(const vector_expression<E>& x, const typename E::value_type& alpha) {
+	return vector_scaled<E>(alpha, x.self());
 }
 
-// scale a vector through operator/ overload
+// An expression must not hold a reference to a temporary vector, as the expression can outlive it.
+// Operators with a temporary vector operand are evaluated eagerly in the storage of that temporary instead.
+template<typename Scalar, typename R>
+vector<Scalar> operator+(vector<Scalar>&& lhs, const vector_expression<R>& rhs) {
+	lhs += rhs.self();
+	return std::move(lhs);
+}
+template<typename L, typename Scalar>
+vector<Scalar> operator+(const vector_expression<L>& lhs, vector<Scalar>&& rhs) {
+	const L& expr = lhs.self();
+	for (size_t i = 0; i < rhs.size(); ++i) rhs[i] = expr[i] + rhs[i];
+	return std::move(rhs);
+}
+template<typename Scalar>
+vector<Scalar> operator+(vector<Scalar>&& lhs, vector<Scalar>&& rhs) {
+	lhs += rhs;
+	return std::move(lhs);
+}
+template<typename Scalar, typename R>
+vector<Scalar> operator-(vector<Scalar>&& lhs, const vector_expression<R>& rhs) {
+	lhs -= rhs.self();
+	return std::move(lhs);
+}
+template<typename L, typename Scalar>
+vector<Scalar> operator-(const vector_expression<L>& lhs, vector<Scalar>&& rhs) {
+	const L& expr = lhs.self();
+	for (size_t i = 0; i < rhs.size(); ++i) rhs[i] = expr[i] - rhs[i];
+	return std::move(rhs);
+}
+template<typename Scalar>
+vector<Scalar> operator-(vector<Scalar>&& lhs, vector<Scalar>&& rhs) {
+	lhs -= rhs;
+	return std::move(lhs);
+}
+// the scalar is not deduced, so that a scalar of another type converts instead of selecting the lazy overload
+template<typename Scalar>
+vector<Scalar> operator*(const typename vector<Scalar>::value_type& alpha, vector<Scalar>&& x) {
+	for (size_t i = 0; i < x.size(); ++i) x[i] = alpha * x[i];
+	return std::move(x);
+}
 template<typename Scalar>
-vector<Scalar> operator/(const vector<Scalar>& v, const Scalar& normalizer) {
-	vector<Scalar> normalized(v);
+vector<Scalar> operator*(vector<Scalar>&& x, const typename vector<Scalar>::value_type& alpha) {
+	for (size_t i = 0; i < x.size(); ++i) x[i] = alpha * x[i];
+	return std::move(x);
+}
+
+// scale a vector through operator/ overload, evaluated eagerly
+template<typename E>
+vector<typename E::value_type> operator/(const vector_expression<E>& v, const typename E::value_type& normalizer) {
+	vector<typename E::value_type> normalized(v.self());
 	return normalized /= normalizer;
 }
 
 // TODO: this next overload will create an ambiguous overload if Scalar is an int as it will be the same as the function above
 
-// scale a vector through operator/ overload
-template<typename Scalar>
-vector<Scalar> operator/(const vector<Scalar>& v, const int normalizer) {
-	vector<Scalar> normalized(v);
-	return normalized /= Scalar(normalizer);
+// scale a vector through operator/ overload, evaluated eagerly
+template<typename E>
+vector<typename E::value_type> operator/(const vector_expression<E>& v, const int normalizer) {
+	vector<typename E::value_type> normalized(v.self());
+	return normalized /= typename E::value_type(normalizer);
 }
 
 template<typename Scalar> auto size(const vector<Scalar>& v) { return v.size(); }
+template<typename E> auto size(const vector_expression<E>& e) { return e.size(); }
 
 // this design does not work well for universal as we would need to create
 // enable_if() configurations for all possible type combinations
@@ -337,7 +492,7 @@ typename std::enable_if<sw::unum::is_posit<Scalar>,Scalar>::type operator*(const
 	constexpr size_t capacity = 20;
 	sw::unum::quire<nbits, es, capacity> sum{ 0 };
 	for (size_t i = 0; i < N; ++i) {
-		sum += sw::unum::quire_mul(a(i), b(i));
+		sum.fma(a(i), b(i));
 	}
 	Scalar p;
 	convert(sum.to_value(), p);
@@ -0,0 +1,80 @@
+#pragma once
+// exponent.hpp: vectorized exponent functions
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cmath>
+#include <universal/blas/vector.hpp>
+
+namespace sw { namespace unum { namespace blas {
+
+// vector base-e exponential function
+template<typename Scalar>
+vector<Scalar> exp(const vector<Scalar>& x) {
+	using std::exp;
+	using namespace sw::unum;
+	vector<Scalar> v(x);
+	if constexpr (is_posit<Scalar>) {
+		if (v.size() > 0) elementary_batch<Scalar>::exp(&v[0], &v[0], v.size());
+	}
+	else {
+		for (size_t i = 0; i < v.size(); ++i) {
+			v[i] = exp(v[i]);
+		}
+	}
+	return v;
+}
+
+// vector base-2 exponential function
+template<typename Scalar>
+vector<Scalar> exp2(const vector<Scalar>& x) {
+	using std::exp2;
+	using namespace sw::unum;
+	vector<Scalar> v(x);
+	if constexpr (is_posit<Scalar>) {
+		if (v.size() > 0) elementary_batch<Scalar>::exp2(&v[0], &v[0], v.size());
+	}
+	else {
+		for (size_t i = 0; i < v.size(); ++i) {
+			v[i] = exp2(v[i]);
+		}
+	}
+	return v;
+}
+
+// vector base-10 exponential function
+template<typename Scalar>
+vector<Scalar> exp10(const vector<Scalar>& x) {
+	using std::pow;
+	using namespace sw::unum;
+	vector<Scalar> v(x);
+	if constexpr (is_posit<Scalar>) {
+		if (v.size() > 0) elementary_batch<Scalar>::exp10(&v[0], &v[0], v.size());
+	}
+	else {
+		for (size_t i = 0; i < v.size(); ++i) {
+			v[i] = pow(Scalar(10), v[i]);
+		}
+	}
+	return v;
+}
+
+// vector base-e exponential function exp(x)-1
+template<typename Scalar>
+vector<Scalar> expm1(const vector<Scalar>& x) {
+	using std::expm1;
+	using namespace sw::unum;
+	vector<Scalar> v(x);
+	if constexpr (is_posit<Scalar>) {
+		if (v.size() > 0) elementary_batch<Scalar>::expm1(&v[0], &v[0], v.size());
+	}
+	else {
+		for (size_t i = 0; i < v.size(); ++i) {
+			v[i] = expm1(v[i]);
+		}
+	}
+	return v;
+}
+
+} } }  // namespace sw::unum::blas
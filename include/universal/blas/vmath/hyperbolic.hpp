@@ -0,0 +1,63 @@
+#pragma once
+// hyperbolic.hpp: vectorized hyperbolic functions
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cmath>
+#include <universal/blas/vector.hpp>
+
+namespace sw { namespace unum { namespace blas {
+
+// vector hyperbolic sine function
+template<typename Scalar>
+vector<Scalar> sinh(const vector<Scalar>& x) {
+	using std::sinh;
+	using namespace sw::unum;
+	vector<Scalar> v(x);
+	if constexpr (is_posit<Scalar>) {
+		if (v.size() > 0) elementary_batch<Scalar>::sinh(&v[0], &v[0], v.size());
+	}
+	else {
+		for (size_t i = 0; i < v.size(); ++i) {
+			v[i] = sinh(v[i]);
+		}
+	}
+	return v;
+}
+
+// vector hyperbolic cosine function
+template<typename Scalar>
+vector<Scalar> cosh(const vector<Scalar>& x) {
+	using std::cosh;
+	using namespace sw::unum;
+	vector<Scalar> v(x);
+	if constexpr (is_posit<Scalar>) {
+		if (v.size() > 0) elementary_batch<Scalar>::cosh(&v[0], &v[0], v.size());
+	}
+	else {
+		for (size_t i = 0; i < v.size(); ++i) {
+			v[i] = cosh(v[i]);
+		}
+	}
+	return v;
+}
+
+// vector hyperbolic tangent function
+template<typename Scalar>
+vector<Scalar> tanh(const vector<Scalar>& x) {
+	using std::tanh;
+	using namespace sw::unum;
+	vector<Scalar> v(x);
+	if constexpr (is_posit<Scalar>) {
+		if (v.size() > 0) elementary_batch<Scalar>::tanh(&v[0], &v[0], v.size());
+	}
+	else {
+		for (size_t i = 0; i < v.size(); ++i) {
+			v[i] = tanh(v[i]);
+		}
+	}
+	return v;
+}
+
+} } }  // namespace sw::unum::blas
@@ -0,0 +1,80 @@
+#pragma once
+// logarithm.hpp: vectorized logarithm functions
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cmath>
+#include <universal/blas/vector.hpp>
+
+namespace sw { namespace unum { namespace blas {
+
+// vector natural logarithm function
+template<typename Scalar>
+vector<Scalar> log(const vector<Scalar>& x) {
+	using std::log;
+	using namespace sw::unum;
+	vector<Scalar> v(x);
+	if constexpr (is_posit<Scalar>) {
+		if (v.size() > 0) elementary_batch<Scalar>::log(&v[0], &v[0], v.size());
+	}
+	else {
+		for (size_t i = 0; i < v.size(); ++i) {
+			v[i] = log(v[i]);
+		}
+	}
+	return v;
+}
+
+// vector binary logarithm function
+template<typename Scalar>
+vector<Scalar> log2(const vector<Scalar>& x) {
+	using std::log2;
+	using namespace sw::unum;
+	vector<Scalar> v(x);
+	if constexpr (is_posit<Scalar>) {
+		if (v.size() > 0) elementary_batch<Scalar>::log2(&v[0], &v[0], v.size());
+	}
+	else {
+		for (size_t i = 0; i < v.size(); ++i) {
+			v[i] = log2(v[i]);
+		}
+	}
+	return v;
+}
+
+// vector decimal logarithm function
+template<typename Scalar>
+vector<Scalar> log10(const vector<Scalar>& x) {
+	using std::log10;
+	using namespace sw::unum;
+	vector<Scalar> v(x);
+	if constexpr (is_posit<Scalar>) {
+		if (v.size() > 0) elementary_batch<Scalar>::log10(&v[0], &v[0], v.size());
+	}
+	else {
+		for (size_t i = 0; i < v.size(); ++i) {
+			v[i] = log10(v[i]);
+		}
+	}
+	return v;
+}
+
+// vector natural logarithm of 1+x function
+template<typename Scalar>
+vector<Scalar> log1p(const vector<Scalar>& x) {
+	using std::log1p;
+	using namespace sw::unum;
+	vector<Scalar> v(x);
+	if constexpr (is_posit<Scalar>) {
+		if (v.size() > 0) elementary_batch<Scalar>::log1p(&v[0], &v[0], v.size());
+	}
+	else {
+		for (size_t i = 0; i < v.size(); ++i) {
+			v[i] = log1p(v[i]);
+		}
+	}
+	return v;
+}
+
+} } }  // namespace sw::unum::blas
@@ -14,9 +14,14 @@ template<typename Scalar>
 vector<Scalar> sin(const vector<Scalar>& radians) {
 	using std::sin;
 	using namespace sw::unum;
-	vector<Scalar> v(radians.size());
-	for (size_t i = 0; i < radians.size(); ++i) {
-		v[i] = sin(radians[i]);
+	vector<Scalar> v(radians);
+	if constexpr (is_posit<Scalar>) {
+		if (v.size() > 0) elementary_batch<Scalar>::sin(&v[0], &v[0], v.size());
+	}
+	else {
+		for (size_t i = 0; i < v.size(); ++i) {
+			v[i] = sin(v[i]);
+		}
 	}
 	return v;
 }
@@ -26,20 +31,82 @@ template<typename Scalar>
 vector<Scalar> cos(const vector<Scalar>& radians) {
 	using std::cos;
 	using namespace sw::unum;
-	vector<Scalar> v(radians.size());
-	for (size_t i = 0; i < radians.size(); ++i) {
-		v[i] = cos(radians[i]);
+	vector<Scalar> v(radians);
+	if constexpr (is_posit<Scalar>) {
+		if (v.size() > 0) elementary_batch<Scalar>::cos(&v[0], &v[0], v.size());
+	}
+	else {
+		for (size_t i = 0; i < v.size(); ++i) {
+			v[i] = cos(v[i]);
+		}
 	}
 	return v;
 }
+
 // vector tangent function
 template<typename Scalar>
 vector<Scalar> tan(const vector<Scalar>& radians) {
 	using std::tan;
 	using namespace sw::unum;
-	vector<Scalar> v(radians.size());
-	for (size_t i = 0; i < radians.size(); ++i) {
-		v[i] = tan(radians[i]);
+	vector<Scalar> v(radians);
+	if constexpr (is_posit<Scalar>) {
+		if (v.size() > 0) elementary_batch<Scalar>::tan(&v[0], &v[0], v.size());
+	}
+	else {
+		for (size_t i = 0; i < v.size(); ++i) {
+			v[i] = tan(v[i]);
+		}
+	}
+	return v;
+}
+
+// vector arc sine function
+template<typename Scalar>
+vector<Scalar> asin(const vector<Scalar>& x) {
+	using std::asin;
+	using namespace sw::unum;
+	vector<Scalar> v(x);
+	if constexpr (is_posit<Scalar>) {
+		if (v.size() > 0) elementary_batch<Scalar>::asin(&v[0], &v[0], v.size());
+	}
+	else {
+		for (size_t i = 0; i < v.size(); ++i) {
+			v[i] = asin(v[i]);
+		}
+	}
+	return v;
+}
+
+// vector arc cosine function
+template<typename Scalar>
+vector<Scalar> acos(const vector<Scalar>& x) {
+	using std::acos;
+	using namespace sw::unum;
+	vector<Scalar> v(x);
+	if constexpr (is_posit<Scalar>) {
+		if (v.size() > 0) elementary_batch<Scalar>::acos(&v[0], &v[0], v.size());
+	}
+	else {
+		for (size_t i = 0; i < v.size(); ++i) {
+			v[i] = acos(v[i]);
+		}
+	}
+	return v;
+}
+
+// vector arc tangent function
+template<typename Scalar>
+vector<Scalar> atan(const vector<Scalar>& x) {
+	using std::atan;
+	using namespace sw::unum;
+	vector<Scalar> v(x);
+	if constexpr (is_posit<Scalar>) {
+		if (v.size() > 0) elementary_batch<Scalar>::atan(&v[0], &v[0], v.size());
+	}
+	else {
+		for (size_t i = 0; i < v.size(); ++i) {
+			v[i] = atan(v[i]);
+		}
 	}
 	return v;
 }
@@ -7,6 +7,7 @@
 #include <iostream>
 #include <string>
 #include <sstream>
+#include "limb_arithmetic.hpp"
 
 // compiler specific operators
 #if defined(__clang__)
@@ -203,17 +204,12 @@ public:
 		return operator+=(twosComplement(rhs));
 	}
 	blockbinary& operator*=(const blockbinary& rhs) { // modulo in-place
-		blockbinary base(*this);
-		blockbinary multiplicant(rhs);
-		clear();
-		for (size_t i = 0; i < nbits; ++i) {
-			if (base.at(i)) {
-				operator+=(multiplicant);
-			}
-			multiplicant <<= 1;
-		}
-		// since we used operator+=, which enforces the nulling of leading bits
-		// we don't need to null here
+		// 2's complement multiplication modulo 2^nbits only needs the lower half of the limb product
+		bt product[nrBlocks];
+		limb_multiply_low(product, _block, rhs._block, nrBlocks);
+		for (size_t i = 0; i < nrBlocks; ++i) _block[i] = product[i];
+		// enforce precondition for fast comparison by properly nulling bits that are outside of nbits
+		_block[MSU] &= MSU_MASK;
 		return *this;
 	}
 	blockbinary& operator/=(const blockbinary& rhs) {
@@ -253,6 +249,8 @@ public:
 			_block[i] |= (bits >> (bitsInBlock - bitsToShift));
 		}
 		_block[0] <<= bitsToShift;
+		// enforce precondition for fast comparison by properly nulling bits that are outside of nbits
+		_block[MSU] &= MSU_MASK;
 		return *this;
 	}
 	// shift right operator
@@ -411,6 +409,13 @@ public:
 		}
 		throw "block index out of bounds";
 	}
+	inline void setblock(size_t b, bt value) {
+		if (b < nrBlocks) {
+			_block[b] = (b == MSU ? bt(value & MSU_MASK) : value);
+			return;
+		}
+		throw "block index out of bounds";
+	}
 
 	template<size_t nnbits>
 	inline blockbinary<nbits, bt>& assign(const blockbinary<nnbits, bt>& rhs) {
@@ -580,58 +585,67 @@ inline blockbinary<nbits, bt> operator>>(const blockbinary<nbits, bt>& a, const
 	return c >>= b;
 }
 
+// unsigned magnitude of a 2's complement blockbinary in nrBlocks limbs: maxneg yields 2^(nbits-1)
+template<size_t nbits, typename bt>
+inline void magnitude_limbs(const blockbinary<nbits, bt>& a, bt* limbs) {
+	using BlockBinary = blockbinary<nbits, bt>;
+	if (a.sign()) {
+		bt carry = 1;
+		for (size_t i = 0; i < BlockBinary::nrBlocks; ++i) limbs[i] = addcarry(bt(~a.block(i)), bt(0), carry);
+		limbs[BlockBinary::MSU] &= BlockBinary::MSU_MASK;
+	}
+	else {
+		for (size_t i = 0; i < BlockBinary::nrBlocks; ++i) limbs[i] = a.block(i);
+	}
+}
+
+// true if any of the bits in the range [0, msb] is set: the sticky bit of a right shift by msb + 1
+template<size_t nbits, typename bt>
+inline bool anyAfter(const blockbinary<nbits, bt>& a, int msb) {
+	constexpr int bitsInBlock = int(blockbinary<nbits, bt>::bitsInBlock);
+	if (msb < 0) return false;
+	if (msb >= int(nbits)) msb = int(nbits) - 1;
+	int topBlock = msb / bitsInBlock;
+	for (int i = 0; i < topBlock; ++i) {
+		if (a.block(size_t(i)) != 0) return true;
+	}
+	int bitsInTopBlock = msb % bitsInBlock + 1;
+	uint64_t mask = (bitsInTopBlock == 64) ? ~uint64_t(0) : ((uint64_t(1) << bitsInTopBlock) - 1);
+	return (uint64_t(a.block(size_t(topBlock))) & mask) != 0;
+}
+
 // divide a by b and return both quotient and remainder
 template<size_t nbits, typename bt>
 quorem<nbits, bt> longdivision(const blockbinary<nbits, bt>& _a, const blockbinary<nbits, bt>& _b) {
+	constexpr size_t nrBlocks = blockbinary<nbits, bt>::nrBlocks;
 	quorem<nbits, bt> result = { 0, 0, 0 };
 	if (_b.iszero()) {
 		result.exceptionId = 1; // division by zero
 		return result;
 	}
-	// generate the absolute values to do long division 
-	// 2's complement special case -max requires an signed int that is 1 bit bigger to represent abs()
+	// generate the absolute values to do long division
+	// the magnitudes of nbits 2's complement numbers fit in nbits unsigned bits: -maxneg is 2^(nbits-1)
 	bool a_sign = _a.sign();
 	bool b_sign = _b.sign();
 	bool result_negative = (a_sign ^ b_sign);
-	// normalize both arguments to positive, which requires expansion by 1-bit to deal with maxneg
-	blockbinary<nbits + 1, bt> a(_a);
-	blockbinary<nbits + 1, bt> b(_b);
-	if (a_sign) a.twoscomplement();
-	if (b_sign) b.twoscomplement();
-
-	if (a < b) { // optimization for integer numbers
+	bt a[nrBlocks], b[nrBlocks];
+	magnitude_limbs(_a, a);
+	magnitude_limbs(_b, b);
+	size_t m = limb_significant(a, nrBlocks);
+	size_t n = limb_significant(b, nrBlocks);
+	if (m < n) { // optimization for integer numbers
 		result.rem = _a; // a % b = a when a / b = 0
 		return result;   // a / b = 0 when b > a
 	}
-	// initialize the long division
-	blockbinary<nbits + 1, bt> accumulator = a;
-	// prepare the subtractand
-	blockbinary<nbits + 1, bt> subtractand = b;
-	int msb_b = b.msb();
-	int msb_a = a.msb();
-	int shift = msb_a - msb_b;
-	subtractand <<= shift;
-	// long division
-	for (int i = shift; i >= 0; --i) {
-		if (subtractand <= accumulator) {
-			accumulator -= subtractand;
-			result.quo.set(i);
-		}
-		else {
-			result.quo.reset(i);
-		}
-		subtractand >>= 1;
-	}
-	if (result_negative) {  // take 2's complement
-		result.quo.flip();
-		result.quo += 1;
-	}
-	if (_a.isneg()) {
-		result.rem = -accumulator;
-	}
-	else {
-		result.rem = accumulator;
+	// word-level long division
+	bt q[nrBlocks] = { 0 }, r[nrBlocks] = { 0 }, ws[2 * nrBlocks + 1];
+	limb_divmod(q, r, a, m, b, n, ws);
+	for (size_t i = 0; i < nrBlocks; ++i) {
+		result.quo.setblock(i, q[i]);
+		result.rem.setblock(i, r[i]);
 	}
+	if (result_negative) result.quo.twoscomplement();
+	if (a_sign) result.rem.twoscomplement();
 	return result;
 }
 
@@ -652,74 +666,31 @@ inline blockbinary<nbits + 1, bt> ursub(const blockbinary<nbits, bt>& a, const b
 	return result -= blockbinary<nbits + 1, bt>(b);
 }
 
-#define TRACE_URMUL 0
 // unrounded multiplication, returns a blockbinary that is of size 2*nbits
-// using brute-force sign-extending of operands to yield correct sign-extended result for 2*nbits 2's complement.
+// multiplies the unsigned magnitudes limb-wise and applies the final sign
 template<size_t nbits, typename bt>
-inline blockbinary<2*nbits, bt> urmul(const blockbinary<nbits, bt>& a, const blockbinary<nbits, bt>& b) {
+inline blockbinary<2 * nbits, bt> urmul2(const blockbinary<nbits, bt>& a, const blockbinary<nbits, bt>& b) {
+	constexpr size_t nrBlocks = blockbinary<nbits, bt>::nrBlocks;
+	constexpr size_t nrProductBlocks = blockbinary<2 * nbits, bt>::nrBlocks;
 	blockbinary<2 * nbits, bt> result;
 	if (a.iszero() || b.iszero()) return result;
 
-	// compute the result
-	blockbinary<2 * nbits, bt> signextended_a(a);
-	blockbinary<2 * nbits, bt> multiplicant(b);
-#if TRACE_URMUL
-	std::cout << "    " << to_binary(a) << " * " << to_binary(b) << std::endl;
-	std::cout << std::setw(3) << 0 << ' ' << to_binary(multiplicant) << ' ' << to_binary(result) << std::endl;
-#endif
-	for (size_t i = 0; i < 2* nbits; ++i) {
-		if (signextended_a.at(i)) {
-			result += multiplicant;
-		}
-		multiplicant <<= 1;
-#if TRACE_URMUL
-		std::cout << std::setw(3) << i << ' ' << to_binary(multiplicant) << ' ' << to_binary(result) << std::endl;
-#endif
-
-	}
-#if TRACE_URMUL
-	std::cout << "fnl " << to_binary(result) << std::endl;
-#endif
-	//blockbinary<2 * nbits, bt> clipped(result);
-	// since we used operator+=, which enforces the nulling of leading bits
-	// we don't need to null here
+	bool result_sign = a.sign() ^ b.sign();
+	bt a_mag[nrBlocks], b_mag[nrBlocks], product[2 * nrBlocks];
+	magnitude_limbs(a, a_mag);
+	magnitude_limbs(b, b_mag);
+	limb_multiply(product, a_mag, nrBlocks, b_mag, nrBlocks);
+	// the product of the magnitudes is at most 2^(2*nbits-2), the upper limbs beyond 2*nbits are zero
+	for (size_t i = 0; i < nrProductBlocks; ++i) result.setblock(i, product[i]);
+	if (result_sign) result.twoscomplement();
 	return result;
 }
 
 // unrounded multiplication, returns a blockbinary that is of size 2*nbits
-// using nbits modulo arithmetic with final sign
+// the product of two nbits 2's complement numbers is exact in 2*nbits, the sign-extended result is identical to urmul2
 template<size_t nbits, typename bt>
-inline blockbinary<2 * nbits, bt> urmul2(const blockbinary<nbits, bt>& a, const blockbinary<nbits, bt>& b) {
-	blockbinary<2 * nbits, bt> result;
-	if (a.iszero() || b.iszero()) return result;
-
-	// compute the result
-	bool result_sign = a.sign() ^ b.sign();
-	// normalize both arguments to positive in new size
-	blockbinary<nbits + 1, bt> a_new(a); // TODO optimize: now create a, create _a.bb, copy, destroy _a.bb_copy
-	blockbinary<nbits + 1, bt> b_new(b);
-	if (a.sign()) a_new.twoscomplement();
-	if (b.sign()) b_new.twoscomplement();
-	blockbinary<2*nbits, bt> multiplicant(b_new);
-
-#if TRACE_URMUL
-	std::cout << "    " << a_new << " * " << b_new << std::endl;
-	std::cout << std::setw(3) << 0 << ' ' << multiplicant << ' ' << result << std::endl;
-#endif
-	for (size_t i = 0; i < (nbits+1); ++i) {
-		if (a_new.at(i)) {
-			result += multiplicant;  // if multiplicant is not the same size as result, the assignment will get sign-extended if the MSB is true, this is not correct because we are assuming unsigned binaries in this loop
-		}
-		multiplicant <<= 1;
-#if TRACE_URMUL
-		std::cout << std::setw(3) << i << ' ' << multiplicant << ' ' << result << std::endl;
-#endif
-	}
-	if (result_sign) result.twoscomplement();
-#if TRACE_URMUL
-	std::cout << "fnl " << result << std::endl;
-#endif
-	return result;
+inline blockbinary<2*nbits, bt> urmul(const blockbinary<nbits, bt>& a, const blockbinary<nbits, bt>& b) {
+	return urmul2(a, b);
 }
 
 #define TRACE_DIV 0
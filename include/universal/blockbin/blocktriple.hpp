@@ -5,12 +5,13 @@
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <cassert>
+#include <cmath>
 #include <iostream>
 #include <iomanip>
+#include <sstream>
 #include <limits>
 
 #include <universal/blockbin/blockbinary.hpp>
-#include "../native/ieee-754.hpp"
 #include "../native/bit_functions.hpp"
 #include "trace_constants.hpp"
 
@@ -21,38 +22,17 @@ namespace unum {
 template<size_t ebits, size_t fbits, typename bt> class blocktriple;
 template<size_t ebits, size_t fbits, typename bt> blocktriple<ebits,fbits,bt> abs(const blocktriple<ebits,fbits,bt>& v);
 
+// copy the srcbits fraction bits of a native fraction into the most significant bits of an nbits fraction:
+// when nbits < srcbits the lower bits of the source fraction are truncated
 template<size_t nbits, typename bt>
-blockbinary<nbits> extract_23b_fraction(uint32_t _23b_fraction_without_hidden_bit) {
-	blockbinary<nbits, typename bt> _fraction;
-	uint32_t mask = uint32_t(0x00400000ul);
-	unsigned int ub = (nbits < 23 ? nbits : 23);
-	for (unsigned int i = 0; i < ub; i++) {
-		_fraction[nbits - 1 - i] = _23b_fraction_without_hidden_bit & mask;
-		mask >>= 1;
-	}
-	return _fraction;
-}
-
-template<size_t nbits, typename bt>
-blockbinary<nbits, bt> extract_52b_fraction(uint64_t _52b_fraction_without_hidden_bit) {
+blockbinary<nbits, bt> extract_fraction(uint64_t fraction_without_hidden_bit, size_t srcbits) {
 	blockbinary<nbits, bt> _fraction;
-	uint64_t mask = uint64_t(0x0008000000000000ull);
-	unsigned int ub = (nbits < 52 ? nbits : 52);
-	for (unsigned int i = 0; i < ub; i++) {
-		_fraction[nbits - 1 - i] = _52b_fraction_without_hidden_bit & mask;
-		mask >>= 1;
+	if (nbits >= srcbits) {
+		_fraction.set_raw_bits(fraction_without_hidden_bit);
+		_fraction <<= int(nbits - srcbits);
 	}
-	return _fraction;
-}
-
-template<size_t nbits, typename bt>
-blockbinary<nbits, bt> extract_63b_fraction(uint64_t _63b_fraction_without_hidden_bit) {
-	blockbinary<nbits, bt> _fraction;
-	uint64_t mask = uint64_t(0x4000000000000000ull);
-	unsigned int ub = (nbits < 63 ? nbits : 63);
-	for (unsigned int i = 0; i < ub; i++) {
-		_fraction[nbits - 1 - i] = _63b_fraction_without_hidden_bit & mask;
-		mask >>= 1;
+	else {
+		_fraction.set_raw_bits(fraction_without_hidden_bit >> (srcbits - nbits));
 	}
 	return _fraction;
 }
@@ -62,11 +42,12 @@ blockbinary<nbits, bt> extract_63b_fraction(uint64_t _63b_fraction_without_hidde
 template<size_t ebits, size_t fbits, typename bt = uint8_t>
 class blocktriple {
 public:
+	static_assert(fbits > 0, "blocktriple requires at least one fraction bit");
 	static constexpr size_t fhbits = fbits + 1;    // number of fraction bits including the hidden bit
 
-	blocktriple() : _sign(false), _scale(0), _nrOfBits(fbits), _fraction(), _inf(false), _zero(true), _nan(false) {}
-	blocktriple(bool sign, int scale, const blockbinary<fbits>& fraction_without_hidden_bit, bool zero = true, bool inf = false) 
-		: _sign(sign), _scale(scale), _nrOfBits(fbits), _fraction(fraction_without_hidden_bit), _inf(inf), _zero(zero), _nan(false) {}
+	blocktriple() : _sign(false), _scale(0), _nrOfBits(fbits), _inf(false), _zero(true), _nan(false), _fraction() {}
+	blocktriple(bool sign, int scale, const blockbinary<fbits, bt>& fraction_without_hidden_bit, bool zero = true, bool inf = false)
+		: _sign(sign), _scale(scale), _nrOfBits(fbits), _inf(inf), _zero(zero), _nan(false), _fraction(fraction_without_hidden_bit) {}
 
 	blocktriple(const signed char initial_value)        { *this = initial_value; }
 	blocktriple(const short initial_value)              { *this = initial_value; }
@@ -110,32 +91,11 @@ public:
 		return *this;
 	}
 	blocktriple& operator=(const long long rhs) {
-		if (_trace_conversion) std::cout << "---------------------- CONVERT -------------------" << std::endl;
-		if (rhs == 0) {
-			setzero();
-			return *this;
-		}
-		reset();
-		_sign = (0x8000000000000000 & rhs);  // 1 is negative, 0 is positive
-		if (_sign) {
-			// process negative number: process 2's complement of the input
-			_scale = findMostSignificantBit(-rhs) - 1;
-			uint64_t _fraction_without_hidden_bit = _scale == 0 ? 0 : (-rhs << (64 - _scale));
-			_fraction.set_raw_bits(_fraction_without_hidden_bit);
-			//take_2s_complement();
-			_nrOfBits = fbits;
-			if (_trace_conversion) std::cout << "int64 " << rhs << " sign " << _sign << " scale " << _scale << " fraction b" << _fraction << std::dec << std::endl;
-		}
-		else {
-			// process positive number
-			if (rhs != 0) {
-				_scale = findMostSignificantBit(rhs) - 1;
-				uint64_t _fraction_without_hidden_bit = _scale == 0 ? 0 : (rhs << (64 - _scale));
-				_fraction.set_raw_bits(_fraction_without_hidden_bit);
-				_nrOfBits = fbits;
-				if (_trace_conversion) std::cout << "int64 " << rhs << " sign " << _sign << " scale " << _scale << " fraction b" << _fraction << std::dec << std::endl;
-			}
-		}
+		if (_trace_triple_conversion) std::cout << "---------------------- CONVERT -------------------" << std::endl;
+		// the magnitude of the most negative value is 2^63, which is representable in an unsigned long long
+		*this = (unsigned long long)(rhs < 0 ? (0ull - (unsigned long long)(rhs)) : (unsigned long long)(rhs));
+		_sign = (rhs < 0);
+		if (_trace_triple_conversion) std::cout << "int64 " << rhs << " sign " << _sign << " scale " << _scale << " fraction b" << _fraction << std::dec << std::endl;
 		return *this;
 	}
 	blocktriple& operator=(const char rhs) {
@@ -151,133 +111,33 @@ public:
 		return *this;
 	}
 	blocktriple& operator=(const unsigned long rhs) {
-		*this = (long long)(rhs);
+		*this = (unsigned long long)(rhs);
 		return *this;
 	}
 	blocktriple& operator=(const unsigned long long rhs) {
-		if (_trace_conversion) std::cout << "---------------------- CONVERT -------------------" << std::endl;
+		if (_trace_triple_conversion) std::cout << "---------------------- CONVERT -------------------" << std::endl;
 		if (rhs == 0) {
 			setzero();
 		}
 		else {
 			reset();
-			_scale = findMostSignificantBit(rhs) - 1;
-			uint64_t _fraction_without_hidden_bit = _scale == 0 ? 0ull : (rhs << (64 - _scale)); // the scale == -1 case is handled above
-			_fraction = copy_integer_fraction<fbits>(_fraction_without_hidden_bit);
+			_scale = int(findMostSignificantBit(rhs)) - 1;
+			// left-align the bits below the hidden bit into a 63-bit fraction
+			uint64_t _63b_fraction_without_hidden_bit = (rhs << (63 - _scale)) & 0x7FFFFFFFFFFFFFFFull;
+			_fraction = extract_fraction<fbits, bt>(_63b_fraction_without_hidden_bit, 63);
 			_nrOfBits = fbits;
 		}
-		if (_trace_conversion) std::cout << "uint64 " << rhs << " sign " << _sign << " scale " << _scale << " fraction b" << _fraction << std::dec << std::endl;
+		if (_trace_triple_conversion) std::cout << "uint64 " << rhs << " sign " << _sign << " scale " << _scale << " fraction b" << _fraction << std::dec << std::endl;
 		return *this;
 	}
 	blocktriple& operator=(const float rhs) {
-		reset();
-		if (_trace_conversion) std::cout << "---------------------- CONVERT -------------------" << std::endl;
-
-		switch (std::fpclassify(rhs)) {
-		case FP_ZERO:
-			_nrOfBits = fbits;
-			_zero = true;
-			break;
-		case FP_INFINITE:
-			_inf  = true;
-			_sign = true;
-			break;
-		case FP_NAN:
-			_nan = true;
-			_sign = true;
-			break;
-		case FP_SUBNORMAL:
-		case FP_NORMAL:
-			{
-				float _fr;
-				unsigned int _23b_fraction_without_hidden_bit;
-				int _exponent;
-				extract_fp_components(rhs, _sign, _exponent, _fr, _23b_fraction_without_hidden_bit);
-				_scale = _exponent - 1;
-				_fraction = extract_23b_fraction<fbits>(_23b_fraction_without_hidden_bit);
-				_nrOfBits = fbits;
-				if (_trace_conversion) std::cout << "float " << rhs << " sign " << _sign << " scale " << _scale << " 23b fraction 0x" << std::hex << _23b_fraction_without_hidden_bit << " _fraction b" << _fraction << std::dec << std::endl;
-			}
-			break;
-		}
-		return *this;
+		return convert_ieee754(rhs);
 	}
 	blocktriple& operator=(const double rhs) {
-		reset();
-		if (_trace_conversion) std::cout << "---------------------- CONVERT -------------------" << std::endl;
-
-		switch (std::fpclassify(rhs)) {
-		case FP_ZERO:
-			_nrOfBits = fbits;
-			_zero = true;
-			break;
-		case FP_INFINITE:
-			_inf = true;
-			_sign = true;
-			break;
-		case FP_NAN:
-			_nan = true;
-			_sign = true;
-			break;
-		case FP_SUBNORMAL:
-		case FP_NORMAL:
-			{
-				double _fr;
-				unsigned long long _52b_fraction_without_hidden_bit;
-				int _exponent;
-				extract_fp_components(rhs, _sign, _exponent, _fr, _52b_fraction_without_hidden_bit);
-				_scale = _exponent - 1;
-				_fraction = extract_52b_fraction<fbits>(_52b_fraction_without_hidden_bit);
-				_nrOfBits = fbits;
-				if (_trace_conversion) std::cout << "double " << rhs << " sign " << _sign << " scale " << _scale << " 52b fraction 0x" << std::hex << _52b_fraction_without_hidden_bit << " _fraction b" << _fraction << std::dec << std::endl;
-			}
-			break;
-		}
-		return *this;
+		return convert_ieee754(rhs);
 	}
 	blocktriple& operator=(const long double rhs) {
-		reset();
-		if (_trace_conversion) std::cout << "---------------------- CONVERT -------------------" << std::endl;
-
-		switch (std::fpclassify(rhs)) {
-		case FP_ZERO:
-			_nrOfBits = fbits;
-			_zero = true;
-			break;
-		case FP_INFINITE:
-			_inf = true;
-			_sign = true;
-			break;
-		case FP_NAN:
-			_nan = true;
-			_sign = true;
-			break;
-		case FP_SUBNORMAL:
-		case FP_NORMAL:
-			{
-				long double _fr;
-				unsigned long long _63b_fraction_without_hidden_bit;
-				int _exponent;
-				extract_fp_components(rhs, _sign, _exponent, _fr, _63b_fraction_without_hidden_bit);
-				_scale = _exponent - 1;
-				// how to interpret the fraction bits: TODO: this should be a static compile-time code block
-				if (sizeof(long double) == 8) {
-					// we are just a double and thus only have 52bits of fraction
-					_fraction = extract_52b_fraction<fbits,bt>(_63b_fraction_without_hidden_bit);
-					if (_trace_conversion) std::cout << "long double " << rhs << " sign " << _sign << " scale " << _scale << " 52b fraction 0x" << std::hex << _63b_fraction_without_hidden_bit << " _fraction b" << _fraction << std::dec << std::endl;
-
-				}
-				else if (sizeof(long double) == 16) {
-					// how to differentiate between 80bit and 128bit formats?
-					_fraction = extract_63b_fraction<fbits,bt>(_63b_fraction_without_hidden_bit);
-					if (_trace_conversion) std::cout << "long double " << rhs << " sign " << _sign << " scale " << _scale << " 63b fraction 0x" << std::hex << _63b_fraction_without_hidden_bit << " _fraction b" << _fraction << std::dec << std::endl;
-
-				}
-				_nrOfBits = fbits;
-			}
-			break;
-		}
-		return *this;
+		return convert_ieee754(rhs);
 	}
 
 	// conversion operators
@@ -286,8 +146,10 @@ public:
 	explicit operator long double() const { return to_long_double(); }
 
 	// operators
-	blocktriple operator-() const {				
-		return blocktriple<ebits, fbits>(!_sign, _scale, _fraction, _zero, _inf);
+	blocktriple operator-() const {
+		blocktriple negated(*this);
+		negated._sign = !_sign;
+		return negated;
 	}
 
 	// modifiers
@@ -300,31 +162,32 @@ public:
 		_nan = false;
 		_fraction.clear();
 	}
-	void set(bool sign, int scale, blockbinary<fbits> fraction_without_hidden_bit, bool zero, bool inf, bool nan = false) {
+	void set(bool sign, int scale, const blockbinary<fbits, bt>& fraction_without_hidden_bit, bool zero, bool inf, bool nan = false) {
 		_sign     = sign;
 		_scale    = scale;
 		_fraction = fraction_without_hidden_bit;
 		_zero     = zero;
 		_inf      = inf;
 		_nan      = nan;
+		_nrOfBits = fbits;
 	}
-	void setzero() {
+	void setzero(bool sign = false) {
 		_zero     = true;
-		_sign     = false;
+		_sign     = sign;
 		_inf      = false;
 		_nan      = false;
 		_scale    = 0;
 		_nrOfBits = fbits;
 		_fraction.clear();
 	}
-	void setinf() {      // this maps to NaR on the posit side, and that has a sign = 1
+	void setinf(bool sign = true) {      // the default maps to NaR on the posit side, and that has a sign = 1
 		_inf      = true;
-		_sign     = true;
+		_sign     = sign;
 		_zero     = false;
 		_nan      = false;
 		_scale    = 0;
 		_nrOfBits = fbits;
-		_fraction.reset();
+		_fraction.clear();
 	}
 	void setnan() {		// this will also map to NaR
 		_nan      = true;
@@ -332,8 +195,8 @@ public:
 		_zero     = false;
 		_inf      = false;
 		_scale    = 0;
-		_nrOfBits = fbits;	
-		_fraction.reset();
+		_nrOfBits = fbits;
+		_fraction.clear();
 	}
 	inline void setscale(int e) { _scale = e; }
 	inline void set_raw_bits(uint64_t v) { _fraction.set_raw_bits(v); }
@@ -344,65 +207,50 @@ public:
 	inline bool isnan() const { return _nan; }
 	inline bool sign() const { return _sign; }
 	inline int scale() const { return _scale; }
-	blockbinary<fbits> fraction() const { return _fraction; }
-	/// Normalized shift (e.g., for addition).
+	blockbinary<fbits, bt> fraction() const { return _fraction; }
+	// the significand with the hidden bit at position fbits and a leading 0, so that it is a positive 2's complement value
+	blockbinary<fhbits + 1, bt> significand() const {
+		blockbinary<fhbits + 1, bt> _significand;
+		if (_zero || _inf || _nan) return _significand;
+		_significand = _fraction;  // the copy sign-extends the fraction msb into the upper two bits: set them explicitly
+		_significand.set(fbits);
+		_significand.reset(fbits + 1);
+		return _significand;
+	}
+	/// Normalized shift (e.g., for addition): the hidden bit lands at position fbits + shift
+	/// and the bits that are shifted out on the right are collected in the sticky bit at position 0
 	template <size_t Size>
-	blockbinary<Size> nshift(long shift) const {
-		bitblock<Size> number;
-
-#if POSIT_THROW_ARITHMETIC_EXCEPTIONS
-		// Check range
-		if (long(fbits) + shift >= long(Size))
-			throw shift_too_large{};
-#else
-		// Check range
-		if (long(fbits) + shift >= long(Size)) {
-			std::cerr << "nshift: shift is too large\n";
-			number.reset();
+	blockbinary<Size, bt> nshift(long shift) const {
+		blockbinary<Size, bt> number;
+		const long hpos = long(fbits) + shift;       // position of hidden bit
+		if (hpos >= long(Size)) throw "nshift: shift is too large";
+		if (hpos < 0) {   // the hidden bit is beyond the LSB: the value only contributes to the sticky bit
+			number.set(0);
 			return number;
 		}
-#endif // POSIT_THROW_ARITHMETIC_EXCEPTIONS
-
-		const long hpos = fbits + shift;       // position of hidden bit
-												  
-		if (hpos <= 0) {   // If hidden bit is LSB or beyond just set uncertainty bit and call it a day
-			number[0] = true;
-			return number;
+		constexpr size_t W = (Size > fhbits + 1 ? Size : fhbits + 1);
+		blockbinary<W, bt> aligned(significand());
+		bool sticky = false;
+		if (shift >= 0) {
+			aligned <<= int(shift);
 		}
-		number[hpos] = true;                   // hidden bit now safely set
-
-											   // Copy fraction bits into certain part
-		for (long npos = hpos - 1, fpos = long(fbits) - 1; npos > 0 && fpos >= 0; --npos, --fpos)
-			number[npos] = _fraction[fpos];
-
-		// Set uncertainty bit
-		bool uncertainty = false;
-		for (long fpos = std::min(long(fbits) - 1, -shift); fpos >= 0 && !uncertainty; --fpos)
-			uncertainty |= _fraction[fpos];
-		number[0] = uncertainty;
+		else {
+			sticky = anyAfter(aligned, int(-shift) - 1);
+			aligned >>= int(-shift);  // aligned is positive, so the arithmetic shift is a logical shift
+		}
+		number = aligned;
+		if (sticky) number.set(0);
 		return number;
 	}
 	// get a fixed point number by making the hidden bit explicit: useful for multiply units
 	blockbinary<fhbits, bt> get_fixed_point() const {
-		blockbinary<fbits + 1, bt> fixed_point_number;
-		fixed_point_number.set(fbits, true); // make hidden bit explicit
-		for (unsigned int i = 0; i < fbits; i++) {
-			fixed_point_number[i] = _fraction[i];
-		}
-		return fixed_point_number;
+		return blockbinary<fhbits, bt>(significand());
 	}
 	// get the fraction value including the implicit hidden bit (this is at an exponent level 1 smaller)
 	template<typename Ty = double>
 	Ty get_implicit_fraction_value() const {
-		if (_zero) return (long double)0.0;
-		Ty v = 1.0;
-		Ty scale = 0.5;
-		for (int i = int(fbits) - 1; i >= 0; i--) {
-			if (_fraction.test(i)) v += scale;
-			scale *= 0.5;
-			if (scale == 0.0) break;
-		}
-		return v;
+		if (_zero) return Ty(0.0);
+		return Ty(1.0) + std::ldexp(fraction_integer<Ty>(), -int(fbits));
 	}
 	int sign_value() const { return (_sign ? -1 : 1); }
 	double scale_value() const {
@@ -411,79 +259,36 @@ public:
 	}
 	template<typename Ty = double>
 	Ty fraction_value() const {
-		if (_zero) return (long double)0.0;
-		Ty v = 1.0;
-		Ty scale = 0.5;
-		for (int i = int(fbits) - 1; i >= 0; i--) {
-			if (_fraction.test(i)) v += scale;
-			scale *= 0.5;
-			if (scale == 0.0) break;
-		}
-		return v;
+		return get_implicit_fraction_value<Ty>();
 	}
 	long double to_long_double() const {
-		return sign_value() * scale_value() * fraction_value<long double>();
+		return to_native<long double>();
 	}
 	double      to_double() const {
-		return sign_value() * scale_value() * fraction_value<double>();
+		return to_native<double>();
 	}
 	float       to_float() const {
-		return float(sign_value() * scale_value() * fraction_value<float>());
+		return to_native<float>();
 	}
 
-	// TODO: this does not implement a 'real' right extend. tgtbits need to be shorter than fbits
-	template<size_t srcbits, size_t tgtbits>
+	// widen or truncate the fraction to tgtbits, keeping the sign, scale, and special cases
+	template<size_t srcbits>
 	void right_extend(const blocktriple<ebits,srcbits,bt>& src) {
 		_sign = src.sign();
 		_scale = src.scale();
-		_nrOfBits = tgtbits;
+		_nrOfBits = fbits;
 		_inf = src.isinf();
 		_zero = src.iszero();
 		_nan = src.isnan();
-		bitblock<srcbits> src_fraction = src.fraction();
+		_fraction.clear();
 		if (!_inf && !_zero && !_nan) {
-			for (int s = srcbits - 1, t = tgtbits - 1; s >= 0 && t >= 0; --s, --t)
-				_fraction[t] = src_fraction[s];
+			constexpr size_t W = (srcbits > fbits ? srcbits : fbits) + 1;
+			blockbinary<W, bt> aligned(src.significand());
+			aligned <<= int(W - 1 - srcbits);  // hidden bit at the top of the aligned fraction
+			aligned >>= int(W - 1 - fbits);    // arithmetic shift smears the hidden bit into the bits above fbits
+			_fraction = aligned;
 		}
 	}
-	template<size_t tgt_ebits, size_t tgt_fbits>
-	blocktriple<tgt_ebits, tgt_fbits, bt> round_to() {
-		blockbinary<tgt_fbits, bt> rounded_fraction;
-		if (tgt_fbits == 0) {
-			bool round_up = false;
-			if (fbits >= 2) {
-				bool blast = _fraction[int(fbits) - 1];
-				bool sb = anyAfter(_fraction, int(fbits) - 2);
-				if (blast && sb) round_up = true;
-			}
-			else if (fbits == 1) {
-				round_up = _fraction[0];
-			}
-			return blocktriple<tgt_ebits,tgt_fbits,bt>(_sign, (round_up ? _scale + 1 : _scale), rounded_fraction, _zero, _inf);
-		}
-		else {
-			if (!_zero || !_inf) {
-				if (tgt_fbits < fbits) {
-					int rb = int(tgt_fbits) - 1;
-					int lb = int(fbits) - int(tgt_fbits) - 1;
-					for (int i = int(fbits) - 1; i > lb; i--, rb--) {
-						rounded_fraction[rb] = _fraction[i];
-					}
-					bool blast = _fraction[lb];
-					bool sb = false;
-					if (lb > 0) sb = anyAfter(_fraction, lb-1);
-					if (blast || sb) rounded_fraction[0] = true;
-				}
-				else {
-					int rb = int(tgt_fbits) - 1;
-					for (int i = int(fbits) - 1; i >= 0; i--, rb--) {
-						rounded_fraction[rb] = _fraction[i];
-					}
-				}
-			}
-		}
-		return blocktriple<tgt_ebits, tgt_fbits, bt>(_sign, _scale, rounded_fraction, _zero, _inf);
-	}
 
 private:
 	bool                _sign;
@@ -494,123 +299,122 @@ private:
 	bool                _nan;
 	blockbinary<fbits, bt>  _fraction;
 
+	template<typename Real>
+	blocktriple& convert_ieee754(Real rhs) {
+		// the fraction bits of the native type, limited to what fits in a 64-bit word
+		constexpr int digits = std::numeric_limits<Real>::digits;
+		constexpr int srcbits = (digits - 1 < 63 ? digits - 1 : 63);
+		reset();
+		if (_trace_triple_conversion) std::cout << "---------------------- CONVERT -------------------" << std::endl;
+
+		switch (std::fpclassify(rhs)) {
+		case FP_ZERO:
+			setzero(std::signbit(rhs));
+			break;
+		case FP_INFINITE:
+			setinf(std::signbit(rhs));
+			break;
+		case FP_NAN:
+			setnan();
+			break;
+		case FP_SUBNORMAL:
+		case FP_NORMAL:
+			{
+				int _exponent;
+				Real _fr = std::frexp(std::fabs(rhs), &_exponent);  // _fr in [0.5, 1.0), which normalizes subnormals
+				uint64_t _significand = uint64_t(std::ldexp(_fr, srcbits + 1));
+				uint64_t _fraction_without_hidden_bit = _significand & ((uint64_t(1) << srcbits) - 1);
+				_sign = std::signbit(rhs);
+				_scale = _exponent - 1;
+				_fraction = extract_fraction<fbits, bt>(_fraction_without_hidden_bit, size_t(srcbits));
+				_nrOfBits = fbits;
+				if (_trace_triple_conversion) std::cout << "native " << rhs << " sign " << _sign << " scale " << _scale << " fraction 0x" << std::hex << _fraction_without_hidden_bit << " _fraction b" << _fraction << std::dec << std::endl;
+			}
+			break;
+		}
+		return *this;
+	}
+
+	// the fraction bits as an integer value, evaluated block by block
+	template<typename Real>
+	Real fraction_integer() const {
+		using Fraction = blockbinary<fbits, bt>;
+		const Real radix = std::ldexp(Real(1.0), int(Fraction::bitsInBlock));
+		Real v = 0;
+		for (int i = int(Fraction::MSU); i >= 0; --i) {
+			v = v * radix + Real(_fraction.block(size_t(i)));
+		}
+		return v;
+	}
+
+	template<typename Real>
+	Real to_native() const {
+		if (_nan) return std::numeric_limits<Real>::quiet_NaN();
+		if (_inf) return (_sign ? -std::numeric_limits<Real>::infinity() : std::numeric_limits<Real>::infinity());
+		if (_zero) return (_sign ? -Real(0.0) : Real(0.0));
+		Real v = std::ldexp(get_implicit_fraction_value<Real>(), _scale);
+		return (_sign ? -v : v);
+	}
+
 	// template parameters need names different from class template parameters (for gcc and clang)
-	template<size_t eebits, size_t ffbits, typename bt>
-	friend std::ostream& operator<< (std::ostream& ostr, const blocktriple<eebits, ffbits, bt>& r);
-	template<size_t eebits, size_t ffbits, typename bt>
-	friend std::istream& operator>> (std::istream& istr, blocktriple<eebits, ffbits, bt>& r);
+	template<size_t eebits, size_t ffbits, typename bbt>
+	friend std::ostream& operator<< (std::ostream& ostr, const blocktriple<eebits, ffbits, bbt>& r);
+	template<size_t eebits, size_t ffbits, typename bbt>
+	friend std::istream& operator>> (std::istream& istr, blocktriple<eebits, ffbits, bbt>& r);
 
 	// logic operators
-	template<size_t eebits, size_t ffbits, typename bt>
-	friend bool operator==(const blocktriple<eebits, ffbits, bt>& lhs, const blocktriple<eebits, ffbits, bt>& rhs);
-	template<size_t eebits, size_t ffbits, typename bt>
-	friend bool operator!=(const blocktriple<eebits, ffbits, bt>& lhs, const blocktriple<eebits, ffbits, bt>& rhs);
-	template<size_t eebits, size_t ffbits, typename bt>
-	friend bool operator< (const blocktriple<eebits, ffbits, bt>& lhs, const blocktriple<eebits, ffbits, bt>& rhs);
-	template<size_t eebits, size_t ffbits, typename bt>
-	friend bool operator> (const blocktriple<eebits, ffbits, bt>& lhs, const blocktriple<eebits, ffbits, bt>& rhs);
-	template<size_t eebits, size_t ffbits, typename bt>
-	friend bool operator<=(const blocktriple<eebits, ffbits, bt>& lhs, const blocktriple<eebits, ffbits, bt>& rhs);
-	template<size_t eebits, size_t ffbits, typename bt>
-	friend bool operator>=(const blocktriple<eebits, ffbits, bt>& lhs, const blocktriple<eebits, ffbits, bt>& rhs);
+	template<size_t eebits, size_t ffbits, typename bbt>
+	friend bool operator==(const blocktriple<eebits, ffbits, bbt>& lhs, const blocktriple<eebits, ffbits, bbt>& rhs);
+	template<size_t eebits, size_t ffbits, typename bbt>
+	friend bool operator!=(const blocktriple<eebits, ffbits, bbt>& lhs, const blocktriple<eebits, ffbits, bbt>& rhs);
+	template<size_t eebits, size_t ffbits, typename bbt>
+	friend bool operator< (const blocktriple<eebits, ffbits, bbt>& lhs, const blocktriple<eebits, ffbits, bbt>& rhs);
+	template<size_t eebits, size_t ffbits, typename bbt>
+	friend bool operator> (const blocktriple<eebits, ffbits, bbt>& lhs, const blocktriple<eebits, ffbits, bbt>& rhs);
+	template<size_t eebits, size_t ffbits, typename bbt>
+	friend bool operator<=(const blocktriple<eebits, ffbits, bbt>& lhs, const blocktriple<eebits, ffbits, bbt>& rhs);
+	template<size_t eebits, size_t ffbits, typename bbt>
+	friend bool operator>=(const blocktriple<eebits, ffbits, bbt>& lhs, const blocktriple<eebits, ffbits, bbt>& rhs);
 };
 
 ////////////////////// operators
 template<size_t ebits, size_t fbits, typename bt>
 inline std::ostream& operator<<(std::ostream& ostr, const blocktriple<ebits, fbits, bt>& v) {
-	if (v._inf) {
-		ostr << FP_INFINITE;
-	}
-	else {
-		ostr << (long double)v;
-	}
-	return ostr;
+	return ostr << v.to_long_double();
 }
 
 template<size_t ebits, size_t fbits, typename bt>
-inline std::istream& operator>> (std::istream& istr, const blocktriple<ebits, fbits, bt>& v) {
-	istr >> v._fraction;
+inline std::istream& operator>> (std::istream& istr, blocktriple<ebits, fbits, bt>& v) {
+	long double ld;
+	istr >> ld;
+	v = ld;
 	return istr;
 }
 
 template<size_t ebits, size_t fbits, typename bt>
-inline blocktriple<ebits, fbits, bt> operator/(const blocktriple<ebits, fbits, bt>& lhs, const blocktriple<ebits, fbits, bt>& rhs) {
-	return lhs;
-}
-
-template<size_t ebits, size_t fbits, typename bt>
-inline bool operator==(const blocktriple<ebits, fbits, bt>& lhs, const blocktriple<ebits, fbits, bt>& rhs) { return lhs._sign == rhs._sign && lhs._scale == rhs._scale && lhs._fraction == rhs._fraction && lhs._nrOfBits == rhs._nrOfBits && lhs._zero == rhs._zero && lhs._inf == rhs._inf; }
+inline bool operator==(const blocktriple<ebits, fbits, bt>& lhs, const blocktriple<ebits, fbits, bt>& rhs) { return lhs._sign == rhs._sign && lhs._scale == rhs._scale && lhs._fraction == rhs._fraction && lhs._nrOfBits == rhs._nrOfBits && lhs._zero == rhs._zero && lhs._inf == rhs._inf && lhs._nan == rhs._nan; }
 
 template<size_t ebits, size_t fbits, typename bt>
 inline bool operator!=(const blocktriple<ebits, fbits, bt>& lhs, const blocktriple<ebits, fbits, bt>& rhs) { return !operator==(lhs, rhs); }
 
 template<size_t ebits, size_t fbits, typename bt>
 inline bool operator< (const blocktriple<ebits, fbits, bt>& lhs, const blocktriple<ebits, fbits, bt>& rhs) {
+	if (lhs._nan || rhs._nan) return false;
 	if (lhs._inf) {
-		if (rhs._inf) return false; else return true; // everything is less than -infinity
-	}
-	else {
-		if (rhs._inf) return false;
+		if (rhs._inf) return lhs._sign && !rhs._sign;
+		return lhs._sign;
 	}
-
+	if (rhs._inf) return !rhs._sign;
 	if (lhs._zero) {
 		if (rhs._zero) return false; // they are both 0
-		if (rhs._sign) return false; else return true;
-	}
-	if (rhs._zero) {
-		if (lhs._sign) return true; else return false;
-	}
-	if (lhs._sign) {
-		if (rhs._sign) {	// both operands are negative
-			if (lhs._scale > rhs._scale) {
-				return true;	// lhs is more negative
-			}
-			else {
-				if (lhs._scale == rhs._scale) {
-					// compare the fraction, which is an unsigned value
-					if (lhs._fraction == rhs._fraction) return false; // they are the same value
-					if (lhs._fraction > rhs._fraction) {
-						return true; // lhs is more negative
-					}
-					else {
-						return false; // lhs is less negative
-					}
-				}
-				else {
-					return false; // lhs is less negative
-				}
-			}
-		}
-		else {
-			return true; // lhs is negative, rhs is positive
-		}
-	}
-	else {
-		if (rhs._sign) {	
-			return false; // lhs is positive, rhs is negative
-		}
-		else {
-			if (lhs._scale > rhs._scale) {
-				return false; // lhs is more positive
-			}
-			else {
-				if (lhs._scale == rhs._scale) {
-					// compare the fractions
-					if (lhs._fraction == rhs._fraction) return false; // they are the same value
-					if (lhs._fraction > rhs._fraction) {
-						return false; // lhs is more positive than rhs
-					}
-					else {
-						return true; // lhs is less positive than rhs
-					}
-				}
-				else {
-					return true; // lhs is less positive
-				}
-			}
-		}
-	}
-	return false;
+		return !rhs._sign;
+	}
+	if (rhs._zero) return lhs._sign;
+	if (lhs._sign != rhs._sign) return lhs._sign;
+	// same sign: compare the magnitudes, the significands are positive 2's complement values
+	bool lhs_is_smaller_magnitude = (lhs._scale == rhs._scale) ? (lhs.significand() < rhs.significand()) : (lhs._scale < rhs._scale);
+	bool rhs_is_smaller_magnitude = (lhs._scale == rhs._scale) ? (rhs.significand() < lhs.significand()) : (rhs._scale < lhs._scale);
+	return lhs._sign ? rhs_is_smaller_magnitude : lhs_is_smaller_magnitude;
 }
 
 template<size_t ebits, size_t fbits, typename bt>
@@ -623,245 +427,151 @@ inline bool operator>=(const blocktriple<ebits, fbits, bt>& lhs, const blocktrip
 template<size_t ebits, size_t fbits, typename bt>
 inline std::string components(const blocktriple<ebits, fbits, bt>& v) {
 	std::stringstream s;
-	if (v.iszero()) {
-		s << "(+,0," << std::setw(fbits) << v.fraction() << ')';
+	if (v.isnan()) {
+		s << "(nan)";
+		return s.str();
+	}
+	else if (v.iszero()) {
+		s << "(" << (v.sign() ? "-" : "+") << ",0," << to_binary(v.fraction()) << ')';
 		return s.str();
 	}
 	else if (v.isinf()) {
-		s << "(inf," << std::setw(fbits) << v.fraction() << ')';
+		s << "(" << (v.sign() ? "-" : "+") << "inf," << to_binary(v.fraction()) << ')';
 		return s.str();
 	}
-	s << "(" << (v.sign() ? "-" : "+") << "," << v.scale() << "," << v.fraction() << ')';
+	s << "(" << (v.sign() ? "-" : "+") << "," << v.scale() << "," << to_binary(v.fraction()) << ')';
 	return s.str();
 }
 
 /// Magnitude of a scientific notation value (equivalent to turning the sign bit off).
 template<size_t ebits, size_t fbits, typename bt>
 blocktriple<ebits, fbits, bt> abs(const blocktriple<ebits, fbits, bt>& v) {
-	return blocktriple<ebits, fbits, bt(false, v.scale(), v.fraction(), v.iszero());
+	return (v.sign() ? -v : v);
 }
 
+/*
+ The arithmetic modules compute the sign, scale, and fraction of the result on blockbinary words,
+ wide enough to be exact, or exact up to a sticky bit in the least significant position.
+ The sticky bit is set when bits that are not zero were shifted out, so that a subsequent
+ truncation of the result fraction can still detect that the result is not exact.
+ */
+
 // add two values with fbits fraction bits, round them to abits, and return the abits+1 result value
 template<size_t ebits, size_t fbits, size_t abits, typename bt>
 void module_add(const blocktriple<ebits,fbits,bt>& lhs, const blocktriple<ebits,fbits,bt>& rhs, blocktriple<ebits,abits + 1,bt>& result) {
-	// with sign/magnitude adders it is customary to organize the computation 
+	// with sign/magnitude adders it is customary to organize the computation
 	// along the four quadrants of sign combinations
 	//  + + = +
 	//  + - =   lhs > rhs ? + : -
 	//  - + =   lhs > rhs ? - : +
-	//  - - = 
-	// to simplify the result processing assign the biggest 
+	//  - - =
+	// to simplify the result processing assign the biggest
 	// absolute value to R1, then the sign of the result will be sign of the value in R1.
-
-	if (lhs.isinf() || rhs.isinf()) {
-		result.setinf();
+	static_assert(abits >= fbits + 4, "module_add requires at least three guard bits and a sticky bit");
+	if (lhs.isnan() || rhs.isnan()) {
+		result.setnan();
 		return;
 	}
-	int lhs_scale = lhs.scale(), rhs_scale = rhs.scale(), scale_of_result = std::max(lhs_scale, rhs_scale);
-
-	// align the fractions
-	blockbinary<abits,bt> r1 = lhs.template nshift<abits>(lhs_scale - scale_of_result + 3);
-	blockbinary<abits,bt> r2 = rhs.template nshift<abits>(rhs_scale - scale_of_result + 3);
-	bool r1_sign = lhs.sign(), r2_sign = rhs.sign();
-	bool signs_are_different = r1_sign != r2_sign;
-
-	if (signs_are_different && sw::unum::abs(lhs) < sw::unum::abs(rhs)) {
-		std::swap(r1, r2);
-		std::swap(r1_sign, r2_sign);
-	}
-
-	if (signs_are_different) r2 = twos_complement(r2);
-
-	if (_trace_add) {
-		std::cout << (r1_sign ? "sign -1" : "sign  1") << " scale " << std::setw(3) << scale_of_result << " r1       " << r1 << std::endl;
-		if (signs_are_different) {
-			std::cout << (r2_sign ? "sign -1" : "sign  1") << " scale " << std::setw(3) << scale_of_result << " r2 orig  " << twos_complement(r2) << std::endl;
+	if (lhs.isinf() || rhs.isinf()) {
+		if (lhs.isinf() && rhs.isinf() && lhs.sign() != rhs.sign()) {
+			result.setnan();
 		}
-		std::cout << (r2_sign ? "sign -1" : "sign  1") << " scale " << std::setw(3) << scale_of_result << " r2       " << r2 << std::endl;
-	}
-
-	bitblock<abits + 1> sum;
-	const bool carry = add_unsigned(r1, r2, sum);
-
-	if (_trace_add) std::cout << (r1_sign ? "sign -1" : "sign  1") << " carry " << std::setw(3) << (carry ? 1 : 0) << " sum     " << sum << std::endl;
-
-	long shift = 0;
-	if (carry) {
-		if (r1_sign == r2_sign) {  // the carry && signs== implies that we have a number bigger than r1
-			shift = -1;
-		} 
 		else {
-			// the carry && signs!= implies ||result|| < ||r1||, must find MSB (in the complement)
-			for (int i = abits - 1; i >= 0 && !sum[i]; i--) {
-				shift++;
-			}
+			result.setinf(lhs.isinf() ? lhs.sign() : rhs.sign());
 		}
-	}
-	assert(shift >= -1);
-
-	if (shift >= long(abits)) {            // we have actual 0                            
-		sum.reset();
-		result.set(false, 0, sum, true, false, false);
 		return;
 	}
-
-	scale_of_result -= shift;
-	const int hpos = abits - 1 - shift;         // position of the hidden bit 
-	sum <<= abits - hpos + 1;
-	if (_trace_add) std::cout << (r1_sign ? "sign -1" : "sign  1") << " scale " << std::setw(3) << scale_of_result << " sum     " << sum << std::endl;
-	result.set(r1_sign, scale_of_result, sum, false, false, false);
-}
-
-// subtract module: use ADDER
-template<size_t ebits, size_t fbits, size_t abits, typename bt>
-void module_subtract(const blocktriple<ebits,fbits,bt>& lhs, const blocktriple<ebits,fbits,bt>& rhs, blocktriple<ebits,abits + 1,bt>& result) {
-	if (lhs.isinf() || rhs.isinf()) {
-		result.setinf();
+	if (lhs.iszero() || rhs.iszero()) {
+		if (lhs.iszero() && rhs.iszero()) {
+			result.setzero(lhs.sign() && rhs.sign());
+		}
+		else {
+			result.right_extend(lhs.iszero() ? rhs : lhs);
+		}
 		return;
 	}
 	int lhs_scale = lhs.scale(), rhs_scale = rhs.scale(), scale_of_result = std::max(lhs_scale, rhs_scale);
 
-	// align the fractions
-	bitblock<abits> r1 = lhs.template nshift<abits>(lhs_scale - scale_of_result + 3);
-	bitblock<abits> r2 = rhs.template nshift<abits>(rhs_scale - scale_of_result + 3);
-	bool r1_sign = lhs.sign(), r2_sign = !rhs.sign();
+	// align the fractions: the hidden bit of the largest scale lands at fbits + 3, the top bits stay free for the carry
+	blockbinary<abits + 2, bt> r1 = lhs.template nshift<abits + 2>(lhs_scale - scale_of_result + 3);
+	blockbinary<abits + 2, bt> r2 = rhs.template nshift<abits + 2>(rhs_scale - scale_of_result + 3);
+	bool r1_sign = lhs.sign(), r2_sign = rhs.sign();
 	bool signs_are_different = r1_sign != r2_sign;
 
-	if (sw::unum::abs(lhs) < sw::unum::abs(rhs)) {
+	if (signs_are_different && r1 < r2) {
 		std::swap(r1, r2);
 		std::swap(r1_sign, r2_sign);
 	}
 
-	if (signs_are_different) r2 = twos_complement(r2);
-
-	if (_trace_sub) {
+	if (_trace_triple_add) {
 		std::cout << (r1_sign ? "sign -1" : "sign  1") << " scale " << std::setw(3) << scale_of_result << " r1       " << r1 << std::endl;
 		std::cout << (r2_sign ? "sign -1" : "sign  1") << " scale " << std::setw(3) << scale_of_result << " r2       " << r2 << std::endl;
 	}
 
-	bitblock<abits + 1> sum;
-	const bool carry = add_unsigned(r1, r2, sum);
+	blockbinary<abits + 2, bt> sum = (signs_are_different ? r1 - r2 : r1 + r2);
 
-	if (_trace_sub) std::cout << (r1_sign ? "sign -1" : "sign  1") << " carry " << std::setw(3) << (carry ? 1 : 0) << " sum     " << sum << std::endl;
+	if (_trace_triple_add) std::cout << (r1_sign ? "sign -1" : "sign  1") << " scale " << std::setw(3) << scale_of_result << " sum     " << sum << std::endl;
 
-	long shift = 0;
-	if (carry) {
-		if (r1_sign == r2_sign) {  // the carry && signs== implies that we have a number bigger than r1
-			shift = -1;
-		}
-		else {
-			// the carry && signs!= implies r2 is complement, result < r1, must find hidden bit (in the complement)
-			for (int i = abits - 1; i >= 0 && !sum[i]; i--) {
-				shift++;
-			}
-		}
-	}
-	assert(shift >= -1);
-
-	if (shift >= long(abits)) {            // we have actual 0                            
-		sum.reset();
-		result.set(false, 0, sum, true, false, false);
+	if (sum.iszero()) {   // we have actual 0: cancellation is exact, the sticky bit can only be set when the scales are far apart
+		result.setzero();
 		return;
 	}
 
-	scale_of_result -= shift;
-	const int hpos = abits - 1 - shift;         // position of the hidden bit 
-	sum <<= abits - hpos + 1;
-	if (_trace_sub) std::cout << (r1_sign ? "sign -1" : "sign  1") << " scale " << std::setw(3) << scale_of_result << " sum     " << sum << std::endl;
-	result.set(r1_sign, scale_of_result, sum, false, false, false);
+	// normalize: move the hidden bit out of the abits+1 fraction field
+	int hpos = sum.msb();
+	scale_of_result += hpos - int(fbits + 3);
+	sum <<= int(abits + 1) - hpos;
+	blockbinary<abits + 1, bt> result_fraction(sum);
+	if (_trace_triple_add) std::cout << (r1_sign ? "sign -1" : "sign  1") << " scale " << std::setw(3) << scale_of_result << " sum     " << result_fraction << std::endl;
+	result.set(r1_sign, scale_of_result, result_fraction, false, false, false);
 }
 
-// subtract module using SUBTRACTOR: CURRENTLY BROKEN FOR UNKNOWN REASON
+// subtract module: use ADDER
 template<size_t ebits, size_t fbits, size_t abits, typename bt>
-void module_subtract_BROKEN(const blocktriple<ebits,fbits,bt>& lhs, const blocktriple<ebits,fbits,bt>& rhs, blocktriple<ebits,abits + 1,bt>& result) {
-
-	if (lhs.isinf() || rhs.isinf()) {
-		result.setinf();
-		return;
-	}
-	int lhs_scale = lhs.scale(), rhs_scale = rhs.scale(), scale_of_result = std::max(lhs_scale, rhs_scale);
-
-	// align the fractions
-	bitblock<abits> r1 = lhs.template nshift<abits>(lhs_scale - scale_of_result + 3);
-	bitblock<abits> r2 = rhs.template nshift<abits>(rhs_scale - scale_of_result + 3);
-	bool r1_sign = lhs.sign(), r2_sign = rhs.sign();
-	//bool signs_are_equal = r1_sign == r2_sign;
-
-	if (r1_sign) r1 = twos_complement(r1);
-	if (r1_sign) r2 = twos_complement(r2);
-
-	if (_trace_sub) {
-		std::cout << (r1_sign ? "sign -1" : "sign  1") << " scale " << std::setw(3) << scale_of_result << " r1       " << r1 << std::endl;
-		std::cout << (r2_sign ? "sign -1" : "sign  1") << " scale " << std::setw(3) << scale_of_result << " r2       " << r2 << std::endl;
-	}
-
-	bitblock<abits + 1> difference;
-	const bool borrow = subtract_unsigned(r1, r2, difference);
-
-	if (_trace_sub) std::cout << (r1_sign ? "sign -1" : "sign  1") << " borrow" << std::setw(3) << (borrow ? 1 : 0) << " diff    " << difference << std::endl;
-
-	long shift = 0;
-	if (borrow) {   // we have a negative value result
-		difference = twos_complement(difference);
-	}
-	// find hidden bit
-	for (int i = abits - 1; i >= 0 && difference[i]; i--) {
-		shift++;
-	}
-	assert(shift >= -1);
-
-	if (shift >= long(abits)) {            // we have actual 0                            
-		difference.reset();
-		result.set(false, 0, difference, true, false, false);
-		return;
-	}
-
-	scale_of_result -= shift;
-	const int hpos = abits - 1 - shift;         // position of the hidden bit 
-	difference <<= abits - hpos + 1;
-	if (_trace_sub) std::cout << (borrow ? "sign -1" : "sign  1") << " scale " << std::setw(3) << scale_of_result << " result  " << difference << std::endl;
-	result.set(borrow, scale_of_result, difference, false, false, false);
+void module_subtract(const blocktriple<ebits,fbits,bt>& lhs, const blocktriple<ebits,fbits,bt>& rhs, blocktriple<ebits,abits + 1,bt>& result) {
+	if (_trace_triple_sub) std::cout << "lhs  " << components(lhs) << std::endl << "rhs  " << components(rhs) << std::endl;
+	module_add<ebits, fbits, abits, bt>(lhs, -rhs, result);
 }
 
 // multiply module
 template<size_t ebits, size_t fbits, size_t mbits, typename bt>
 void module_multiply(const blocktriple<ebits,fbits,bt>& lhs, const blocktriple<ebits,fbits,bt>& rhs, blocktriple<ebits,mbits,bt>& result) {
 	static constexpr size_t fhbits = fbits + 1;  // fraction + hidden bit
-	if (_trace_mul) std::cout << "lhs  " << components(lhs) << std::endl << "rhs  " << components(rhs) << std::endl;
+	static_assert(mbits <= 2 * fhbits + 1, "module_multiply: the result fraction is wider than the product");
+	if (_trace_triple_mul) std::cout << "lhs  " << components(lhs) << std::endl << "rhs  " << components(rhs) << std::endl;
 
+	bool new_sign = lhs.sign() ^ rhs.sign();
+	if (lhs.isnan() || rhs.isnan() || (lhs.isinf() && rhs.iszero()) || (lhs.iszero() && rhs.isinf())) {
+		result.setnan();
+		return;
+	}
 	if (lhs.isinf() || rhs.isinf()) {
-		result.setinf();
+		result.setinf(new_sign);
 		return;
 	}
 	if (lhs.iszero() || rhs.iszero()) {
-		result.setzero();
+		result.setzero(new_sign);
 		return;
 	}
 
-	bool new_sign = lhs.sign() ^ rhs.sign();
 	int new_scale = lhs.scale() + rhs.scale();
-	blockbinary<mbits,bt> result_fraction;
-
-	if (fbits > 0) {
-		// fractions are without hidden bit, get_fixed_point adds the hidden bit back in
-		bitblock<fhbits> r1 = lhs.get_fixed_point();
-		bitblock<fhbits> r2 = rhs.get_fixed_point();
-		multiply_unsigned(r1, r2, result_fraction);
-
-		if (_trace_mul) std::cout << "r1  " << r1 << std::endl << "r2  " << r2 << std::endl << "res " << result_fraction << std::endl;
-		// check if the radix point needs to shift
-		int shift = 2;
-		if (result_fraction.test(mbits - 1)) {
-			shift = 1;
-			if (_trace_mul) std::cout << " shift " << shift << std::endl;
-			new_scale += 1;
-		}
-		result_fraction <<= shift;    // shift hidden bit out	
+	// the product of the significands is in [1, 4): the hidden bit of the product is at 2*fbits or 2*fbits+1
+	blockbinary<2 * fhbits + 2, bt> product = urmul2(lhs.significand(), rhs.significand());
+	int hpos = product.msb();
+	new_scale += hpos - int(2 * fbits);
+	bool sticky = false;
+	int shift = int(mbits) - hpos;
+	if (shift >= 0) {
+		product <<= shift;    // shift hidden bit out of the mbits fraction field
 	}
-	else {   // posit<3,0>, <4,1>, <5,2>, <6,3>, <7,4> etc are pure sign and scale
-		// multiply the hidden bits together, i.e. 1*1: we know the answer a priori
+	else {
+		sticky = anyAfter(product, -shift - 1);
+		product >>= -shift;
 	}
-	if (_trace_mul) std::cout << "sign " << (new_sign ? "-1 " : " 1 ") << "scale " << new_scale << " fraction " << result_fraction << std::endl;
+	blockbinary<mbits, bt> result_fraction(product);
+	if (sticky) result_fraction.set(0);
+
+	if (_trace_triple_mul) std::cout << "sign " << (new_sign ? "-1 " : " 1 ") << "scale " << new_scale << " fraction " << result_fraction << std::endl;
 
 	result.set(new_sign, new_scale, result_fraction, false, false, false);
 }
@@ -870,45 +580,39 @@ void module_multiply(const blocktriple<ebits,fbits,bt>& lhs, const blocktriple<e
 template<size_t ebits, size_t fbits, size_t divbits, typename bt>
 void module_divide(const blocktriple<ebits,fbits,bt>& lhs, const blocktriple<ebits,fbits,bt>& rhs, blocktriple<ebits,divbits,bt>& result) {
 	static constexpr size_t fhbits = fbits + 1;  // fraction + hidden bit
-	if (_trace_div) std::cout << "lhs  " << components(lhs) << std::endl << "rhs  " << components(rhs) << std::endl;
+	static constexpr size_t qbits = fhbits + divbits + 3; // dividend scaled by 2^(divbits+1) and a leading 0
+	if (_trace_triple_div) std::cout << "lhs  " << components(lhs) << std::endl << "rhs  " << components(rhs) << std::endl;
 
-	if (lhs.isinf() || rhs.isinf()) {
-		result.setinf();
+	bool new_sign = lhs.sign() ^ rhs.sign();
+	if (lhs.isnan() || rhs.isnan() || (lhs.isinf() && rhs.isinf()) || (lhs.iszero() && rhs.iszero())) {
+		result.setnan();
 		return;
 	}
-	if (lhs.iszero() || rhs.iszero()) {
-		result.setzero();
+	if (lhs.isinf() || rhs.iszero()) {
+		result.setinf(new_sign);
+		return;
+	}
+	if (lhs.iszero() || rhs.isinf()) {
+		result.setzero(new_sign);
 		return;
 	}
 
-	bool new_sign = lhs.sign() ^ rhs.sign();
 	int new_scale = lhs.scale() - rhs.scale();
-	blockbinary<divbits,bt> result_fraction;
-
-	if (fbits > 0) {
-		// fractions are without hidden bit, get_fixed_point adds the hidden bit back in
-		bitblock<fhbits> r1 = lhs.get_fixed_point();
-		bitblock<fhbits> r2 = rhs.get_fixed_point();
-		divide_with_fraction(r1, r2, result_fraction);
-		if (_trace_div) std::cout << "r1     " << r1 << std::endl << "r2     " << r2 << std::endl << "result " << result_fraction << std::endl << "scale  " << new_scale << std::endl;
-		// check if the radix point needs to shift
-		// radix point is at divbits - fhbits
-		int msb = divbits - fhbits;
-		int shift = fhbits;
-		if (!result_fraction.test(msb)) {
-			msb--; shift++;
-			while (!result_fraction.test(msb)) { // search for the first 1
-				msb--; shift++;
-			}
-		}
-		result_fraction <<= shift;    // shift hidden bit out
-		new_scale -= (shift - fhbits);
-		if (_trace_div) std::cout << "shift  " << shift << std::endl << "result " << result_fraction << std::endl << "scale  " << new_scale << std::endl;;
-	}
-	else {   // posit<3,0>, <4,1>, <5,2>, <6,3>, <7,4> etc are pure sign and scale
-			 // no need to multiply the hidden bits together, i.e. 1*1: we know the answer a priori
-	}
-	if (_trace_div) std::cout << "sign " << (new_sign ? "-1 " : " 1 ") << "scale " << new_scale << " fraction " << result_fraction << std::endl;
+	// the quotient of the significands is in (1/2, 2): scaled by 2^(divbits+1) its hidden bit is at divbits or divbits+1
+	blockbinary<qbits, bt> dividend(lhs.significand()), divisor(rhs.significand());
+	dividend <<= int(divbits + 1);
+	quorem<qbits, bt> qr = longdivision(dividend, divisor);
+	int hpos = qr.quo.msb();
+	new_scale += hpos - int(divbits + 1);
+	bool sticky = !qr.rem.iszero();
+	if (hpos > int(divbits)) {
+		sticky = sticky || qr.quo.test(0);
+		qr.quo >>= 1;
+	}
+	blockbinary<divbits, bt> result_fraction(qr.quo);
+	if (sticky) result_fraction.set(0);
+
+	if (_trace_triple_div) std::cout << "sign " << (new_sign ? "-1 " : " 1 ") << "scale " << new_scale << " fraction " << result_fraction << std::endl;
 
 	result.set(new_sign, new_scale, result_fraction, false, false, false);
 }
@@ -0,0 +1,512 @@
+#pragma once
+// limb_arithmetic.hpp: multi-precision kernels on arrays of unsigned limbs, least significant limb first
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "../native/bit_functions.hpp"
+
+// LIMB_KARATSUBA_THRESHOLD is the operand length, in limbs, at which the multiply kernels
+// switch from schoolbook to Karatsuba. Below it the quadratic schoolbook loop is faster.
+#ifndef LIMB_KARATSUBA_THRESHOLD
+#define LIMB_KARATSUBA_THRESHOLD 32
+#endif
+
+namespace sw { namespace unum {
+
+// limb arithmetic: add and subtract with carry/borrow on a single block
+// blocks narrower than 64 bits are cast up to uint64_t, 64-bit blocks use a 128-bit accumulator when the compiler offers it
+template<typename BlockType>
+inline BlockType addcarry(BlockType a, BlockType b, BlockType& carry) {
+	constexpr size_t bitsInBlock = sizeof(BlockType) * 8;
+	if constexpr (bitsInBlock < 64) {
+		uint64_t s = uint64_t(a) + uint64_t(b) + uint64_t(carry);
+		carry = BlockType(s >> bitsInBlock);
+		return BlockType(s);
+	}
+	else {
+#if defined(__SIZEOF_INT128__)
+		__extension__ typedef unsigned __int128 uint128;
+		uint128 s = uint128(a) + b + carry;
+		carry = BlockType(s >> 64);
+		return BlockType(s);
+#else
+		BlockType s = a + b;
+		BlockType c = (s < a) ? 1 : 0;
+		s += carry;
+		carry = c | ((s < carry) ? 1 : 0);
+		return s;
+#endif
+	}
+}
+template<typename BlockType>
+inline BlockType subborrow(BlockType a, BlockType b, BlockType& borrow) {
+	constexpr size_t bitsInBlock = sizeof(BlockType) * 8;
+	if constexpr (bitsInBlock < 64) {
+		uint64_t d = uint64_t(a) - uint64_t(b) - uint64_t(borrow);
+		borrow = BlockType((d >> bitsInBlock) & 0x1);
+		return BlockType(d);
+	}
+	else {
+		BlockType d = a - b;
+		BlockType c = (a < b) ? 1 : 0;
+		BlockType r = d - borrow;
+		borrow = c | ((d < borrow) ? 1 : 0);
+		return r;
+	}
+}
+// multiply-accumulate on a single block: returns the low half of a * b + c + carry, the high half goes to carry
+// the sum cannot overflow the double-width product: (2^w - 1)^2 + 2 * (2^w - 1) = 2^2w - 1
+template<typename BlockType>
+inline BlockType muladdcarry(BlockType a, BlockType b, BlockType c, BlockType& carry) {
+	constexpr size_t bitsInBlock = sizeof(BlockType) * 8;
+	if constexpr (bitsInBlock < 64) {
+		uint64_t p = uint64_t(a) * uint64_t(b) + uint64_t(c) + uint64_t(carry);
+		carry = BlockType(p >> bitsInBlock);
+		return BlockType(p);
+	}
+	else {
+#if defined(__SIZEOF_INT128__)
+		__extension__ typedef unsigned __int128 uint128;
+		uint128 p = uint128(a) * b + c + carry;
+		carry = BlockType(p >> 64);
+		return BlockType(p);
+#else
+		// four 32x32 partial products
+		uint64_t al = a & 0xFFFFFFFFull, ah = a >> 32, bl = b & 0xFFFFFFFFull, bh = b >> 32;
+		uint64_t ll = al * bl, lh = al * bh, hl = ah * bl, hh = ah * bh;
+		uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFFull) + (hl & 0xFFFFFFFFull);
+		uint64_t lo = (ll & 0xFFFFFFFFull) | (mid << 32);
+		uint64_t hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+		lo += c;     hi += (lo < c) ? 1 : 0;
+		lo += carry; hi += (lo < carry) ? 1 : 0;
+		carry = hi;
+		return lo;
+#endif
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// limb vector kernels
+// operands are unsigned magnitudes stored in arrays of n limbs, least significant limb first
+
+// r[0..n) = a[0..n) + b[0..n), returns the carry out
+template<typename BlockType>
+inline BlockType limb_add(BlockType* r, const BlockType* a, const BlockType* b, size_t n) {
+	BlockType carry = 0;
+	for (size_t i = 0; i < n; ++i) r[i] = addcarry(a[i], b[i], carry);
+	return carry;
+}
+// r[0..n) -= a[0..na) with na <= n, the borrow ripples to the end of r, returns the borrow out
+template<typename BlockType>
+inline BlockType limb_sub_inplace(BlockType* r, size_t n, const BlockType* a, size_t na) {
+	BlockType borrow = 0;
+	size_t i = 0;
+	for (; i < na; ++i) r[i] = subborrow(r[i], a[i], borrow);
+	for (; borrow && i < n; ++i) r[i] = subborrow(r[i], BlockType(0), borrow);
+	return borrow;
+}
+// r[0..n) += a[0..na) with na <= n, the carry ripples to the end of r, returns the carry out
+template<typename BlockType>
+inline BlockType limb_add_inplace(BlockType* r, size_t n, const BlockType* a, size_t na) {
+	BlockType carry = 0;
+	size_t i = 0;
+	for (; i < na; ++i) r[i] = addcarry(r[i], a[i], carry);
+	for (; carry && i < n; ++i) r[i] = addcarry(r[i], BlockType(0), carry);
+	return carry;
+}
+
+// schoolbook multiply: r[0..na+nb) = a[0..na) * b[0..nb), r may not alias a or b
+template<typename BlockType>
+inline void limb_mul_schoolbook(BlockType* r, const BlockType* a, size_t na, const BlockType* b, size_t nb) {
+	for (size_t i = 0; i < na + nb; ++i) r[i] = 0;
+	for (size_t i = 0; i < na; ++i) {
+		BlockType ai = a[i];
+		if (ai == 0) continue;
+		BlockType carry = 0;
+		for (size_t j = 0; j < nb; ++j) r[i + j] = muladdcarry(ai, b[j], r[i + j], carry);
+		r[i + nb] = carry;
+	}
+}
+// truncated schoolbook multiply: r[0..n) = a[0..n) * b[0..n) modulo 2^(n * bitsInBlock)
+// only the partial products that land in the lower n limbs are computed
+template<typename BlockType>
+inline void limb_mul_low_schoolbook(BlockType* r, const BlockType* a, const BlockType* b, size_t n) {
+	for (size_t i = 0; i < n; ++i) r[i] = 0;
+	for (size_t i = 0; i < n; ++i) {
+		BlockType ai = a[i];
+		if (ai == 0) continue;
+		BlockType carry = 0;
+		for (size_t j = 0; i + j < n; ++j) r[i + j] = muladdcarry(ai, b[j], r[i + j], carry);
+	}
+}
+
+// the Karatsuba recursion needs at least 4 limbs to make progress: h + 1 < n
+constexpr size_t limb_karatsuba_threshold = (LIMB_KARATSUBA_THRESHOLD < 4 ? 4 : LIMB_KARATSUBA_THRESHOLD);
+
+// scratch limbs consumed by limb_mul_karatsuba for n-limb operands
+inline size_t limb_karatsuba_scratch(size_t n) {
+	size_t s = 0;
+	while (n >= limb_karatsuba_threshold) {
+		size_t h = n - n / 2 + 1;  // length of the half sums
+		s += 4 * h;
+		n = h;
+	}
+	return s;
+}
+// scratch limbs consumed by limb_mul_low_karatsuba for n-limb operands
+inline size_t limb_karatsuba_low_scratch(size_t n) {
+	if (n < limb_karatsuba_threshold) return 0;
+	size_t m = n - n / 2, h = n / 2;
+	size_t full = limb_karatsuba_scratch(m), low = limb_karatsuba_low_scratch(h);
+	return 2 * m + h + (full > low ? full : low);
+}
+
+// Karatsuba: r[0..2n) = a[0..n) * b[0..n), ws points to limb_karatsuba_scratch(n) limbs
+// with a = a1 * B^m + a0, b = b1 * B^m + b0, the middle product is (a0 + a1)(b0 + b1) - a0 b0 - a1 b1
+template<typename BlockType>
+void limb_mul_karatsuba(BlockType* r, const BlockType* a, const BlockType* b, size_t n, BlockType* ws) {
+	if (n < limb_karatsuba_threshold) {
+		limb_mul_schoolbook(r, a, n, b, n);
+		return;
+	}
+	size_t m = n / 2;      // length of the low halves
+	size_t h = n - m;      // length of the high halves, h >= m
+	BlockType* sa = ws;             // h + 1 limbs
+	BlockType* sb = sa + (h + 1);   // h + 1 limbs
+	BlockType* z1 = sb + (h + 1);   // 2h + 2 limbs
+	BlockType* next = z1 + 2 * (h + 1);
+
+	// z0 = a0 * b0 in r[0..2m), z2 = a1 * b1 in r[2m..2n)
+	limb_mul_karatsuba(r, a, b, m, next);
+	limb_mul_karatsuba(r + 2 * m, a + m, b + m, h, next);
+
+	// half sums, the high halves are at least as long as the low halves
+	for (size_t i = 0; i < h; ++i) { sa[i] = a[m + i]; sb[i] = b[m + i]; }
+	sa[h] = limb_add_inplace(sa, h, a, m);
+	sb[h] = limb_add_inplace(sb, h, b, m);
+	limb_mul_karatsuba(z1, sa, sb, h + 1, next);
+
+	// z1 = (a0 + a1)(b0 + b1) - z0 - z2 is non-negative
+	limb_sub_inplace(z1, 2 * h + 2, r, 2 * m);
+	limb_sub_inplace(z1, 2 * h + 2, r + 2 * m, 2 * h);
+	// the middle product fits in 2h + 1 limbs, accumulate it at limb offset m
+	size_t len = 2 * h + 2;
+	while (len > 0 && z1[len - 1] == 0) --len;
+	limb_add_inplace(r + m, 2 * n - m, z1, len);
+}
+
+// truncated Karatsuba: r[0..n) = a[0..n) * b[0..n) modulo B^n, ws points to limb_karatsuba_low_scratch(n) limbs
+// the low halves are multiplied in full, the cross terms only need their lower h limbs
+template<typename BlockType>
+void limb_mul_low_karatsuba(BlockType* r, const BlockType* a, const BlockType* b, size_t n, BlockType* ws) {
+	if (n < limb_karatsuba_threshold) {
+		limb_mul_low_schoolbook(r, a, b, n);
+		return;
+	}
+	size_t m = n - n / 2;  // length of the low halves
+	size_t h = n / 2;      // length of the high halves, h <= m
+	BlockType* z0 = ws;          // 2m limbs
+	BlockType* t = z0 + 2 * m;   // h limbs
+	BlockType* next = t + h;
+
+	limb_mul_karatsuba(z0, a, b, m, next);
+	for (size_t i = 0; i < n; ++i) r[i] = z0[i];
+	limb_mul_low_karatsuba(t, a, b + m, h, next);
+	limb_add_inplace(r + m, h, t, h);
+	limb_mul_low_karatsuba(t, a + m, b, h, next);
+	limb_add_inplace(r + m, h, t, h);
+}
+
+// full product: r[0..na+nb) = a[0..na) * b[0..nb), r may not alias a or b
+// operands shorter than LIMB_KARATSUBA_THRESHOLD limbs use the schoolbook kernel,
+// longer operands are cut into balanced chunks that are multiplied with Karatsuba
+template<typename BlockType>
+void limb_multiply(BlockType* r, const BlockType* a, size_t na, const BlockType* b, size_t nb) {
+	if (na < nb) { const BlockType* t = a; a = b; b = t; size_t s = na; na = nb; nb = s; }
+	if (nb < limb_karatsuba_threshold) {
+		limb_mul_schoolbook(r, a, na, b, nb);
+		return;
+	}
+	std::vector<BlockType> ws(limb_karatsuba_scratch(nb) + 2 * nb);
+	BlockType* chunk = ws.data();
+	BlockType* scratch = chunk + 2 * nb;
+	for (size_t i = 0; i < na + nb; ++i) r[i] = 0;
+	for (size_t offset = 0; offset < na; offset += nb) {
+		size_t len = (na - offset < nb) ? (na - offset) : nb;
+		if (len == nb) {
+			limb_mul_karatsuba(chunk, a + offset, b, nb, scratch);
+		}
+		else {
+			limb_mul_schoolbook(chunk, b, nb, a + offset, len);
+		}
+		limb_add_inplace(r + offset, na + nb - offset, chunk, len + nb);
+	}
+}
+
+// truncated product: r[0..n) = a[0..n) * b[0..n) modulo 2^(n * bitsInBlock), r may not alias a or b
+// this is the 2's complement product of n-limb numbers, and the modular multiply of fixed-size integers
+template<typename BlockType>
+void limb_multiply_low(BlockType* r, const BlockType* a, const BlockType* b, size_t n) {
+	if (n < limb_karatsuba_threshold) {
+		limb_mul_low_schoolbook(r, a, b, n);
+		return;
+	}
+	std::vector<BlockType> ws(limb_karatsuba_low_scratch(n));
+	limb_mul_low_karatsuba(r, a, b, n, ws.data());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// limb division
+
+// number of leading zero bits of a limb
+template<typename BlockType>
+inline int limb_clz(BlockType x) {
+	return countLeadingZeros(uint64_t(x)) - int(64 - sizeof(BlockType) * 8);
+}
+
+// number of trailing zero bits of a limb
+template<typename BlockType>
+inline int limb_ctz(BlockType x) {
+	return (x == 0 ? int(sizeof(BlockType) * 8) : countTrailingZeros(uint64_t(x)));
+}
+
+// number of significant limbs of a[0..n): leading zero limbs are stripped
+template<typename BlockType>
+inline size_t limb_significant(const BlockType* a, size_t n) {
+	while (n > 0 && a[n - 1] == 0) --n;
+	return n;
+}
+
+// divide the double-width value (hi, lo) by d, precondition hi < d so that the quotient fits in a limb
+template<typename BlockType>
+inline BlockType divwide(BlockType hi, BlockType lo, BlockType d, BlockType& remainder) {
+	constexpr size_t bitsInBlock = sizeof(BlockType) * 8;
+	if constexpr (bitsInBlock < 64) {
+		uint64_t n = (uint64_t(hi) << bitsInBlock) | uint64_t(lo);
+		remainder = BlockType(n % d);
+		return BlockType(n / d);
+	}
+	else {
+#if defined(__SIZEOF_INT128__)
+		__extension__ typedef unsigned __int128 uint128;
+		uint128 n = (uint128(hi) << 64) | lo;
+		remainder = BlockType(n % d);
+		return BlockType(n / d);
+#else
+		// Knuth D on 32-bit digits, the divisor is normalized to bring its most significant bit into position
+		const uint64_t b = 0x100000000ull;
+		int s = countLeadingZeros(d);
+		uint64_t v = uint64_t(d) << s;
+		uint64_t vn1 = v >> 32, vn0 = v & 0xFFFFFFFFull;
+		uint64_t un32 = (uint64_t(hi) << s) | (s == 0 ? 0 : uint64_t(lo) >> (64 - s));
+		uint64_t un10 = uint64_t(lo) << s;
+		uint64_t un1 = un10 >> 32, un0 = un10 & 0xFFFFFFFFull;
+		uint64_t q1 = un32 / vn1, rhat = un32 - q1 * vn1;
+		while (q1 >= b || q1 * vn0 > b * rhat + un1) {
+			--q1; rhat += vn1;
+			if (rhat >= b) break;
+		}
+		uint64_t un21 = un32 * b + un1 - q1 * v;
+		uint64_t q0 = un21 / vn1;
+		rhat = un21 - q0 * vn1;
+		while (q0 >= b || q0 * vn0 > b * rhat + un0) {
+			--q0; rhat += vn1;
+			if (rhat >= b) break;
+		}
+		remainder = BlockType((un21 * b + un0 - q0 * v) >> s);
+		return BlockType(q1 * b + q0);
+#endif
+	}
+}
+
+// single-limb divisor: q[0..n) = a[0..n) / d, returns the remainder
+template<typename BlockType>
+inline BlockType limb_divmod_single(BlockType* q, const BlockType* a, size_t n, BlockType d) {
+	BlockType r = 0;
+	for (size_t i = n; i > 0; --i) q[i - 1] = divwide(r, a[i - 1], d, r);
+	return r;
+}
+
+// Knuth algorithm D: q[0..m-n+1) = u[0..m) / v[0..n), r[0..n) = u mod v
+// preconditions: m >= n >= 1, v[n-1] != 0, ws points to m + n + 1 limbs of scratch
+// the divisor is normalized so that its most significant bit is set, which bounds the error
+// of the quotient digit estimate from the top two dividend limbs to at most two
+template<typename BlockType>
+void limb_divmod(BlockType* q, BlockType* r, const BlockType* u, size_t m, const BlockType* v, size_t n, BlockType* ws) {
+	constexpr size_t bitsInBlock = sizeof(BlockType) * 8;
+	constexpr BlockType ALL_ONES = BlockType(~BlockType(0));
+	if (n == 1) {
+		r[0] = limb_divmod_single(q, u, m, v[0]);
+		return;
+	}
+	BlockType* un = ws;         // m + 1 limbs
+	BlockType* vn = ws + m + 1; // n limbs
+	int s = limb_clz(v[n - 1]);
+	if (s == 0) {
+		for (size_t i = 0; i < n; ++i) vn[i] = v[i];
+		for (size_t i = 0; i < m; ++i) un[i] = u[i];
+		un[m] = 0;
+	}
+	else {
+		for (size_t i = n - 1; i > 0; --i) vn[i] = BlockType((v[i] << s) | (v[i - 1] >> (bitsInBlock - s)));
+		vn[0] = BlockType(v[0] << s);
+		un[m] = BlockType(u[m - 1] >> (bitsInBlock - s));
+		for (size_t i = m - 1; i > 0; --i) un[i] = BlockType((u[i] << s) | (u[i - 1] >> (bitsInBlock - s)));
+		un[0] = BlockType(u[0] << s);
+	}
+
+	for (size_t j = m - n + 1; j > 0; --j) {
+		size_t k = j - 1;
+		// estimate the quotient digit from the top two limbs of the running remainder
+		BlockType qhat, rhat;
+		bool rhatOverflow = false;
+		if (un[k + n] >= vn[n - 1]) {
+			qhat = ALL_ONES;
+			rhat = BlockType(un[k + n - 1] + vn[n - 1]);
+			rhatOverflow = (rhat < vn[n - 1]);
+		}
+		else {
+			qhat = divwide(un[k + n], un[k + n - 1], vn[n - 1], rhat);
+		}
+		// refine with the third limb: qhat * vn[n-2] > rhat * B + un[k+n-2] means qhat is too large
+		while (!rhatOverflow) {
+			BlockType phi = 0;
+			BlockType plo = muladdcarry(qhat, vn[n - 2], BlockType(0), phi);
+			if (phi < rhat || (phi == rhat && plo <= un[k + n - 2])) break;
+			--qhat;
+			rhat = BlockType(rhat + vn[n - 1]);
+			rhatOverflow = (rhat < vn[n - 1]);
+		}
+		// multiply and subtract
+		BlockType borrow = 0, carry = 0;
+		for (size_t i = 0; i < n; ++i) {
+			BlockType p = muladdcarry(qhat, vn[i], BlockType(0), carry);
+			un[i + k] = subborrow(un[i + k], p, borrow);
+		}
+		un[k + n] = subborrow(un[k + n], carry, borrow);
+		if (borrow) {
+			// the estimate was one too large: add the divisor back
+			--qhat;
+			BlockType c = 0;
+			for (size_t i = 0; i < n; ++i) un[i + k] = addcarry(un[i + k], vn[i], c);
+			un[k + n] = BlockType(un[k + n] + c);
+		}
+		q[k] = qhat;
+	}
+	// unnormalize the remainder
+	if (s == 0) {
+		for (size_t i = 0; i < n; ++i) r[i] = un[i];
+	}
+	else {
+		for (size_t i = 0; i + 1 < n; ++i) r[i] = BlockType((un[i] >> s) | (un[i + 1] << (bitsInBlock - s)));
+		r[n - 1] = BlockType(un[n - 1] >> s);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// limb gcd
+
+// compare a[0..n) and b[0..n): returns -1, 0, or 1
+template<typename BlockType>
+inline int limb_compare(const BlockType* a, const BlockType* b, size_t n) {
+	for (size_t i = n; i > 0; --i) {
+		if (a[i - 1] != b[i - 1]) return (a[i - 1] < b[i - 1]) ? -1 : 1;
+	}
+	return 0;
+}
+
+// number of significant bits of a[0..n)
+template<typename BlockType>
+inline size_t limb_bitlength(const BlockType* a, size_t n) {
+	n = limb_significant(a, n);
+	return (n == 0) ? 0 : n * sizeof(BlockType) * 8 - size_t(limb_clz(a[n - 1]));
+}
+
+// the 64 bits of a[0..n) that start at bit position k, bits beyond the end read as zero
+template<typename BlockType>
+inline uint64_t limb_extract64(const BlockType* a, size_t n, size_t k) {
+	constexpr size_t bitsInBlock = sizeof(BlockType) * 8;
+	uint64_t bits = 0;
+	size_t i = k / bitsInBlock, s = k % bitsInBlock;
+	for (size_t filled = 0; filled < 64 + s && i < n; filled += bitsInBlock, ++i) {
+		uint64_t limb = uint64_t(a[i]);
+		if (filled >= s) bits |= limb << (filled - s);
+		else bits |= limb >> (s - filled);
+	}
+	return bits;
+}
+
+// r[0..n) = x * a[0..n) - y * b[0..n) for single-limb cofactors, the caller guarantees the difference is in [0, B^n)
+template<typename BlockType>
+inline void limb_lincomb(BlockType* r, BlockType x, const BlockType* a, BlockType y, const BlockType* b, size_t n) {
+	BlockType carryX = 0, carryY = 0, borrow = 0;
+	for (size_t i = 0; i < n; ++i) {
+		BlockType p = muladdcarry(x, a[i], BlockType(0), carryX);
+		BlockType q = muladdcarry(y, b[i], BlockType(0), carryY);
+		r[i] = subborrow(p, q, borrow);
+	}
+}
+
+// Lehmer gcd of a[0..n) and b[0..n): the gcd is returned in a, b is clobbered
+// The leading 32 bits of the operands simulate a run of Euclid steps in native arithmetic, collecting the
+// quotients into the cofactor matrix (A B; C D), which is then applied to the full operands in a single pass.
+// The cofactors are bounded by 2^32, so the blocks must be at least 32 bits wide to hold them.
+template<typename BlockType>
+void limb_gcd_lehmer(BlockType* a, BlockType* b, size_t n) {
+	static_assert(sizeof(BlockType) >= 4, "limb_gcd_lehmer requires blocks of at least 32 bits");
+	if (limb_compare(a, b, n) < 0) {
+		for (size_t i = 0; i < n; ++i) std::swap(a[i], b[i]);
+	}
+	std::vector<BlockType> q(n), t(n), u(n), ws(2 * n + 1);
+	while (limb_bitlength(b, n) > 64) {
+		size_t na = limb_significant(a, n), nb = limb_significant(b, n);
+		size_t k = limb_bitlength(a, n) - 32;
+		int64_t x = int64_t(limb_extract64(a, na, k) & 0xFFFFFFFFull);
+		int64_t y = int64_t(limb_extract64(b, nb, k) & 0xFFFFFFFFull);
+		int64_t A = 1, B = 0, C = 0, D = 1;
+		for (;;) {
+			int64_t yc = y + C, yd = y + D;
+			if (yc <= 0 || yd <= 0) break;
+			int64_t q1 = (x + A) / yc, q2 = (x + B) / yd;
+			if (q1 != q2) break;
+			int64_t T;
+			T = A - q1 * C; A = C; C = T;
+			T = B - q1 * D; B = D; D = T;
+			T = x - q1 * y; x = y; y = T;
+		}
+		if (B == 0) {
+			// the leading bits did not determine a quotient: take a full Euclid step
+			for (size_t i = 0; i < n; ++i) t[i] = 0;
+			limb_divmod(q.data(), t.data(), a, na, b, nb, ws.data());
+			for (size_t i = 0; i < n; ++i) { a[i] = b[i]; b[i] = t[i]; }
+		}
+		else {
+			// the cofactors of each row have opposite signs, or one of them is zero
+			if (B <= 0) limb_lincomb(t.data(), BlockType(A), a, BlockType(-B), b, n);
+			else        limb_lincomb(t.data(), BlockType(B), b, BlockType(-A), a, n);
+			if (D <= 0) limb_lincomb(u.data(), BlockType(C), a, BlockType(-D), b, n);
+			else        limb_lincomb(u.data(), BlockType(D), b, BlockType(-C), a, n);
+			for (size_t i = 0; i < n; ++i) { a[i] = t[i]; b[i] = u[i]; }
+		}
+	}
+	// b fits in 64 bits: reduce a once, and finish in native arithmetic
+	size_t nb = limb_significant(b, n);
+	if (nb == 0) return;
+	for (size_t i = 0; i < n; ++i) t[i] = 0;
+	limb_divmod(q.data(), t.data(), a, limb_significant(a, n), b, nb, ws.data());
+	uint64_t x = limb_extract64(b, n, 0), y = limb_extract64(t.data(), n, 0);
+	while (y != 0) {
+		uint64_t r = x % y;
+		x = y;
+		y = r;
+	}
+	for (size_t i = 0; i < n; ++i) a[i] = 0;
+	for (size_t i = 0; i < n && i * sizeof(BlockType) * 8 < 64; ++i) a[i] = BlockType(x >> (i * sizeof(BlockType) * 8));
+}
+
+}} // namespace sw::unum
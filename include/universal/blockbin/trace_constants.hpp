@@ -8,23 +8,24 @@
 namespace sw {
 namespace unum {
 
+// the blocktriple trace constants carry their own prefix so that they coexist with the posit trace constants
 
 # ifndef BLOCKTRIPLE_VERBOSE_OUTPUT
 // blocktriple decode and conversion
-constexpr bool _trace_decode      = false;
-constexpr bool _trace_conversion  = false;
-constexpr bool _trace_rounding    = false;
+constexpr bool _trace_triple_decode      = false;
+constexpr bool _trace_triple_conversion  = false;
+constexpr bool _trace_triple_rounding    = false;
 
 // arithmetic operator tracing
-constexpr bool _trace_add         = false;
-constexpr bool _trace_sub         = false;
-constexpr bool _trace_mul         = false;
-constexpr bool _trace_div         = false;
-constexpr bool _trace_reciprocate = false;
-constexpr bool _trace_sqrt        = false;
+constexpr bool _trace_triple_add         = false;
+constexpr bool _trace_triple_sub         = false;
+constexpr bool _trace_triple_mul         = false;
+constexpr bool _trace_triple_div         = false;
+constexpr bool _trace_triple_reciprocate = false;
+constexpr bool _trace_triple_sqrt        = false;
 
 // quire update tracing
-constexpr bool _trace_quire_add   = false;
+constexpr bool _trace_triple_quire_add   = false;
 
 # else // !BLOCKTRIPLE_VERBOSE_OUTPUT
 
@@ -47,65 +48,65 @@ constexpr bool _trace_quire_add   = false;
 // blocktriple decode and conversion
 
 #ifndef BLOCKTRIPLE_TRACE_DECODE
-constexpr bool _trace_decode = false;
+constexpr bool _trace_triple_decode = false;
 #else
-constexpr bool _trace_decode = true;
+constexpr bool _trace_triple_decode = true;
 #endif
 
 #ifndef BLOCKTRIPLE_TRACE_CONVERSION
-constexpr bool _trace_conversion = false;
+constexpr bool _trace_triple_conversion = false;
 #else
-constexpr bool _trace_conversion = true;
+constexpr bool _trace_triple_conversion = true;
 #endif
 
 #ifndef BLOCKTRIPLE_TRACE_ROUNDING
-constexpr bool _trace_rounding = false;
+constexpr bool _trace_triple_rounding = false;
 #else
-constexpr bool _trace_rounding = true;
+constexpr bool _trace_triple_rounding = true;
 #endif
 
 // arithmetic operator tracing
 #ifndef BLOCKTRIPLE_TRACE_ADD
-constexpr bool _trace_add = false;
+constexpr bool _trace_triple_add = false;
 #else
-constexpr bool _trace_add = true;
+constexpr bool _trace_triple_add = true;
 #endif
 
 #ifndef BLOCKTRIPLE_TRACE_SUB
-constexpr bool _trace_sub = false;
+constexpr bool _trace_triple_sub = false;
 #else
-constexpr bool _trace_sub = true;
+constexpr bool _trace_triple_sub = true;
 #endif
 
 #ifndef BLOCKTRIPLE_TRACE_MUL
-constexpr bool _trace_mul = false;
+constexpr bool _trace_triple_mul = false;
 #else
-constexpr bool _trace_mul = true;
+constexpr bool _trace_triple_mul = true;
 #endif
 
 #ifndef BLOCKTRIPLE_TRACE_DIV
-constexpr bool _trace_div = false;
+constexpr bool _trace_triple_div = false;
 #else
-constexpr bool _trace_div = true;
+constexpr bool _trace_triple_div = true;
 #endif
 
 #ifndef BLOCKTRIPLE_TRACE_RECIPROCATE
-constexpr bool _trace_reciprocate = false;
+constexpr bool _trace_triple_reciprocate = false;
 #else
-constexpr bool _trace_reciprocate = true;
+constexpr bool _trace_triple_reciprocate = true;
 #endif
 
 #ifndef BLOCKTRIPLE_TRACE_SQRT
-constexpr bool _trace_sqrt = false;
+constexpr bool _trace_triple_sqrt = false;
 #else
-constexpr bool _trace_sqrt = true;
+constexpr bool _trace_triple_sqrt = true;
 #endif
 
 // QUIRE tracing
 #ifndef QUIRE_TRACE_ADD
-constexpr bool _trace_quire_add = false;
+constexpr bool _trace_triple_quire_add = false;
 #else
-constexpr bool _trace_quire_add = true;
+constexpr bool _trace_triple_quire_add = true;
 #endif
 
 # endif
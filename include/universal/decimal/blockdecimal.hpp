@@ -0,0 +1,506 @@
+#pragma once
+// blockdecimal.hpp: definition of a fixed-size decimal integer with inline base-10^9 limb storage
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cmath>
+#include <string>
+#include <sstream>
+#include <iostream>
+
+#include "./decimal.hpp"
+
+namespace sw { namespace unum {
+
+// forward references
+template<size_t ndigits> class blockdecimal;
+template<size_t ndigits> struct blockdecimaldiv;
+template<size_t ndigits> blockdecimaldiv<ndigits> blockdecimal_divide(const blockdecimal<ndigits>&, const blockdecimal<ndigits>&);
+
+// quotient and remainder of a blockdecimal long division
+template<size_t ndigits>
+struct blockdecimaldiv {
+	blockdecimal<ndigits> quot; // quotient
+	blockdecimal<ndigits> rem;  // remainder
+};
+
+// blockdecimal<ndigits> is a sign-magnitude decimal integer with a capacity of ndigits decimal digits.
+// The magnitude is stored inline in base-10^9 limbs, so no arithmetic operation touches the allocator.
+// Like integer<nbits>, results that exceed the capacity wrap: the magnitude is taken modulo 10^ndigits.
+template<size_t _ndigits>
+class blockdecimal {
+public:
+	static_assert(_ndigits > 0, "blockdecimal requires at least one digit");
+	static constexpr size_t ndigits = _ndigits;
+	static constexpr size_t nrLimbs = (ndigits + DECIMAL_LIMB_DIGITS - 1) / DECIMAL_LIMB_DIGITS;
+	static constexpr unsigned msuDigits = unsigned(ndigits - DECIMAL_LIMB_DIGITS * (nrLimbs - 1)); // digits in the most significant limb
+
+	blockdecimal() : negative{ false }, _block{ 0 } {}
+
+	blockdecimal(const blockdecimal&) = default;
+	blockdecimal(blockdecimal&&) = default;
+
+	blockdecimal& operator=(const blockdecimal&) = default;
+	blockdecimal& operator=(blockdecimal&&) = default;
+
+	// conversion from and to the dynamic decimal
+	blockdecimal(const decimal& d) { *this = d; }
+	blockdecimal& operator=(const decimal& d) {
+		declimbs limbs;
+		to_limbs(d, limbs);
+		clear();
+		for (size_t i = 0; i < nrLimbs && i < limbs.size(); ++i) _block[i] = limbs[i];
+		truncate();
+		setsign(d.sign());
+		return *this;
+	}
+	explicit operator decimal() const {
+		decimal d;
+		from_limbs(_block, nrLimbs, d);
+		if (!d.iszero()) d.setsign(negative);
+		return d;
+	}
+
+	// initializers for native types
+	blockdecimal(char initial_value) { *this = (long long)initial_value; }
+	blockdecimal(short initial_value) { *this = (long long)initial_value; }
+	blockdecimal(int initial_value) { *this = (long long)initial_value; }
+	blockdecimal(long initial_value) { *this = (long long)initial_value; }
+	blockdecimal(long long initial_value) { *this = initial_value; }
+	blockdecimal(unsigned char initial_value) { *this = (unsigned long long)initial_value; }
+	blockdecimal(unsigned short initial_value) { *this = (unsigned long long)initial_value; }
+	blockdecimal(unsigned int initial_value) { *this = (unsigned long long)initial_value; }
+	blockdecimal(unsigned long initial_value) { *this = (unsigned long long)initial_value; }
+	blockdecimal(unsigned long long initial_value) { *this = initial_value; }
+	blockdecimal(float initial_value) { *this = (long double)initial_value; }
+	blockdecimal(double initial_value) { *this = (long double)initial_value; }
+	blockdecimal(long double initial_value) { *this = initial_value; }
+
+	// assignment operators for native types
+	blockdecimal& operator=(const std::string& digits) {
+		parse(digits);
+		return *this;
+	}
+	blockdecimal& operator=(char rhs) { return *this = (long long)rhs; }
+	blockdecimal& operator=(short rhs) { return *this = (long long)rhs; }
+	blockdecimal& operator=(int rhs) { return *this = (long long)rhs; }
+	blockdecimal& operator=(long rhs) { return *this = (long long)rhs; }
+	blockdecimal& operator=(long long rhs) {
+		// negate in the unsigned domain so that the most negative value is representable
+		unsigned long long magnitude = (rhs < 0) ? (0ull - (unsigned long long)rhs) : (unsigned long long)rhs;
+		*this = magnitude;
+		setsign(rhs < 0);
+		return *this;
+	}
+	blockdecimal& operator=(unsigned char rhs) { return *this = (unsigned long long)rhs; }
+	blockdecimal& operator=(unsigned short rhs) { return *this = (unsigned long long)rhs; }
+	blockdecimal& operator=(unsigned int rhs) { return *this = (unsigned long long)rhs; }
+	blockdecimal& operator=(unsigned long rhs) { return *this = (unsigned long long)rhs; }
+	blockdecimal& operator=(unsigned long long rhs) {
+		clear();
+		for (size_t i = 0; i < nrLimbs && rhs != 0; ++i) {
+			_block[i] = uint32_t(rhs % DECIMAL_LIMB_BASE);
+			rhs /= DECIMAL_LIMB_BASE;
+		}
+		truncate();
+		return *this;
+	}
+	blockdecimal& operator=(float rhs) { return *this = (long double)rhs; }
+	blockdecimal& operator=(double rhs) { return *this = (long double)rhs; }
+	blockdecimal& operator=(long double rhs) {
+		// the integer part of the value, truncated towards zero
+		clear();
+		bool sign = (rhs < 0);
+		long double v = std::trunc(sign ? -rhs : rhs);
+		for (size_t i = 0; i < nrLimbs && v >= 1.0l; ++i) {
+			long double q = std::floor(v / DECIMAL_LIMB_BASE);
+			_block[i] = uint32_t(v - q * DECIMAL_LIMB_BASE);
+			v = q;
+		}
+		truncate();
+		setsign(sign);
+		return *this;
+	}
+
+	// arithmetic operators
+	blockdecimal& operator+=(const blockdecimal& rhs) {
+		if (negative != rhs.negative) return subtract_magnitude(rhs, rhs.negative);
+		declimb_add_inplace(_block, nrLimbs, rhs._block, nrLimbs);
+		truncate();
+		return *this;
+	}
+	blockdecimal& operator-=(const blockdecimal& rhs) {
+		if (negative != rhs.negative) {
+			declimb_add_inplace(_block, nrLimbs, rhs._block, nrLimbs);
+			truncate();
+			return *this;
+		}
+		return subtract_magnitude(rhs, !rhs.negative);
+	}
+	blockdecimal& operator*=(const blockdecimal& rhs) {
+		bool signOfFinalResult = (negative != rhs.negative);
+		size_t na = declimb_significant(_block, nrLimbs);
+		size_t nb = declimb_significant(rhs._block, nrLimbs);
+		if (na == 0 || nb == 0) {
+			setzero();
+			return *this;
+		}
+		// the comba kernel needs no scratch, so the product lives on the stack
+		uint32_t product[2 * nrLimbs];
+		declimb_mul_comba(product, _block, na, rhs._block, nb);
+		for (size_t i = 0; i < nrLimbs; ++i) _block[i] = (i < na + nb) ? product[i] : 0;
+		truncate();
+		setsign(signOfFinalResult);
+		return *this;
+	}
+	blockdecimal& operator/=(const blockdecimal& rhs) {
+		*this = blockdecimal_divide(*this, rhs).quot;
+		return *this;
+	}
+	blockdecimal& operator%=(const blockdecimal& rhs) {
+		*this = blockdecimal_divide(*this, rhs).rem;
+		return *this;
+	}
+	// decimal shifts: multiply or divide by a power of 10
+	blockdecimal& operator<<=(int shift) {
+		if (shift < 0) return operator>>=(-shift);
+		if (size_t(shift) >= ndigits) {
+			setzero();
+			return *this;
+		}
+		size_t limbShift = size_t(shift) / DECIMAL_LIMB_DIGITS;
+		for (size_t i = nrLimbs; i > limbShift; --i) _block[i - 1] = _block[i - 1 - limbShift];
+		for (size_t i = 0; i < limbShift; ++i) _block[i] = 0;
+		declimb_mul_small(_block, _block, nrLimbs, declimb_pow10(unsigned(size_t(shift) % DECIMAL_LIMB_DIGITS)));
+		truncate();
+		return *this;
+	}
+	blockdecimal& operator>>=(int shift) {
+		if (shift < 0) return operator<<=(-shift);
+		if (size_t(shift) >= ndigits) {
+			setzero();
+			return *this;
+		}
+		size_t limbShift = size_t(shift) / DECIMAL_LIMB_DIGITS;
+		for (size_t i = 0; i + limbShift < nrLimbs; ++i) _block[i] = _block[i + limbShift];
+		for (size_t i = nrLimbs - limbShift; i < nrLimbs; ++i) _block[i] = 0;
+		declimb_divmod_single(_block, _block, nrLimbs, declimb_pow10(unsigned(size_t(shift) % DECIMAL_LIMB_DIGITS)));
+		truncate();
+		return *this;
+	}
+
+	// unitary operators
+	blockdecimal operator-() const {
+		blockdecimal tmp(*this);
+		tmp.setsign(!tmp.sign());
+		return tmp;
+	}
+	blockdecimal operator++(int) { // postfix
+		blockdecimal tmp(*this);
+		++(*this);
+		return tmp;
+	}
+	blockdecimal& operator++() { // prefix
+		return increment(!negative);
+	}
+	blockdecimal operator--(int) { // postfix
+		blockdecimal tmp(*this);
+		--(*this);
+		return tmp;
+	}
+	blockdecimal& operator--() { // prefix
+		return increment(negative);
+	}
+
+	// conversion operators
+	explicit operator unsigned short() const { return static_cast<unsigned short>(to_long_long()); }
+	explicit operator unsigned int() const { return static_cast<unsigned int>(to_long_long()); }
+	explicit operator unsigned long() const { return static_cast<unsigned long>(to_long_long()); }
+	explicit operator unsigned long long() const { return static_cast<unsigned long long>(to_long_long()); }
+	explicit operator short() const { return static_cast<short>(to_long_long()); }
+	explicit operator int() const { return static_cast<int>(to_long_long()); }
+	explicit operator long() const { return static_cast<long>(to_long_long()); }
+	explicit operator long long() const { return to_long_long(); }
+	explicit operator float() const { return static_cast<float>(to_long_double()); }
+	explicit operator double() const { return static_cast<double>(to_long_double()); }
+	explicit operator long double() const { return to_long_double(); }
+
+	// selectors
+	inline bool iszero() const { return declimb_significant(_block, nrLimbs) == 0; }
+	inline bool sign() const { return negative; }
+	inline bool isneg() const { return negative; }   // <  0
+	inline bool ispos() const { return !negative; }  // >= 0
+	// the i-th decimal digit of the magnitude, least significant first
+	inline uint8_t digit(size_t i) const {
+		if (i >= ndigits) return 0;
+		return uint8_t((_block[i / DECIMAL_LIMB_DIGITS] / declimb_pow10(unsigned(i % DECIMAL_LIMB_DIGITS))) % 10);
+	}
+	// the i-th base-10^9 limb of the magnitude, least significant first
+	inline uint32_t limb(size_t i) const { return _block[i]; }
+	// compare magnitudes: returns -1, 0, or 1
+	inline int compare_magnitude(const blockdecimal& rhs) const {
+		return declimb_compare(_block, declimb_significant(_block, nrLimbs), rhs._block, declimb_significant(rhs._block, nrLimbs));
+	}
+
+	// modifiers
+	inline void clear() { negative = false; for (size_t i = 0; i < nrLimbs; ++i) _block[i] = 0; }
+	inline void setzero() { clear(); }
+	inline void setsign(bool sign) { negative = sign && !iszero(); }
+	inline void setneg() { setsign(true); }
+	inline void setpos() { negative = false; }
+	inline void setdigit(uint8_t d, bool sign = false) {
+		clear();
+		_block[0] = d % 10u;
+		setsign(sign);
+	}
+
+	// read a decimal ASCII format: [+-]?[0-9]+, digits beyond the capacity wrap
+	bool parse(const std::string& _digits) {
+		std::string digits(_digits);
+		trim(digits);
+		size_t first = 0;
+		bool sign = false;
+		if (first < digits.size() && (digits[first] == '-' || digits[first] == '+')) {
+			sign = (digits[first] == '-');
+			++first;
+		}
+		if (first == digits.size()) return false;
+		for (size_t i = first; i < digits.size(); ++i) {
+			if (digits[i] < '0' || digits[i] > '9') return false;
+		}
+		clear();
+		// consume the digit string from the least significant end, nine digits per limb
+		size_t end = digits.size();
+		for (size_t i = 0; i < nrLimbs && end > first; ++i) {
+			size_t begin = (end - first > DECIMAL_LIMB_DIGITS) ? end - DECIMAL_LIMB_DIGITS : first;
+			uint32_t limb = 0;
+			for (size_t j = begin; j < end; ++j) limb = limb * 10 + uint32_t(digits[j] - '0');
+			_block[i] = limb;
+			end = begin;
+		}
+		truncate();
+		setsign(sign);
+		return true;
+	}
+
+protected:
+	// HELPER methods
+
+	// reduce the magnitude modulo 10^ndigits
+	inline void truncate() {
+		if (msuDigits < DECIMAL_LIMB_DIGITS) _block[nrLimbs - 1] %= declimb_pow10(msuDigits);
+		if (iszero()) negative = false;
+	}
+
+	// this = |this| - |rhs| with the sign of the larger magnitude, where rhsSign is the sign rhs contributes
+	blockdecimal& subtract_magnitude(const blockdecimal& rhs, bool rhsSign) {
+		if (compare_magnitude(rhs) >= 0) {
+			declimb_sub_inplace(_block, nrLimbs, rhs._block, nrLimbs);
+		}
+		else {
+			uint32_t diff[nrLimbs];
+			for (size_t i = 0; i < nrLimbs; ++i) diff[i] = rhs._block[i];
+			declimb_sub_inplace(diff, nrLimbs, _block, nrLimbs);
+			for (size_t i = 0; i < nrLimbs; ++i) _block[i] = diff[i];
+			negative = rhsSign;
+		}
+		if (iszero()) negative = false;
+		return *this;
+	}
+
+	// move the value one unit away from zero when away is set, one unit towards zero otherwise
+	blockdecimal& increment(bool away) {
+		static const uint32_t one[1] = { 1 };
+		if (away) {
+			declimb_add_inplace(_block, nrLimbs, one, 1);
+			truncate();
+		}
+		else if (iszero()) {
+			// only reached by decrementing zero, which steps over to -1
+			_block[0] = 1;
+			negative = true;
+		}
+		else {
+			declimb_sub_inplace(_block, nrLimbs, one, 1);
+			if (iszero()) negative = false;
+		}
+		return *this;
+	}
+
+	// conversion functions
+	inline long long to_long_long() const {
+		unsigned long long v = 0;
+		for (size_t i = nrLimbs; i > 0; --i) v = v * DECIMAL_LIMB_BASE + _block[i - 1];
+		return negative ? (long long)(0ull - v) : (long long)v;
+	}
+	inline long double to_long_double() const {
+		long double v = 0.0l;
+		for (size_t i = nrLimbs; i > 0; --i) v = v * DECIMAL_LIMB_BASE + _block[i - 1];
+		return negative ? -v : v;
+	}
+
+private:
+	// sign-magnitude number: indicate if number is positive or negative
+	bool     negative;
+	uint32_t _block[nrLimbs];
+
+	template<size_t nd>
+	friend blockdecimaldiv<nd> blockdecimal_divide(const blockdecimal<nd>&, const blockdecimal<nd>&);
+};
+
+////////////////// BLOCKDECIMAL operators
+
+// generate an ASCII decimal string
+template<size_t ndigits>
+inline std::string to_string(const blockdecimal<ndigits>& d) {
+	std::string s;
+	size_t msd = ndigits;
+	while (msd > 1 && d.digit(msd - 1) == 0) --msd;
+	if (d.isneg()) s += '-';
+	for (size_t i = msd; i > 0; --i) s += char('0' + d.digit(i - 1));
+	return s;
+}
+
+// generate an ASCII decimal format and send to ostream
+template<size_t ndigits>
+inline std::ostream& operator<<(std::ostream& ostr, const blockdecimal<ndigits>& d) {
+	// to make certain that setw and left/right operators work properly
+	// we need to transform the decimal into a string
+	return ostr << to_string(d);
+}
+
+// read an ASCII decimal format from an istream
+template<size_t ndigits>
+inline std::istream& operator>>(std::istream& istr, blockdecimal<ndigits>& d) {
+	std::string txt;
+	istr >> txt;
+	if (!d.parse(txt)) {
+		std::cerr << "unable to parse -" << txt << "- into a blockdecimal value\n";
+	}
+	return istr;
+}
+
+/// blockdecimal binary arithmetic operators
+
+template<size_t ndigits>
+inline blockdecimal<ndigits> operator+(const blockdecimal<ndigits>& lhs, const blockdecimal<ndigits>& rhs) {
+	blockdecimal<ndigits> sum(lhs);
+	return sum += rhs;
+}
+template<size_t ndigits>
+inline blockdecimal<ndigits> operator-(const blockdecimal<ndigits>& lhs, const blockdecimal<ndigits>& rhs) {
+	blockdecimal<ndigits> diff(lhs);
+	return diff -= rhs;
+}
+template<size_t ndigits>
+inline blockdecimal<ndigits> operator*(const blockdecimal<ndigits>& lhs, const blockdecimal<ndigits>& rhs) {
+	blockdecimal<ndigits> mul(lhs);
+	return mul *= rhs;
+}
+template<size_t ndigits>
+inline blockdecimal<ndigits> operator/(const blockdecimal<ndigits>& lhs, const blockdecimal<ndigits>& rhs) {
+	return blockdecimal_divide(lhs, rhs).quot;
+}
+template<size_t ndigits>
+inline blockdecimal<ndigits> operator%(const blockdecimal<ndigits>& lhs, const blockdecimal<ndigits>& rhs) {
+	return blockdecimal_divide(lhs, rhs).rem;
+}
+template<size_t ndigits>
+inline blockdecimal<ndigits> operator<<(const blockdecimal<ndigits>& lhs, int shift) {
+	blockdecimal<ndigits> d(lhs);
+	return d <<= shift;
+}
+template<size_t ndigits>
+inline blockdecimal<ndigits> operator>>(const blockdecimal<ndigits>& lhs, int shift) {
+	blockdecimal<ndigits> d(lhs);
+	return d >>= shift;
+}
+
+/// logic operators
+
+template<size_t ndigits>
+inline bool operator==(const blockdecimal<ndigits>& lhs, const blockdecimal<ndigits>& rhs) {
+	return lhs.sign() == rhs.sign() && lhs.compare_magnitude(rhs) == 0;
+}
+template<size_t ndigits>
+inline bool operator!=(const blockdecimal<ndigits>& lhs, const blockdecimal<ndigits>& rhs) {
+	return !operator==(lhs, rhs);
+}
+template<size_t ndigits>
+inline bool operator<(const blockdecimal<ndigits>& lhs, const blockdecimal<ndigits>& rhs) {
+	if (lhs.sign() != rhs.sign()) return lhs.sign();
+	int cmp = lhs.compare_magnitude(rhs);
+	return lhs.sign() ? (cmp > 0) : (cmp < 0);
+}
+template<size_t ndigits>
+inline bool operator>(const blockdecimal<ndigits>& lhs, const blockdecimal<ndigits>& rhs) {
+	return operator<(rhs, lhs);
+}
+template<size_t ndigits>
+inline bool operator<=(const blockdecimal<ndigits>& lhs, const blockdecimal<ndigits>& rhs) {
+	return !operator<(rhs, lhs);
+}
+template<size_t ndigits>
+inline bool operator>=(const blockdecimal<ndigits>& lhs, const blockdecimal<ndigits>& rhs) {
+	return !operator<(lhs, rhs);
+}
+
+// blockdecimal - long logic operators
+template<size_t ndigits>
+inline bool operator==(const blockdecimal<ndigits>& lhs, long long rhs) { return lhs == blockdecimal<ndigits>(rhs); }
+template<size_t ndigits>
+inline bool operator!=(const blockdecimal<ndigits>& lhs, long long rhs) { return lhs != blockdecimal<ndigits>(rhs); }
+template<size_t ndigits>
+inline bool operator< (const blockdecimal<ndigits>& lhs, long long rhs) { return lhs <  blockdecimal<ndigits>(rhs); }
+template<size_t ndigits>
+inline bool operator> (const blockdecimal<ndigits>& lhs, long long rhs) { return lhs >  blockdecimal<ndigits>(rhs); }
+template<size_t ndigits>
+inline bool operator<=(const blockdecimal<ndigits>& lhs, long long rhs) { return lhs <= blockdecimal<ndigits>(rhs); }
+template<size_t ndigits>
+inline bool operator>=(const blockdecimal<ndigits>& lhs, long long rhs) { return lhs >= blockdecimal<ndigits>(rhs); }
+
+// long - blockdecimal logic operators
+template<size_t ndigits>
+inline bool operator==(long long lhs, const blockdecimal<ndigits>& rhs) { return blockdecimal<ndigits>(lhs) == rhs; }
+template<size_t ndigits>
+inline bool operator!=(long long lhs, const blockdecimal<ndigits>& rhs) { return blockdecimal<ndigits>(lhs) != rhs; }
+template<size_t ndigits>
+inline bool operator< (long long lhs, const blockdecimal<ndigits>& rhs) { return blockdecimal<ndigits>(lhs) <  rhs; }
+template<size_t ndigits>
+inline bool operator> (long long lhs, const blockdecimal<ndigits>& rhs) { return blockdecimal<ndigits>(lhs) >  rhs; }
+template<size_t ndigits>
+inline bool operator<=(long long lhs, const blockdecimal<ndigits>& rhs) { return blockdecimal<ndigits>(lhs) <= rhs; }
+template<size_t ndigits>
+inline bool operator>=(long long lhs, const blockdecimal<ndigits>& rhs) { return blockdecimal<ndigits>(lhs) >= rhs; }
+
+///////////////////////
+// divide blockdecimal a and b: the quotient truncates towards zero, the remainder takes the sign of the dividend
+// the scratch limbs of the long division live on the stack
+template<size_t ndigits>
+blockdecimaldiv<ndigits> blockdecimal_divide(const blockdecimal<ndigits>& a, const blockdecimal<ndigits>& b) {
+	constexpr size_t nrLimbs = blockdecimal<ndigits>::nrLimbs;
+	blockdecimaldiv<ndigits> divresult;
+	size_t m = declimb_significant(a._block, nrLimbs);
+	size_t n = declimb_significant(b._block, nrLimbs);
+	if (n == 0) {
+#if DECIMAL_THROW_ARITHMETIC_EXCEPTION
+		throw decimal_integer_divide_by_zero{};
+#else
+		std::cerr << "integer_divide_by_zero\n";
+		return divresult;
+#endif // DECIMAL_THROW_ARITHMETIC_EXCEPTION
+	}
+	if (declimb_compare(a._block, m, b._block, n) < 0) {
+		divresult.rem = a; // a % b = a when a / b = 0
+		return divresult;
+	}
+	uint32_t ws[2 * nrLimbs + 1];
+	declimb_divmod(divresult.quot._block, divresult.rem._block, a._block, m, b._block, n, ws);
+	divresult.quot.setsign(a.sign() != b.sign());
+	divresult.rem.setsign(a.sign());
+	return divresult;
+}
+
+}} // namespace sw::unum
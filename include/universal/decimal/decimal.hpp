@@ -18,6 +18,7 @@
 #include <universal/native/ieee-754.hpp>
 #include <universal/string/strmanip.hpp>
 #include "./decimal_exceptions.hpp"
+#include "./decimal_limbs.hpp"
 
 #if defined(__clang__)
 /* Clang/LLVM. ---------------------------------------------- */
@@ -59,6 +60,8 @@ decimal quotient(const decimal&, const decimal&);
 decimal remainder(const decimal&, const decimal&);
 int findMsd(const decimal&);
 template<typename Ty> void convert_to_decimal(Ty, decimal&);
+void to_limbs(const decimal&, declimbs&);
+void from_limbs(const uint32_t*, size_t, decimal&);
 
 // Arbitrary precision decimal integer number
 class decimal : public std::vector<uint8_t> {
@@ -294,49 +297,13 @@ public:
 			return *this;
 		}
 		bool signOfFinalResult = (negative != rhs.negative) ? true : false;
-		decimal product;
-		// find the smallest decimal to minimize the amount of work
-		size_t l = size();
-		size_t r = rhs.size();
-		decimal::const_iterator sit, bit; // sit = smallest iterator, bit = biggest iterator
-		if (l < r) {
-			int64_t position = 0;
-			for (sit = begin(); sit != end(); ++sit) {
-				decimal partial_sum; partial_sum.clear(); // TODO: this is silly, create and immediately destruct to make the insert work
-				partial_sum.insert(partial_sum.end(), r + position, 0);
-				decimal::iterator pit = partial_sum.begin() + position;
-				uint8_t carry = 0;
-				for (bit = rhs.begin(); bit != rhs.end() && pit != partial_sum.end(); ++bit, ++pit) {
-					uint8_t digit = static_cast<uint8_t>(*sit * *bit + carry);
-					*pit = static_cast<uint8_t>(digit % 10);
-					carry = static_cast<uint8_t>(digit / 10);
-				}
-				if (carry) partial_sum.push_back(carry);
-				product += partial_sum;
-				//				std::cout << "partial sum " << partial_sum << " intermediate product " << product << std::endl;
-				++position;
-			}
-		}
-		else {
-			int64_t position = 0;
-			for (sit = rhs.begin(); sit != rhs.end(); ++sit) {
-				decimal partial_sum; partial_sum.clear(); // TODO: this is silly, create and immediately destruct to make the insert work
-				partial_sum.insert(partial_sum.end(), l + position, 0);
-				decimal::iterator pit = partial_sum.begin() + position;
-				uint8_t carry = 0;
-				for (bit = begin(); bit != end() && pit != partial_sum.end(); ++bit, ++pit) {
-					uint8_t digit = static_cast<uint8_t>(*sit * *bit + carry);
-					*pit = static_cast<uint8_t>(digit % 10);
-					carry = static_cast<uint8_t>(digit / 10);
-				}
-				if (carry) partial_sum.push_back(carry);
-				product += partial_sum;
-				//				std::cout << "partial sum " << partial_sum << " intermediate product " << product << std::endl;
-				++position;
-			}
-		}
-		product.unpad();
-		*this = product;
+		// multiply the magnitudes in base-10^9 limbs
+		declimbs a, b;
+		to_limbs(*this, a);
+		to_limbs(rhs, b);
+		declimbs product(a.size() + b.size());
+		declimb_multiply(product.data(), a.data(), a.size(), b.data(), b.size());
+		from_limbs(product.data(), product.size(), *this);
 		setsign(signOfFinalResult);
 		return *this;
 	}
@@ -353,9 +320,8 @@ public:
 		if (shift < 0) {
 			return operator>>=(-shift);
 		}
-		for (int i = 0; i < shift; ++i) {
-			this->insert(this->begin(), 0);
-		}
+		if (iszero()) return *this;
+		this->insert(this->begin(), size_t(shift), uint8_t(0));
 		return *this;
 	}
 	decimal& operator>>=(int shift) {
@@ -367,9 +333,7 @@ public:
 			this->setzero();
 		}
 		else {
-			for (int i = 0; i < shift; ++i) {
-				this->erase(this->begin());
-			}
+			this->erase(this->begin(), this->begin() + shift);
 		}
 		return *this;
 	}
@@ -635,6 +599,39 @@ void convert_to_decimal(Ty v, decimal& d) {
 	d.setsign(sign);
 }
 
+// pack the digits of the magnitude of d into base-10^9 limbs, without leading zero limbs
+inline void to_limbs(const decimal& d, declimbs& limbs) {
+	size_t nrDigits = d.size();
+	limbs.resize((nrDigits + DECIMAL_LIMB_DIGITS - 1) / DECIMAL_LIMB_DIGITS);
+	for (size_t i = 0; i < limbs.size(); ++i) {
+		size_t lsd = i * DECIMAL_LIMB_DIGITS;
+		size_t msd = std::min(lsd + DECIMAL_LIMB_DIGITS, nrDigits);
+		uint32_t limb = 0;
+		for (size_t j = msd; j > lsd; --j) limb = limb * 10 + d[j - 1];
+		limbs[i] = limb;
+	}
+	limbs.normalize();
+}
+
+// unpack base-10^9 limbs into the digits of d: the result is positive and unpadded
+inline void from_limbs(const uint32_t* limbs, size_t n, decimal& d) {
+	n = declimb_significant(limbs, n);
+	if (n == 0) {
+		d.setzero();
+		return;
+	}
+	d.clear();
+	d.setpos();
+	d.reserve(n * DECIMAL_LIMB_DIGITS);
+	for (size_t i = 0; i < n; ++i) {
+		uint32_t limb = limbs[i];
+		for (unsigned j = 0; j < DECIMAL_LIMB_DIGITS; ++j) {
+			d.push_back(uint8_t(limb % 10));
+			limb /= 10;
+		}
+	}
+	d.unpad();
+}
 
 ////////////////// DECIMAL operators
 
@@ -836,59 +833,35 @@ struct decintdiv {
 };
 
 // divide integer decimal a and b and return result argument
+// the magnitudes are divided in base-10^9 limbs, estimating a quotient limb at a time (Knuth algorithm D)
 decintdiv decint_divide(const decimal& _a, const decimal& _b) {
+	decintdiv divresult;
 	if (_b == 0) {
 #if DECIMAL_THROW_ARITHMETIC_EXCEPTION
 		throw decimal_integer_divide_by_zero{};
 #else
 		std::cerr << "integer_divide_by_zero\n";
+		return divresult;
 #endif // INTEGER_THROW_ARITHMETIC_EXCEPTION
 	}
-	// generate the absolute values to do long division 
-	bool a_negative = _a.sign();
-	bool b_negative = _b.sign();
-	bool result_negative = (a_negative ^ b_negative);
-	decimal a(_a); a.setpos();
-	decimal b(_b); b.setpos();
-	decintdiv divresult;
-	if (a < b) {
+	bool result_negative = (_a.sign() ^ _b.sign());
+	declimbs a, b;
+	to_limbs(_a, a);
+	to_limbs(_b, b);
+	if (declimb_compare(a.data(), a.size(), b.data(), b.size()) < 0) {
 		divresult.quot = 0;
 		divresult.rem = _a; // a % b = a when a / b = 0
 		return divresult; // a / b = 0 when b > a
 	}
-	// initialize the long division
-	decimal accumulator = a;
-	// prepare the subtractand
-	decimal subtractand = b;
-	int msd_b = findMsd(b);
-	int msd_a = findMsd(a);
-	int shift = msd_a - msd_b;
-	subtractand <<= shift;
-	// long division
-	for (int i = shift; i >= 0; --i) {
-		if (subtractand <= accumulator) {
-			decimal multiple = findLargestMultiple(accumulator, subtractand);
-			accumulator -= multiple * subtractand;
-			uint8_t multiplier = static_cast<uint8_t>(int(multiple)); // TODO: fix the ugly
-			divresult.quot.insert(divresult.quot.begin(), multiplier);
-		}
-		else {
-			divresult.quot.insert(divresult.quot.begin(), 0);
-		}
-		subtractand >>= 1;
-		if (subtractand == 0) break;
-	}
-	if (result_negative) {
-		divresult.quot.setneg();
-	}
-	if (_a < 0) {
-		divresult.rem = -accumulator;
-	}
-	else {
-		divresult.rem = accumulator;
-	}
-	divresult.quot.unpad();
-	divresult.rem.unpad();
+	size_t m = a.size();
+	size_t n = b.size();
+	declimbs q(m - n + 1), r(n), ws(m + n + 1);
+	declimb_divmod(q.data(), r.data(), a.data(), m, b.data(), n, ws.data());
+	from_limbs(q.data(), q.size(), divresult.quot);
+	from_limbs(r.data(), r.size(), divresult.rem);
+	// the quotient is at least 1, the remainder takes the sign of the dividend
+	divresult.quot.setsign(result_negative);
+	if (!divresult.rem.iszero()) divresult.rem.setsign(_a.sign());
 	return divresult;
 }
 
@@ -0,0 +1,327 @@
+#pragma once
+// decimal_limbs.hpp: multi-precision kernels on arrays of base-10^9 limbs, least significant limb first
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+
+// DECIMAL_KARATSUBA_THRESHOLD is the operand length, in base-10^9 limbs, at which the multiply kernel
+// switches from the comba column product to Karatsuba.
+#ifndef DECIMAL_KARATSUBA_THRESHOLD
+#define DECIMAL_KARATSUBA_THRESHOLD 40
+#endif
+
+// DECIMAL_INLINE_LIMBS is the number of limbs a declimbs object stores without a heap allocation
+#ifndef DECIMAL_INLINE_LIMBS
+#define DECIMAL_INLINE_LIMBS 8
+#endif
+
+namespace sw { namespace unum {
+
+// a base-10^9 limb holds nine decimal digits in a uint32_t
+constexpr uint32_t DECIMAL_LIMB_BASE = 1000000000u;
+constexpr unsigned DECIMAL_LIMB_DIGITS = 9;
+
+// powers of 10 that fit in a limb
+inline uint32_t declimb_pow10(unsigned e) {
+	static const uint32_t p[] = { 1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u };
+	return p[e];
+}
+
+// number of significant limbs of a[0..n): leading zero limbs are stripped
+inline size_t declimb_significant(const uint32_t* a, size_t n) {
+	while (n > 0 && a[n - 1] == 0) --n;
+	return n;
+}
+
+// magnitude of an arbitrary precision decimal in base-10^9 limbs, least significant limb first
+// small magnitudes live in an inline buffer, larger ones spill over to the heap
+class declimbs {
+public:
+	declimbs() : _size(0), _local{ 0 }, _heap() {}
+	explicit declimbs(size_t n) : declimbs() { resize(n); }
+
+	size_t size() const { return _size; }
+	uint32_t* data() { return _heap.empty() ? _local : _heap.data(); }
+	const uint32_t* data() const { return _heap.empty() ? _local : _heap.data(); }
+	uint32_t& operator[](size_t i) { return data()[i]; }
+	uint32_t operator[](size_t i) const { return data()[i]; }
+
+	// resize the limb array, new limbs are zero
+	void resize(size_t n) {
+		if (!_heap.empty() || n > DECIMAL_INLINE_LIMBS) {
+			if (_heap.empty()) _heap.assign(_local, _local + _size);
+			_heap.resize(n, 0);
+		}
+		else {
+			for (size_t i = _size; i < n; ++i) _local[i] = 0;
+		}
+		_size = n;
+	}
+	// strip leading zero limbs
+	void normalize() { resize(declimb_significant(data(), _size)); }
+
+private:
+	size_t                _size;
+	uint32_t              _local[DECIMAL_INLINE_LIMBS];
+	std::vector<uint32_t> _heap;
+};
+
+// compare a[0..na) and b[0..nb) without leading zero limbs: returns -1, 0, or 1
+inline int declimb_compare(const uint32_t* a, size_t na, const uint32_t* b, size_t nb) {
+	if (na != nb) return (na < nb) ? -1 : 1;
+	for (size_t i = na; i > 0; --i) {
+		if (a[i - 1] != b[i - 1]) return (a[i - 1] < b[i - 1]) ? -1 : 1;
+	}
+	return 0;
+}
+
+// r[0..n) += a[0..na) with na <= n, the carry ripples to the end of r, returns the carry out
+inline uint32_t declimb_add_inplace(uint32_t* r, size_t n, const uint32_t* a, size_t na) {
+	uint32_t carry = 0;
+	size_t i = 0;
+	for (; i < na; ++i) {
+		uint32_t s = r[i] + a[i] + carry;
+		carry = (s >= DECIMAL_LIMB_BASE) ? 1u : 0u;
+		r[i] = s - carry * DECIMAL_LIMB_BASE;
+	}
+	for (; carry && i < n; ++i) {
+		uint32_t s = r[i] + carry;
+		carry = (s >= DECIMAL_LIMB_BASE) ? 1u : 0u;
+		r[i] = s - carry * DECIMAL_LIMB_BASE;
+	}
+	return carry;
+}
+// r[0..n) -= a[0..na) with na <= n, the borrow ripples to the end of r, returns the borrow out
+inline uint32_t declimb_sub_inplace(uint32_t* r, size_t n, const uint32_t* a, size_t na) {
+	uint32_t borrow = 0;
+	size_t i = 0;
+	for (; i < na; ++i) {
+		uint32_t s = a[i] + borrow;
+		borrow = (r[i] < s) ? 1u : 0u;
+		r[i] = r[i] + borrow * DECIMAL_LIMB_BASE - s;
+	}
+	for (; borrow && i < n; ++i) {
+		borrow = (r[i] == 0) ? 1u : 0u;
+		r[i] = r[i] + borrow * DECIMAL_LIMB_BASE - 1;
+	}
+	return borrow;
+}
+
+// r[0..n) = a[0..n) * f + c for a single limb factor f < 10^9, returns the carry limb
+inline uint32_t declimb_mul_small(uint32_t* r, const uint32_t* a, size_t n, uint32_t f, uint32_t c = 0) {
+	uint64_t carry = c;
+	for (size_t i = 0; i < n; ++i) {
+		uint64_t t = uint64_t(a[i]) * f + carry;
+		carry = t / DECIMAL_LIMB_BASE;
+		r[i] = uint32_t(t - carry * DECIMAL_LIMB_BASE);
+	}
+	return uint32_t(carry);
+}
+
+// comba multiply: r[0..na+nb) = a[0..na) * b[0..nb), r may not alias a or b
+// the partial products of a column are summed before a single carry propagation: each product < 10^18 is split
+// into its low and high limb, so that the two column accumulators can absorb billions of products without overflow
+inline void declimb_mul_comba(uint32_t* r, const uint32_t* a, size_t na, const uint32_t* b, size_t nb) {
+	uint64_t carry = 0;
+	for (size_t k = 0; k + 1 < na + nb; ++k) {
+		uint64_t lo = carry, hi = 0;
+		size_t i = (k < nb) ? 0 : k - nb + 1;
+		size_t iend = (k < na) ? k : na - 1;
+		for (; i <= iend; ++i) {
+			uint64_t p = uint64_t(a[i]) * b[k - i];
+			uint64_t ph = p / DECIMAL_LIMB_BASE;
+			lo += p - ph * DECIMAL_LIMB_BASE;
+			hi += ph;
+		}
+		uint64_t lh = lo / DECIMAL_LIMB_BASE;
+		r[k] = uint32_t(lo - lh * DECIMAL_LIMB_BASE);
+		carry = hi + lh;
+	}
+	r[na + nb - 1] = uint32_t(carry);
+}
+
+// the Karatsuba recursion needs at least 4 limbs to make progress
+constexpr size_t declimb_karatsuba_threshold = (DECIMAL_KARATSUBA_THRESHOLD < 4 ? 4 : DECIMAL_KARATSUBA_THRESHOLD);
+
+// scratch limbs consumed by declimb_mul_karatsuba for n-limb operands
+inline size_t declimb_karatsuba_scratch(size_t n) {
+	size_t s = 0;
+	while (n >= declimb_karatsuba_threshold) {
+		size_t h = n - n / 2 + 1;  // length of the half sums
+		s += 4 * h;
+		n = h;
+	}
+	return s;
+}
+
+// Karatsuba: r[0..2n) = a[0..n) * b[0..n), ws points to declimb_karatsuba_scratch(n) limbs
+// with a = a1 * B^m + a0, b = b1 * B^m + b0, the middle product is (a0 + a1)(b0 + b1) - a0 b0 - a1 b1
+inline void declimb_mul_karatsuba(uint32_t* r, const uint32_t* a, const uint32_t* b, size_t n, uint32_t* ws) {
+	if (n < declimb_karatsuba_threshold) {
+		declimb_mul_comba(r, a, n, b, n);
+		return;
+	}
+	size_t m = n / 2;      // length of the low halves
+	size_t h = n - m;      // length of the high halves, h >= m
+	uint32_t* sa = ws;             // h + 1 limbs
+	uint32_t* sb = sa + (h + 1);   // h + 1 limbs
+	uint32_t* z1 = sb + (h + 1);   // 2h + 2 limbs
+	uint32_t* next = z1 + 2 * (h + 1);
+
+	// z0 = a0 * b0 in r[0..2m), z2 = a1 * b1 in r[2m..2n)
+	declimb_mul_karatsuba(r, a, b, m, next);
+	declimb_mul_karatsuba(r + 2 * m, a + m, b + m, h, next);
+
+	// half sums, the high halves are at least as long as the low halves
+	for (size_t i = 0; i < h; ++i) { sa[i] = a[m + i]; sb[i] = b[m + i]; }
+	sa[h] = declimb_add_inplace(sa, h, a, m);
+	sb[h] = declimb_add_inplace(sb, h, b, m);
+	declimb_mul_karatsuba(z1, sa, sb, h + 1, next);
+
+	// z1 = (a0 + a1)(b0 + b1) - z0 - z2 is non-negative
+	declimb_sub_inplace(z1, 2 * h + 2, r, 2 * m);
+	declimb_sub_inplace(z1, 2 * h + 2, r + 2 * m, 2 * h);
+	size_t len = declimb_significant(z1, 2 * h + 2);
+	declimb_add_inplace(r + m, 2 * n - m, z1, len);
+}
+
+// full product: r[0..na+nb) = a[0..na) * b[0..nb), r may not alias a or b
+// operands shorter than DECIMAL_KARATSUBA_THRESHOLD limbs use the comba kernel,
+// longer operands are cut into balanced chunks that are multiplied with Karatsuba
+inline void declimb_multiply(uint32_t* r, const uint32_t* a, size_t na, const uint32_t* b, size_t nb) {
+	if (na < nb) { const uint32_t* t = a; a = b; b = t; size_t s = na; na = nb; nb = s; }
+	if (nb == 0) {
+		for (size_t i = 0; i < na; ++i) r[i] = 0;
+		return;
+	}
+	if (nb < declimb_karatsuba_threshold) {
+		declimb_mul_comba(r, a, na, b, nb);
+		return;
+	}
+	std::vector<uint32_t> ws(declimb_karatsuba_scratch(nb) + 2 * nb);
+	uint32_t* chunk = ws.data();
+	uint32_t* scratch = chunk + 2 * nb;
+	for (size_t i = 0; i < na + nb; ++i) r[i] = 0;
+	for (size_t offset = 0; offset < na; offset += nb) {
+		size_t len = (na - offset < nb) ? (na - offset) : nb;
+		if (len == nb) {
+			declimb_mul_karatsuba(chunk, a + offset, b, nb, scratch);
+		}
+		else {
+			declimb_mul_comba(chunk, b, nb, a + offset, len);
+		}
+		declimb_add_inplace(r + offset, na + nb - offset, chunk, len + nb);
+	}
+}
+
+// single-limb divisor: q[0..n) = a[0..n) / d, returns the remainder
+inline uint32_t declimb_divmod_single(uint32_t* q, const uint32_t* a, size_t n, uint32_t d) {
+	uint64_t r = 0;
+	for (size_t i = n; i > 0; --i) {
+		uint64_t t = r * DECIMAL_LIMB_BASE + a[i - 1];
+		q[i - 1] = uint32_t(t / d);
+		r = t - uint64_t(q[i - 1]) * d;
+	}
+	return uint32_t(r);
+}
+
+// long division in base 10^9 (Knuth algorithm D): q[0..m-n+1) = u[0..m) / v[0..n), r[0..n) = u mod v
+// preconditions: m >= n >= 1, v[n-1] != 0, ws points to m + n + 1 limbs of scratch
+// both operands are scaled by f = B / (v[n-1] + 1), which brings the top divisor limb to at least B/2
+// so that the quotient limb estimated from the top two remainder limbs is at most two too large
+inline void declimb_divmod(uint32_t* q, uint32_t* r, const uint32_t* u, size_t m, const uint32_t* v, size_t n, uint32_t* ws) {
+	constexpr uint64_t B = DECIMAL_LIMB_BASE;
+	if (n == 1) {
+		r[0] = declimb_divmod_single(q, u, m, v[0]);
+		return;
+	}
+	uint32_t* un = ws;          // m + 1 limbs
+	uint32_t* vn = ws + m + 1;  // n limbs
+	uint32_t f = uint32_t(B / (uint64_t(v[n - 1]) + 1));
+	un[m] = declimb_mul_small(un, u, m, f);
+	declimb_mul_small(vn, v, n, f);
+
+	for (size_t j = m - n + 1; j > 0; --j) {
+		size_t k = j - 1;
+		// estimate the quotient limb from the top two limbs of the running remainder
+		uint64_t num = uint64_t(un[k + n]) * B + un[k + n - 1];
+		uint64_t qhat = num / vn[n - 1];
+		uint64_t rhat = num - qhat * vn[n - 1];
+		// refine with the third limb
+		while (qhat >= B || qhat * vn[n - 2] > rhat * B + un[k + n - 2]) {
+			--qhat;
+			rhat += vn[n - 1];
+			if (rhat >= B) break;
+		}
+		// multiply and subtract
+		int64_t borrow = 0;
+		uint64_t carry = 0;
+		for (size_t i = 0; i < n; ++i) {
+			uint64_t p = qhat * vn[i] + carry;
+			carry = p / B;
+			int64_t t = int64_t(un[i + k]) - int64_t(p - carry * B) + borrow;
+			borrow = (t < 0) ? -1 : 0;
+			un[i + k] = uint32_t(t - borrow * int64_t(B));
+		}
+		int64_t t = int64_t(un[k + n]) - int64_t(carry) + borrow;
+		if (t < 0) {
+			// the estimate was one too large: add the divisor back
+			un[k + n] = uint32_t(t + int64_t(B));
+			--qhat;
+			uint32_t c = declimb_add_inplace(un + k, n, vn, n);
+			un[k + n] = uint32_t((un[k + n] + c) % B);
+		}
+		else {
+			un[k + n] = uint32_t(t);
+		}
+		q[k] = uint32_t(qhat);
+	}
+	// unscale the remainder
+	declimb_divmod_single(r, un, n, f);
+}
+
+
+// integer square root: s = floor(sqrt(a[0..n))), preconditions: n >= 1 and a[n-1] != 0
+// returns true when a is a perfect square
+// Newton iteration x' = (x + a / x) / 2 decreases monotonically from any start at or above floor(sqrt(a)),
+// which is derived from the leading one or two limbs of a
+inline bool declimb_sqrt(std::vector<uint32_t>& s, const uint32_t* a, size_t n) {
+	constexpr uint64_t B = DECIMAL_LIMB_BASE;
+	// a < (lead + 1) * B^(2 * half)
+	size_t half = (n - 1) / 2;
+	uint64_t lead = ((n - 1) % 2) ? uint64_t(a[n - 1]) * B + a[n - 2] : uint64_t(a[n - 1]);
+	uint64_t x0 = uint64_t(std::sqrt(double(lead + 1))) + 2;
+	std::vector<uint32_t> x(half + 2, 0), q, r, t, ws;
+	x[half] = uint32_t(x0 % B);
+	x[half + 1] = uint32_t(x0 / B);
+	x.resize(declimb_significant(x.data(), x.size()));
+	bool exact = false;
+	for (;;) {
+		size_t nx = x.size();
+		q.assign(n - nx + 1, 0);
+		r.assign(nx, 0);
+		ws.resize(n + nx + 1);
+		declimb_divmod(q.data(), r.data(), a, n, x.data(), nx, ws.data());
+		size_t nq = declimb_significant(q.data(), q.size());
+		exact = (declimb_compare(q.data(), nq, x.data(), nx) == 0) && (declimb_significant(r.data(), nx) == 0);
+		// t = (x + q) / 2
+		size_t nt = (nx > nq ? nx : nq) + 1;
+		t.assign(x.begin(), x.end());
+		t.resize(nt, 0);
+		declimb_add_inplace(t.data(), nt, q.data(), nq);
+		declimb_divmod_single(t.data(), t.data(), nt, 2);
+		nt = declimb_significant(t.data(), nt);
+		if (declimb_compare(t.data(), nt, x.data(), nx) >= 0) break;
+		t.resize(nt);
+		x.swap(t);
+	}
+	s.swap(x);
+	return exact;
+}
+
+}} // namespace sw::unum
@@ -12,6 +12,8 @@
 #include <vector>
 #include <map>
 #include <cassert>
+#include <cstdint>
+#include <type_traits>
 
 /*
 The fixed-point arithmetic can be configured to:
@@ -65,6 +67,13 @@ Run-time configuration is used to select modular vs saturation arithmetic.
 
 #endif
 
+// FIXPNT_NATIVE_ARITHMETIC selects native integer arithmetic for fixpnt configurations that fit in 64 bits:
+// nbits <= 32 computes in int64_t, nbits <= 64 computes in __int128 when the compiler provides it.
+// The results are bit-identical to the blockbinary path.
+#ifndef FIXPNT_NATIVE_ARITHMETIC
+#define FIXPNT_NATIVE_ARITHMETIC 1
+#endif
+
 namespace sw {
 namespace unum {
 
@@ -213,6 +222,67 @@ inline void convert_unsigned(uint64_t v, fixpnt<nbits, rbits, arithmetic, bt>& r
 	}
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// native integer kernels for fixpnt<nbits <= 64>
+// operands are the raw 2's complement encodings sign-extended to int64_t, Wide holds the exact product
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef __int128 fixpnt_int128;
+constexpr size_t fixpnt_native_limit = 64;
+#else
+constexpr size_t fixpnt_native_limit = 32;
+#endif
+
+template<size_t nbits>
+using fixpnt_wide_t = typename std::conditional<(nbits <= 32), int64_t,
+#if defined(__SIZEOF_INT128__)
+	fixpnt_int128
+#else
+	int64_t
+#endif
+	>::type;
+
+// clamp to [maxneg, maxpos] when saturating, modulo arithmetic keeps the lower nbits when the raw bits are set
+template<size_t nbits, bool arithmetic, typename Wide>
+inline constexpr Wide fixpnt_native_saturate(Wide v) {
+	if constexpr (arithmetic == Saturating) {
+		constexpr Wide maxpos = (Wide(1) << (nbits - 1)) - 1;
+		constexpr Wide maxneg = -(Wide(1) << (nbits - 1));
+		v = (v > maxpos) ? maxpos : v;
+		v = (v < maxneg) ? maxneg : v;
+	}
+	return v;
+}
+
+// a + b
+template<size_t nbits, bool arithmetic>
+inline constexpr int64_t fixpnt_native_add(int64_t a, int64_t b) {
+	using Wide = fixpnt_wide_t<nbits>;
+	return int64_t(fixpnt_native_saturate<nbits, arithmetic>(Wide(a) + Wide(b)));
+}
+
+// a - b
+template<size_t nbits, bool arithmetic>
+inline constexpr int64_t fixpnt_native_sub(int64_t a, int64_t b) {
+	using Wide = fixpnt_wide_t<nbits>;
+	return int64_t(fixpnt_native_saturate<nbits, arithmetic>(Wide(a) - Wide(b)));
+}
+
+// a * b rounded to nearest, ties to even, at the radix point
+// the arithmetic shift yields the floor of the product, the discarded bits decide the round-up without a branch
+template<size_t nbits, size_t rbits, bool arithmetic>
+inline constexpr int64_t fixpnt_native_mul(int64_t a, int64_t b) {
+	using Wide = fixpnt_wide_t<nbits>;
+	Wide p = Wide(a) * Wide(b);
+	Wide q = p >> rbits;
+	if constexpr (rbits > 0) {
+		constexpr Wide half = Wide(1) << (rbits - 1);
+		Wide discarded = p & ((Wide(1) << rbits) - 1);
+		q += Wide((discarded > half) | ((discarded == half) & ((q & 1) != 0)));
+	}
+	return int64_t(fixpnt_native_saturate<nbits, arithmetic>(q));
+}
+
 // fixpnt is a binary fixed point number of nbits with rbits after the radix point
 template<size_t _nbits, size_t _rbits, bool arithmetic = Modulo, typename bt = uint8_t>
 class fixpnt {
@@ -226,6 +296,7 @@ public:
 	static constexpr size_t MSU = nrBlocks - 1;
 	// warning C4310: cast truncates constant value
 	static constexpr bt MSU_MASK = (bt(0xFFFFFFFFFFFFFFFFul) >> (nrBlocks * bitsInBlock - nbits));
+	static constexpr bool nativeArithmetic = (FIXPNT_NATIVE_ARITHMETIC != 0) && (nbits <= fixpnt_native_limit);
 
 	constexpr fixpnt() noexcept : bb(0) {}
 
@@ -337,6 +408,8 @@ public:
 		int radixPoint = 23 - (decoder.parts.exponent - 127); // move radix point to the right if scale > 0, left if scale < 0
 		// our fixed-point has its radixPoint at rbits
 		int shiftRight = radixPoint - int(rbits);
+		// values below half the least significant bit round to zero
+		if (shiftRight > 24) return *this;
 		// do we need to round?
 		if (shiftRight > 0) {
 			// yes, round the raw bits
@@ -405,6 +478,8 @@ public:
 
 		// our fixed-point has its radixPoint at rbits
 		int shiftRight = radixPoint - int(rbits);
+		// values below half the least significant bit round to zero
+		if (shiftRight > 53) return *this;
 		// do we need to round?
 		if (shiftRight > 0) {
 			// yes, round the raw bits
@@ -564,6 +639,10 @@ public:
 
 	// arithmetic operators
 	fixpnt& operator+=(const fixpnt& rhs) {
+		if constexpr (nativeArithmetic) {
+			set_native(fixpnt_native_add<nbits, arithmetic>(native(), rhs.native()));
+			return *this;
+		}
 		if (arithmetic == Modulo) {
 			bb += rhs.bb;
 		}
@@ -586,6 +665,10 @@ public:
 		return *this;
 	}
 	fixpnt& operator-=(const fixpnt& rhs) {
+		if constexpr (nativeArithmetic) {
+			set_native(fixpnt_native_sub<nbits, arithmetic>(native(), rhs.native()));
+			return *this;
+		}
 		if (arithmetic == Modulo) {
 			operator+=(twos_complement(rhs));
 		}
@@ -608,6 +691,10 @@ public:
 		return *this;
 	}
 	fixpnt& operator*=(const fixpnt& rhs) {
+		if constexpr (nativeArithmetic) {
+			set_native(fixpnt_native_mul<nbits, rbits, arithmetic>(native(), rhs.native()));
+			return *this;
+		}
 		if (arithmetic == Modulo) {
 //			blockbinary<2 * nbits, bt> c = urmul(this->bb, rhs.bb);
 			blockbinary<2 * nbits, bt> c = urmul2(this->bb, rhs.bb);
@@ -712,6 +799,16 @@ public:
 protected:
 	// HELPER methods
 
+	// raw 2's complement encoding sign-extended to 64 bits, requires nbits <= 64
+	inline int64_t native() const {
+		uint64_t raw = 0;
+		for (size_t i = 0; i < nrBlocks; ++i) raw |= uint64_t(bb.block(i)) << (i * bitsInBlock);
+		constexpr unsigned unused = unsigned(64 - (nbits < 64 ? nbits : 64));
+		return int64_t(raw << unused) >> unused;
+	}
+	// set the raw encoding from the lower nbits of v
+	inline void set_native(int64_t v) { bb.set_raw_bits(uint64_t(v)); }
+
 	// conversion functions
 	// from fixed-point to native
 	template<typename Integer>
@@ -842,6 +939,10 @@ protected:
 private:
 	blockbinary<nbits, bt> bb;
 
+	// the quire accumulates the exact products of the native encodings
+	template<size_t, size_t, bool, typename, size_t>
+	friend class fixpnt_quire;
+
 	// convert
 	template<size_t nnbits, size_t rrbits, bool aarithmetic, typename Bbt>
 	friend std::string convert_to_decimal_string(const fixpnt<nnbits, rrbits, aarithmetic, Bbt>& value);
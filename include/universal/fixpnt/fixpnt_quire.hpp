@@ -0,0 +1,184 @@
+#pragma once
+// fixpnt_quire.hpp: wide accumulator and fused dot product for fixed-point numbers
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <vector>
+#include <universal/fixpnt/fixed_point.hpp>
+#include <universal/traits/fixpnt_traits.hpp>
+
+namespace sw { namespace unum {
+
+/*
+ The product of two fixpnt<nbits, rbits> is exact in 2*nbits bits with 2*rbits fraction bits.
+ A fixpnt_quire accumulates these products, and fixpnt values aligned to the same radix point,
+ in 2*nbits + capacity bits, so that a sum of up to 2^capacity terms is exact.
+ Rounding to nearest, ties to even, and the saturation or modulo wrap of the fixpnt arithmetic
+ are applied once, when the accumulated value is converted back to a fixpnt.
+
+ When the accumulator fits in a native integer, each term is a plain integer multiply-add;
+ wider accumulators are carried in a blockbinary.
+ */
+template<size_t _nbits, size_t _rbits, bool arithmetic = Modulo, typename bt = uint8_t, size_t _capacity = 20>
+class fixpnt_quire {
+public:
+	static constexpr size_t nbits = _nbits;
+	static constexpr size_t rbits = _rbits;
+	static constexpr size_t capacity = _capacity;
+	static constexpr size_t qbits = 2 * nbits + capacity;  // size of the accumulator, including the sign bit
+	static constexpr size_t radix_point = 2 * rbits;       // number of fraction bits of the accumulator
+#if defined(__SIZEOF_INT128__)
+	static constexpr bool nativeAccumulator = (qbits <= 128);
+#else
+	static constexpr bool nativeAccumulator = (qbits <= 64);
+#endif
+	using Fixed = fixpnt<nbits, rbits, arithmetic, bt>;
+	using Accumulator = typename std::conditional<(qbits <= 64), int64_t,
+		typename std::conditional<nativeAccumulator, fixpnt_wide_t<64>, blockbinary<qbits, bt> >::type >::type;
+
+	fixpnt_quire() : _acc(0) {}
+	fixpnt_quire(const Fixed& rhs) : _acc(0) { *this += rhs; }
+
+	fixpnt_quire& operator=(const Fixed& rhs) {
+		clear();
+		return *this += rhs;
+	}
+
+	// add a fixpnt value, aligned to the radix point of the accumulator
+	fixpnt_quire& operator+=(const Fixed& rhs) {
+		if constexpr (nativeAccumulator) {
+			_acc += Accumulator(rhs.native()) << rbits;
+		}
+		else {
+			blockbinary<qbits, bt> v(rhs.getbb());
+			v <<= int(rbits);
+			_acc += v;
+		}
+		return *this;
+	}
+	fixpnt_quire& operator-=(const Fixed& rhs) {
+		if constexpr (nativeAccumulator) {
+			_acc -= Accumulator(rhs.native()) << rbits;
+		}
+		else {
+			blockbinary<qbits, bt> v(rhs.getbb());
+			v <<= int(rbits);
+			_acc -= v;
+		}
+		return *this;
+	}
+	fixpnt_quire& operator+=(const fixpnt_quire& rhs) {
+		_acc += rhs._acc;
+		return *this;
+	}
+
+	// accumulate the exact product a * b
+	fixpnt_quire& fma(const Fixed& a, const Fixed& b) {
+		if constexpr (nativeAccumulator) {
+			_acc += Accumulator(a.native()) * Accumulator(b.native());
+		}
+		else {
+			_acc += blockbinary<qbits, bt>(urmul2(a.getbb(), b.getbb()));
+		}
+		return *this;
+	}
+
+	// the one and only rounding step: round to nearest, ties to even, at rbits, then saturate or wrap into nbits
+	Fixed to_fixpnt() const {
+		Fixed result;
+		if constexpr (nativeAccumulator) {
+			Accumulator q = _acc >> rbits;
+			if constexpr (rbits > 0) {
+				constexpr Accumulator half = Accumulator(1) << (rbits - 1);
+				Accumulator discarded = _acc & ((Accumulator(1) << rbits) - 1);
+				q += Accumulator((discarded > half) | ((discarded == half) & ((q & 1) != 0)));
+			}
+			result.set_native(int64_t(fixpnt_native_saturate<nbits, arithmetic>(q)));
+		}
+		else {
+			blockbinary<qbits, bt> c(_acc);
+			bool roundUp = c.roundingMode(rbits);
+			c >>= int(rbits);
+			if (arithmetic == Saturating) {
+				if (c >= blockbinary<qbits, bt>(maxpos(result).getbb())) return result;
+				if (c < blockbinary<qbits, bt>(maxneg(result).getbb())) return result;
+			}
+			if (roundUp) ++c;
+			result = c;  // select the lower nbits of the result
+		}
+		return result;
+	}
+	explicit operator Fixed() const { return to_fixpnt(); }
+
+	// modifiers
+	inline void clear() { _acc = Accumulator(0); }
+	inline void reset() { clear(); }
+
+	// selectors
+	inline bool iszero() const {
+		if constexpr (nativeAccumulator) return _acc == 0; else return _acc.iszero();
+	}
+	inline bool sign() const {
+		if constexpr (nativeAccumulator) return _acc < 0; else return _acc.sign();
+	}
+
+private:
+	Accumulator _acc;
+};
+
+// the quire that accumulates the exact products of a fixpnt type
+template<typename FixedPoint, size_t capacity = 20>
+struct fixpnt_quire_trait;
+template<size_t nbits, size_t rbits, bool arithmetic, typename bt, size_t capacity>
+struct fixpnt_quire_trait<fixpnt<nbits, rbits, arithmetic, bt>, capacity> {
+	using type = fixpnt_quire<nbits, rbits, arithmetic, bt, capacity>;
+};
+
+// generate an ASCII representation of the accumulated value after the one rounding step
+template<size_t nbits, size_t rbits, bool arithmetic, typename bt, size_t capacity>
+inline std::ostream& operator<<(std::ostream& ostr, const fixpnt_quire<nbits, rbits, arithmetic, bt, capacity>& q) {
+	return ostr << q.to_fixpnt();
+}
+
+/// //////////////////////////////////////////////////////////////////
+/// fused dot product operators for fixed-point
+/// fdp_qc         fused dot product with quire continuation
+/// fdp_stride     fused dot product with non-negative stride
+/// fdp            fused dot product of two vectors
+
+// Fused dot product with quire continuation
+template<size_t nbits, size_t rbits, bool arithmetic, typename bt, size_t capacity, typename Vector>
+void fdp_qc(fixpnt_quire<nbits, rbits, arithmetic, bt, capacity>& sum_of_products, size_t n, const Vector& x, size_t incx, const Vector& y, size_t incy) {
+	size_t ix, iy;
+	for (ix = 0, iy = 0; ix < n && iy < n; ix = ix + incx, iy = iy + incy) {
+		sum_of_products.fma(x[ix], y[iy]);
+	}
+}
+
+// Resolved fused dot product with non-negative stride
+template<typename Vector>
+enable_if_fixpnt<value_type<Vector>, value_type<Vector> > // as return type
+fdp_stride(size_t n, const Vector& x, size_t incx, const Vector& y, size_t incy) {
+	typename fixpnt_quire_trait<value_type<Vector> >::type q;
+	size_t ix, iy;
+	for (ix = 0, iy = 0; ix < n && iy < n; ix = ix + incx, iy = iy + incy) {
+		q.fma(x[ix], y[iy]);
+	}
+	return q.to_fixpnt();  // one and only rounding step of the fused-dot product
+}
+
+// Resolved fused dot product that assumes unit stride
+template<typename Vector>
+enable_if_fixpnt<value_type<Vector>, value_type<Vector> > // as return type
+fdp(const Vector& x, const Vector& y) {
+	typename fixpnt_quire_trait<value_type<Vector> >::type q;
+	size_t n = (x.size() < y.size() ? x.size() : y.size());
+	for (size_t i = 0; i < n; ++i) {
+		q.fma(x[i], y[i]);
+	}
+	return q.to_fixpnt();  // one and only rounding step of the fused-dot product
+}
+
+}} // namespace sw::unum
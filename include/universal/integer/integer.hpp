@@ -11,8 +11,12 @@
 #include <regex>
 #include <vector>
 #include <map>
+#include <cstring>
+#include <limits>
+#include <type_traits>
 
 #include "./integer_exceptions.hpp"
+#include "../blockbin/limb_arithmetic.hpp"
 
 #if defined(__clang__)
 /* Clang/LLVM. ---------------------------------------------- */
@@ -80,40 +84,24 @@ inline long scale(const integer<nbits, BlockType>& i) {
 		}
 	}
 	// calculate scale
-	long scale = 0;
-	while (v > 1) {
-		++scale;
-		v >>= 1;
-	}
-	return scale;
+	signed msb = findMsb(v);
+	return long(msb < 0 ? 0 : msb);
 }
 
 template<size_t nbits, typename BlockType>
 inline void convert(int64_t v, integer<nbits, BlockType>& result) {
-	constexpr uint64_t mask = 0x1;
-	bool negative = (v < 0 ? true : false);
-	result.clear();
-	unsigned upper = (nbits <= 64 ? nbits : 64);
-	for (unsigned i = 0; i < upper && v != 0; ++i) {
-		if (v & mask) result.set(i);
-		v >>= 1;
-	}
-	if (nbits > 64 && negative) {
-		// sign extend
-		for (unsigned i = upper; i < nbits; ++i) {
-			result.set(i);
+	result.set_raw_bits(uint64_t(v));
+	if (nbits > 64 && v < 0) {
+		// sign extend: 64 is a multiple of the block size, so the extension starts at a block boundary
+		constexpr size_t firstBlock = 64 / integer<nbits, BlockType>::bitsInBlock;
+		for (size_t i = firstBlock; i < integer<nbits, BlockType>::nrBlocks; ++i) {
+			result.setblock(i, BlockType(~BlockType(0)));
 		}
 	}
 }
 template<size_t nbits, typename BlockType>
 inline void convert_unsigned(uint64_t v, integer<nbits, BlockType>& result) {
-	constexpr uint64_t mask = 0x1;
-	result.clear();
-	unsigned upper = (nbits <= 64 ? nbits : 64);
-	for (unsigned i = 0; i < upper; ++i) {
-		if (v & mask) result.set(i);
-		v >>= 1;
-	}
+	result.set_raw_bits(v);
 }
 
 template<size_t nbits, typename BlockType>
@@ -144,14 +132,24 @@ allowable range of numbers, and their sum is between them, it must fit as well.
 When implementing addition/subtraction on chuncks the overflow condition must be deduced from the 
 chunk values. The chunks need to be interpreted as unsigned binary segments.
 */
+
 // integer is an arbitrary size 2's complement integer
+// the bits are stored in an array of BlockType limbs, least significant limb first:
+// uint8_t limbs are the default, uint32_t or uint64_t limbs process a large integer a word at a time
 template<size_t _nbits, typename BlockType = uint8_t>
 class integer {
 public:
+	static_assert(std::is_integral<BlockType>::value && std::is_unsigned<BlockType>::value, "integer<nbits, BlockType>: BlockType must be an unsigned integer type");
+	static_assert(sizeof(BlockType) <= 8, "integer<nbits, BlockType>: BlockType must be uint8_t, uint16_t, uint32_t, or uint64_t");
 	static constexpr size_t nbits = _nbits;
+	static constexpr size_t bitsInByte = 8;
+	static constexpr size_t bitsInBlock = sizeof(BlockType) * bitsInByte;
+	static constexpr size_t bytesInBlock = sizeof(BlockType);
 	static constexpr unsigned nrBytes = (1 + ((nbits - 1) / 8));
-	static constexpr unsigned MS_BYTE = nrBytes - 1;
-	static constexpr uint8_t MS_BYTE_MASK = (0xFF >> (nrBytes * 8 - nbits));
+	static constexpr size_t nrBlocks = 1 + ((nbits - 1) / bitsInBlock);
+	static constexpr size_t MSU = nrBlocks - 1; // MSU == Most Significant Unit
+	static constexpr BlockType ALL_ONES = BlockType(~BlockType(0));
+	static constexpr BlockType MSU_MASK = BlockType(ALL_ONES >> (nrBlocks * bitsInBlock - nbits));
 
 	integer() { setzero(); }
 
@@ -166,10 +164,11 @@ public:
 	integer(const integer<srcbits, BlockType>& a) {
 //		static_assert(srcbits > nbits, "Source integer is bigger than target: potential loss of precision"); // TODO: do we want this?
 		bitcopy(a);
-		if (a.sign()) { // sign extend
-			for (int i = int(srcbits); i < int(nbits); ++i) {
-				set(i);
-			}
+		if (a.sign() && nbits > srcbits) { // sign extend: first up to a block boundary, then full blocks
+			size_t i = srcbits;
+			for (; i < nbits && (i % bitsInBlock) != 0; ++i) set(unsigned(i));
+			for (i = (i + bitsInBlock - 1) / bitsInBlock; i < nrBlocks; ++i) _block[i] = ALL_ONES;
+			_block[MSU] &= MSU_MASK;
 		}
 	}
 
@@ -339,7 +338,7 @@ public:
 	}
 	integer& operator++() {
 		*this += integer<nbits, BlockType>(1);
-		b[MS_BYTE] = b[MS_BYTE] & MS_BYTE_MASK; // assert precondition of properly nulled leading non-bits
+		_block[MSU] &= MSU_MASK; // assert precondition of properly nulled leading non-bits
 		return *this;
 	}
 	// decrement
@@ -350,7 +349,7 @@ public:
 	}
 	integer& operator--() {
 		*this -= integer<nbits, BlockType>(1);
-		b[MS_BYTE] = b[MS_BYTE] & MS_BYTE_MASK; // assert precondition of properly nulled leading non-bits
+		_block[MSU] &= MSU_MASK; // assert precondition of properly nulled leading non-bits
 		return *this;
 	}
 	// conversion operators
@@ -370,17 +369,12 @@ public:
 	// arithmetic operators
 	integer& operator+=(const integer& rhs) {
 		integer<nbits, BlockType> sum;
-		bool carry = false;
-		for (unsigned i = 0; i < nrBytes; ++i) {
-			// cast up so we can test for overflow
-			uint16_t l = uint16_t(b[i]);
-			uint16_t r = uint16_t(rhs.b[i]);
-			uint16_t s = l + r + (carry ? uint16_t(0x0001) : uint16_t(0x0000));
-			carry = (s > 255 ? true : false);
-			sum.b[i] = (uint8_t)(s & 0xFF);
+		BlockType carry = 0;
+		for (size_t i = 0; i < nrBlocks; ++i) {
+			sum._block[i] = addcarry(_block[i], rhs._block[i], carry);
 		}
 		// enforce precondition for fast comparison by properly nulling bits that are outside of nbits
-		sum.b[MS_BYTE] = MS_BYTE_MASK & sum.b[MS_BYTE];
+		sum._block[MSU] &= MSU_MASK;
 #if INTEGER_THROW_ARITHMETIC_EXCEPTION
 		if (carry) throw integer_overflow();
 #endif
@@ -388,21 +382,48 @@ public:
 		return *this;
 	}
 	integer& operator-=(const integer& rhs) {
-		operator+=(twos_complement(rhs));
+		BlockType borrow = 0;
+		for (size_t i = 0; i < nrBlocks; ++i) {
+			_block[i] = subborrow(_block[i], rhs._block[i], borrow);
+		}
+		// enforce precondition for fast comparison by properly nulling bits that are outside of nbits
+		_block[MSU] &= MSU_MASK;
 		return *this;
 	}
 	integer& operator*=(const integer& rhs) {
-		integer<nbits, BlockType> base(*this);
-		integer<nbits, BlockType> multiplicant(rhs);
-		clear();
-		for (unsigned i = 0; i < nbits; ++i) {
-			if (base.at(i)) {
-				operator+=(multiplicant);
-			}
-			multiplicant <<= 1;
+#if INTEGER_THROW_ARITHMETIC_EXCEPTION
+		// multiply the magnitudes in full precision so that we can detect that the product does not fit
+		bool negative = sign() ^ rhs.sign();
+		integer<nbits, BlockType> a(sign() ? -*this : *this);
+		integer<nbits, BlockType> b(rhs.sign() ? -rhs : rhs);
+		BlockType product[2 * nrBlocks];
+		limb_multiply(product, a._block, nrBlocks, b._block, nrBlocks);
+		// the magnitude must be < 2^(nbits-1), or == 2^(nbits-1) for a negative product
+		constexpr size_t signBlock = (nbits - 1) / bitsInBlock;
+		constexpr BlockType signBit = BlockType(BlockType(1) << ((nbits - 1) % bitsInBlock));
+		bool fits = true;
+		for (size_t i = signBlock + 1; i < 2 * nrBlocks; ++i) fits = fits && (product[i] == 0);
+		BlockType upper = BlockType(product[signBlock] & BlockType(~BlockType(signBit - 1)));
+		if (upper == signBit && negative) {
+			// only maxneg itself may use the sign bit
+			fits = fits && ((product[signBlock] & BlockType(signBit - 1)) == 0);
+			for (size_t i = 0; i < signBlock; ++i) fits = fits && (product[i] == 0);
 		}
-		// since we used operator+=, which enforces the nulling of leading bits
-		// we don't need to null here
+		else {
+			fits = fits && (upper == 0);
+		}
+		if (!fits) throw integer_overflow();
+		for (size_t i = 0; i < nrBlocks; ++i) _block[i] = product[i];
+		_block[MSU] &= MSU_MASK;
+		if (negative && !iszero()) *this = -*this;
+#else
+		// 2's complement multiplication modulo 2^nbits only needs the lower half of the limb product
+		BlockType product[nrBlocks];
+		limb_multiply_low(product, _block, rhs._block, nrBlocks);
+		for (size_t i = 0; i < nrBlocks; ++i) _block[i] = product[i];
+		// enforce precondition for fast comparison by properly nulling bits that are outside of nbits
+		_block[MSU] &= MSU_MASK;
+#endif
 		return *this;
 	}
 	integer& operator/=(const integer& rhs) {
@@ -425,11 +446,20 @@ public:
 			clear();
 			return *this;
 		}
-		integer<nbits, BlockType> target;
-		for (unsigned i = shift; i < nbits; ++i) {  // TODO: inefficient as it works at the bit level
-			target.set(i, at(i - shift));
+		// move whole blocks first, then funnel the remaining bits across the block boundaries
+		size_t blockShift = size_t(shift) / bitsInBlock;
+		size_t bitShift = size_t(shift) % bitsInBlock;
+		if (blockShift > 0) {
+			for (size_t i = MSU; i >= blockShift; --i) _block[i] = _block[i - blockShift];
+			for (size_t i = 0; i < blockShift; ++i) _block[i] = BlockType(0);
 		}
-		*this = target;
+		if (bitShift > 0) {
+			for (size_t i = MSU; i > blockShift; --i) {
+				_block[i] = BlockType((_block[i] << bitShift) | (_block[i - 1] >> (bitsInBlock - bitShift)));
+			}
+			_block[blockShift] = BlockType(_block[blockShift] << bitShift);
+		}
+		_block[MSU] &= MSU_MASK; // assert precondition of properly nulled leading non-bits
 		return *this;
 	}
 	integer& operator>>=(const signed shift) {
@@ -442,248 +472,184 @@ public:
 			clear();
 			return *this;
 		}
-		integer<nbits, BlockType> target;
-		for (int i = nbits - 1; i >= int(shift); --i) {  // TODO: inefficient as it works at the bit level
-			target.set(i - shift, at(i));
+		// logical shift: the leading non-bits are nulled, so zeros shift in from the top
+		size_t blockShift = size_t(shift) / bitsInBlock;
+		size_t bitShift = size_t(shift) % bitsInBlock;
+		size_t lastBlock = MSU - blockShift;
+		if (blockShift > 0) {
+			for (size_t i = 0; i + blockShift < nrBlocks; ++i) _block[i] = _block[i + blockShift];
+			for (size_t i = lastBlock + 1; i < nrBlocks; ++i) _block[i] = BlockType(0);
+		}
+		if (bitShift > 0) {
+			for (size_t i = 0; i < lastBlock; ++i) {
+				_block[i] = BlockType((_block[i] >> bitShift) | (_block[i + 1] << (bitsInBlock - bitShift)));
+			}
+			_block[lastBlock] = BlockType(_block[lastBlock] >> bitShift);
 		}
-		*this = target;
 		return *this;
 	}
 	integer& operator&=(const integer& rhs) {
-		for (unsigned i = 0; i < nrBytes; ++i) {
-			b[i] &= rhs.b[i];
+		for (size_t i = 0; i < nrBlocks; ++i) {
+			_block[i] &= rhs._block[i];
 		}
-		b[MS_BYTE] &= MS_BYTE_MASK;
+		_block[MSU] &= MSU_MASK;
 		return *this;
 	}
 	integer& operator|=(const integer& rhs) {
-		for (unsigned i = 0; i < nrBytes; ++i) {
-			b[i] |= rhs.b[i];
+		for (size_t i = 0; i < nrBlocks; ++i) {
+			_block[i] |= rhs._block[i];
 		}
-		b[MS_BYTE] &= MS_BYTE_MASK;
+		_block[MSU] &= MSU_MASK;
 		return *this;
 	}
 	integer& operator^=(const integer& rhs) {
-		for (unsigned i = 0; i < nrBytes; ++i) {
-			b[i] ^= rhs.b[i];
+		for (size_t i = 0; i < nrBlocks; ++i) {
+			_block[i] ^= rhs._block[i];
 		}
-		b[MS_BYTE] &= MS_BYTE_MASK;
+		_block[MSU] &= MSU_MASK;
 		return *this;
 	}
 
 	// modifiers
-	inline void clear() { std::memset(&b, 0, nrBytes); }
+	inline void clear() { std::memset(&_block, 0, sizeof(_block)); }
 	inline void setzero() { clear(); }
 	inline void set(unsigned int i) {
 		if (i < nbits) {
-			uint8_t byte = b[i / 8];
-			uint8_t mask = 1 << (i % 8);
-			b[i / 8] = byte | mask;
+			_block[i / bitsInBlock] |= BlockType(BlockType(1) << (i % bitsInBlock));
 			return;
 		}
 		throw "integer<nbits, BlockType> bit index out of bounds";
 	}
 	inline void reset(unsigned int i) {
 		if (i < nbits) {
-			uint8_t byte = b[i / 8];
-			uint8_t mask = ~(1 << (i % 8));
-			b[i / 8] = byte & mask;
+			_block[i / bitsInBlock] &= BlockType(~(BlockType(1) << (i % bitsInBlock)));
 			return;
 		}
 		throw "integer<nbits, BlockType> bit index out of bounds";
 	}
 	inline void set(unsigned i, bool v) {
 		if (i < nbits) {
-			uint8_t byte = b[i / 8];
-			uint8_t null = ~(1 << (i % 8));
-			uint8_t bit = (v ? 1 : 0);
-			uint8_t mask = (bit << (i % 8));
-			b[i / 8] = (byte & null) | mask;
+			BlockType block = _block[i / bitsInBlock];
+			BlockType null = BlockType(~(BlockType(1) << (i % bitsInBlock)));
+			BlockType mask = BlockType(BlockType(v ? 1 : 0) << (i % bitsInBlock));
+			_block[i / bitsInBlock] = (block & null) | mask;
 			return;
 		}
 		throw "integer<nbits, BlockType> bit index out of bounds";
 	}
 	inline void setbyte(unsigned i, uint8_t value) {
-		if (i < nrBytes) { b[i] = value; return; }
+		if (i < nrBytes) {
+			unsigned shift = unsigned((i % bytesInBlock) * bitsInByte);
+			BlockType block = _block[i / bytesInBlock];
+			BlockType null = BlockType(~(BlockType(0xFF) << shift));
+			_block[i / bytesInBlock] = (block & null) | BlockType(BlockType(value) << shift);
+			// enforce precondition for fast comparison by properly nulling bits that are outside of nbits
+			_block[MSU] &= MSU_MASK;
+			return;
+		}
 		throw integer_byte_index_out_of_bounds{};
 	}
+	inline void setblock(size_t i, BlockType value) {
+		if (i < nrBlocks) {
+			_block[i] = value;
+			// enforce precondition for fast comparison by properly nulling bits that are outside of nbits
+			_block[MSU] &= MSU_MASK;
+			return;
+		}
+		throw "integer<nbits, BlockType> block index out of bounds";
+	}
 	// use un-interpreted raw bits to set the bits of the integer
 	inline void set_raw_bits(unsigned long long value) {
 		clear();
-		for (unsigned i = 0; i < nrBytes; ++i) {
-			b[i] = value & 0xFF;
-			value >>= 8;
+		for (size_t i = 0; i < nrBlocks && i * bitsInBlock < 64; ++i) {
+			_block[i] = BlockType(value);
+			if constexpr (bitsInBlock < 64) value >>= bitsInBlock;
 		}
 		// enforce precondition for fast comparison by properly nulling bits that are outside of nbits
-		b[MS_BYTE] = MS_BYTE_MASK & b[MS_BYTE];
+		_block[MSU] &= MSU_MASK;
 	}
 	inline integer& assign(const std::string& txt) {
 		if (!parse(txt, *this)) {
 			std::cerr << "Unable to parse: " << txt << std::endl;
 		}
 		// enforce precondition for fast comparison by properly nulling bits that are outside of nbits
-		b[MS_BYTE] = MS_BYTE_MASK & b[MS_BYTE];
+		_block[MSU] &= MSU_MASK;
 		return *this;
 	}
 	// pure bit copy of source integer, no sign extension
 	template<size_t src_nbits>
 	inline void bitcopy(const integer<src_nbits, BlockType>& src) {
-		int lastByte = (nrBytes < src.nrBytes ? nrBytes : src.nrBytes);
+		size_t lastBlock = (nrBlocks < src.nrBlocks ? nrBlocks : src.nrBlocks);
 		clear();
-		for (int i = 0; i < lastByte; ++i) {
-			b[i] = src.byte(i);
+		for (size_t i = 0; i < lastBlock; ++i) {
+			_block[i] = src.block(i);
 		}
-		b[MS_BYTE] = b[MS_BYTE] & MS_BYTE_MASK; // assert precondition of properly nulled leading non-bits
+		_block[MSU] &= MSU_MASK; // assert precondition of properly nulled leading non-bits
 	}
 	// in-place one's complement
 	inline integer& flip() {
-		for (unsigned i = 0; i < nrBytes; ++i) {
-			b[i] = ~b[i];
+		for (size_t i = 0; i < nrBlocks; ++i) {
+			_block[i] = BlockType(~_block[i]);
 		}
-		b[MS_BYTE] = b[MS_BYTE] & MS_BYTE_MASK; // assert precondition of properly nulled leading non-bits
+		_block[MSU] &= MSU_MASK; // assert precondition of properly nulled leading non-bits
 		return *this;
 	}
 
 	// selectors
 	inline bool iszero() const {
-		for (unsigned i = 0; i < nrBytes; ++i) {
-			if (b[i] != 0x00) return false;
+		for (size_t i = 0; i < nrBlocks; ++i) {
+			if (_block[i] != 0) return false;
 		}
 		return true;
 	}
 	inline bool isone() const {
-		for (unsigned i = 0; i < nrBytes; ++i) {
-			if (i == 0) {
-				if (b[0] != 0x01) return false;
-			}
-			else {
-				if (b[i] != 0x00) return false;
-			}
+		if (_block[0] != 0x01) return false;
+		for (size_t i = 1; i < nrBlocks; ++i) {
+			if (_block[i] != 0) return false;
 		}
 		return true;
 	}
 	inline bool isodd() const {
-		return (b[0] & 0x01) ? true : false;
+		return (_block[0] & 0x01) ? true : false;
 	}
 	inline bool iseven() const {
 		return !isodd();
 	}
-	inline bool sign() const { return at(nbits - 1); }
+	inline bool sign() const { return (_block[MSU] >> ((nbits - 1) % bitsInBlock)) & 0x01; }
 	inline bool at(size_t i) const {
 		if (i < nbits) {
-			uint8_t byte = b[i / 8];
-			uint8_t mask = 1 << (i % 8);
-			return (byte & mask);
+			return (_block[i / bitsInBlock] >> (i % bitsInBlock)) & 0x01;
 		}
 		throw "bit index out of bounds";
 	}
 	inline uint8_t byte(unsigned int i) const {
-		if (i < nrBytes) return b[i];
+		if (i < nrBytes) return uint8_t(_block[i / bytesInBlock] >> ((i % bytesInBlock) * bitsInByte));
 		throw integer_byte_index_out_of_bounds{};
 	}
+	inline BlockType block(size_t i) const {
+		if (i < nrBlocks) return _block[i];
+		throw "integer<nbits, BlockType> block index out of bounds";
+	}
 
 protected:
 	// HELPER methods
 
-	// conversion functions
-	short to_short() const {
-		constexpr unsigned sizeofshort = 8 * sizeof(short);
-		short s = 0;
-		short mask = 1;
-		unsigned upper = (nbits < sizeofshort ? nbits : sizeofshort);
-		for (unsigned i = 0; i < upper; ++i) {
-			s |= at(i) ? mask : 0;
-			mask <<= 1;
-		}
-		if (sign() && upper < sizeofshort) { // sign extend
-			for (unsigned i = upper; i < sizeofshort; ++i) {
-				s |= mask;
-				mask <<= 1;
-			}
-		}
-		return s;
-	}
-	int to_int() const {
-		constexpr unsigned sizeofint = 8 * sizeof(int);
-		int value = 0;
-		int mask = 1;
-		unsigned upper = (nbits < sizeofint ? nbits : sizeofint);
-		for (unsigned i = 0; i < upper; ++i) {
-			value |= at(i) ? mask : 0;
-			mask <<= 1;
-		}
-		if (sign() && upper < sizeofint) { // sign extend
-			for (unsigned i = upper; i < sizeofint; ++i) {
-				value |= mask;
-				mask <<= 1;
-			}
-		}
-		return value;
-	}
-	long to_long() const {
-		constexpr unsigned sizeoflong = 8 * sizeof(long);
-		long l = 0;
-		long mask = 1;
-		unsigned upper = (nbits < sizeoflong ? nbits : sizeoflong);
-		for (unsigned i = 0; i < upper; ++i) {
-			l |= at(i) ? mask : 0;
-			mask <<= 1;
-		}
-		if (sign() && upper < sizeoflong) { // sign extend
-			for (unsigned i = upper; i < sizeoflong; ++i) {
-				l |= mask;
-				mask <<= 1;
-			}
-		}
-		return l;
-	}
+	// conversion functions: the native types receive the least significant bits, sign extended when nbits is smaller
+	short to_short() const { return short(to_long_long()); }
+	int to_int() const { return int(to_long_long()); }
+	long to_long() const { return long(to_long_long()); }
 	long long to_long_long() const {
-		constexpr unsigned sizeoflonglong = 8 * sizeof(long long);
-		long long ll = 0;
-		long long mask = 1;
-		unsigned upper = (nbits < sizeoflonglong ? nbits : sizeoflonglong);
-		for (unsigned i = 0; i < upper; ++i) {
-			ll |= at(i) ? mask : 0;
-			mask <<= 1;
-		}
-		if (sign() && upper < sizeoflonglong) { // sign extend
-			for (unsigned i = upper; i < sizeoflonglong; ++i) {
-				ll |= mask;
-				mask <<= 1;
-			}
-		}
-		return ll;
-	}
-	unsigned short to_ushort() const {
-		if (iszero()) return 0;
-		unsigned short us;
-		char* p = (char*)&us;
-		*p = b[0];
-		*(p + 1) = b[1];
-		return us;
-	}
-	unsigned int to_uint() const {
-		unsigned int ui;
-		char* p = (char*)&ui;
-		*p = b[0];
-		*(p + 1) = b[1];
-		*(p + 2) = b[2];
-		*(p + 3) = b[3];
-		return ui;
-	}
-	unsigned long to_ulong() const {
-		unsigned long ul = 0;
-		char* p = (char*)&ul;
-		for (int i = 0; i < nrBytes; ++i) {
-			*(p + i) = b[i];
-		}
-		return ul;
+		unsigned long long ull = to_ulong_long();
+		if (nbits < 64 && sign()) ull |= (0xFFFFFFFFFFFFFFFFull << (nbits % 64)); // sign extend
+		return (long long)ull;
 	}
+	unsigned short to_ushort() const { return (unsigned short)to_ulong_long(); }
+	unsigned int to_uint() const { return (unsigned int)to_ulong_long(); }
+	unsigned long to_ulong() const { return (unsigned long)to_ulong_long(); }
 	unsigned long long to_ulong_long() const {
 		unsigned long long ull = 0;
-		char* p = (char*)&ull;
-		for (int i = 0; i < nrBytes; ++i) {
-			*(p + i) = b[i];
+		for (size_t i = 0; i < nrBlocks && i * bitsInBlock < 64; ++i) {
+			ull |= (unsigned long long)(_block[i]) << (i * bitsInBlock);
 		}
 		return ull;
 	}
@@ -708,7 +674,7 @@ protected:
 	}
 
 private:
-	uint8_t b[nrBytes];
+	BlockType _block[nrBlocks];
 
 	// convert
 	template<size_t nnbits, typename BBlockType>
@@ -717,6 +683,8 @@ private:
 	// integer - integer logic comparisons
 	template<size_t nnbits, typename BBlockType>
 	friend bool operator==(const integer<nnbits, BBlockType>& lhs, const integer<nnbits, BBlockType>& rhs);
+	template<size_t nnbits, typename BBlockType>
+	friend bool operator< (const integer<nnbits, BBlockType>& lhs, const integer<nnbits, BBlockType>& rhs);
 
 	// integer - literal logic comparisons
 	template<size_t nnbits, typename BBlockType>
@@ -953,20 +921,38 @@ std::string convert_to_decimal_string(const integer<nbits, BlockType>& value) {
 // findMsb takes an integer<nbits, BlockType> reference and returns the position of the most significant bit, -1 if v == 0
 template<size_t nbits, typename BlockType>
 inline signed findMsb(const integer<nbits, BlockType>& v) {
-	for (signed i = v.nrBytes - 1; i >= 0; --i) {
-		if (v.b[i] != 0) {
-			uint8_t mask = 0x80;
-			for (signed j = 7; j >= 0; --j) {
-				if (v.b[i] & mask) {
-					return i * 8 + j;
-				}
-				mask >>= 1;
-			}
-		}
+	constexpr signed bitsInBlock = signed(integer<nbits, BlockType>::bitsInBlock);
+	for (signed i = signed(v.MSU); i >= 0; --i) {
+		BlockType block = v._block[i];
+		if (block != 0) return i * bitsInBlock + (bitsInBlock - 1 - limb_clz(block));
+	}
+	return -1; // no significant bit found, all bits are zero
+}
+
+// findLsb takes an integer<nbits, BlockType> reference and returns the position of the least significant bit, -1 if v == 0
+template<size_t nbits, typename BlockType>
+inline signed findLsb(const integer<nbits, BlockType>& v) {
+	constexpr signed bitsInBlock = signed(integer<nbits, BlockType>::bitsInBlock);
+	for (signed i = 0; i < signed(v.nrBlocks); ++i) {
+		BlockType block = v.block(size_t(i));
+		if (block != 0) return i * bitsInBlock + limb_ctz(block);
 	}
 	return -1; // no significant bit found, all bits are zero
 }
 
+// number of leading zero bits of the nbits encoding, nbits if v == 0
+template<size_t nbits, typename BlockType>
+inline int countLeadingZeros(const integer<nbits, BlockType>& v) {
+	return int(nbits) - 1 - findMsb(v);
+}
+
+// number of trailing zero bits of the nbits encoding, nbits if v == 0
+template<size_t nbits, typename BlockType>
+inline int countTrailingZeros(const integer<nbits, BlockType>& v) {
+	signed lsb = findLsb(v);
+	return (lsb < 0 ? int(nbits) : lsb);
+}
+
 ////////////////////////    INTEGER operators   /////////////////////////////////
 
 // divide integer<nbits, BlockType> a and b and return result argument
@@ -1007,48 +993,36 @@ idiv_t<nbits, BlockType> idiv(const integer<nbits, BlockType>& _a, const integer
 		std::cerr << "integer_divide_by_zero\n";
 #endif // INTEGER_THROW_ARITHMETIC_EXCEPTION
 	}
-	// generate the absolute values to do long division 
-	// 2's complement special case -max requires an signed int that is 1 bit bigger to represent abs()
+	// the magnitudes of nbits 2's complement numbers fit in nbits unsigned bits: -maxneg is 2^(nbits-1)
+	using Integer = integer<nbits, BlockType>;
+	constexpr size_t nrBlocks = Integer::nrBlocks;
 	bool a_negative = _a.sign();
 	bool b_negative = _b.sign();
 	bool result_negative = (a_negative ^ b_negative);
-	integer<nbits + 1, BlockType> a; a.bitcopy(a_negative ? -_a : _a);
-	integer<nbits + 1, BlockType> b; b.bitcopy(b_negative ? -_b : _b);
+	Integer a_magnitude(a_negative ? -_a : _a);
+	Integer b_magnitude(b_negative ? -_b : _b);
+	BlockType a[nrBlocks], b[nrBlocks];
+	for (size_t i = 0; i < nrBlocks; ++i) {
+		a[i] = a_magnitude.block(i);
+		b[i] = b_magnitude.block(i);
+	}
+	size_t m = limb_significant(a, nrBlocks);
+	size_t n = limb_significant(b, nrBlocks);
 	idiv_t<nbits, BlockType> divresult;
-	if (a < b) {
+	if (n == 0) return divresult;  // division by zero without exceptions yields 0
+	if (m < n) {
 		divresult.rem = _a; // a % b = a when a / b = 0
 		return divresult; // a / b = 0 when b > a
 	}
-	// initialize the long division
-	integer<nbits + 1, BlockType> accumulator = a;
-	// prepare the subtractand
-	integer<nbits + 1, BlockType> subtractand = b;
-	int msb_b = findMsb(b);
-	int msb_a = findMsb(a);
-	int shift = msb_a - msb_b;
-	subtractand <<= shift;
-	// long division
-	for (int i = shift; i >= 0; --i) {
-		if (subtractand <= accumulator) {
-			accumulator -= subtractand;
-			divresult.quot.set(i);
-		}
-		else {
-			divresult.quot.reset(i);
-		}
-		subtractand >>= 1;
-	}
-	if (result_negative) {  // take 2's complement
-		divresult.quot.flip();
-		divresult.quot += 1;
-	} 
-	if (_a < integer<nbits, BlockType>(0)) {
-		divresult.rem = -accumulator;
+	// word-level long division
+	BlockType q[nrBlocks] = { 0 }, r[nrBlocks] = { 0 }, ws[2 * nrBlocks + 1];
+	limb_divmod(q, r, a, m, b, n, ws);
+	for (size_t i = 0; i < nrBlocks; ++i) {
+		divresult.quot.setblock(i, q[i]);
+		divresult.rem.setblock(i, r[i]);
 	}
-	else {
-		divresult.rem = accumulator;
-	}
-
+	if (result_negative && !divresult.quot.iszero()) divresult.quot = -divresult.quot;
+	if (a_negative && !divresult.rem.iszero()) divresult.rem = -divresult.rem;
 	return divresult;
 }
 
@@ -1232,8 +1206,8 @@ inline std::string to_binary(const integer<nbits, BlockType>& number) {
 // equal: precondition is that the storage is properly nulled in all arithmetic paths
 template<size_t nbits, typename BlockType>
 inline bool operator==(const integer<nbits, BlockType>& lhs, const integer<nbits, BlockType>& rhs) {
-	for (unsigned i = 0; i < lhs.nrBytes; ++i) {
-		if (lhs.b[i] != rhs.b[i]) return false;
+	for (size_t i = 0; i < lhs.nrBlocks; ++i) {
+		if (lhs._block[i] != rhs._block[i]) return false;
 	}
 	return true;
 }
@@ -1247,18 +1221,9 @@ inline bool operator< (const integer<nbits, BlockType>& lhs, const integer<nbits
 	bool rhs_is_negative = rhs.sign();
 	if (lhs_is_negative && !rhs_is_negative) return true;
 	if (rhs_is_negative && !lhs_is_negative) return false;
-	// arguments have the same sign
-	for (int i = nbits - 1; i >= 0; --i) {
-		bool a = lhs.at(i);
-		bool b = rhs.at(i);
-		if (a ^ b) {
-			if (a == false) {
-				return true; 
-			}
-			else {
-				return false;
-			}
-		}
+	// arguments have the same sign, so the unsigned order of the limbs is the order of the values
+	for (signed i = signed(lhs.MSU); i >= 0; --i) {
+		if (lhs._block[i] != rhs._block[i]) return lhs._block[i] < rhs._block[i];
 	}
 	return false; // lhs and rhs are the same
 }
@@ -1392,6 +1357,20 @@ inline integer<nbits, BlockType> operator^(const integer<nbits, BlockType>& lhs,
 	bitwise ^= rhs;
 	return bitwise;
 }
+// BINARY SHIFT LEFT
+template<size_t nbits, typename BlockType>
+inline integer<nbits, BlockType> operator<<(const integer<nbits, BlockType>& lhs, const signed shift) {
+	integer<nbits, BlockType> shifted = lhs;
+	shifted <<= shift;
+	return shifted;
+}
+// BINARY SHIFT RIGHT
+template<size_t nbits, typename BlockType>
+inline integer<nbits, BlockType> operator>>(const integer<nbits, BlockType>& lhs, const signed shift) {
+	integer<nbits, BlockType> shifted = lhs;
+	shifted >>= shift;
+	return shifted;
+}
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 // integer - literal binary arithmetic operators
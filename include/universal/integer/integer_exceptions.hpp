@@ -48,6 +48,11 @@ struct integer_overflow : public std::runtime_error {
 	integer_overflow() : std::runtime_error("integer arithmetic overflow") {}
 };
 
+// modulus exception for the modular reduction contexts
+struct integer_invalid_modulus : public std::runtime_error {
+	integer_invalid_modulus() : std::runtime_error("invalid modulus for modular reduction") {}
+};
+
 ///////////////////////////////////////////////////////////////
 // internal implementation exceptions
 
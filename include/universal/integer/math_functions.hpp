@@ -55,9 +55,13 @@ integer<nbits, BlockType> floor_sqrt(const integer<nbits, BlockType>& a) {
 	if (a < 0) throw "negative argument to floor_sqrt";
 
 	using Integer = integer<nbits, BlockType>;
+	// sqrt(a) < 2^(msb/2 + 1) bounds the search interval to half the bits of a
 	Integer start(1), end(a), v(a), root(0);
+	Integer bound(1);
+	bound <<= findMsb(a) / 2 + 1;
+	if (bound < end) end = bound;
 	while (start <= end) {
-		Integer midpoint = start + (end - start) / 2;
+		Integer midpoint = start + ((end - start) >> 1);
 //		std::cout << start << " : " << midpoint << " : " << end << " = " << root << std::endl;
 		if (midpoint == v / midpoint) return midpoint;
 		if (midpoint  < v / midpoint) {   // midpoint * midpoint can overflow badly hence the use of divide to stay in the numerical range of Integer
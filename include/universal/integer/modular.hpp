@@ -0,0 +1,198 @@
+#pragma once
+// modular.hpp: reduction contexts for repeated modular arithmetic against a fixed modulus
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include "./integer_exceptions.hpp"
+
+/*
+ Modular exponentiation spends all its time reducing double-width products modulo the same m.
+ Both contexts below precompute a modulus-dependent constant once, so that every reduction
+ is a couple of limb multiplies instead of a long division:
+   - montgomery<nbits, BlockType>: odd moduli only, operands live in the Montgomery domain a * R mod m
+   - barrett<nbits, BlockType>   : any positive modulus, operands stay in the normal domain
+ The modulus must be positive, so it is smaller than 2^(nbits-1): the intermediate sums never overflow the limbs.
+ A modulus that is not positive, or even for Montgomery, throws integer_invalid_modulus.
+ Operands and results are residues in [0, m), exponents are non-negative.
+ */
+
+namespace sw { namespace unum {
+
+// reduce a to its residue in [0, m)
+template<size_t nbits, typename BlockType>
+inline integer<nbits, BlockType> residue(const integer<nbits, BlockType>& a, const integer<nbits, BlockType>& m) {
+	integer<nbits, BlockType> r = a % m;
+	if (r.sign()) r += m;
+	return r;
+}
+
+// Montgomery multiplication context for a fixed odd modulus m
+// with R = 2^(nrBlocks * bitsInBlock), multiply(a, b) = a * b * R^-1 mod m only needs limb multiplies and shifts
+template<size_t nbits, typename BlockType = uint8_t>
+class montgomery {
+public:
+	using Integer = integer<nbits, BlockType>;
+	static constexpr size_t nrBlocks = Integer::nrBlocks;
+
+	explicit montgomery(const Integer& modulus) : m(modulus) {
+		if (modulus.sign() || !modulus.isodd()) throw integer_invalid_modulus{};
+		for (size_t i = 0; i < nrBlocks; ++i) mlimbs[i] = m.block(i);
+		// Newton iteration for m^-1 mod B: every step doubles the number of correct bits, starting with 3
+		uint64_t inv = mlimbs[0];
+		for (int i = 0; i < 6; ++i) inv *= 2 - uint64_t(mlimbs[0]) * inv;
+		minv = BlockType(0 - inv);
+		// R^2 mod m converts operands into the Montgomery domain
+		BlockType u[2 * nrBlocks + 1] = { 0 };
+		u[2 * nrBlocks] = 1;
+		size_t n = limb_significant(mlimbs, nrBlocks);
+		BlockType q[2 * nrBlocks + 1], r[nrBlocks] = { 0 }, ws[3 * nrBlocks + 2];
+		limb_divmod(q, r, u, 2 * nrBlocks + 1, mlimbs, n, ws);
+		for (size_t i = 0; i < nrBlocks; ++i) R2.setblock(i, r[i]);
+		one = to_montgomery(Integer(1));
+	}
+
+	const Integer& modulus() const { return m; }
+
+	// a * R mod m
+	Integer to_montgomery(const Integer& a) const { return multiply(residue(a, m), R2); }
+	// a * R^-1 mod m
+	Integer from_montgomery(const Integer& a) const {
+		BlockType t[2 * nrBlocks + 1] = { 0 };
+		for (size_t i = 0; i < nrBlocks; ++i) t[i] = a.block(i);
+		return redc(t);
+	}
+	// Montgomery product a * b * R^-1 mod m of two operands in the Montgomery domain
+	Integer multiply(const Integer& a, const Integer& b) const {
+		BlockType x[nrBlocks], y[nrBlocks], t[2 * nrBlocks + 1];
+		for (size_t i = 0; i < nrBlocks; ++i) { x[i] = a.block(i); y[i] = b.block(i); }
+		limb_multiply(t, x, nrBlocks, y, nrBlocks);
+		t[2 * nrBlocks] = 0;
+		return redc(t);
+	}
+	// a * b mod m of two operands in the normal domain
+	Integer mulmod(const Integer& a, const Integer& b) const { return from_montgomery(multiply(to_montgomery(a), to_montgomery(b))); }
+	// base^exponent mod m, operands and result in the normal domain
+	Integer pow(const Integer& base, const Integer& exponent) const {
+		Integer x = to_montgomery(base);
+		Integer result = one;
+		for (int i = findMsb(exponent); i >= 0; --i) {
+			result = multiply(result, result);
+			if (exponent.at(unsigned(i))) result = multiply(result, x);
+		}
+		return from_montgomery(result);
+	}
+
+private:
+	Integer   m;
+	BlockType mlimbs[nrBlocks];
+	BlockType minv;  // -m^-1 mod B
+	Integer   R2;    // R^2 mod m
+	Integer   one;   // R mod m
+
+	// Montgomery reduction of t[0..2*nrBlocks] < m * R: returns t * R^-1 mod m
+	Integer redc(BlockType* t) const {
+		for (size_t i = 0; i < nrBlocks; ++i) {
+			// choose u so that t + u * m * B^i has a zero limb i
+			BlockType u = BlockType(uint64_t(t[i]) * minv);
+			BlockType carry = 0;
+			for (size_t j = 0; j < nrBlocks; ++j) t[i + j] = muladdcarry(u, mlimbs[j], t[i + j], carry);
+			for (size_t k = i + nrBlocks; carry && k < 2 * nrBlocks + 1; ++k) t[k] = addcarry(t[k], BlockType(0), carry);
+		}
+		// t / R < 2m: a single conditional subtraction brings it in range
+		BlockType* r = t + nrBlocks;
+		if (r[nrBlocks] || !limb_less(r, mlimbs)) limb_sub_inplace(r, nrBlocks + 1, mlimbs, nrBlocks);
+		Integer result;
+		for (size_t i = 0; i < nrBlocks; ++i) result.setblock(i, r[i]);
+		return result;
+	}
+	static bool limb_less(const BlockType* a, const BlockType* b) {
+		for (size_t i = nrBlocks; i > 0; --i) {
+			if (a[i - 1] != b[i - 1]) return a[i - 1] < b[i - 1];
+		}
+		return false;
+	}
+};
+
+// Barrett reduction context for a fixed positive modulus m of k limbs
+// with mu = floor(B^2k / m), the quotient of x < B^2k by m is estimated by two limb multiplies to within 2
+template<size_t nbits, typename BlockType = uint8_t>
+class barrett {
+public:
+	using Integer = integer<nbits, BlockType>;
+	static constexpr size_t nrBlocks = Integer::nrBlocks;
+
+	explicit barrett(const Integer& modulus) : m(modulus) {
+		if (modulus.sign() || modulus.iszero()) throw integer_invalid_modulus{};
+		for (size_t i = 0; i < nrBlocks; ++i) mlimbs[i] = m.block(i);
+		mlimbs[nrBlocks] = 0;
+		k = limb_significant(mlimbs, nrBlocks);
+		// mu has at most k + 2 limbs
+		BlockType u[2 * nrBlocks + 1] = { 0 };
+		u[2 * k] = 1;
+		BlockType r[nrBlocks], ws[3 * nrBlocks + 2];
+		for (size_t i = 0; i < nrBlocks + 2; ++i) mu[i] = 0;
+		limb_divmod(mu, r, u, 2 * k + 1, mlimbs, k, ws);
+	}
+
+	const Integer& modulus() const { return m; }
+
+	// a mod m for any a
+	Integer reduce(const Integer& a) const { return residue(a, m); }
+	// a * b mod m for residues a, b in [0, m)
+	Integer mulmod(const Integer& a, const Integer& b) const {
+		BlockType x[nrBlocks], y[nrBlocks], t[2 * nrBlocks];
+		for (size_t i = 0; i < nrBlocks; ++i) { x[i] = a.block(i); y[i] = b.block(i); }
+		// the residues have at most k limbs, so the product fits in 2k limbs
+		limb_multiply(t, x, k, y, k);
+		return reduce_product(t);
+	}
+	// base^exponent mod m
+	Integer pow(const Integer& base, const Integer& exponent) const {
+		Integer x = residue(base, m);
+		Integer result = residue(Integer(1), m);
+		for (int i = findMsb(exponent); i >= 0; --i) {
+			result = mulmod(result, result);
+			if (exponent.at(unsigned(i))) result = mulmod(result, x);
+		}
+		return result;
+	}
+
+private:
+	Integer   m;
+	BlockType mlimbs[nrBlocks + 1];
+	BlockType mu[nrBlocks + 2];
+	size_t    k;    // significant limbs of the modulus
+
+	// x[0..2k) < m^2: returns x mod m
+	Integer reduce_product(const BlockType* x) const {
+		// q3 = floor(floor(x / B^(k-1)) * mu / B^(k+1)) underestimates floor(x / m) by at most 2
+		BlockType q2[2 * nrBlocks + 3];
+		limb_multiply(q2, x + (k - 1), k + 1, mu, k + 2);
+		const BlockType* q3 = q2 + (k + 1);
+		// r = x - q3 * m modulo B^(k+1)
+		BlockType qm[2 * nrBlocks + 2], r[nrBlocks + 1];
+		limb_multiply(qm, q3, k + 1, mlimbs, k);
+		for (size_t i = 0; i < k + 1; ++i) r[i] = x[i];
+		limb_sub_inplace(r, k + 1, qm, k + 1);
+		while (!limb_less(r, mlimbs, k + 1)) limb_sub_inplace(r, k + 1, mlimbs, k + 1);
+		Integer result;
+		for (size_t i = 0; i < k; ++i) result.setblock(i, r[i]);
+		return result;
+	}
+	static bool limb_less(const BlockType* a, const BlockType* b, size_t n) {
+		for (size_t i = n; i > 0; --i) {
+			if (a[i - 1] != b[i - 1]) return a[i - 1] < b[i - 1];
+		}
+		return false;
+	}
+};
+
+// base^exponent mod modulus: Montgomery for odd moduli, Barrett otherwise
+template<size_t nbits, typename BlockType>
+integer<nbits, BlockType> powmod(const integer<nbits, BlockType>& base, const integer<nbits, BlockType>& exponent, const integer<nbits, BlockType>& modulus) {
+	if (modulus.isodd()) return montgomery<nbits, BlockType>(modulus).pow(base, exponent);
+	return barrett<nbits, BlockType>(modulus).pow(base, exponent);
+}
+
+}} // namespace sw::unum
@@ -5,7 +5,26 @@
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <vector>
+#include <random>
+#include <algorithm>
 #include "./integer_exceptions.hpp"
+#include "./modular.hpp"
+#include "./sieves.hpp"
+
+// INTEGER_LEHMER_GCD_THRESHOLD is the width, in bits, from which gcd switches from binary gcd to Lehmer's gcd.
+// Lehmer needs blocks of at least 32 bits to hold its cofactors, narrower blocks always use binary gcd.
+#ifndef INTEGER_LEHMER_GCD_THRESHOLD
+#define INTEGER_LEHMER_GCD_THRESHOLD 128
+#endif
+// INTEGER_TRIAL_DIVISION_LIMIT bounds the small primes that primeFactorization divides out before it switches to Pollard-Brent rho
+#ifndef INTEGER_TRIAL_DIVISION_LIMIT
+#define INTEGER_TRIAL_DIVISION_LIMIT 1024
+#endif
+// INTEGER_SIEVE_PRIME_LIMIT bounds the base primes of primeNumbersInRange: candidates that survive a sieve
+// that does not reach sqrt(high) are confirmed with Miller-Rabin
+#ifndef INTEGER_SIEVE_PRIME_LIMIT
+#define INTEGER_SIEVE_PRIME_LIMIT (1u << 20)
+#endif
 
 #if defined(__clang__)
 /* Clang/LLVM. ---------------------------------------------- */
@@ -112,86 +131,292 @@ template<class _Mt,
  least common multiple  lcm(a, b) = PROD p^max(a_p, b_p)
  */
 
-// calculate the greatest common divisor of two numbers
+// binary (Stein) gcd: strip the common powers of 2, then subtract the smaller odd value from the larger
+// every step is a limb-wise subtraction and shift, no division
+template<size_t nbits, typename BlockType>
+integer<nbits, BlockType> binary_gcd(const integer<nbits, BlockType>& a, const integer<nbits, BlockType>& b) {
+	using Integer = integer<nbits, BlockType>;
+	Integer u(a.sign() ? -a : a), v(b.sign() ? -b : b);
+	if (u.iszero()) return v;
+	if (v.iszero()) return u;
+	int shift = countTrailingZeros(u);
+	int vtz = countTrailingZeros(v);
+	if (vtz < shift) shift = vtz;
+	u >>= countTrailingZeros(u);
+	do {
+		v >>= countTrailingZeros(v);
+		if (v < u) std::swap(u, v);
+		v -= u;
+	} while (!v.iszero());
+	return u << shift;
+}
+
+// Lehmer gcd: runs of Euclid steps are simulated on the leading bits and applied to the full limbs in a single pass
+template<size_t nbits, typename BlockType>
+integer<nbits, BlockType> lehmer_gcd(const integer<nbits, BlockType>& a, const integer<nbits, BlockType>& b) {
+	using Integer = integer<nbits, BlockType>;
+	constexpr size_t nrBlocks = Integer::nrBlocks;
+	Integer u(a.sign() ? -a : a), v(b.sign() ? -b : b);
+	BlockType x[nrBlocks], y[nrBlocks];
+	for (size_t i = 0; i < nrBlocks; ++i) {
+		x[i] = u.block(i);
+		y[i] = v.block(i);
+	}
+	limb_gcd_lehmer(x, y, nrBlocks);
+	Integer result;
+	for (size_t i = 0; i < nrBlocks; ++i) result.setblock(i, x[i]);
+	return result;
+}
+
+// calculate the greatest common divisor of two numbers, the result is non-negative
 template<size_t nbits, typename BlockType>
 integer<nbits, BlockType> gcd(const integer<nbits, BlockType>& a, const integer<nbits, BlockType>& b) {
-	return b.iszero() ? a : gcd(b, a % b);
+	if constexpr (sizeof(BlockType) >= 4 && nbits >= INTEGER_LEHMER_GCD_THRESHOLD) {
+		return lehmer_gcd(a, b);
+	}
+	else {
+		return binary_gcd(a, b);
+	}
 }
 
 // calculate the greatest common divisor of N numbers
+// the values are reduced pairwise in a tree, so that the operands of each level stay balanced
 template<size_t nbits, typename BlockType>
 integer<nbits, BlockType> gcd(const std::vector< integer<nbits, BlockType> >& v) {
 	if (v.size() == 0) return 0;
 	if (v.size() == 1) return v[0];
-	integer<nbits, BlockType> gcd_n = v[0];
-	for (size_t i = 1; i < v.size(); ++i) {
-		gcd_n = gcd(gcd_n, v[i]);
+	std::vector< integer<nbits, BlockType> > level(v);
+	while (level.size() > 1) {
+		size_t half = level.size() / 2;
+		for (size_t i = 0; i < half; ++i) {
+			level[i] = gcd(level[2 * i], level[2 * i + 1]);
+			if (level[i] == 1) return level[i];  // nothing can reduce a gcd of 1 any further
+		}
+		if (level.size() % 2) level[half++] = level.back();
+		level.resize(half);
 	}
-	return gcd_n;
+	return level[0];
 }
 
 // calculate the least common multiple of two numbers
+// dividing before multiplying keeps the intermediate within the range of the result
 template<size_t nbits, typename BlockType>
 integer<nbits, BlockType> lcm(const integer<nbits, BlockType>& a, const integer<nbits, BlockType>& b) {
-	return (a * b) / gcd(a, b);
+	if (a.iszero() || b.iszero()) return 0;
+	return (a / gcd(a, b)) * b;
 }
 
 // calculate the least common multiple of N numbers
+// the values are reduced pairwise in a tree, so that the operands of each level stay balanced
 template<size_t nbits, typename BlockType>
 integer<nbits, BlockType> lcm(const std::vector< integer<nbits, BlockType> >& v) {
 	if (v.size() == 0) return 0;
 	if (v.size() == 1) return v[0];
-	integer<nbits, BlockType> lcm = v[0];
-	for (size_t i = 0; i < v.size(); ++i) {
-		lcm = (v[i] * lcm) / gcd(lcm, v[i]);
+	std::vector< integer<nbits, BlockType> > level(v);
+	while (level.size() > 1) {
+		size_t half = level.size() / 2;
+		for (size_t i = 0; i < half; ++i) level[i] = lcm(level[2 * i], level[2 * i + 1]);
+		if (level.size() % 2) level[half++] = level.back();
+		level.resize(half);
 	}
-	return lcm;
+	return level[0];
 }
 
-// check if a number is prime
+// Miller-Rabin strong probable prime test of an odd n > 2 to a single witness, with n - 1 = d * 2^s
 template<size_t nbits, typename BlockType>
-bool isPrime(const integer<nbits, BlockType>& a) {
-	if (a.iszero() || a == 1) return false; // smallest prime number is 2
-	for (integer<nbits, BlockType> i = 2; i < a / 2; ++i) if ((a % i) == 0) return false;
+bool strongProbablePrime(const montgomery<nbits, BlockType>& mg, const integer<nbits, BlockType>& witness, const integer<nbits, BlockType>& d, int s) {
+	using Integer = integer<nbits, BlockType>;
+	const Integer& n = mg.modulus();
+	Integer x = mg.pow(witness, d);
+	if (x == 1 || x == n - 1) return true;
+	// square in the Montgomery domain until we hit -1
+	Integer one = mg.to_montgomery(Integer(1));
+	Integer minusOne = mg.to_montgomery(n - 1);
+	x = mg.to_montgomery(x);
+	for (int r = 1; r < s; ++r) {
+		x = mg.multiply(x, x);
+		if (x == minusOne) return true;
+		if (x == one) return false;
+	}
+	return false;
+}
+
+// Miller-Rabin primality test
+// the first twelve primes as witnesses are deterministic for n < 3.18 * 10^23, which covers all n < 2^64,
+// larger n are tested with an additional number of random witnesses, each of which lets a composite pass with probability < 1/4
+template<size_t nbits, typename BlockType>
+bool millerRabin(const integer<nbits, BlockType>& n, unsigned rounds = 20) {
+	using Integer = integer<nbits, BlockType>;
+	static const int smallPrimes[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+	if (n < 2) return false;
+	for (int p : smallPrimes) {
+		if (n == p) return true;
+		if ((n % Integer(p)).iszero()) return false;
+	}
+	if (n < 41 * 41) return true; // no factor <= 37 below 41^2
+	Integer d = n - 1;
+	int s = countTrailingZeros(d);
+	d >>= s;
+	montgomery<nbits, BlockType> mg(n);
+	for (int p : smallPrimes) {
+		if (!strongProbablePrime(mg, Integer(p), d, s)) return false;
+	}
+	if (findMsb(n) < 64) return true;
+	// random witnesses in [2, n - 2], seeded by n so that the outcome is reproducible
+	std::mt19937_64 rng((unsigned long long)n);
+	Integer range = n - 3;
+	for (unsigned i = 0; i < rounds; ++i) {
+		Integer w;
+		for (unsigned b = 0; b < Integer::nrBytes; ++b) w.setbyte(b, uint8_t(rng()));
+		w.reset(unsigned(nbits - 1));
+		w = w % range + 2;
+		if (!strongProbablePrime(mg, w, d, s)) return false;
+	}
 	return true;
 }
 
+// check if a number is prime: deterministic below 2^64, probabilistic above
+template<size_t nbits, typename BlockType>
+bool isPrime(const integer<nbits, BlockType>& a) {
+	return millerRabin(a);
+}
+
 // generate prime numbers in a range
+// a segmented sieve marks the candidates in [low, high), the range must fit in the address space
 template<size_t nbits, typename BlockType>
 bool primeNumbersInRange(const integer<nbits, BlockType>& low, const integer<nbits, BlockType>& high, std::vector< integer<nbits, BlockType> >& primes) {
+	using Integer = integer<nbits, BlockType>;
+	if (!(low < high)) return false;
+	Integer range = high - low;
+	if (findMsb(range) >= int(sizeof(size_t) * 8 - 1)) throw "primeNumbersInRange: range is too large to sieve";
+	size_t width = size_t((unsigned long long)range);
+	// base primes up to sqrt(high - 1), capped so that the sieve does not dwarf small ranges of large numbers
+	uint64_t limit = INTEGER_SIEVE_PRIME_LIMIT;
+	Integer last = high - 1;
+	bool complete = false;
+	if (findMsb(last) < 64) {
+		uint64_t root = (last < 2) ? 1 : uint64_t((unsigned long long)floor_sqrt(last));
+		if (root <= limit) { limit = root; complete = true; }
+	}
+	bitsieve candidates = segmentedSieve(low, width, sieveOfEratosthenes(uint32_t(limit)));
 	bool bFound = false;
-	for (integer<nbits, BlockType> i = low; i < high; ++i) {
-		if (isPrime(i)) {
-			primes.push_back(i);
+	for (size_t i = 0; i < width; ++i) {
+		if (!candidates.test(i)) continue;
+		Integer candidate = low + Integer(i);
+		if (complete || isPrime(candidate)) {
+			primes.push_back(candidate);
 			bFound = true;
 		}
 	}
 	return bFound;
 }
 
+// absolute difference of two non-negative integers
+template<size_t nbits, typename BlockType>
+inline integer<nbits, BlockType> absdiff(const integer<nbits, BlockType>& a, const integer<nbits, BlockType>& b) {
+	return (a < b) ? b - a : a - b;
+}
+
+// Pollard-Brent rho: returns a non-trivial factor of an odd composite n
+// iterates x -> x^2 + c mod n in the Montgomery domain, and amortizes the gcd over a batch of products of differences:
+// the Montgomery form aR of a differs by the unit R, which leaves gcd(a, n) unchanged
+template<size_t nbits, typename BlockType>
+integer<nbits, BlockType> pollardBrent(const integer<nbits, BlockType>& n) {
+	using Integer = integer<nbits, BlockType>;
+	constexpr size_t batch = 128;
+	montgomery<nbits, BlockType> mg(n);
+	for (Integer c = 1; c < n; ++c) {
+		Integer cm = mg.to_montgomery(c);
+		auto f = [&](const Integer& v) {
+			Integer r = mg.multiply(v, v) + cm;
+			if (!(r < n)) r -= n;
+			return r;
+		};
+		Integer x, ys, y = mg.to_montgomery(Integer(2)), q = mg.to_montgomery(Integer(1)), g = 1;
+		for (size_t r = 1; g == 1; r <<= 1) {
+			x = y;
+			for (size_t i = 0; i < r; ++i) y = f(y);
+			for (size_t k = 0; k < r && g == 1; k += batch) {
+				ys = y;
+				size_t steps = std::min(batch, r - k);
+				for (size_t i = 0; i < steps; ++i) {
+					y = f(y);
+					q = mg.multiply(q, absdiff(x, y));
+				}
+				g = gcd(q, n);
+			}
+		}
+		if (g == n) {
+			// the batch collapsed to a multiple of n: retrace it one step at a time
+			do {
+				ys = f(ys);
+				g = gcd(absdiff(x, ys), n);
+			} while (g == 1);
+		}
+		if (g != n) return g;
+	}
+	return n;
+}
+
 // prime factors of an arbitrary integer
 template<size_t nbits, typename BlockType>
 class primefactors : public std::vector< std::pair< integer<nbits, BlockType>, integer<nbits, BlockType> > > { };
 
+// split an odd n without small factors into its prime factors, unordered and with repetition
+template<size_t nbits, typename BlockType>
+void splitFactors(const integer<nbits, BlockType>& n, std::vector< integer<nbits, BlockType> >& primes) {
+	if (n == 1) return;
+	if (isPrime(n)) {
+		primes.push_back(n);
+		return;
+	}
+	integer<nbits, BlockType> d = pollardBrent(n);
+	if (d == n) { // rho did not find a split: report the cofactor as is
+		primes.push_back(n);
+		return;
+	}
+	splitFactors(d, primes);
+	splitFactors(n / d, primes);
+}
+
 // generate prime factors of an arbitrary integer
+// the small primes are divided out by trial division, the remaining cofactor is split with Pollard-Brent rho
 template<size_t nbits, typename BlockType>
 void primeFactorization(const integer<nbits, BlockType>& a, primefactors<nbits, BlockType>& factors) {
 	using Integer = integer<nbits, BlockType>;
+	if (a < 2) return;
 	Integer i(a);
-	Integer factor = 2;
-	Integer power = 0;
 	// powers of 2
-	while (i.iseven()) { ++power; i >>= 1; }
-	if (power > 0) factors.push_back(std::pair<Integer, Integer>(factor, power));
-	// powers of odd numbers > 2
-	for (factor = 3; factor <= sqrt(i); factor += 2) {
-		if (isPrime(factor)) {
-			power = 0;
-			while ((i % factor) == 0) { ++power; i /= factor; }
-			if (power > 0) factors.push_back(std::pair<Integer, Integer>(factor, power));
-		}
+	int twos = countTrailingZeros(i);
+	if (twos > 0) {
+		factors.push_back(std::pair<Integer, Integer>(Integer(2), Integer(twos)));
+		i >>= twos;
+	}
+	// trial division by the small odd primes: stay below sqrt(i) so that the primes are representable in Integer
+	uint64_t limit = INTEGER_TRIAL_DIVISION_LIMIT;
+	if (findMsb(i) < 64) {
+		uint64_t root = (unsigned long long)floor_sqrt(i);
+		if (root < limit) limit = root;
+	}
+	for (uint32_t p : sieveOfEratosthenes(uint32_t(limit))) {
+		if (p == 2) continue;
+		Integer factor(p);
+		if (factor > i / factor) break;
+		Integer power = 0;
+		while ((i % factor).iszero()) { ++power; i /= factor; }
+		if (power > 0) factors.push_back(std::pair<Integer, Integer>(factor, power));
+	}
+	if (i == 1) return;
+	// the cofactor only has prime factors beyond the trial division limit
+	std::vector<Integer> primes;
+	splitFactors(i, primes);
+	std::sort(primes.begin(), primes.end());
+	for (size_t k = 0; k < primes.size(); ) {
+		size_t j = k;
+		while (j < primes.size() && primes[j] == primes[k]) ++j;
+		factors.push_back(std::pair<Integer, Integer>(primes[k], Integer(long(j - k))));
+		k = j;
 	}
-	if (i > 2) factors.push_back(std::pair < Integer, Integer>(i, 1));
 }
 
 // Factorization using Fermat's method: precondition number must be odd
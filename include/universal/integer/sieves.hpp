@@ -4,6 +4,7 @@
 // Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
 #include <vector>
 #include "./integer_exceptions.hpp"
 
@@ -37,9 +38,90 @@
 
 #endif
 
+// SIEVE_SEGMENT_BITS is the number of candidates sieved per segment of the segmented sieve:
+// 2^18 bits is a 32KB segment that stays resident in the L1 cache while all base primes cross it
+#ifndef SIEVE_SEGMENT_BITS
+#define SIEVE_SEGMENT_BITS (size_t(1) << 18)
+#endif
+
 namespace sw {
 namespace unum {
 
+// bit array of sieve results, bit i represents the candidate low + i
+class bitsieve : public std::vector<uint64_t> {
+public:
+	bitsieve() : nrBits{ 0 } {}
+	// all candidates start out as prime
+	explicit bitsieve(size_t n) : std::vector<uint64_t>((n + 63) / 64, ~uint64_t(0)), nrBits{ n } {
+		if (n % 64) back() = (uint64_t(1) << (n % 64)) - 1;
+	}
+	size_t bits() const { return nrBits; }
+	bool test(size_t i) const { return (operator[](i >> 6) >> (i & 63)) & 0x1; }
+	void reset(size_t i) { operator[](i >> 6) &= ~(uint64_t(1) << (i & 63)); }
+private:
+	size_t nrBits;
+};
+
+// sieve of Eratosthenes: all primes <= limit, the sieve only tracks the odd numbers
+inline std::vector<uint32_t> sieveOfEratosthenes(uint32_t limit) {
+	std::vector<uint32_t> primes;
+	if (limit < 2) return primes;
+	primes.push_back(2);
+	// bit i represents the odd number 2i + 1
+	size_t n = (size_t(limit) + 1) / 2;
+	bitsieve odd(n);
+	odd.reset(0);
+	for (size_t i = 1; i < n; ++i) {
+		if (!odd.test(i)) continue;
+		uint64_t p = 2 * i + 1;
+		primes.push_back(uint32_t(p));
+		for (uint64_t j = (p * p) / 2; j < n; j += p) odd.reset(size_t(j));
+	}
+	return primes;
+}
+
+// segmented sieve of Eratosthenes of the candidates [low, low + width) against the base primes
+// bit i of the result is cleared when low + i is divisible by a base prime other than itself, or is smaller than 2:
+// when the base primes cover sqrt(low + width), the bits that remain set are exactly the primes in the range.
+// The range is sieved in cache-sized segments, and every base prime carries its next multiple from one segment to the next.
+template<size_t nbits, typename BlockType>
+bitsieve segmentedSieve(const integer<nbits, BlockType>& low, size_t width, const std::vector<uint32_t>& basePrimes) {
+	using Integer = integer<nbits, BlockType>;
+	bitsieve candidates(width);
+	if (width == 0) return candidates;
+	// clear the candidates below 2
+	Integer two(2);
+	size_t skip = 0;
+	for (Integer v = low; skip < width && v < two; ++v) candidates.reset(skip++);
+	if (skip == width) return candidates;
+	Integer start = low + Integer(skip);
+
+	// the first multiple of p to strike is max(p * p, first multiple of p >= start)
+	std::vector<uint64_t> next;
+	next.reserve(basePrimes.size());
+	for (uint32_t p : basePrimes) {
+		Integer P(p);
+		if (P > start / P) { // p * p > start
+			Integer offset = P * P - start;
+			next.push_back((findMsb(offset) < 63) ? uint64_t((unsigned long long)offset) + skip : uint64_t(width));
+		}
+		else {
+			uint64_t r = (unsigned long long)(start % P);
+			next.push_back((r == 0 ? 0 : p - r) + skip);
+		}
+	}
+
+	for (size_t segment = 0; segment < width; segment += SIEVE_SEGMENT_BITS) {
+		uint64_t segmentEnd = (width - segment < SIEVE_SEGMENT_BITS) ? width : segment + SIEVE_SEGMENT_BITS;
+		for (size_t k = 0; k < basePrimes.size(); ++k) {
+			uint64_t j = next[k];
+			const uint64_t p = basePrimes[k];
+			for (; j < segmentEnd; j += p) candidates.reset(size_t(j));
+			next[k] = j;
+		}
+	}
+	return candidates;
+}
 
 } // namespace unum
 } // namespace sw
@@ -0,0 +1,151 @@
+#pragma once
+// gaussian_logarithms.hpp: table-driven Gaussian logarithms for logarithmic number system addition and subtraction
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cmath>
+#include <vector>
+
+// configurations with up to LNS_GAUSSIAN_DIRECT_RBITS fraction bits tabulate every argument of the Gaussian logarithms
+#if !defined(LNS_GAUSSIAN_DIRECT_RBITS)
+#define LNS_GAUSSIAN_DIRECT_RBITS 8
+#endif
+// configurations with up to LNS_GAUSSIAN_TABLE_RBITS fraction bits interpolate in sampled tables,
+// larger configurations evaluate the Gaussian logarithms with the math library
+#if !defined(LNS_GAUSSIAN_TABLE_RBITS)
+#define LNS_GAUSSIAN_TABLE_RBITS 16
+#endif
+
+namespace sw { namespace unum {
+
+/*
+ With x = log2|X| >= y = log2|Y| and z = y - x <= 0, the sum and difference of X and Y are
+     log2(|X| + |Y|) = x + sb(z),  sb(z) = log2(1 + 2^z)
+     log2(|X| - |Y|) = x + db(z),  db(z) = log2(1 - 2^z)
+ Arguments and results are fixed-point in units of 2^-rbits. Below z = -(rbits + 4) both functions are smaller than
+ a tenth of a unit, so the tables cover the essential zone [-(rbits + 4), 0] and return 0 outside of it.
+
+ Direct tables hold the correctly rounded value for every argument in the essential zone.
+ Interpolated tables sample the functions every 2^-s, s = ceil(rbits/2), with 8 guard bits, which keeps
+ the linear interpolation error of db for z <= -1 below a fifth of a unit.
+ db has a singularity at z = 0, so in (-1, 0) it is evaluated with a cotransformation: z = z1 + z2 with z1 a sample point
+ and -2^-s < z2 < 0, and
+     db(z) = db(z2) + sb(z2 + db(z1) - db(z2))
+ where db(z2) comes from a second table with one entry per unit in (-2^-s, 0).
+ */
+template<size_t rbits>
+class gaussian_logarithm {
+public:
+	static constexpr bool direct = (rbits <= LNS_GAUSSIAN_DIRECT_RBITS);
+	static constexpr bool tabulated = (rbits <= LNS_GAUSSIAN_TABLE_RBITS);
+	static constexpr int64_t one = int64_t(1) << rbits;
+	static constexpr int64_t range = int64_t(rbits + 4) << rbits;  // essential zone [-range, 0]
+	static constexpr size_t gbits = 8;                              // guard bits of the sampled tables
+	static constexpr size_t sbits = (rbits + 1) / 2;                // sample spacing is 2^-sbits
+	static constexpr size_t shift = rbits + gbits - sbits;          // log2 of the number of guard units per sample spacing
+	static constexpr int64_t samples = int64_t(rbits + 4) << sbits; // number of sample spacings in the essential zone
+
+	// log2(1 + 2^z) for z <= 0
+	static int64_t sb(int64_t z) {
+		if (z < -range) return 0;
+		if constexpr (direct) {
+			return instance()._sb[size_t(-z)];
+		}
+		else if constexpr (tabulated) {
+			return round(instance().sb_guarded(z << gbits));
+		}
+		else {
+			long double v = std::log2(1.0l + std::exp2((long double)(z) / one));
+			return std::llround(v * one);
+		}
+	}
+	// log2(1 - 2^z) for z < 0
+	static int64_t db(int64_t z) {
+		if (z < -range) return 0;
+		if constexpr (direct) {
+			return instance()._db[size_t(-z)];
+		}
+		else if constexpr (tabulated) {
+			return round(instance().db_guarded(z));
+		}
+		else {
+			// 1 - 2^z = -expm1(z * ln(2)) keeps the relative precision near the singularity
+			long double v = std::log2(-std::expm1((long double)(z) / one * 0.693147180559945309417232121458176568l));
+			return std::llround(v * one);
+		}
+	}
+
+private:
+	std::vector<int64_t> _sb, _db, _dbfine;
+
+	static const gaussian_logarithm& instance() {
+		static const gaussian_logarithm tables;
+		return tables;
+	}
+
+	static long double sb_exact(long double z) { return std::log2(1.0l + std::exp2(z)); }
+	static long double db_exact(long double z) { return std::log2(-std::expm1(z * 0.693147180559945309417232121458176568l)); }
+
+	gaussian_logarithm() {
+		if constexpr (direct) {
+			_sb.resize(size_t(range) + 1);
+			_db.resize(size_t(range) + 1);
+			for (int64_t i = 0; i <= range; ++i) {
+				long double z = -(long double)(i) / one;
+				_sb[size_t(i)] = std::llround(sb_exact(z) * one);
+				_db[size_t(i)] = (i == 0) ? 0 : std::llround(db_exact(z) * one);  // db(0) is -infinity: never referenced
+			}
+		}
+		else if constexpr (tabulated) {
+			const long double guarded = (long double)(int64_t(1) << (rbits + gbits));
+			_sb.resize(size_t(samples) + 1);
+			_db.resize(size_t(samples) + 1);
+			for (int64_t k = 0; k <= samples; ++k) {
+				long double z = -(long double)(k) / (long double)(int64_t(1) << sbits);
+				_sb[size_t(k)] = std::llround(sb_exact(z) * guarded);
+				_db[size_t(k)] = (k == 0) ? 0 : std::llround(db_exact(z) * guarded);
+			}
+			const int64_t fine = int64_t(1) << (rbits - sbits);
+			_dbfine.resize(size_t(fine));
+			for (int64_t j = 1; j < fine; ++j) {
+				_dbfine[size_t(j)] = std::llround(db_exact(-(long double)(j) / one) * guarded);
+			}
+		}
+	}
+
+	// round a value in guard units to units of 2^-rbits
+	static int64_t round(int64_t v) { return (v + (int64_t(1) << (gbits - 1))) >> gbits; }
+
+	// sb of an argument in guard units, of either sign, using sb(w) = w + sb(-w) for w > 0
+	int64_t sb_guarded(int64_t w) const {
+		if (w > 0) return w + sb_guarded(-w);
+		int64_t u = -w;
+		int64_t k = u >> shift;
+		if (k >= samples) return 0;
+		int64_t r = u & ((int64_t(1) << shift) - 1);
+		return _sb[size_t(k)] + (((_sb[size_t(k) + 1] - _sb[size_t(k)]) * r) >> shift);
+	}
+
+	// db of an argument z < 0 in units of 2^-rbits, result in guard units
+	int64_t db_guarded(int64_t z) const {
+		int64_t u = -z;
+		if (u >= one) {
+			int64_t k = (u << gbits) >> shift;
+			if (k >= samples) return 0;
+			int64_t r = (u << gbits) & ((int64_t(1) << shift) - 1);
+			return _db[size_t(k)] + (((_db[size_t(k) + 1] - _db[size_t(k)]) * r) >> shift);
+		}
+		// cotransformation in the neighborhood of the singularity
+		constexpr size_t fineBits = rbits - sbits;
+		int64_t k1 = u >> fineBits;                            // z1 = -k1 * 2^-sbits
+		int64_t j2 = u & ((int64_t(1) << fineBits) - 1);       // z2 = -j2 * 2^-rbits
+		if (j2 == 0) return _db[size_t(k1)];
+		int64_t d2 = _dbfine[size_t(j2)];
+		if (k1 == 0) return d2;
+		return d2 + sb_guarded(-(j2 << gbits) + _db[size_t(k1)] - d2);
+	}
+};
+
+}} // namespace sw::unum
@@ -5,14 +5,26 @@
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <cassert>
+#include <cstdint>
+#include <cmath>
 #include <limits>
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include <vector>
 
 #include <universal/native/ieee-754.hpp>
 #include <universal/blockbin/blockbinary.hpp>
 #include <universal/abstract/triple.hpp>
+#include <universal/lns/exceptions.hpp>
+#include <universal/lns/gaussian_logarithms.hpp>
+
+#if !defined(LNS_THROW_ARITHMETIC_EXCEPTION)
+#define LNS_THROW_ARITHMETIC_EXCEPTION 0
+#endif
 
 namespace sw {	namespace unum {
-		
+
 // Forward definitions
 template<size_t nbits, typename bt> class lns;
 template<size_t nbits, typename bt> lns<nbits,bt> abs(const lns<nbits,bt>& v);
@@ -21,7 +33,7 @@ template<size_t nbits, typename bt> lns<nbits,bt> abs(const lns<nbits,bt>& v);
 template<size_t nbits, typename bt>
 inline lns<nbits, bt>& convert(const triple<nbits,bt>& v, lns<nbits,bt>& p) {
 	if (v.iszero()) {
-		return p.setnan();
+		return p.setzero();
 	}
 	if (v.isnan() || v.isinf()) {
 		return p.setnan();
@@ -31,29 +43,44 @@ inline lns<nbits, bt>& convert(const triple<nbits,bt>& v, lns<nbits,bt>& p) {
 
 template<size_t nbits, typename bt>
 lns<nbits, bt>& minpos(lns<nbits, bt>& lminpos) {
-	return lminpos;
+	return lminpos.set(false, lns<nbits, bt>::min_log);
 }
 template<size_t nbits, typename bt>
 lns<nbits, bt>& maxpos(lns<nbits, bt>& lmaxpos) {
-	return lmaxpos;
+	return lmaxpos.set(false, lns<nbits, bt>::max_log);
 }
 template<size_t nbits, typename bt>
 lns<nbits, bt>& minneg(lns<nbits, bt>& lminneg) {
-	return lminneg;
+	return lminneg.set(true, lns<nbits, bt>::min_log);
 }
 template<size_t nbits, typename bt>
 lns<nbits, bt>& maxneg(lns<nbits, bt>& lmaxneg) {
-	return lmaxneg;
+	return lmaxneg.set(true, lns<nbits, bt>::max_log);
 }
 
-// template class representing a value in scientific notation, using a template size for the number of fraction bits
+/*
+ lns<nbits> represents X by a sign bit and x = log2|X|, a 2's complement fixed-point number of nbits-1 bits
+ with rbits fraction bits:
+     bit nbits-1          sign of X
+     bits [nbits-2, 0]    x
+ The most negative pattern of x is reserved: with a positive sign it encodes zero, with a negative sign it encodes NaN.
+ Multiplication and division add and subtract the logarithms. Addition and subtraction use the Gaussian logarithms
+ sb and db of gaussian_logarithms.hpp. Results that are too large saturate to maxpos/maxneg, results smaller than
+ minpos flush to zero.
+ */
 template<size_t nbits, typename bt = uint8_t>
 class lns {
 public:
+	static_assert(nbits >= 4, "lns configuration error: nbits must be at least 4");
+	static_assert(nbits <= 64, "lns configuration error: nbits must be at most 64");
 	static constexpr size_t rbits = nbits / 2;
-	static constexpr double scaling = double(1 << rbits);
+	static constexpr double scaling = double(1ull << rbits);
+	static constexpr int64_t special_log = -(int64_t(1) << (nbits - 2));  // reserved for zero and NaN
+	static constexpr int64_t min_log = special_log + 1;
+	static constexpr int64_t max_log = (int64_t(1) << (nbits - 2)) - 1;
+	using GaussianLog = gaussian_logarithm<rbits>;
 
-	lns() : _bits{ 0 } {}
+	lns() : _bits{ 0 } { setzero(); }
 
 	lns(const lns&) = default;
 	lns(lns&&) = default;
@@ -74,37 +101,59 @@ public:
 	lns& operator=(signed char rhs) { return *this = (long long)(rhs); }
 	lns& operator=(short rhs) { return *this = (long long)(rhs); }
 	lns& operator=(int rhs) { return *this = (long long)(rhs); }
-	lns& operator=(long long rhs) { return *this; }
-	lns& operator=(unsigned long long rhs) { return *this; }
-	constexpr lns& operator=(float rhs) { _bits = (long long)(std::log(rhs) * scaling); return *this; }
-	constexpr lns& operator=(double rhs) { _bits = (long long)(std::log(rhs) * scaling); return *this; }
-	lns& operator=(long double rhs) { _bits = (long long)(std::log(rhs) * scaling); return *this; }
+	lns& operator=(long long rhs) { return *this = (long double)(rhs); }
+	lns& operator=(unsigned long long rhs) { return *this = (long double)(rhs); }
+	lns& operator=(float rhs) { return *this = (long double)(rhs); }
+	lns& operator=(double rhs) { return *this = (long double)(rhs); }
+	lns& operator=(long double rhs) {
+		if (rhs == 0.0l) return setzero();
+		if (std::isnan(rhs) || std::isinf(rhs)) return setnan();
+		long double x = std::log2(std::fabs(rhs)) * (long double)(scaling);
+		if (x > (long double)(max_log)) return set(rhs < 0, max_log);
+		if (x < (long double)(special_log)) return setzero();
+		return normalize(rhs < 0, std::llround(x));
+	}
 
 	// arithmetic operators
 	// prefix operator
-	lns operator-() const {				
-		return *this;
+	lns operator-() const {
+		lns negated(*this);
+		if (!iszero() && !isnan()) negated.set(!sign(), log());
+		return negated;
 	}
 
 	// in-place arithmetic assignment operators
-	lns& operator+=(const lns& rhs) { return *this; }
+	lns& operator+=(const lns& rhs) { return accumulate(rhs, false); }
 	lns& operator+=(double rhs) { return *this += lns(rhs); }
-	lns& operator-=(const lns& rhs) { return *this; }
-	lns& operator-=(double rhs) { return *this -= lns<nbits>(rhs); }
+	lns& operator-=(const lns& rhs) { return accumulate(rhs, true); }
+	lns& operator-=(double rhs) { return *this -= lns(rhs); }
 	lns& operator*=(const lns& rhs) {
-		this->_bits += rhs._bits;
-		return *this; 
+		if (isnan() || rhs.isnan()) return setnan();
+		if (iszero() || rhs.iszero()) return setzero();
+		return normalize(sign() != rhs.sign(), log() + rhs.log());
 	}
-	lns& operator*=(double rhs) { return *this *= lns<nbits>(rhs); }
+	lns& operator*=(double rhs) { return *this *= lns(rhs); }
 	lns& operator/=(const lns& rhs) {
-		this->_bits -= rhs._bits;
-		return *this;
+		if (isnan() || rhs.isnan()) return setnan();
+		if (rhs.iszero()) {
+#if LNS_THROW_ARITHMETIC_EXCEPTION
+			throw lns_divide_by_zero();
+#else
+			std::cerr << "lns_divide_by_zero" << std::endl;
+			return setnan();
+#endif
+		}
+		if (iszero()) return *this;
+		return normalize(sign() != rhs.sign(), log() - rhs.log());
 	}
-	lns& operator/=(double rhs) { return *this /= lns<nbits>(rhs); }
+	lns& operator/=(double rhs) { return *this /= lns(rhs); }
 
-	// prefix/postfix operators
+	// prefix/postfix operators: move to the next value on the real line
 	lns& operator++() {
-		return *this;
+		if (isnan()) return *this;
+		if (iszero()) return set(false, min_log);
+		if (!sign()) return (log() < max_log) ? set(false, log() + 1) : *this;
+		return (log() > min_log) ? set(true, log() - 1) : setzero();
 	}
 	lns operator++(int) {
 		lns tmp(*this);
@@ -112,7 +161,10 @@ public:
 		return tmp;
 	}
 	lns& operator--() {
-		return *this;
+		if (isnan()) return *this;
+		if (iszero()) return set(true, min_log);
+		if (sign()) return (log() < max_log) ? set(true, log() + 1) : *this;
+		return (log() > min_log) ? set(false, log() - 1) : setzero();
 	}
 	lns operator--(int) {
 		lns tmp(*this);
@@ -121,38 +173,81 @@ public:
 	}
 
 	// modifiers
-	void reset() {	}
+	void reset() { setzero(); }
+	lns& setzero() { return set(false, special_log); }
+	lns& setnan() { return set(true, special_log); }
+	// set the sign and the logarithm in units of 2^-rbits, which must be within [special_log, max_log]
+	lns& set(bool negative, int64_t logarithm) {
+		constexpr uint64_t logMask = (~uint64_t(0)) >> (65 - nbits);
+		_bits.set_raw_bits((uint64_t(negative) << (nbits - 1)) | (uint64_t(logarithm) & logMask));
+		return *this;
+	}
+	void set_raw_bits(uint64_t raw) { _bits.set_raw_bits(raw); }
 
 	// selectors
-	inline constexpr bool isneg() const { return false; }
-	inline constexpr bool iszero() const { return false; }
+	inline bool isneg() const { return sign() && !isnan(); }
+	inline bool iszero() const { return !sign() && log() == special_log; }
 	inline constexpr bool isinf() const { return false; }
-	inline constexpr bool isnan() const { return false; }
-	inline constexpr bool sign() const { return false; }
-	inline constexpr int scale() const { return false; }
-	inline std::string get() const { 
+	inline bool isnan() const { return sign() && log() == special_log; }
+	inline bool sign() const { return _bits.at(nbits - 1); }
+	inline int scale() const { return int(log() >> rbits); }
+	// logarithm of the magnitude in units of 2^-rbits
+	inline int64_t log() const {
+		uint64_t raw = 0;
+		for (size_t i = 0; i < blockbinary<nbits, bt>::nrBlocks; ++i) raw |= uint64_t(_bits.block(i)) << (i * blockbinary<nbits, bt>::bitsInBlock);
+		constexpr unsigned unused = unsigned(65 - nbits);
+		return int64_t(raw << unused) >> unused;
+	}
+	inline std::string get() const {
 		std::stringstream s;
-		s << std::exp(double(_bits.to_long_long()));
-		return s.str(); 
+		s << to_double();
+		return s.str();
 	}
 
 	long double to_long_double() const {
-		return std::exp((long double)(_bits.to_long_long()))/scaling;
-	}
-	double to_double() const {
-		return std::exp(double(_bits.to_long_long()))/scaling;
-	}
-	float to_float() const {
-		return std::exp(float(_bits.to_long_long()))/scaling;
+		if (iszero()) return 0.0l;
+		if (isnan()) return std::numeric_limits<long double>::quiet_NaN();
+		long double v = std::exp2((long double)(log()) / (long double)(scaling));
+		return sign() ? -v : v;
 	}
+	double to_double() const { return double(to_long_double()); }
+	float to_float() const { return float(to_long_double()); }
 	// Maybe remove explicit
 	explicit operator long double() const { return to_long_double(); }
 	explicit operator double() const { return to_double(); }
 	explicit operator float() const { return to_float(); }
 
+	// log2(2^a + 2^b) in units of 2^-rbits without saturation
+	static int64_t gaussian_add(int64_t a, int64_t b) {
+		return (a >= b) ? a + GaussianLog::sb(b - a) : b + GaussianLog::sb(a - b);
+	}
+	// log2(2^a - 2^b) in units of 2^-rbits for a > b, without saturation
+	static int64_t gaussian_sub(int64_t a, int64_t b) {
+		return a + GaussianLog::db(b - a);
+	}
+
+	// set from a sign and a logarithm that may be out of range: saturate to maxpos/maxneg or flush to zero
+	lns& normalize(bool negative, int64_t logarithm) {
+		if (logarithm > max_log) return set(negative, max_log);
+		if (logarithm < min_log) return setzero();
+		return set(negative, logarithm);
+	}
+
 private:
 	blockbinary<nbits,bt>  _bits;
 
+	// sum or difference through the Gaussian logarithms of the ratio of the smaller to the larger magnitude
+	lns& accumulate(const lns& rhs, bool subtract) {
+		if (isnan() || rhs.isnan()) return setnan();
+		bool rhsSign = rhs.sign() != subtract;
+		if (rhs.iszero()) return *this;
+		if (iszero()) return set(rhsSign, rhs.log());
+		int64_t a = log(), b = rhs.log();
+		if (sign() == rhsSign) return normalize(sign(), gaussian_add(a, b));
+		if (a == b) return setzero();
+		return (a > b) ? normalize(sign(), gaussian_sub(a, b)) : normalize(rhsSign, gaussian_sub(b, a));
+	}
+
 	// template parameters need names different from class template parameters (for gcc and clang)
 	template<size_t nnbits, typename nbt>
 	friend std::ostream& operator<< (std::ostream& ostr, const lns<nnbits,nbt>& r);
@@ -181,17 +276,28 @@ inline std::ostream& operator<<(std::ostream& ostr, const lns<nnbits,nbt>& v) {
 }
 
 template<size_t nnbits, typename nbt>
-inline std::istream& operator>>(std::istream& istr, const lns<nnbits,nbt>& v) {
-	istr >> v._fraction;
+inline std::istream& operator>>(std::istream& istr, lns<nnbits,nbt>& v) {
+	double d;
+	istr >> d;
+	v = d;
 	return istr;
 }
 
 template<size_t nnbits, typename nbt>
-inline bool operator==(const lns<nnbits,nbt>& lhs, const lns<nnbits,nbt>& rhs) { return false; }
+inline bool operator==(const lns<nnbits,nbt>& lhs, const lns<nnbits,nbt>& rhs) {
+	if (lhs.isnan() || rhs.isnan()) return false;
+	return lhs._bits == rhs._bits;
+}
 template<size_t nnbits, typename nbt>
 inline bool operator!=(const lns<nnbits,nbt>& lhs, const lns<nnbits,nbt>& rhs) { return !operator==(lhs, rhs); }
 template<size_t nnbits, typename nbt>
-inline bool operator< (const lns<nnbits,nbt>& lhs, const lns<nnbits,nbt>& rhs) { return false; }
+inline bool operator< (const lns<nnbits,nbt>& lhs, const lns<nnbits,nbt>& rhs) {
+	if (lhs.isnan() || rhs.isnan()) return false;
+	if (lhs.iszero()) return !rhs.iszero() && !rhs.sign();
+	if (rhs.iszero()) return lhs.sign();
+	if (lhs.sign() != rhs.sign()) return lhs.sign();
+	return lhs.sign() ? (lhs.log() > rhs.log()) : (lhs.log() < rhs.log());
+}
 template<size_t nnbits, typename nbt>
 inline bool operator> (const lns<nnbits,nbt>& lhs, const lns<nnbits,nbt>& rhs) { return  operator< (rhs, lhs); }
 template<size_t nnbits, typename nbt>
@@ -203,52 +309,84 @@ inline bool operator>=(const lns<nnbits,nbt>& lhs, const lns<nnbits,nbt>& rhs) {
 // BINARY ADDITION
 template<size_t nbits, typename bt>
 inline lns<nbits, bt> operator+(const lns<nbits, bt>& lhs, const lns<nbits, bt>& rhs) {
-	lns<nbits> sum(lhs);
+	lns<nbits, bt> sum(lhs);
 	sum += rhs;
 	return sum;
 }
 // BINARY SUBTRACTION
 template<size_t nbits, typename bt>
 inline lns<nbits, bt> operator-(const lns<nbits, bt>& lhs, const lns<nbits, bt>& rhs) {
-	lns<nbits> diff(lhs);
+	lns<nbits, bt> diff(lhs);
 	diff -= rhs;
 	return diff;
 }
 // BINARY MULTIPLICATION
 template<size_t nbits, typename bt>
 inline lns<nbits, bt> operator*(const lns<nbits, bt>& lhs, const lns<nbits, bt>& rhs) {
-	lns<nbits> mul(lhs);
+	lns<nbits, bt> mul(lhs);
 	mul *= rhs;
 	return mul;
 }
 // BINARY DIVISION
 template<size_t nbits, typename bt>
 inline lns<nbits, bt> operator/(const lns<nbits, bt>& lhs, const lns<nbits, bt>& rhs) {
-	lns<nbits> ratio(lhs);
+	lns<nbits, bt> ratio(lhs);
 	ratio /= rhs;
 	return ratio;
 }
 
+/// sum of n lns values
+/// The terms are decoded once. Positive and negative terms accumulate separately in the log domain with sb only,
+/// without saturation of the partial sums, and a single db resolves the cancellation between the two partial sums.
+template<size_t nbits, typename bt>
+lns<nbits, bt> lns_sum(const lns<nbits, bt>* x, size_t n) {
+	using Lns = lns<nbits, bt>;
+	bool havePositive = false, haveNegative = false;
+	int64_t positive = 0, negative = 0;
+	Lns result;
+	for (size_t i = 0; i < n; ++i) {
+		if (x[i].isnan()) return result.setnan();
+		if (x[i].iszero()) continue;
+		int64_t term = x[i].log();
+		if (x[i].sign()) {
+			negative = haveNegative ? Lns::gaussian_add(negative, term) : term;
+			haveNegative = true;
+		}
+		else {
+			positive = havePositive ? Lns::gaussian_add(positive, term) : term;
+			havePositive = true;
+		}
+	}
+	if (!haveNegative) return havePositive ? result.normalize(false, positive) : result;
+	if (!havePositive) return result.normalize(true, negative);
+	if (positive == negative) return result;
+	return (positive > negative) ? result.normalize(false, Lns::gaussian_sub(positive, negative)) : result.normalize(true, Lns::gaussian_sub(negative, positive));
+}
+template<size_t nbits, typename bt>
+inline lns<nbits, bt> lns_sum(const std::vector< lns<nbits, bt> >& x) {
+	return lns_sum(x.data(), x.size());
+}
 
 template<size_t nbits, typename bt>
 inline std::string components(const lns<nbits,bt>& v) {
 	std::stringstream s;
 	if (v.iszero()) {
-		s << " zero b" << std::setw(nbits) << v.fraction();
+		s << " zero";
 		return s.str();
 	}
-	else if (v.isinf()) {
-		s << " infinite b" << std::setw(nbits) << v.fraction();
+	else if (v.isnan()) {
+		s << " nan";
 		return s.str();
 	}
-	s << "(" << (v.sign() ? "-" : "+") << "," << v.scale() << "," << v.fraction() << ")";
+	s << "(" << (v.sign() ? "-" : "+") << "," << v.scale() << "," << (double(v.log()) / lns<nbits, bt>::scaling) << ")";
 	return s.str();
 }
 
-/// Magnitude of a scientific notation value (equivalent to turning the sign bit off).
+/// Magnitude of a logarithmic value (equivalent to turning the sign bit off).
 template<size_t nbits, typename bt>
-lns<nbits> abs(const lns<nbits,bt>& v) {
-	return lns<nbits>();
+lns<nbits, bt> abs(const lns<nbits,bt>& v) {
+	lns<nbits, bt> a(v);
+	return (v.iszero() || v.isnan()) ? a : a.set(false, v.log());
 }
 
 
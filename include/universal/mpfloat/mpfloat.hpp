@@ -11,8 +11,23 @@
 #include <regex>
 #include <vector>
 #include <map>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <algorithm>
 
-//#include "./mpfloat_exceptions.hpp"
+#include <universal/decimal/decimal_limbs.hpp>
+#include "./mpfloat_exceptions.hpp"
+
+// MPFLOAT_DEFAULT_PRECISION is the number of base-10^9 limbs arithmetic results are rounded to
+#ifndef MPFLOAT_DEFAULT_PRECISION
+#define MPFLOAT_DEFAULT_PRECISION 8
+#endif
+
+#if !defined(MPFLOAT_THROW_ARITHMETIC_EXCEPTION)
+// default is to use std::cerr for signalling an error
+#define MPFLOAT_THROW_ARITHMETIC_EXCEPTION 0
+#endif
 
 #if defined(__clang__)
 /* Clang/LLVM. ---------------------------------------------- */
@@ -51,11 +66,18 @@ namespace unum {
 class mpfloat;
 inline mpfloat& convert(int64_t v, mpfloat& result);
 inline mpfloat& convert_unsigned(uint64_t v, mpfloat& result);
-bool parse(const std::string& number, mpfloat& v);
+inline bool parse(const std::string& number, mpfloat& v);
 
 // mpfloat is an arbitrary precision and scale linear floating point type
+// value = (-1)^sign * sum coef[i] * 10^(9 * (exp + i)), with coef in base-10^9 limbs, least significant limb first
+// the coefficient has neither leading nor trailing zero limbs, and zero is an empty, positive coefficient
+//
+// conversions from native types and strings are exact, the arithmetic operators round their result
+// to the nearest value of precision() limbs, ties to even
 class mpfloat {
 	using BlockType = uint32_t;
+	static constexpr BlockType BASE = DECIMAL_LIMB_BASE;
+	static constexpr BlockType HALF = DECIMAL_LIMB_BASE / 2;
 public:
 	mpfloat() : sign(false), exp(0) { }
 
@@ -105,28 +127,81 @@ public:
 	}
 #endif // ADAPTER_POSIT_AND_MPFLOAT
 
+	// precision context: the number of base-10^9 limbs that arithmetic results are rounded to
+	static size_t precision() { return context(); }
+	static void setprecision(size_t limbs) { context() = (limbs > 0 ? limbs : 1); }
+
 	// prefix operators
 	mpfloat operator-() const {
 		mpfloat negated(*this);
+		if (!negated.iszero()) negated.sign = !negated.sign;
 		return negated;
 	}
 
-	// conversion operators
-	explicit operator float() const { return float(toNativeFloatingPoint()); }
-	explicit operator double() const { return float(toNativeFloatingPoint()); }
+	// conversion operators: correctly rounded through the exact decimal representation
+	explicit operator float() const { return std::strtof(decimal_string().c_str(), nullptr); }
+	explicit operator double() const { return std::strtod(decimal_string().c_str(), nullptr); }
 	explicit operator long double() const { return toNativeFloatingPoint(); }
 
 	// arithmetic operators
 	mpfloat& operator+=(const mpfloat& rhs) {
-		return *this;
+		return accumulate(rhs, rhs.sign);
 	}
 	mpfloat& operator-=(const mpfloat& rhs) {
-		return *this;
+		return accumulate(rhs, !rhs.sign);
 	}
 	mpfloat& operator*=(const mpfloat& rhs) {
+		bool rhs_sign = rhs.sign;
+		int64_t rhs_exp = rhs.exp;
+		if (iszero() || rhs.iszero()) {
+			setzero();
+			return *this;
+		}
+		size_t na = coef.size(), nb = rhs.coef.size();
+		std::vector<BlockType>& ws = workspace();
+		ws.resize(na + nb);
+		declimb_multiply(ws.data(), coef.data(), na, rhs.coef.data(), nb);
+		coef.assign(ws.begin(), ws.begin() + (na + nb));
+		sign = (sign != rhs_sign);
+		exp += rhs_exp;
+		normalize();
+		round_to(precision());
 		return *this;
 	}
 	mpfloat& operator/=(const mpfloat& rhs) {
+		if (rhs.iszero()) {
+#if MPFLOAT_THROW_ARITHMETIC_EXCEPTION
+			throw mpfloat_divide_by_zero{};
+#else
+			std::cerr << "mpfloat_divide_by_zero\n";
+			return *this;
+#endif // MPFLOAT_THROW_ARITHMETIC_EXCEPTION
+		}
+		if (iszero()) return *this;
+		bool rhs_sign = rhs.sign;
+		int64_t rhs_exp = rhs.exp;
+		// scale the dividend so that the quotient carries a guard limb below the precision
+		size_t p = precision();
+		size_t na = coef.size(), nb = rhs.coef.size();
+		size_t k = (nb + p + 1 > na) ? (nb + p + 1 - na) : 0;
+		size_t m = na + k;
+		size_t nq = m - nb + 1;
+		// workspace: sticky limb and quotient, dividend, remainder, and division scratch
+		std::vector<BlockType>& ws = workspace();
+		ws.assign(1 + nq + m + nb + (m + nb + 1), 0);
+		BlockType* q = ws.data() + 1;
+		BlockType* u = q + nq;
+		BlockType* r = u + m;
+		std::copy(coef.begin(), coef.end(), u + k);
+		declimb_divmod(q, r, u, m, rhs.coef.data(), nb, r + nb);
+		// a non-zero remainder is a sticky limb below the quotient
+		bool sticky = declimb_significant(r, nb) > 0;
+		ws[0] = sticky ? 1u : 0u;
+		coef.assign(ws.begin(), ws.begin() + (1 + nq));
+		exp = exp - int64_t(k) - rhs_exp - 1;
+		sign = (sign != rhs_sign);
+		normalize();
+		round_to(p);
 		return *this;
 	}
 
@@ -138,13 +213,14 @@ public:
 		clear();
 	}
 	inline mpfloat& assign(const std::string& txt) {
+		if (!parse(txt, *this)) std::cerr << "unable to parse -" << txt << "- into an mpfloat value\n";
 		return *this;
 	}
 
 	// selectors
 	inline bool iszero() const { return !sign && coef.size() == 0; }
-	inline bool isone() const  { return true; }
-	inline bool isodd() const  { return false; }
+	inline bool isone() const  { return !sign && exp == 0 && coef.size() == 1 && coef[0] == 1; }
+	inline bool isodd() const  { return exp == 0 && coef.size() > 0 && (coef[0] & 0x1); }
 	inline bool iseven() const { return !isodd(); }
 	inline bool ispos() const  { return !sign; }
 	inline bool ineg() const   { return sign; }
@@ -165,9 +241,9 @@ public:
 
 		if (magnitude == 0) {
 			if (sign)
-				return std::string("-0.0") + str;
+				return std::string("-0.") + str;
 			else
-				return std::string("0.0") + str;
+				return std::string("0.") + str;
 		}
 
 		std::string before_decimal = std::to_string(coef.back());
@@ -203,18 +279,207 @@ protected:
 
 	// convert to native floating-point, use conversion rules to cast down to float and double
 	long double toNativeFloatingPoint() const {
-		long double ld = 0;
-		return ld;
+		return std::strtold(decimal_string().c_str(), nullptr);
+	}
+
+	// exact value as a decimal integer and a power of ten: [-]digits e exponent
+	std::string decimal_string() const {
+		if (coef.empty()) return std::string("0");
+		std::string digits = sign ? "-" : "";
+		digits += std::to_string(coef.back());
+		char segment[] = "000000000";
+		for (size_t i = coef.size() - 1; i > 0; --i) {
+			BlockType w = coef[i - 1];
+			for (int d = 8; d >= 0; --d) {
+				segment[d] = char(w % 10 + '0');
+				w /= 10;
+			}
+			digits += segment;
+		}
+		return digits + "e" + std::to_string(9 * exp);
 	}
 
+	// the significand is peeled off 28 bits at a time into an integer, and the power of two
+	// is applied as a product of limb-sized powers of 2 or, for negative powers, of 5 followed by a decimal shift
 	template<typename Ty>
-	mpfloat& float_assign(Ty& rhs) {
+	mpfloat& float_assign(Ty rhs) {
 		clear();
-		long long base = (long long)rhs;
-		*this = base;
+		if (!std::isfinite(rhs)) {
+#if MPFLOAT_THROW_ARITHMETIC_EXCEPTION
+			throw mpfloat_nonfinite_conversion{};
+#else
+			std::cerr << "mpfloat_nonfinite_conversion\n";
+			return *this;
+#endif // MPFLOAT_THROW_ARITHMETIC_EXCEPTION
+		}
+		if (rhs == 0) return *this;
+		int e;
+		Ty f = std::fabs(std::frexp(rhs, &e));
+		int shift = e;
+		while (f != 0) {
+			f = std::ldexp(f, 28);
+			Ty chunk = std::floor(f);
+			f -= chunk;
+			shift -= 28;
+			mul_small(BlockType(1) << 28, BlockType(chunk));
+		}
+		while (shift > 0) {
+			int k = (shift < 29 ? shift : 29);
+			mul_small(BlockType(1) << k);
+			shift -= k;
+		}
+		if (shift < 0) {
+			// 2^-k = 5^k * 10^-k
+			int k = -shift;
+			for (int i = k; i > 0; i -= 12) mul_small(i < 12 ? pow5(i) : pow5(12));
+			exp -= k / 9;
+			if (k % 9) {
+				mul_small(declimb_pow10(unsigned(9 - k % 9)));
+				exp -= 1;
+			}
+		}
+		sign = (rhs < 0);
+		normalize();
 		return *this;
 	}
 
+	// coef = coef * f + c for a single limb factor
+	void mul_small(BlockType f, BlockType c = 0) {
+		BlockType carry = declimb_mul_small(coef.data(), coef.data(), coef.size(), f, c);
+		if (carry) coef.push_back(carry);
+	}
+	static BlockType pow5(int e) {
+		BlockType p = 1;
+		while (e-- > 0) p *= 5;
+		return p;
+	}
+
+	// strip leading and trailing zero limbs, the trailing limbs move into the exponent
+	void normalize() {
+		coef.resize(declimb_significant(coef.data(), coef.size()));
+		size_t tz = 0;
+		while (tz < coef.size() && coef[tz] == 0) ++tz;
+		if (tz > 0) {
+			coef.erase(coef.begin(), coef.begin() + tz);
+			exp += int64_t(tz);
+		}
+		if (coef.empty()) clear();
+	}
+
+	// round the normalized coefficient to the nearest value with at most limbs limbs, ties to even
+	void round_to(size_t limbs) {
+		if (coef.size() <= limbs) return;
+		size_t drop = coef.size() - limbs;
+		BlockType guard = coef[drop - 1];
+		bool sticky = declimb_significant(coef.data(), drop - 1) > 0;
+		bool roundup = (guard > HALF) || (guard == HALF && (sticky || (coef[drop] & 0x1)));
+		coef.erase(coef.begin(), coef.begin() + drop);
+		exp += int64_t(drop);
+		if (roundup) {
+			BlockType one = 1;
+			if (declimb_add_inplace(coef.data(), coef.size(), &one, 1)) coef.push_back(1);
+		}
+		normalize();
+	}
+
+	// add rhs with sign rhs_sign in place: the coefficient buffer is widened to the span of both operands
+	// when the operands are two or more limbs apart, the result loses at most one leading limb to cancellation,
+	// and the smaller operand is truncated a few limbs below the precision of the result, but not below the
+	// larger operand: the truncated limbs are replaced by a sticky limb, which cannot change the rounding
+	mpfloat& accumulate(const mpfloat& rhs, bool rhs_sign) {
+		if (&rhs == this) {
+			mpfloat operand(rhs);
+			return accumulate(operand, rhs_sign);
+		}
+		size_t p = precision();
+		if (rhs.iszero()) {
+			round_to(p);
+			return *this;
+		}
+		if (iszero()) {
+			coef = rhs.coef;
+			exp = rhs.exp;
+			sign = rhs_sign;
+			round_to(p);
+			return *this;
+		}
+		int64_t lscale = scale(), rscale = rhs.scale();
+		int64_t top = std::max(lscale, rscale) + 1;
+		int64_t cut = std::numeric_limits<int64_t>::min();
+		if (lscale - rscale >= 2) cut = std::min(lscale - int64_t(p) - 3, exp);
+		if (rscale - lscale >= 2) cut = std::min(rscale - int64_t(p) - 3, rhs.exp);
+
+		// truncate this operand at the cut
+		if (exp < cut) {
+			size_t k = size_t(std::min(cut - exp, int64_t(coef.size())));
+			bool sticky = declimb_significant(coef.data(), k) > 0;
+			coef.erase(coef.begin(), coef.begin() + k);
+			exp = cut;
+			if (sticky) {
+				coef.insert(coef.begin(), 1);
+				--exp;
+			}
+		}
+		// the limbs of rhs at or above the cut
+		const BlockType* rlimbs = rhs.coef.data();
+		size_t rsize = rhs.coef.size();
+		int64_t rexp = rhs.exp;
+		bool rsticky = false;
+		if (rexp < cut) {
+			size_t k = size_t(std::min(cut - rexp, int64_t(rsize)));
+			rsticky = declimb_significant(rlimbs, k) > 0;
+			rlimbs += k;
+			rsize -= k;
+			rexp = cut;
+		}
+		int64_t bottom = std::min(exp, rsticky ? rexp - 1 : rexp);
+
+		// widen the coefficient to [bottom, top)
+		coef.insert(coef.begin(), size_t(exp - bottom), 0);
+		exp = bottom;
+		coef.resize(size_t(top - bottom), 0);
+		size_t n = coef.size();
+		BlockType one = 1;
+		if (sign == rhs_sign) {
+			declimb_add_inplace(coef.data() + (rexp - bottom), n - size_t(rexp - bottom), rlimbs, rsize);
+			if (rsticky) declimb_add_inplace(coef.data() + (rexp - 1 - bottom), n - size_t(rexp - 1 - bottom), &one, 1);
+		}
+		else {
+			BlockType borrow = declimb_sub_inplace(coef.data() + (rexp - bottom), n - size_t(rexp - bottom), rlimbs, rsize);
+			if (rsticky) borrow |= declimb_sub_inplace(coef.data() + (rexp - 1 - bottom), n - size_t(rexp - 1 - bottom), &one, 1);
+			if (borrow) {
+				// |rhs| > |this|: the ten's complement is the magnitude of the difference
+				for (size_t i = 0; i < n; ++i) coef[i] = (BASE - 1) - coef[i];
+				declimb_add_inplace(coef.data(), n, &one, 1);
+				sign = rhs_sign;
+			}
+		}
+		normalize();
+		round_to(p);
+		return *this;
+	}
+
+	// compare the magnitudes of two normalized values: returns -1, 0, or 1
+	static int compare_magnitude(const mpfloat& lhs, const mpfloat& rhs) {
+		if (lhs.coef.empty() || rhs.coef.empty()) return (lhs.coef.empty() ? 0 : 1) - (rhs.coef.empty() ? 0 : 1);
+		if (lhs.scale() != rhs.scale()) return (lhs.scale() < rhs.scale()) ? -1 : 1;
+		size_t i = lhs.coef.size(), j = rhs.coef.size();
+		for (; i > 0 && j > 0; --i, --j) {
+			if (lhs.coef[i - 1] != rhs.coef[j - 1]) return (lhs.coef[i - 1] < rhs.coef[j - 1]) ? -1 : 1;
+		}
+		return (i > 0) ? 1 : ((j > 0) ? -1 : 0);
+	}
+
+	// precision context and scratch limbs of the calling thread
+	static size_t& context() {
+		static thread_local size_t limbs = MPFLOAT_DEFAULT_PRECISION;
+		return limbs;
+	}
+	static std::vector<BlockType>& workspace() {
+		static thread_local std::vector<BlockType> ws;
+		return ws;
+	}
+
 	// convert to string with nrDigits of significant digits and return the scale
 	// value = str + "10^" + scale
 	int64_t trimmed(size_t nrDigits, std::string& number) const {
@@ -278,6 +543,7 @@ private:
 
 	// mpfloat - mpfloat logic comparisons
 	friend bool operator==(const mpfloat& lhs, const mpfloat& rhs);
+	friend bool operator< (const mpfloat& lhs, const mpfloat& rhs);
 
 	// mpfloat - literal logic comparisons
 	friend bool operator==(const mpfloat& lhs, const long long rhs);
@@ -287,6 +553,11 @@ private:
 
 	// find the most significant bit set
 	friend signed findMsb(const mpfloat& v);
+
+	friend mpfloat& convert(int64_t v, mpfloat& result);
+	friend mpfloat& convert_unsigned(uint64_t v, mpfloat& result);
+	friend bool parse(const std::string& number, mpfloat& value);
+	friend mpfloat sqrt(const mpfloat& a);
 };
 
 inline mpfloat& convert(int64_t v, mpfloat& result) {
@@ -294,18 +565,19 @@ inline mpfloat& convert(int64_t v, mpfloat& result) {
 		result.setzero();
 	}
 	else {
-		// convert 
+		convert_unsigned((v < 0) ? (uint64_t(0) - uint64_t(v)) : uint64_t(v), result);
+		result.sign = (v < 0);
 	}
 	return result;
 }
 
 inline mpfloat& convert_unsigned(uint64_t v, mpfloat& result) {
-	if (0 == v) {
-		result.setzero();
-	}
-	else {
-		// convert 
+	result.setzero();
+	while (v > 0) {
+		result.coef.push_back(uint32_t(v % DECIMAL_LIMB_BASE));
+		v /= DECIMAL_LIMB_BASE;
 	}
+	result.normalize();
 	return result;
 }
 
@@ -313,7 +585,37 @@ inline mpfloat& convert_unsigned(uint64_t v, mpfloat& result) {
 
 
 inline mpfloat abs(const mpfloat& a) {
-	return a; // (a < 0 ? -a : a);
+	return (a.ineg() ? -a : a);
+}
+
+// square root, rounded to the precision context
+// the coefficient is extended with zero limbs to an even exponent and at least 2 * (precision + 1) limbs,
+// so that the integer square root carries a guard limb, and an inexact root is marked with a sticky limb
+inline mpfloat sqrt(const mpfloat& a) {
+	mpfloat root;
+	if (a.ineg()) {
+#if MPFLOAT_THROW_ARITHMETIC_EXCEPTION
+		throw mpfloat_negative_sqrt_arg{};
+#else
+		std::cerr << "mpfloat_negative_sqrt_arg\n";
+		return root;
+#endif // MPFLOAT_THROW_ARITHMETIC_EXCEPTION
+	}
+	if (a.iszero()) return root;
+	size_t p = mpfloat::precision();
+	size_t na = a.coef.size();
+	size_t k = (2 * (p + 1) > na) ? (2 * (p + 1) - na) : 0;
+	if ((a.exp - int64_t(k)) & 0x1) ++k;
+	std::vector<uint32_t> u(k, 0), s;
+	u.insert(u.end(), a.coef.begin(), a.coef.end());
+	bool exact = declimb_sqrt(s, u.data(), u.size());
+	root.coef.reserve(s.size() + 1);
+	root.coef.push_back(exact ? 0u : 1u);
+	root.coef.insert(root.coef.end(), s.begin(), s.end());
+	root.exp = (a.exp - int64_t(k)) / 2 - 1;
+	root.normalize();
+	root.round_to(p);
+	return root;
 }
 
 
@@ -327,17 +629,47 @@ inline signed findMsb(const mpfloat& v) {
 
 // divide mpfloat a and b and return result argument
 
-void divide(const mpfloat& a, const mpfloat& b, mpfloat& quotient) {
+inline void divide(const mpfloat& a, const mpfloat& b, mpfloat& quotient) {
+	quotient = a;
+	quotient /= b;
 }
 
 /// stream operators
 
 // read a mpfloat ASCII format and make a binary mpfloat out of it
-
-bool parse(const std::string& number, mpfloat& value) {
-	bool bSuccess = false;
-
-	return bSuccess;
+// accepts [+|-]digits[.digits][(e|E)[+|-]digits], the conversion is exact
+
+inline bool parse(const std::string& number, mpfloat& value) {
+	static const std::regex decimal_regex("[\\+-]?([0-9]+\\.?[0-9]*|\\.[0-9]+)([eE][\\+-]?[0-9]+)?");
+	if (!std::regex_match(number, decimal_regex)) return false;
+	bool negative = (number[0] == '-');
+	std::string digits;
+	int64_t scale = 0;
+	bool fraction = false;
+	size_t i = (number[0] == '-' || number[0] == '+') ? 1 : 0;
+	for (; i < number.size() && number[i] != 'e' && number[i] != 'E'; ++i) {
+		if (number[i] == '.') {
+			fraction = true;
+		}
+		else {
+			digits += number[i];
+			if (fraction) --scale;
+		}
+	}
+	if (i < number.size()) scale += std::stoll(number.substr(i + 1));
+	// align the decimal exponent to a limb boundary
+	int64_t r = ((scale % 9) + 9) % 9;
+	digits.append(size_t(r), '0');
+	scale -= r;
+	value.setzero();
+	for (size_t end = digits.size(); end > 0; end = (end > 9 ? end - 9 : 0)) {
+		size_t begin = (end > 9 ? end - 9 : 0);
+		value.coef.push_back(uint32_t(std::stoul(digits.substr(begin, end - begin))));
+	}
+	value.exp = scale / 9;
+	value.sign = negative;
+	value.normalize();
+	return true;
 }
 
 // generate an mpfloat format ASCII format
@@ -376,7 +708,7 @@ inline std::istream& operator>>(std::istream& istr, mpfloat& p) {
 // equal: precondition is that the storage is properly nulled in all arithmetic paths
 
 inline bool operator==(const mpfloat& lhs, const mpfloat& rhs) {
-	return true;
+	return lhs.sign == rhs.sign && lhs.exp == rhs.exp && lhs.coef == rhs.coef;
 }
 
 inline bool operator!=(const mpfloat& lhs, const mpfloat& rhs) {
@@ -384,7 +716,9 @@ inline bool operator!=(const mpfloat& lhs, const mpfloat& rhs) {
 }
 
 inline bool operator< (const mpfloat& lhs, const mpfloat& rhs) {
-	return false; // lhs and rhs are the same
+	if (lhs.sign != rhs.sign) return lhs.sign;
+	int cmp = mpfloat::compare_magnitude(lhs, rhs);
+	return lhs.sign ? (cmp > 0) : (cmp < 0);
 }
 
 inline bool operator> (const mpfloat& lhs, const mpfloat& rhs) {
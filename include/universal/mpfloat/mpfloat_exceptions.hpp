@@ -0,0 +1,26 @@
+#pragma once
+// mpfloat_exceptions.hpp: definition of multi-precision floating point exceptions
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <stdexcept>
+
+namespace sw { namespace unum {
+
+// divide by zero arithmetic exception for mpfloat
+struct mpfloat_divide_by_zero : public std::runtime_error {
+	mpfloat_divide_by_zero() : std::runtime_error("mpfloat division by zero") {}
+};
+
+// square root of a negative number
+struct mpfloat_negative_sqrt_arg : public std::runtime_error {
+	mpfloat_negative_sqrt_arg() : std::runtime_error("mpfloat sqrt of negative number") {}
+};
+
+// mpfloat has no encoding for infinity and NaN
+struct mpfloat_nonfinite_conversion : public std::runtime_error {
+	mpfloat_nonfinite_conversion() : std::runtime_error("mpfloat assignment of a non-finite value") {}
+};
+
+}} // namespace sw::unum
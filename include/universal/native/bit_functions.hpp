@@ -5,6 +5,9 @@
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <cstdint>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 // This file contains bit manipulation functions for native integer types.
 namespace sw { namespace unum {
@@ -77,4 +80,31 @@ inline unsigned int findMostSignificantBit(signed char x) {
 	return base + bval[tmp];
 }
 
+// count the number of leading zeros of a 64-bit word: returns 64 when no bits are set
+inline int countLeadingZeros(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+	return (x == 0 ? 64 : __builtin_clzll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	return (_BitScanReverse64(&index, x) ? 63 - int(index) : 64);
+#else
+	return 64 - int(findMostSignificantBit((unsigned long long)x));
+#endif
+}
+
+// count the number of trailing zeros of a 64-bit word: returns 64 when no bits are set
+inline int countTrailingZeros(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+	return (x == 0 ? 64 : __builtin_ctzll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	return (_BitScanForward64(&index, x) ? int(index) : 64);
+#else
+	if (x == 0) return 64;
+	int n = 0;
+	while ((x & 0x1) == 0) { x >>= 1; ++n; }
+	return n;
+#endif
+}
+
 }}  // namespace sw::unum
@@ -35,7 +35,7 @@ fdp_stride(size_t n, const Vector& x, size_t incx, const Vector& y, size_t incy)
 	quire<nbits, es, capacity> q = 0;
 	size_t ix, iy;
 	for (ix = 0, iy = 0; ix < n && iy < n; ix = ix + incx, iy = iy + incy) {
-		q += sw::unum::quire_mul(x[ix], y[iy]);
+		q.fma(x[ix], y[iy]);
 		if (sw::unum::_trace_quire_add) std::cout << q << '\n';
 	}
 	typename Vector::value_type sum;
@@ -55,7 +55,7 @@ fdp(const Vector& x, const Vector& y) {
 	quire<nbits, es, capacity> q(0);
 	size_t ix, iy, n = size(x);
 	for (ix = 0, iy = 0; ix < n && iy < n; ++ix, ++iy) {
-		q += sw::unum::quire_mul(x[ix], y[iy]);
+		q.fma(x[ix], y[iy]);
 	}
 	typename Vector::value_type sum;
 	convert(q.to_value(), sum);     // one and only rounding step of the fused-dot product
@@ -78,7 +78,7 @@ fdp(const Vector& x, const Vector& y) {
 	quire<nbits, es, capacity> q(0);
 	size_t ix, iy, n = size(x);
 	for (ix = 0, iy = 0; ix < n && iy < n; ++ix, ++iy) {
-		q += sw::unum::quire_mul(x[ix], y[iy]);
+		q.fma(x[ix], y[iy]);
 	}
 	typename Vector::value_type sum;
 	convert(q.to_value(), sum);     // one and only rounding step of the fused-dot product
@@ -0,0 +1,1348 @@
+#pragma once
+// elementary_kernels.hpp: evaluation of the elementary functions of posits in the posit domain
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <type_traits>
+#include "universal/posit/quire.hpp"
+#include "universal/posit/posit_batch.hpp"
+#include "elementary_tables.hpp"
+
+// POSIT_NATIVE_ELEMENTARY_FUNCTIONS when set evaluates every elementary function in the posit domain.
+// By default only the posit configurations whose fraction, with guard bits, does not fit the significand
+// of double or long double, such as posit<64,3> and posit<128,4>, are evaluated in the posit domain,
+// and the smaller configurations round the result of the native math library, which is faithful but not
+// guaranteed to be correctly rounded.
+#ifndef POSIT_NATIVE_ELEMENTARY_FUNCTIONS
+#define POSIT_NATIVE_ELEMENTARY_FUNCTIONS 0
+#endif
+
+namespace sw { namespace unum { namespace internal {
+
+/*
+ The posit-domain kernels follow the classic recipe of argument reduction, series evaluation, and reconstruction,
+ carried out in a working posit<nbits + 20, es> with the quire as the accumulator: every Horner step and every
+ reconstruction is a fused multiply-add that rounds once, and the constants are (hi, lo) pairs of working posits
+ taken from the 768-bit tables in elementary_tables.hpp, so that the reductions are exact to twice the working precision.
+ The coefficients are Taylor coefficients computed at the working precision on first use, because the kernels
+ serve every posit configuration; the number of terms adapts to the magnitude of the reduced argument.
+
+ The working result is accepted when the 16 working posits on either side of it round to the same posit<nbits, es>,
+ which is Ziv's rounding test. Otherwise the function is evaluated again in posit<nbits + 64, es> and that result is rounded.
+ Results that are exact, such as exp2 of an integer, are exact in the working posit and round correctly on the second pass.
+ */
+
+/////////////////////////////////////////////////////////////////////////////////////
+// selection of the evaluation method
+
+// a native floating-point type evaluates the elementary functions of a posit<nbits, es> when its significand holds
+// the widest significand of the posit, nbits - 2 - es bits with the hidden bit, plus 12 guard bits
+// and its exponent covers the dynamic range of the posit
+template<typename Real, size_t nbits, size_t es>
+constexpr bool elementary_fits_native() {
+	return (int(nbits) - 2 - int(es)) + 12 <= std::numeric_limits<Real>::digits
+		&& (int(nbits) << es) < std::numeric_limits<Real>::max_exponent;
+}
+
+// the native floating-point type of a posit configuration, void when the posit is evaluated in the posit domain
+template<size_t nbits, size_t es>
+using elementary_native_t = std::conditional_t<elementary_fits_native<double, nbits, es>(), double,
+	std::conditional_t<elementary_fits_native<long double, nbits, es>(), long double, void>>;
+
+template<size_t nbits, size_t es>
+constexpr bool elementary_in_posit_domain() {
+	return POSIT_NATIVE_ELEMENTARY_FUNCTIONS || std::is_void<elementary_native_t<nbits, es>>::value;
+}
+
+// posit configurations whose encodings convert to and from double with the branch-free batch kernels
+template<size_t nbits, size_t es>
+constexpr bool elementary_batch_convertible() {
+	return nbits >= es + 4 && 2 * nbits + es <= 33 && ((int(nbits) - 2) << es) < 1022;
+}
+
+template<typename Real, size_t nbits, size_t es>
+inline Real elementary_to_native(const posit<nbits, es>& x) {
+	if constexpr (std::is_same<Real, double>::value && elementary_batch_convertible<nbits, es>()) {
+		return posit_batch_kernels<nbits, es>::to_double(uint32_t(x.encoding()));
+	}
+	else {
+		return Real(x);
+	}
+}
+
+template<size_t nbits, size_t es, typename Real>
+inline posit<nbits, es> elementary_from_native(Real v) {
+	posit<nbits, es> p;
+	if constexpr (std::is_same<Real, double>::value && elementary_batch_convertible<nbits, es>()) {
+		p.set_raw_bits(posit_batch_kernels<nbits, es>::from_double(v));
+	}
+	else {
+		p = v;
+	}
+	return p;
+}
+
+// evaluate a function of the native type of the posit configuration and round the result to the posit
+template<size_t nbits, size_t es, typename Function>
+inline posit<nbits, es> elementary_native(const posit<nbits, es>& x, Function f) {
+	using Real = elementary_native_t<nbits, es>;
+	return elementary_from_native<nbits, es>(f(elementary_to_native<Real>(x)));
+}
+template<size_t nbits, size_t es, typename Function>
+inline posit<nbits, es> elementary_native(const posit<nbits, es>& x, const posit<nbits, es>& y, Function f) {
+	using Real = elementary_native_t<nbits, es>;
+	return elementary_from_native<nbits, es>(f(elementary_to_native<Real>(x), elementary_to_native<Real>(y)));
+}
+
+// a native result that overflowed or underflowed is replaced by a value that rounds to maxpos or minpos:
+// only for functions whose result is never zero
+template<typename Real>
+inline Real elementary_saturate(Real v) {
+	if (std::isinf(v)) return std::copysign(std::numeric_limits<Real>::max(), v);
+	if (v == Real(0)) return std::numeric_limits<Real>::min();
+	return v;
+}
+
+// the native evaluation of each function, shared by the scalar functions and the array functions of blas/vmath
+struct elementary_native_exp   { template<typename Real> Real operator()(Real v) const { return elementary_saturate(std::exp(v)); } };
+struct elementary_native_exp2  { template<typename Real> Real operator()(Real v) const { return elementary_saturate(std::exp2(v)); } };
+struct elementary_native_exp10 { template<typename Real> Real operator()(Real v) const { return elementary_saturate(std::pow(Real(10), v)); } };
+struct elementary_native_expm1 { template<typename Real> Real operator()(Real v) const { return v == Real(0) ? v : elementary_saturate(std::expm1(v)); } };
+struct elementary_native_log   { template<typename Real> Real operator()(Real v) const { return std::log(v); } };
+struct elementary_native_log2  { template<typename Real> Real operator()(Real v) const { return std::log2(v); } };
+struct elementary_native_log10 { template<typename Real> Real operator()(Real v) const { return std::log10(v); } };
+struct elementary_native_log1p { template<typename Real> Real operator()(Real v) const { return std::log1p(v); } };
+struct elementary_native_sin   { template<typename Real> Real operator()(Real v) const { return std::sin(v); } };
+struct elementary_native_cos   { template<typename Real> Real operator()(Real v) const { return std::cos(v); } };
+struct elementary_native_tan   { template<typename Real> Real operator()(Real v) const { return std::tan(v); } };
+struct elementary_native_cot   { template<typename Real> Real operator()(Real v) const { return std::cos(v) / std::sin(v); } };
+struct elementary_native_sec   { template<typename Real> Real operator()(Real v) const { return Real(1) / std::cos(v); } };
+struct elementary_native_csc   { template<typename Real> Real operator()(Real v) const { return Real(1) / std::sin(v); } };
+struct elementary_native_atan  { template<typename Real> Real operator()(Real v) const { return std::atan(v); } };
+struct elementary_native_asin  { template<typename Real> Real operator()(Real v) const { return std::asin(v); } };
+struct elementary_native_acos  { template<typename Real> Real operator()(Real v) const { return std::acos(v); } };
+struct elementary_native_sinh  { template<typename Real> Real operator()(Real v) const { return v == Real(0) ? v : elementary_saturate(std::sinh(v)); } };
+struct elementary_native_cosh  { template<typename Real> Real operator()(Real v) const { return elementary_saturate(std::cosh(v)); } };
+struct elementary_native_tanh  { template<typename Real> Real operator()(Real v) const { return std::tanh(v); } };
+struct elementary_native_asinh { template<typename Real> Real operator()(Real v) const { return std::asinh(v); } };
+struct elementary_native_acosh { template<typename Real> Real operator()(Real v) const { return std::acosh(v); } };
+struct elementary_native_atanh { template<typename Real> Real operator()(Real v) const { return std::atanh(v); } };
+
+// y[i] = f(x[i]) for i in [0, n): the configurations evaluated natively convert a block of operands, apply the native
+// function, and round the block in three separate loops that the compiler can vectorize, and the configurations
+// evaluated in the posit domain call the posit function for each element. x and y may be the same array.
+template<size_t nbits, size_t es, typename Native, typename Function>
+void elementary_array(const posit<nbits, es>* x, posit<nbits, es>* y, size_t n, Native native, Function function) {
+	if constexpr (elementary_in_posit_domain<nbits, es>()) {
+		for (size_t i = 0; i < n; ++i) y[i] = function(x[i]);
+	}
+	else {
+		using Real = elementary_native_t<nbits, es>;
+		constexpr size_t blockSize = 64;
+		Real block[blockSize];
+		for (size_t i = 0; i < n; i += blockSize) {
+			size_t m = (n - i < blockSize) ? n - i : blockSize;
+			for (size_t j = 0; j < m; ++j) block[j] = elementary_to_native<Real>(x[i + j]);
+			for (size_t j = 0; j < m; ++j) block[j] = native(block[j]);
+			for (size_t j = 0; j < m; ++j) y[i + j] = x[i + j].isnar() ? x[i + j] : elementary_from_native<nbits, es>(block[j]);
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+// working precision arithmetic
+
+template<size_t wbits, size_t es>
+inline posit<wbits, es> elementary_round(const quire<wbits, es, 30>& q) {
+	posit<wbits, es> p;
+	convert(q.template sticky_value<wbits>(), p);
+	return p;
+}
+
+// the value of a working posit times 2^k
+template<size_t wbits, size_t es>
+inline value<posit<wbits, es>::fbits> elementary_ldexp(const posit<wbits, es>& y, int k) {
+	value<posit<wbits, es>::fbits> v = y.to_value();
+	if (!v.iszero() && !v.isinf() && !v.isnan()) v.setExponent(v.scale() + k);
+	return v;
+}
+
+// scale of the leading bit of a nonzero posit
+template<size_t wbits, size_t es>
+inline int elementary_scale(const posit<wbits, es>& y) {
+	return y.to_value().scale();
+}
+
+// number of bits to represent a nonnegative integer
+constexpr size_t elementary_bit_width(size_t v) {
+	return v == 0 ? 0 : 1 + elementary_bit_width(v >> 1);
+}
+
+// (hi, lo) pair of working posits whose sum approximates a constant to about twice the working precision
+template<size_t wbits, size_t es>
+struct elementary_pair {
+	posit<wbits, es> hi, lo;
+};
+
+// the constants and series coefficients of the kernels at the working precision posit<wbits, es>, computed once
+template<size_t wbits, size_t es>
+class elementary_constants {
+public:
+	using Posit = posit<wbits, es>;
+	using Pair = elementary_pair<wbits, es>;
+	static constexpr size_t fbits = Posit::fbits;
+
+	Pair pi, pi_2, pi_6, sqrt3, ln2, ln10, log2e, log10e, log10_2;
+	std::vector<Posit> exp_series;   // 1/k!                 for |r| <= ln(2)/2
+	std::vector<Posit> expm1_series; // 1/(k + 1)!           for |r| <= ln(2)/2
+	std::vector<Posit> sin_series;   // (-1)^k / (2k + 1)!    in r^2 for |r| <= pi/4
+	std::vector<Posit> cos_series;   // (-1)^k / (2k)!        in r^2 for |r| <= pi/4
+	std::vector<Posit> sinh_series;  // 1 / (2k + 1)!         in x^2 for |x| <= 1
+	std::vector<Posit> atan_series;  // (-1)^k / (2k + 1)     in t^2 for |t| <= 2 - sqrt(3)
+	std::vector<Posit> atanh_series; // 1 / (2k + 1)          in s^2 for |s| <= 3 - 2 sqrt(2)
+
+	static const elementary_constants& instance() {
+		static const elementary_constants constants;
+		return constants;
+	}
+
+private:
+	static constexpr size_t tbits = 2 * wbits + 16;   // fraction bits taken from the tables
+	static_assert(tbits < 768, "elementary_constants: working precision exceeds the precision of the constant tables");
+
+	elementary_constants() {
+		pi      = make_pair(pi_scale, pi_bits);
+		pi_2    = make_pair(pi_scale - 1, pi_bits);
+		pi_6    = make_pair(pi_6_scale, pi_6_bits);
+		sqrt3   = make_pair(sqrt3_scale, sqrt3_bits);
+		ln2     = make_pair(ln2_scale, ln2_bits);
+		ln10    = make_pair(ln10_scale, ln10_bits);
+		log2e   = make_pair(log2e_scale, log2e_bits);
+		log10e  = make_pair(log10e_scale, log10e_bits);
+		log10_2 = make_pair(log10_2_scale, log10_2_bits);
+
+		// log2 of the magnitude of the k-th term of each series at the bound of its argument
+		auto log2_inverse_factorial = [](double n) { return -std::lgamma(n + 1.0) / std::log(2.0); };
+		size_t nexp   = terms([&](double k) { return k * std::log2(0.3466) + log2_inverse_factorial(k); });
+		size_t nsin   = terms([&](double k) { return 2 * k * std::log2(0.7854) + log2_inverse_factorial(2 * k + 1); });
+		size_t ncos   = terms([&](double k) { return 2 * k * std::log2(0.7854) + log2_inverse_factorial(2 * k); });
+		size_t nsinh  = terms([&](double k) { return log2_inverse_factorial(2 * k + 1); });
+		size_t natan  = terms([&](double k) { return 2 * k * std::log2(0.2680) - std::log2(2 * k + 1); });
+		size_t natanh = terms([&](double k) { return 2 * k * std::log2(0.1716) - std::log2(2 * k + 1); });
+
+		// inverse factorials 1/n! for n up to the longest factorial series
+		size_t nfactorials = std::max(nexp, std::max(2 * nsin, std::max(2 * ncos, 2 * nsinh)));
+		std::vector<Posit> inverse_factorial(nfactorials + 1);
+		inverse_factorial[0] = 1;
+		for (size_t n = 1; n <= nfactorials; ++n) inverse_factorial[n] = inverse_factorial[n - 1] / Posit(n);
+
+		for (size_t k = 0; k < nexp; ++k) exp_series.push_back(inverse_factorial[k]);
+		expm1_series.assign(exp_series.begin() + 1, exp_series.end());
+		for (size_t k = 0; k < nsin; ++k) sin_series.push_back((k & 1) ? -inverse_factorial[2 * k + 1] : inverse_factorial[2 * k + 1]);
+		for (size_t k = 0; k < ncos; ++k) cos_series.push_back((k & 1) ? -inverse_factorial[2 * k] : inverse_factorial[2 * k]);
+		for (size_t k = 0; k < nsinh; ++k) sinh_series.push_back(inverse_factorial[2 * k + 1]);
+		for (size_t k = 0; k < natan; ++k) {
+			Posit c = Posit(1) / Posit(2 * k + 1);
+			atan_series.push_back((k & 1) ? -c : c);
+		}
+		for (size_t k = 0; k < natanh; ++k) atanh_series.push_back(Posit(1) / Posit(2 * k + 1));
+	}
+
+	// number of terms of a series until the magnitude of the terms drops below 2^-(fbits + 8)
+	template<typename Log2Term>
+	static size_t terms(Log2Term log2term) {
+		size_t k = 1;
+		while (log2term(double(k)) > -double(fbits + 8)) ++k;
+		return k;
+	}
+
+	// split a table constant into a (hi, lo) pair
+	static Pair make_pair(int scale, const uint32_t* bits) {
+		bitblock<tbits> fraction;
+		for (size_t j = 0; j < tbits; ++j) {
+			size_t t = j + 1;  // skip the leading bit of the table, which is the hidden bit
+			fraction[tbits - 1 - j] = (bits[t >> 5] >> (31 - (t & 31))) & 0x1;
+		}
+		value<tbits> v(false, scale, fraction, false, false);
+		Pair p;
+		convert(v, p.hi);
+		quire<wbits, es, 30> q(v);
+		q -= p.hi.to_value();
+		p.lo = elementary_round(q);
+		return p;
+	}
+};
+
+// c[0] + c[1] z + ... + c[n-1] z^(n-1) with one rounding per Horner step: the coefficients are at most 1 in magnitude,
+// so the terms of a small z that fall below the working precision are skipped
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_horner(const std::vector<posit<wbits, es>>& c, const posit<wbits, es>& z) {
+	constexpr int fbits = int(posit<wbits, es>::fbits);
+	if (z.iszero()) return c[0];
+	size_t n = c.size();
+	int log2z = elementary_scale(z) + 1;   // |z| < 2^log2z
+	if (log2z < 0) {
+		size_t significant = size_t((fbits + 8) / -log2z) + 1;
+		if (significant < n) n = significant;
+	}
+	posit<wbits, es> y = c[n - 1];
+	quire<wbits, es, 30> q;
+	for (size_t k = n - 1; k-- > 0; ) {
+		q = c[k];
+		q.fma(y, z);
+		y = elementary_round(q);
+	}
+	return y;
+}
+
+// quotient at the working precision: the native reciprocal of the divisor refined by residual corrections
+// q += (n - d q) / d in the quire, each of which gains the 60 bits of the native reciprocal
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_divide(const posit<wbits, es>& n, const posit<wbits, es>& d) {
+	using Posit = posit<wbits, es>;
+	Posit reciprocal(1.0L / (long double)d);
+	quire<wbits, es, 30> q;
+	q.fma(n, reciprocal);
+	Posit y = elementary_round(q);
+	for (int bits = std::numeric_limits<long double>::digits - 4; bits < int(Posit::fbits) + 4; bits += std::numeric_limits<long double>::digits - 4) {
+		q = n;
+		q.fma(-d, y);
+		Posit residual = elementary_round(q);
+		q = y;
+		q.fma(residual, reciprocal);
+		y = elementary_round(q);
+	}
+	return y;
+}
+
+// square root at the working precision: a native seed refined with Newton steps y = (y + m/y)/2
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_sqrt(const posit<wbits, es>& a) {
+	using Posit = posit<wbits, es>;
+	if (a.iszero()) return a;
+	// a = m 2^(2h) with m in [1, 4)
+	auto v = a.to_value();
+	int h = (v.scale() >= 0) ? v.scale() / 2 : -((1 - v.scale()) / 2);
+	v.setExponent(v.scale() - 2 * h);
+	Posit m;
+	convert(v, m);
+	Posit y(std::sqrt((long double)m));
+	Posit half(0.5);
+	quire<wbits, es, 30> q;
+	for (int bits = std::numeric_limits<long double>::digits - 4; bits < int(Posit::fbits) + 4; bits *= 2) {
+		Posit mdivy = elementary_divide(m, y);
+		q.clear();
+		q.fma(half, y);
+		q.fma(half, mdivy);
+		y = elementary_round(q);
+	}
+	convert(elementary_ldexp(y, h), y);
+	return y;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+// limb arithmetic of the Payne-Hanek reduction and of exact powers
+
+using elementary_limbs = std::vector<uint32_t>;  // little-endian 32-bit words
+
+inline elementary_limbs elementary_multiply(const elementary_limbs& a, const elementary_limbs& b) {
+	elementary_limbs p(a.size() + b.size(), 0);
+	for (size_t i = 0; i < a.size(); ++i) {
+		uint64_t carry = 0;
+		for (size_t j = 0; j < b.size(); ++j) {
+			uint64_t t = uint64_t(a[i]) * b[j] + p[i + j] + carry;
+			p[i + j] = uint32_t(t);
+			carry = t >> 32;
+		}
+		p[i + b.size()] = uint32_t(carry);
+	}
+	return p;
+}
+
+// index of the most significant bit that is set, -1 for zero
+inline int elementary_msb(const elementary_limbs& a) {
+	for (size_t i = a.size(); i-- > 0; ) {
+		if (a[i]) {
+			int msb = 31;
+			while (!((a[i] >> msb) & 0x1)) --msb;
+			return int(i * 32) + msb;
+		}
+	}
+	return -1;
+}
+
+inline bool elementary_bit(const elementary_limbs& a, int i) {
+	return (i >= 0 && i < int(32 * a.size())) ? ((a[size_t(i) >> 5] >> (i & 31)) & 0x1) : false;
+}
+
+// a nonzero integer times 2^(scale - msb) as a value<fbits>: the bits below the fraction are jammed into its lsb
+template<size_t fbits>
+value<fbits> elementary_to_value(const elementary_limbs& a, bool sign, int scale) {
+	int msb = elementary_msb(a);
+	bitblock<fbits> fraction;
+	int i = msb - 1;
+	for (int f = int(fbits) - 1; f >= 0 && i >= 0; --f, --i) fraction[size_t(f)] = elementary_bit(a, i);
+	bool sticky = false;
+	for (; i >= 0 && !sticky; --i) sticky = elementary_bit(a, i);
+	if (sticky) fraction[0] = true;
+	return value<fbits>(sign, scale, fraction, false, false);
+}
+
+// the significand of a nonzero posit as an integer M with |x| = M 2^(scale - fbits)
+template<size_t nbits, size_t es>
+elementary_limbs elementary_significand(const posit<nbits, es>& x, int& scale) {
+	constexpr size_t fbits = posit<nbits, es>::fbits;
+	auto v = x.to_value();
+	scale = v.scale();
+	elementary_limbs m(fbits / 32 + 1, 0);
+	bitblock<fbits> fraction = v.fraction();
+	for (size_t i = 0; i < fbits; ++i) if (fraction[i]) m[i >> 5] |= uint32_t(1) << (i & 31);
+	m[fbits >> 5] |= uint32_t(1) << (fbits & 31);
+	return m;
+}
+
+// Payne-Hanek reduction of x >= 0 modulo pi/2: returns r in [-pi/4, pi/4] and the quadrant such that
+// x = (4j + quadrant) pi/2 + r. The bits of 2/pi whose products with x are multiples of 4 are skipped, and
+// the product keeps 3 fbits + 64 bits below the radix point to absorb the cancellation of arguments near a multiple of pi/2.
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_trig_reduce(const posit<wbits, es>& x, unsigned& quadrant) {
+	using Posit = posit<wbits, es>;
+	constexpr int fbits = int(Posit::fbits);
+	constexpr int guard = 3 * fbits + 64;
+	constexpr int nrWords = int(sizeof(two_over_pi_bits) / sizeof(two_over_pi_bits[0]));
+	quadrant = 0;
+	if (x < Posit(0.75)) return x;
+
+	int scale;
+	elementary_limbs m = elementary_significand(x, scale);
+	int e0 = scale - fbits;                     // x = M 2^e0
+	// word i of 2/pi contributes M w_i 2^(e0 - 32(i + 1))
+	int first = (e0 >= 2) ? (e0 - 2) / 32 : 0;
+	int last = (e0 + guard + 31) / 32 - 1;
+	if (last >= nrWords) last = nrWords - 1;
+	elementary_limbs t(size_t(last - first + 1));
+	for (int i = first; i <= last; ++i) t[size_t(last - i)] = two_over_pi_bits[i];
+	elementary_limbs z = elementary_multiply(m, t);
+	int L = 32 * (last + 1) - e0;               // bits of z below the radix point
+
+	quadrant = unsigned(elementary_bit(z, L)) | (unsigned(elementary_bit(z, L + 1)) << 1);
+	bool negative = elementary_bit(z, L - 1);
+	z.resize(size_t((L + 31) / 32), 0);
+	if (L & 31) z.back() &= (uint32_t(1) << (L & 31)) - 1;
+	if (negative) {
+		// the fraction is at least 1/2: take 1 - fraction and round the quadrant up
+		uint64_t carry = 1;
+		for (auto& w : z) {
+			uint64_t s = uint64_t(uint32_t(~w)) + carry;
+			w = uint32_t(s);
+			carry = s >> 32;
+		}
+		if (L & 31) z.back() &= (uint32_t(1) << (L & 31)) - 1;
+		quadrant = (quadrant + 1) & 0x3;
+	}
+	int msb = elementary_msb(z);
+	if (msb < 0) return Posit(0);
+
+	// r = fraction * pi/2 with the leading fbits + 64 bits of pi
+	constexpr int K = fbits + 64;
+	elementary_limbs p(size_t((K + 31) / 32), 0);
+	for (int b = 0; b < K; ++b) {
+		int i = K - 1 - b;  // bit index into the table, leading bit first
+		if ((pi_bits[i >> 5] >> (31 - (i & 31))) & 0x1) p[size_t(b) >> 5] |= uint32_t(1) << (b & 31);
+	}
+	elementary_limbs product = elementary_multiply(z, p);
+	int scale_r = elementary_msb(product) - L + (pi_scale - 1) - (K - 1);
+	Posit r;
+	convert(elementary_to_value<wbits>(product, negative, scale_r), r);
+	return r;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+// kernels: each takes and returns working posits, and returns the result as y 2^k when it can exceed the working range
+
+// exp(x) = 2^k exp(r) with r = x - k ln(2) in [-ln(2)/2, ln(2)/2]
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_exp_kernel(const posit<wbits, es>& x, int& k) {
+	using Posit = posit<wbits, es>;
+	const auto& c = elementary_constants<wbits, es>::instance();
+	k = int(std::nearbyint((long double)x * 1.44269504088896340736L));
+	Posit pk(-k);
+	quire<wbits, es, 30> q(x);
+	q.fma(pk, c.ln2.hi);
+	q.fma(pk, c.ln2.lo);
+	return elementary_horner(c.exp_series, elementary_round(q));
+}
+
+// 2^x = 2^k exp(r) with r = (x - k) ln(2)
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_exp2_kernel(const posit<wbits, es>& x, int& k) {
+	using Posit = posit<wbits, es>;
+	const auto& c = elementary_constants<wbits, es>::instance();
+	k = int(std::nearbyint((long double)x));
+	quire<wbits, es, 30> q(x);
+	q -= Posit(k);
+	Posit f = elementary_round(q);
+	q.clear();
+	q.fma(f, c.ln2.hi);
+	q.fma(f, c.ln2.lo);
+	return elementary_horner(c.exp_series, elementary_round(q));
+}
+
+// 10^x = 2^k exp(r) with r = x ln(10) - k ln(2)
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_exp10_kernel(const posit<wbits, es>& x, int& k) {
+	using Posit = posit<wbits, es>;
+	const auto& c = elementary_constants<wbits, es>::instance();
+	k = int(std::nearbyint((long double)x * 3.32192809488736234787L));
+	Posit pk(-k);
+	quire<wbits, es, 30> q;
+	q.fma(x, c.ln10.hi);
+	q.fma(x, c.ln10.lo);
+	q.fma(pk, c.ln2.hi);
+	q.fma(pk, c.ln2.lo);
+	return elementary_horner(c.exp_series, elementary_round(q));
+}
+
+// exp(x) - 1: the series of exp without its constant term for |x| <= ln(2)/2, otherwise 2^k exp(r) - 1 in the quire
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_expm1_kernel(const posit<wbits, es>& x, int& k) {
+	using Posit = posit<wbits, es>;
+	const auto& c = elementary_constants<wbits, es>::instance();
+	Posit y = elementary_exp_kernel(x, k);
+	quire<wbits, es, 30> q;
+	if (k == 0) {
+		// exp(x) - 1 = x (1 + x/2! + x^2/3! + ...)
+		q.fma(x, elementary_horner(c.expm1_series, x));
+	}
+	else {
+		q += elementary_ldexp(y, k);
+		q -= Posit(1);
+		k = 0;
+	}
+	return elementary_round(q);
+}
+
+// x = 2^e m with m in [sqrt(1/2), sqrt(2)) and log(m) = 2 s P(s^2) with s = (m - 1)/(m + 1) and P the series of atanh(s)/s
+template<size_t wbits, size_t es>
+void elementary_log_reduce(const posit<wbits, es>& x, int& e, posit<wbits, es>& s, posit<wbits, es>& P) {
+	using Posit = posit<wbits, es>;
+	const auto& c = elementary_constants<wbits, es>::instance();
+	auto v = x.to_value();
+	e = v.scale();
+	v.setExponent(0);
+	Posit m;
+	convert(v, m);
+	if (m > Posit(1.4142135623730950488)) {
+		++e;
+		convert(elementary_ldexp(m, -1), m);
+	}
+	quire<wbits, es, 30> q(m);
+	q -= Posit(1);
+	Posit numerator = elementary_round(q);
+	q += Posit(2);
+	Posit denominator = elementary_round(q);
+	s = elementary_divide(numerator, denominator);
+	q.clear();
+	q.fma(s, s);
+	P = elementary_horner(c.atanh_series, elementary_round(q));
+}
+
+// log(1 + x) = 2 s P(s^2) with s = x/(2 + x) when 1 + x is in [sqrt(1/2), sqrt(2)), otherwise log of the rounded 1 + x
+template<size_t wbits, size_t es>
+void elementary_log1p_reduce(const posit<wbits, es>& x, int& e, posit<wbits, es>& s, posit<wbits, es>& P) {
+	using Posit = posit<wbits, es>;
+	const auto& c = elementary_constants<wbits, es>::instance();
+	quire<wbits, es, 30> q(x);
+	if (x > Posit(-0.29289321881345247560) && x < Posit(0.41421356237309504880)) {
+		q += Posit(2);
+		s = elementary_divide(x, elementary_round(q));
+		q.clear();
+		q.fma(s, s);
+		P = elementary_horner(c.atanh_series, elementary_round(q));
+		e = 0;
+	}
+	else {
+		q += Posit(1);
+		elementary_log_reduce(elementary_round(q), e, s, P);
+	}
+}
+
+// accumulate e ln(2) + 2 s P(s^2), negated when subtract is set
+template<size_t wbits, size_t es>
+void elementary_log_accumulate(quire<wbits, es, 30>& q, int e, const posit<wbits, es>& s, const posit<wbits, es>& P, bool subtract = false) {
+	using Posit = posit<wbits, es>;
+	const auto& c = elementary_constants<wbits, es>::instance();
+	Posit ss = subtract ? -s : s;
+	Posit pe(subtract ? -e : e);
+	q.fma(ss, P);
+	q.fma(ss, P);
+	q.fma(pe, c.ln2.hi);
+	q.fma(pe, c.ln2.lo);
+}
+
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_log_kernel(const posit<wbits, es>& x, int&) {
+	int e;
+	posit<wbits, es> s, P;
+	elementary_log_reduce(x, e, s, P);
+	quire<wbits, es, 30> q;
+	elementary_log_accumulate(q, e, s, P);
+	return elementary_round(q);
+}
+
+// log2(x) = e + log(m) log2(e)
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_log2_kernel(const posit<wbits, es>& x, int&) {
+	using Posit = posit<wbits, es>;
+	const auto& c = elementary_constants<wbits, es>::instance();
+	int e;
+	Posit s, P;
+	elementary_log_reduce(x, e, s, P);
+	quire<wbits, es, 30> q;
+	elementary_log_accumulate(q, 0, s, P);
+	Posit lm = elementary_round(q);
+	q = Posit(e);
+	q.fma(lm, c.log2e.hi);
+	q.fma(lm, c.log2e.lo);
+	return elementary_round(q);
+}
+
+// log10(x) = e log10(2) + log(m) log10(e)
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_log10_kernel(const posit<wbits, es>& x, int&) {
+	using Posit = posit<wbits, es>;
+	const auto& c = elementary_constants<wbits, es>::instance();
+	int e;
+	Posit s, P;
+	elementary_log_reduce(x, e, s, P);
+	quire<wbits, es, 30> q;
+	elementary_log_accumulate(q, 0, s, P);
+	Posit lm = elementary_round(q);
+	Posit pe(e);
+	q.clear();
+	q.fma(pe, c.log10_2.hi);
+	q.fma(pe, c.log10_2.lo);
+	q.fma(lm, c.log10e.hi);
+	q.fma(lm, c.log10e.lo);
+	return elementary_round(q);
+}
+
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_log1p_kernel(const posit<wbits, es>& x, int&) {
+	int e;
+	posit<wbits, es> s, P;
+	elementary_log1p_reduce(x, e, s, P);
+	quire<wbits, es, 30> q;
+	elementary_log_accumulate(q, e, s, P);
+	return elementary_round(q);
+}
+
+enum class elementary_trig { SIN, COS, TAN, COT, SEC, CSC };
+
+// the trigonometric functions from sin(r) = r S(r^2) and cos(r) = C(r^2) of the reduced argument
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_trig_kernel(const posit<wbits, es>& x, elementary_trig function) {
+	using Posit = posit<wbits, es>;
+	const auto& c = elementary_constants<wbits, es>::instance();
+	bool negative = x.isneg();
+	unsigned quadrant;
+	Posit r = elementary_trig_reduce(negative ? -x : x, quadrant);
+	quire<wbits, es, 30> q;
+	q.fma(r, r);
+	Posit z = elementary_round(q);
+	Posit sine, cosine;
+	bool needSine = function != elementary_trig::COS && function != elementary_trig::SEC ? true : (quadrant & 1);
+	bool needCosine = function != elementary_trig::SIN && function != elementary_trig::CSC ? true : (quadrant & 1);
+	if (needSine) {
+		q.clear();
+		q.fma(r, elementary_horner(c.sin_series, z));
+		sine = elementary_round(q);
+	}
+	if (needCosine) cosine = elementary_horner(c.cos_series, z);
+	// sin and cos of x from the quadrant
+	Posit s, co;
+	switch (quadrant) {
+	case 0: s = sine;     co = cosine;  break;
+	case 1: s = cosine;   co = -sine;   break;
+	case 2: s = -sine;    co = -cosine; break;
+	case 3: s = -cosine;  co = sine;    break;
+	}
+	if (negative) s = -s;
+	switch (function) {
+	case elementary_trig::SIN: return s;
+	case elementary_trig::COS: return co;
+	case elementary_trig::TAN: return elementary_divide(s, co);
+	case elementary_trig::COT: return elementary_divide(co, s);
+	case elementary_trig::SEC: return elementary_divide(Posit(1), co);
+	case elementary_trig::CSC: return elementary_divide(Posit(1), s);
+	}
+	return s;
+}
+
+// atan(x) with |x| > 1 reflected by atan(x) = pi/2 - atan(1/x) and |x| > 2 - sqrt(3) shifted by
+// atan(x) = pi/6 + atan((sqrt(3) x - 1)/(x + sqrt(3))), which leaves an argument in [-(2 - sqrt(3)), 2 - sqrt(3)]
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_atan_kernel(const posit<wbits, es>& x, int&) {
+	using Posit = posit<wbits, es>;
+	const auto& c = elementary_constants<wbits, es>::instance();
+	bool negative = x.isneg();
+	Posit a = negative ? -x : x;
+	Posit one(1);
+	bool reflect = a > one;
+	if (reflect) a = elementary_divide(one, a);
+	bool shift = a > Posit(0.26794919243112270647);
+	quire<wbits, es, 30> q;
+	if (shift) {
+		q.fma(a, c.sqrt3.hi);
+		q.fma(a, c.sqrt3.lo);
+		q -= one;
+		Posit numerator = elementary_round(q);
+		q = a;
+		q += c.sqrt3.hi;
+		q += c.sqrt3.lo;
+		a = elementary_divide(numerator, elementary_round(q));
+	}
+	q.clear();
+	q.fma(a, a);
+	Posit P = elementary_horner(c.atan_series, elementary_round(q));
+	q.clear();
+	q.fma(reflect ? -a : a, P);
+	if (shift) {
+		if (reflect) {
+			q -= c.pi_6.hi;
+			q -= c.pi_6.lo;
+		}
+		else {
+			q += c.pi_6.hi;
+			q += c.pi_6.lo;
+		}
+	}
+	if (reflect) {
+		q += c.pi_2.hi;
+		q += c.pi_2.lo;
+	}
+	Posit y = elementary_round(q);
+	return negative ? -y : y;
+}
+
+// atan2(y, x) for x and y not both zero
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_atan2_kernel(const posit<wbits, es>& y, const posit<wbits, es>& x, int& k) {
+	using Posit = posit<wbits, es>;
+	const auto& c = elementary_constants<wbits, es>::instance();
+	quire<wbits, es, 30> q;
+	if (x.iszero()) {
+		q += c.pi_2.hi;
+		q += c.pi_2.lo;
+		Posit a = elementary_round(q);
+		return y.isneg() ? -a : a;
+	}
+	Posit a = elementary_atan_kernel(elementary_divide(Posit(abs(y)), Posit(abs(x))), k);
+	if (x.isneg()) {
+		q += c.pi.hi;
+		q += c.pi.lo;
+		q -= a;
+		a = elementary_round(q);
+	}
+	return y.isneg() ? -a : a;
+}
+
+// asin(x) = atan(x / sqrt(1 - x^2)) for |x| < 1
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_asin_kernel(const posit<wbits, es>& x, int& k) {
+	using Posit = posit<wbits, es>;
+	quire<wbits, es, 30> q(Posit(1));
+	q.fma(-x, x);
+	Posit s = elementary_sqrt(elementary_round(q));
+	return elementary_atan_kernel(elementary_divide(x, s), k);
+}
+
+// acos(x) = atan2(sqrt(1 - x^2), x) for |x| < 1
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_acos_kernel(const posit<wbits, es>& x, int& k) {
+	using Posit = posit<wbits, es>;
+	quire<wbits, es, 30> q(Posit(1));
+	q.fma(-x, x);
+	Posit s = elementary_sqrt(elementary_round(q));
+	return elementary_atan2_kernel(s, x, k);
+}
+
+// sinh(x) = x S(x^2) for |x| <= 1, otherwise (exp(|x|) - exp(-|x|))/2
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_sinh_kernel(const posit<wbits, es>& x, int&) {
+	using Posit = posit<wbits, es>;
+	const auto& c = elementary_constants<wbits, es>::instance();
+	bool negative = x.isneg();
+	Posit a = negative ? -x : x;
+	quire<wbits, es, 30> q;
+	if (a <= Posit(1)) {
+		q.fma(a, a);
+		Posit z = elementary_round(q);
+		q.clear();
+		q.fma(a, elementary_horner(c.sinh_series, z));
+	}
+	else {
+		int k;
+		Posit e = elementary_exp_kernel(a, k);
+		Posit inverse = elementary_divide(Posit(1), e);
+		q += elementary_ldexp(e, k - 1);
+		q -= elementary_ldexp(inverse, -k - 1);
+	}
+	Posit y = elementary_round(q);
+	return negative ? -y : y;
+}
+
+// cosh(x) = (exp(|x|) + exp(-|x|))/2
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_cosh_kernel(const posit<wbits, es>& x, int&) {
+	using Posit = posit<wbits, es>;
+	int k;
+	Posit e = elementary_exp_kernel(x.isneg() ? -x : x, k);
+	Posit inverse = elementary_divide(Posit(1), e);
+	quire<wbits, es, 30> q;
+	q += elementary_ldexp(e, k - 1);
+	q += elementary_ldexp(inverse, -k - 1);
+	return elementary_round(q);
+}
+
+// tanh(x) = sinh(x)/cosh(x) for |x| < 1/2, otherwise 1 - 2/(exp(2|x|) + 1)
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_tanh_kernel(const posit<wbits, es>& x, int& k) {
+	using Posit = posit<wbits, es>;
+	bool negative = x.isneg();
+	Posit a = negative ? -x : x;
+	Posit y;
+	if (a < Posit(0.5)) {
+		y = elementary_divide(elementary_sinh_kernel(a, k), elementary_cosh_kernel(a, k));
+	}
+	else {
+		int k2;
+		Posit e = elementary_exp_kernel(Posit(a + a), k2);
+		quire<wbits, es, 30> q;
+		q += elementary_ldexp(e, k2);
+		q += Posit(1);
+		Posit t = elementary_divide(Posit(2), elementary_round(q));
+		q = Posit(1);
+		q -= t;
+		y = elementary_round(q);
+	}
+	return negative ? -y : y;
+}
+
+// scale beyond which x^2 exceeds the precision of the working posit, and beyond which it would exceed its dynamic range
+template<size_t wbits, size_t es>
+constexpr int elementary_large_argument() {
+	constexpr int fbits = int(posit<wbits, es>::fbits);
+	constexpr int maxscale = (int(wbits) - 2) << es;
+	return std::min(fbits / 2 + 2, maxscale / 2 - 1);
+}
+
+// asinh(x) = log1p(|x| + x^2/(1 + sqrt(1 + x^2))), and log(2|x|) when x^2 is beyond the working posit
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_asinh_kernel(const posit<wbits, es>& x, int&) {
+	using Posit = posit<wbits, es>;
+	bool negative = x.isneg();
+	Posit a = negative ? -x : x;
+	int e;
+	Posit s, P;
+	quire<wbits, es, 30> q;
+	if (elementary_scale(a) > elementary_large_argument<wbits, es>()) {
+		elementary_log_reduce(a, e, s, P);
+		++e;
+	}
+	else {
+		q.fma(a, a);
+		Posit a2 = elementary_round(q);
+		q += Posit(1);
+		Posit root = elementary_sqrt(elementary_round(q));
+		q = root;
+		q += Posit(1);
+		Posit u = elementary_divide(a2, elementary_round(q));
+		q = a;
+		q += u;
+		elementary_log1p_reduce(elementary_round(q), e, s, P);
+		q.clear();
+	}
+	elementary_log_accumulate(q, e, s, P);
+	Posit y = elementary_round(q);
+	return negative ? -y : y;
+}
+
+// acosh(x) = log1p((x - 1) + sqrt((x - 1)(x + 1))) for x < 2, log(x + sqrt(x^2 - 1)) beyond, and log(2x) when x^2
+// is beyond the working precision
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_acosh_kernel(const posit<wbits, es>& x, int&) {
+	using Posit = posit<wbits, es>;
+	int e;
+	Posit s, P;
+	quire<wbits, es, 30> q;
+	if (elementary_scale(x) > elementary_large_argument<wbits, es>()) {
+		elementary_log_reduce(x, e, s, P);
+		++e;
+	}
+	else if (x < Posit(2)) {
+		q = x;
+		q -= Posit(1);
+		Posit xm1 = elementary_round(q);
+		q += Posit(2);
+		Posit xp1 = elementary_round(q);
+		q.clear();
+		q.fma(xm1, xp1);
+		Posit root = elementary_sqrt(elementary_round(q));
+		q = xm1;
+		q += root;
+		elementary_log1p_reduce(elementary_round(q), e, s, P);
+	}
+	else {
+		q.fma(x, x);
+		q -= Posit(1);
+		Posit root = elementary_sqrt(elementary_round(q));
+		q = x;
+		q += root;
+		elementary_log_reduce(elementary_round(q), e, s, P);
+	}
+	q.clear();
+	elementary_log_accumulate(q, e, s, P);
+	return elementary_round(q);
+}
+
+// atanh(x) = log1p(2x/(1 - x))/2 for |x| < 1/2, otherwise (log(1 + x) - log(1 - x))/2 with 1 + x and 1 - x exact
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_atanh_kernel(const posit<wbits, es>& x, int& k) {
+	using Posit = posit<wbits, es>;
+	bool negative = x.isneg();
+	Posit a = negative ? -x : x;
+	int e;
+	Posit s, P;
+	quire<wbits, es, 30> q(Posit(1));
+	q -= a;
+	Posit am1 = elementary_round(q);
+	if (a < Posit(0.5)) {
+		Posit t;
+		convert(elementary_ldexp(elementary_divide(a, am1), 1), t);
+		elementary_log1p_reduce(t, e, s, P);
+		q.clear();
+		elementary_log_accumulate(q, e, s, P);
+	}
+	else {
+		q += a;
+		q += a;
+		Posit ap1 = elementary_round(q);
+		q.clear();
+		elementary_log_reduce(ap1, e, s, P);
+		elementary_log_accumulate(q, e, s, P);
+		elementary_log_reduce(am1, e, s, P);
+		elementary_log_accumulate(q, e, s, P, true);
+	}
+	k = -1;
+	Posit y = elementary_round(q);
+	return negative ? -y : y;
+}
+
+// x^y = 2^k exp(r) for x > 0, with y log2(x) = k + r/ln(2)
+template<size_t wbits, size_t es>
+posit<wbits, es> elementary_pow_kernel(const posit<wbits, es>& x, const posit<wbits, es>& y, int& k) {
+	using Posit = posit<wbits, es>;
+	const auto& c = elementary_constants<wbits, es>::instance();
+	Posit log2x = elementary_log2_kernel(x, k);
+	quire<wbits, es, 30> q;
+	q.fma(y, log2x);
+	k = int(std::nearbyint((long double)elementary_round(q)));
+	q -= Posit(k);
+	Posit f = elementary_round(q);
+	q.clear();
+	q.fma(f, c.ln2.hi);
+	q.fma(f, c.ln2.lo);
+	return elementary_horner(c.exp_series, elementary_round(q));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+// rounding of the working result to the target posit
+
+// round y 2^k to the posit
+template<size_t nbits, size_t es, size_t wbits>
+inline posit<nbits, es>& elementary_convert(const posit<wbits, es>& y, int k, posit<nbits, es>& result) {
+	convert(elementary_ldexp(y, k), result);
+	return result;
+}
+
+// Ziv's rounding test: y 2^k rounds correctly when the working posits 16 steps below and above it round to the same posit.
+// The kernels only produce zero for an exact zero.
+template<size_t nbits, size_t es, size_t wbits>
+bool elementary_round_test(const posit<wbits, es>& y, int k, posit<nbits, es>& result) {
+	if (y.iszero()) {
+		result.setzero();
+		return true;
+	}
+	posit<wbits, es> lo(y), hi(y);
+	for (int i = 0; i < 16; ++i) {
+		--lo;
+		++hi;
+	}
+	posit<nbits, es> a, b;
+	elementary_convert(lo, k, a);
+	elementary_convert(hi, k, b);
+	if (a != b) return false;
+	result = a;
+	return true;
+}
+
+// evaluate a kernel at the working precision, and again at the extended precision when the rounding test fails:
+// the extra bits compensate kernels whose error grows with the magnitude of the result
+template<size_t nbits, size_t es, size_t extra = 0, typename Kernel, typename... Args>
+posit<nbits, es> elementary_evaluate(Kernel kernel, const Args&... args) {
+	using Working = posit<nbits + 20 + extra, es>;
+	using Extended = posit<nbits + 64 + extra, es>;
+	posit<nbits, es> result;
+	int k = 0;
+	Working y = kernel(Working(args)..., k);
+	if (elementary_round_test(y, k, result)) return result;
+	k = 0;
+	Extended z = kernel(Extended(args)..., k);
+	return elementary_convert(z, k, result);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+// the elementary functions in the posit domain, for arguments that are not NaR
+
+// saturate the result 2^t of an exponential to maxpos or minpos when t is outside the dynamic range of the posit
+template<size_t nbits, size_t es>
+inline bool elementary_saturates(long double t, bool negative, posit<nbits, es>& p) {
+	constexpr long double maxscale = (long double)((int(nbits) - 2) << es);
+	if (t > maxscale + 1) maxpos<nbits, es>(p);
+	else if (t < -(maxscale + 1)) minpos<nbits, es>(p);
+	else return false;
+	if (negative) p = -p;
+	return true;
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_exp(const posit<nbits, es>& x) {
+	posit<nbits, es> p;
+	if (x.iszero()) return p = 1;
+	if (elementary_saturates((long double)x * 1.44269504088896340736L, false, p)) return p;
+	return elementary_evaluate<nbits, es>([](const auto& w, int& k) { return elementary_exp_kernel(w, k); }, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_exp2(const posit<nbits, es>& x) {
+	posit<nbits, es> p;
+	if (x.iszero()) return p = 1;
+	if (elementary_saturates((long double)x, false, p)) return p;
+	return elementary_evaluate<nbits, es>([](const auto& w, int& k) { return elementary_exp2_kernel(w, k); }, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_exp10(const posit<nbits, es>& x) {
+	posit<nbits, es> p;
+	if (x.iszero()) return p = 1;
+	if (elementary_saturates((long double)x * 3.32192809488736234787L, false, p)) return p;
+	// 10^n = 5^n 2^n is exact for small positive integers and can fall on a rounding tie of the posit
+	long double n = (long double)x;
+	if (n > 0 && n <= 27 && n == std::floor(n)) {
+		uint64_t power = 1;
+		for (int i = 0; i < int(n); ++i) power *= 5;
+		value<64> v(power);
+		v.setExponent(v.scale() + int(n));
+		return convert(v, p);
+	}
+	return elementary_evaluate<nbits, es>([](const auto& w, int& k) { return elementary_exp10_kernel(w, k); }, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_expm1(const posit<nbits, es>& x) {
+	posit<nbits, es> p;
+	if (x.iszero()) return x;
+	long double t = (long double)x * 1.44269504088896340736L;
+	if (t < -(long double)(nbits + 8)) return p = -1;   // exp(x) is below half the spacing of the posits at -1
+	if (t > 0 && elementary_saturates(t, false, p)) return p;
+	return elementary_evaluate<nbits, es>([](const auto& w, int& k) { return elementary_expm1_kernel(w, k); }, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_log(const posit<nbits, es>& x) {
+	posit<nbits, es> p;
+	if (x.isneg() || x.iszero()) { p.setnar(); return p; }
+	return elementary_evaluate<nbits, es>([](const auto& w, int& k) { return elementary_log_kernel(w, k); }, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_log2(const posit<nbits, es>& x) {
+	posit<nbits, es> p;
+	if (x.isneg() || x.iszero()) { p.setnar(); return p; }
+	return elementary_evaluate<nbits, es>([](const auto& w, int& k) { return elementary_log2_kernel(w, k); }, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_log10(const posit<nbits, es>& x) {
+	posit<nbits, es> p;
+	if (x.isneg() || x.iszero()) { p.setnar(); return p; }
+	return elementary_evaluate<nbits, es>([](const auto& w, int& k) { return elementary_log10_kernel(w, k); }, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_log1p(const posit<nbits, es>& x) {
+	posit<nbits, es> p;
+	if (x <= posit<nbits, es>(-1)) { p.setnar(); return p; }
+	if (x.iszero()) return x;
+	return elementary_evaluate<nbits, es>([](const auto& w, int& k) { return elementary_log1p_kernel(w, k); }, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_trigonometric(const posit<nbits, es>& x, elementary_trig function) {
+	posit<nbits, es> p;
+	if (x.iszero()) {
+		switch (function) {
+		case elementary_trig::COS:
+		case elementary_trig::SEC: return p = 1;
+		case elementary_trig::COT:
+		case elementary_trig::CSC: p.setnar(); return p;
+		default: return x;
+		}
+	}
+	return elementary_evaluate<nbits, es>([function](const auto& w, int&) { return elementary_trig_kernel(w, function); }, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_atan(const posit<nbits, es>& x) {
+	if (x.iszero()) return x;
+	return elementary_evaluate<nbits, es>([](const auto& w, int& k) { return elementary_atan_kernel(w, k); }, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_atan2(const posit<nbits, es>& y, const posit<nbits, es>& x) {
+	posit<nbits, es> p;
+	if (y.iszero()) {
+		if (!x.isneg()) return p = 0;
+	}
+	return elementary_evaluate<nbits, es>([](const auto& wy, const auto& wx, int& k) { return elementary_atan2_kernel(wy, wx, k); }, y, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_asin(const posit<nbits, es>& x) {
+	posit<nbits, es> p, one(1);
+	posit<nbits, es> a = abs(x);
+	if (a > one) { p.setnar(); return p; }
+	if (x.iszero()) return x;
+	if (a == one) return elementary_atan2(x, posit<nbits, es>(0));
+	return elementary_evaluate<nbits, es>([](const auto& w, int& k) { return elementary_asin_kernel(w, k); }, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_acos(const posit<nbits, es>& x) {
+	posit<nbits, es> p, one(1);
+	if (abs(x) > one) { p.setnar(); return p; }
+	if (x == one) return p = 0;
+	return elementary_evaluate<nbits, es>([](const auto& w, int& k) { return elementary_acos_kernel(w, k); }, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_sinh(const posit<nbits, es>& x) {
+	posit<nbits, es> p;
+	if (x.iszero()) return x;
+	if (elementary_saturates((long double)abs(x) * 1.44269504088896340736L, x.isneg(), p)) return p;
+	return elementary_evaluate<nbits, es>([](const auto& w, int& k) { return elementary_sinh_kernel(w, k); }, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_cosh(const posit<nbits, es>& x) {
+	posit<nbits, es> p;
+	if (x.iszero()) return p = 1;
+	if (elementary_saturates((long double)abs(x) * 1.44269504088896340736L, false, p)) return p;
+	return elementary_evaluate<nbits, es>([](const auto& w, int& k) { return elementary_cosh_kernel(w, k); }, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_tanh(const posit<nbits, es>& x) {
+	posit<nbits, es> p;
+	if (x.iszero()) return x;
+	// 1 - tanh(|x|) < 2 exp(-2|x|) is below half the spacing of the posits at 1
+	if ((long double)abs(x) * 2.88539008177792681472L > (long double)(nbits + 8)) return p = (x.isneg() ? -1 : 1);
+	return elementary_evaluate<nbits, es>([](const auto& w, int& k) { return elementary_tanh_kernel(w, k); }, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_asinh(const posit<nbits, es>& x) {
+	if (x.iszero()) return x;
+	return elementary_evaluate<nbits, es>([](const auto& w, int& k) { return elementary_asinh_kernel(w, k); }, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_acosh(const posit<nbits, es>& x) {
+	posit<nbits, es> p, one(1);
+	if (x < one) { p.setnar(); return p; }
+	if (x == one) return p = 0;
+	return elementary_evaluate<nbits, es>([](const auto& w, int& k) { return elementary_acosh_kernel(w, k); }, x);
+}
+
+template<size_t nbits, size_t es>
+posit<nbits, es> elementary_atanh(const posit<nbits, es>& x) {
+	posit<nbits, es> p;
+	if (abs(x) >= posit<nbits, es>(1)) { p.setnar(); return p; }
+	if (x.iszero()) return x;
+	return elementary_evaluate<nbits, es>([](const auto& w, int& k) { return elementary_atanh_kernel(w, k); }, x);
+}
+
+// the integer y of a posit, with integral set when the posit is an integer: integers beyond 2^62 are clamped,
+// and keep their parity, which is even
+template<size_t nbits, size_t es>
+long long elementary_integer(const posit<nbits, es>& y, bool& integral) {
+	integral = true;
+	if (y.iszero()) return 0;
+	auto v = y.to_value();
+	int scale = v.scale();
+	constexpr int fbits = int(posit<nbits, es>::fbits);
+	if (scale < 0) {
+		integral = false;
+		return 0;
+	}
+	auto fraction = v.fraction();
+	for (int i = 0; i < fbits - scale; ++i) {
+		if (fraction[size_t(i)]) {
+			integral = false;
+			return 0;
+		}
+	}
+	if (scale > 62) return v.sign() ? -(1ll << 62) : (1ll << 62);
+	long long n = 1;
+	for (int i = 1; i <= scale; ++i) n = (n << 1) | ((fbits - i >= 0 && fraction[size_t(fbits - i)]) ? 1 : 0);
+	return v.sign() ? -n : n;
+}
+
+// the odd integer m of a nonzero posit with |x| = m 2^exponent
+template<size_t nbits, size_t es>
+elementary_limbs elementary_odd_part(const posit<nbits, es>& x, int& exponent) {
+	int scale;
+	elementary_limbs significand = elementary_significand(abs(x), scale);
+	int msb = elementary_msb(significand);
+	int trailing = 0;
+	while (!elementary_bit(significand, trailing)) ++trailing;
+	elementary_limbs m(size_t((msb - trailing) / 32 + 1), 0);
+	for (int i = trailing; i <= msb; ++i) {
+		if (elementary_bit(significand, i)) m[size_t(i - trailing) >> 5] |= uint32_t(1) << ((i - trailing) & 31);
+	}
+	exponent = scale - (msb - trailing);
+	return m;
+}
+
+// m^n with integer arithmetic
+inline elementary_limbs elementary_integer_power(const elementary_limbs& m, long long n) {
+	elementary_limbs power{ 1 };
+	for (long long i = 0; i < n; ++i) {
+		power = elementary_multiply(power, m);
+		while (power.size() > 1 && power.back() == 0) power.pop_back();
+	}
+	return power;
+}
+
+// x^n for a positive integer n with the odd part of x raised to the power with integer arithmetic and rounded once,
+// which resolves the powers that fall on a rounding tie of the posit: returns false when the power exceeds 4096 bits
+template<size_t nbits, size_t es>
+bool elementary_exact_power(const posit<nbits, es>& x, long long n, posit<nbits, es>& result) {
+	int exponent;
+	elementary_limbs m = elementary_odd_part(x, exponent);
+	if ((long long)(elementary_msb(m) + 1) * n > 4096) return false;
+	elementary_limbs power = elementary_integer_power(m, n);
+	// x^n = m^n 2^(n exponent)
+	long long s = (long long)elementary_msb(power) + n * (long long)exponent;
+	constexpr long long maxscale = (long long)((int(nbits) - 2) << es);
+	if (s > maxscale + 1) s = maxscale + 1;
+	if (s < -(maxscale + 1)) s = -(maxscale + 1);
+	convert(elementary_to_value<nbits + 4>(power, x.isneg() && (n & 1), int(s)), result);
+	return true;
+}
+
+// the root c of x = c^(2^j) for a positive x when c is a posit<nbits, es>: the candidate is rounded from j square roots
+// at the working precision and verified with integer arithmetic
+template<size_t wbits, size_t nbits, size_t es>
+bool elementary_exact_root(const posit<nbits, es>& x, int j, posit<nbits, es>& root) {
+	posit<wbits, es> c(x);
+	for (int i = 0; i < j; ++i) c = elementary_sqrt(c);
+	convert(c.to_value(), root);
+	int xexponent, cexponent;
+	elementary_limbs mx = elementary_odd_part(x, xexponent);
+	elementary_limbs mc = elementary_odd_part(root, cexponent);
+	if ((long long)cexponent * (1ll << j) != (long long)xexponent) return false;
+	if ((long long)(elementary_msb(mc) + 1) << j > (long long)elementary_msb(mx) + (1ll << j)) return false;
+	return elementary_integer_power(mc, 1ll << j) == mx;
+}
+
+// x^y for x and y that are not NaR, with the conventions of std::pow: x^0 = 1, 1^y = 1, a negative x requires
+// an integer y, and 0^y is 0 for y > 0. The working precision carries the bits of the magnitude of y log2(x).
+template<size_t nbits, size_t es, typename Exponent>
+posit<nbits, es> elementary_pow(const posit<nbits, es>& x, const Exponent& y, bool integral, long long n) {
+	constexpr size_t extra = elementary_bit_width((nbits - 2) << es);
+	posit<nbits, es> p;
+	long double ly = (long double)y;
+	if (ly == 0) return p = 1;
+	if (x.iszero()) {
+		if (ly < 0) p.setnar();
+		return p;
+	}
+	if (x.isneg() && !integral) { p.setnar(); return p; }
+	bool negative = x.isneg() && (n & 1);
+	posit<nbits, es> a = abs(x);
+	if (a == posit<nbits, es>(1)) return p = (negative ? -1 : 1);
+	long double t = ly * std::log2((long double)a);
+	if (elementary_saturates(t, negative, p)) return p;
+	if (integral && n > 0 && elementary_exact_power(x, n, p)) return p;
+	using Working = posit<nbits + 20 + extra, es>;
+	if (!integral && ly > 0) {
+		// x^(n/2^j) for an odd n is exact when x is the 2^j-th power of a posit, and can fall on a rounding tie
+		Working wy(y);
+		for (int j = 1; j <= 6; ++j) {
+			Working scaled;
+			convert(elementary_ldexp(wy, j), scaled);
+			bool dyadic;
+			long long odd = elementary_integer(scaled, dyadic);
+			if (!dyadic) continue;
+			posit<nbits, es> root;
+			if (elementary_exact_root<nbits + 20 + extra>(a, j, root) && elementary_exact_power(root, odd, p)) return p;
+			break;
+		}
+	}
+	p = elementary_evaluate<nbits, es, extra>([](const auto& wx, const auto& wy, int& k) { return elementary_pow_kernel(wx, wy, k); }, a, y);
+	return negative ? -p : p;
+}
+
+}}} // namespace sw::unum::internal
+
+namespace sw { namespace unum {
+
+// the array versions of the elementary functions that blas/vmath dispatches to: f(x, y, n) sets y[i] = f(x[i]) for i in [0, n)
+// with results identical to the scalar functions
+template<size_t nbits, size_t es>
+struct elementary_batch< posit<nbits, es> > {
+	using Posit = posit<nbits, es>;
+
+	static void exp(const Posit* x, Posit* y, size_t n)   { apply(x, y, n, internal::elementary_native_exp{},   [](const Posit& p) { return internal::elementary_exp(p); }); }
+	static void exp2(const Posit* x, Posit* y, size_t n)  { apply(x, y, n, internal::elementary_native_exp2{},  [](const Posit& p) { return internal::elementary_exp2(p); }); }
+	static void exp10(const Posit* x, Posit* y, size_t n) { apply(x, y, n, internal::elementary_native_exp10{}, [](const Posit& p) { return internal::elementary_exp10(p); }); }
+	static void expm1(const Posit* x, Posit* y, size_t n) { apply(x, y, n, internal::elementary_native_expm1{}, [](const Posit& p) { return internal::elementary_expm1(p); }); }
+	static void log(const Posit* x, Posit* y, size_t n)   { apply(x, y, n, internal::elementary_native_log{},   [](const Posit& p) { return internal::elementary_log(p); }); }
+	static void log2(const Posit* x, Posit* y, size_t n)  { apply(x, y, n, internal::elementary_native_log2{},  [](const Posit& p) { return internal::elementary_log2(p); }); }
+	static void log10(const Posit* x, Posit* y, size_t n) { apply(x, y, n, internal::elementary_native_log10{}, [](const Posit& p) { return internal::elementary_log10(p); }); }
+	static void log1p(const Posit* x, Posit* y, size_t n) { apply(x, y, n, internal::elementary_native_log1p{}, [](const Posit& p) { return internal::elementary_log1p(p); }); }
+	static void sin(const Posit* x, Posit* y, size_t n)   { apply(x, y, n, internal::elementary_native_sin{},   [](const Posit& p) { return internal::elementary_trigonometric(p, internal::elementary_trig::SIN); }); }
+	static void cos(const Posit* x, Posit* y, size_t n)   { apply(x, y, n, internal::elementary_native_cos{},   [](const Posit& p) { return internal::elementary_trigonometric(p, internal::elementary_trig::COS); }); }
+	static void tan(const Posit* x, Posit* y, size_t n)   { apply(x, y, n, internal::elementary_native_tan{},   [](const Posit& p) { return internal::elementary_trigonometric(p, internal::elementary_trig::TAN); }); }
+	static void atan(const Posit* x, Posit* y, size_t n)  { apply(x, y, n, internal::elementary_native_atan{},  [](const Posit& p) { return internal::elementary_atan(p); }); }
+	static void asin(const Posit* x, Posit* y, size_t n)  { apply(x, y, n, internal::elementary_native_asin{},  [](const Posit& p) { return internal::elementary_asin(p); }); }
+	static void acos(const Posit* x, Posit* y, size_t n)  { apply(x, y, n, internal::elementary_native_acos{},  [](const Posit& p) { return internal::elementary_acos(p); }); }
+	static void sinh(const Posit* x, Posit* y, size_t n)  { apply(x, y, n, internal::elementary_native_sinh{},  [](const Posit& p) { return internal::elementary_sinh(p); }); }
+	static void cosh(const Posit* x, Posit* y, size_t n)  { apply(x, y, n, internal::elementary_native_cosh{},  [](const Posit& p) { return internal::elementary_cosh(p); }); }
+	static void tanh(const Posit* x, Posit* y, size_t n)  { apply(x, y, n, internal::elementary_native_tanh{},  [](const Posit& p) { return internal::elementary_tanh(p); }); }
+
+private:
+	template<typename Native, typename Kernel>
+	static void apply(const Posit* x, Posit* y, size_t n, Native native, Kernel kernel) {
+		internal::elementary_array(x, y, n, native, [kernel](const Posit& p) { return p.isnar() ? p : kernel(p); });
+	}
+};
+
+}} // namespace sw::unum
@@ -0,0 +1,114 @@
+#pragma once
+// elementary_tables.hpp: high-precision constants for the posit-domain elementary function kernels
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+
+namespace sw { namespace unum { namespace internal {
+
+// each constant is stored as the scale of its leading bit and 768 bits of its significand, leading bit first,
+// which is enough to split the constant into a (hi, lo) pair of posits for configurations up to 384 bits
+
+// pi
+static constexpr int      pi_scale = 1;
+static constexpr uint32_t pi_bits[] = {
+	0xC90FDAA2, 0x2168C234, 0xC4C6628B, 0x80DC1CD1, 0x29024E08, 0x8A67CC74, 0x020BBEA6, 0x3B139B22,
+	0x514A0879, 0x8E3404DD, 0xEF9519B3, 0xCD3A431B, 0x302B0A6D, 0xF25F1437, 0x4FE1356D, 0x6D51C245,
+	0xE485B576, 0x625E7EC6, 0xF44C42E9, 0xA637ED6B, 0x0BFF5CB6, 0xF406B7ED, 0xEE386BFB, 0x5A899FA5,
+};
+// pi/6
+static constexpr int      pi_6_scale = -1;
+static constexpr uint32_t pi_6_bits[] = {
+	0x860A91C1, 0x6B9B2C23, 0x2DD99707, 0xAB3D688B, 0x70AC3405, 0xB19A884D, 0x56B27F19, 0x7CB7BCC1,
+	0x8B86B051, 0x0978033E, 0x9FB8BBCD, 0x337C2CBC, 0xCAC75C49, 0x4C3F62CF, 0x8A96239E, 0x48E12C2E,
+	0x985923A4, 0x41945484, 0xA2DD81F1, 0x197A9E47, 0x5D54E879, 0xF8047A9E, 0x9ED047FC, 0xE7066A6E,
+};
+// sqrt(3)
+static constexpr int      sqrt3_scale = 0;
+static constexpr uint32_t sqrt3_bits[] = {
+	0xDDB3D742, 0xC265539D, 0x92BA16B8, 0x3C5C1DC4, 0x92EC1A66, 0x29ED23CC, 0x63905324, 0x3722D371,
+	0x2485E7EC, 0xAF78AEDE, 0xD4C98557, 0x091147C3, 0xE6267926, 0xD1D0F634, 0x686699D0, 0x0D6CD1C1,
+	0xDCF09173, 0x09C61D73, 0x6F2F6F1D, 0xEA16DB98, 0x0DB5FAA9, 0xD7BD84FE, 0xB75F799D, 0x4D4FF2BB,
+};
+// ln(2)
+static constexpr int      ln2_scale = -1;
+static constexpr uint32_t ln2_bits[] = {
+	0xB17217F7, 0xD1CF79AB, 0xC9E3B398, 0x03F2F6AF, 0x40F34326, 0x7298B62D, 0x8A0D175B, 0x8BAAFA2B,
+	0xE7B87620, 0x6DEBAC98, 0x559552FB, 0x4AFA1B10, 0xED2EAE35, 0xC1382144, 0x27573B29, 0x1169B825,
+	0x3E96CA16, 0x224AE8C5, 0x1ACBDA11, 0x317C387E, 0xB9EA9BC3, 0xB136603B, 0x256FA0EC, 0x7657F74B,
+};
+// ln(10)
+static constexpr int      ln10_scale = 1;
+static constexpr uint32_t ln10_bits[] = {
+	0x935D8DDD, 0xAAA8AC16, 0xEA56D62B, 0x82D30A28, 0xE28FECF9, 0xDA5DF90E, 0x83C61E82, 0x01F02D72,
+	0x962F02D7, 0xB1A8105C, 0xCC70CBC0, 0x2C5F0D68, 0x2C622418, 0x410BE2DA, 0xFB8F7884, 0x02E516D6,
+	0x782CF8A2, 0x8A8C911E, 0x765AA6C3, 0xB0D831FB, 0xEF66CEB0, 0x4AB3C6FA, 0x5161BB49, 0xD219C7BB,
+};
+// log2(e) = 1/ln(2)
+static constexpr int      log2e_scale = 0;
+static constexpr uint32_t log2e_bits[] = {
+	0xB8AA3B29, 0x5C17F0BB, 0xBE87FED0, 0x691D3E88, 0xEB577AA8, 0xDD695A58, 0x8B25166C, 0xD1A13247,
+	0xDE1C43F7, 0x55176CD6, 0x24D92F75, 0xC16BE0B3, 0xEA90B9E6, 0x0C4A909F, 0xC4BFAF03, 0x53DF39B3,
+	0x2FE29493, 0x2617D9D5, 0xB21B43D5, 0x79D5A206, 0x0B5EBBBF, 0x3A828546, 0x8D1CF457, 0xAB63253C,
+};
+// log10(e) = 1/ln(10)
+static constexpr int      log10e_scale = -2;
+static constexpr uint32_t log10e_bits[] = {
+	0xDE5BD8A9, 0x37287195, 0x355BAAAF, 0xAD33DC32, 0x3EE34602, 0x45C9A202, 0x3A3F2D44, 0xF78EA53C,
+	0x75424EFA, 0x1402F3F2, 0x92235592, 0xC6464A15, 0x18CE3BD9, 0xFD38DCBC, 0x6FA2B8D2, 0xC8CDA7B3,
+	0x4356BD19, 0x48D06FF9, 0x40072005, 0x8C1DC4DA, 0x658B61EA, 0x42C84D6A, 0x50B36DED, 0x2F3739D5,
+};
+// log10(2)
+static constexpr int      log10_2_scale = -2;
+static constexpr uint32_t log10_2_bits[] = {
+	0x9A209A84, 0xFBCFF798, 0x8F8959AC, 0x0B7C9178, 0x26AD30C5, 0x43D1F349, 0x8A5E6F26, 0xB7CC63CB,
+	0x286A2D81, 0x919FABD0, 0x9E5CBC73, 0x3471BD12, 0x91473495, 0xB18B921E, 0x58B527F5, 0x2552D2CC,
+	0x5F837DEE, 0x02555CBC, 0x9CF1D190, 0xC40602E5, 0xD26C272F, 0xDE7102F4, 0xEB91129B, 0x1592D9DC,
+};
+
+// 2/pi for the Payne-Hanek argument reduction: word i holds the bits of weight 2^-(32 i + 1) down to 2^-(32 i + 32),
+// and the 9600 bits reduce the arguments of every posit up to posit<256,5>
+static constexpr uint32_t two_over_pi_bits[] = {
+	0xA2F9836E, 0x4E441529, 0xFC2757D1, 0xF534DDC0, 0xDB629599, 0x3C439041, 0xFE5163AB, 0xDEBBC561,
+	0xB7246E3A, 0x424DD2E0, 0x06492EEA, 0x09D1921C, 0xFE1DEB1C, 0xB129A73E, 0xE88235F5, 0x2EBB4484,
+	0xE99C7026, 0xB45F7E41, 0x3991D639, 0x835339F4, 0x9C845F8B, 0xBDF9283B, 0x1FF897FF, 0xDE05980F,
+	0xEF2F118B, 0x5A0A6D1F, 0x6D367ECF, 0x27CB09B7, 0x4F463F66, 0x9E5FEA2D, 0x7527BAC7, 0xEBE5F17B,
+	0x3D0739F7, 0x8A5292EA, 0x6BFB5FB1, 0x1F8D5D08, 0x56033046, 0xFC7B6BAB, 0xF0CFBC20, 0x9AF4361D,
+	0xA9E39161, 0x5EE61B08, 0x6599855F, 0x14A06840, 0x8DFFD880, 0x4D732731, 0x06061556, 0xCA73A8C9,
+	0x60E27BC0, 0x8C6B47C4, 0x19C367CD, 0xDCE8092A, 0x8359C476, 0x8B961CA6, 0xDDAF44D1, 0x5719053E,
+	0xA5FF0705, 0x3F7E33E8, 0x32C2DE4F, 0x98327DBB, 0xC33D26EF, 0x6B1E5EF8, 0x9F3A1F35, 0xCAF27F1D,
+	0x87F12190, 0x7C7C246A, 0xFA6ED577, 0x2D30433B, 0x15C614B5, 0x9D19C3C2, 0xC4AD414D, 0x2C5D000C,
+	0x467D862D, 0x71E39AC6, 0x9B006233, 0x7CD2B497, 0xA7B4D555, 0x37F63ED7, 0x1810A3FC, 0x764D2A9D,
+	0x64ABD770, 0xF87C6357, 0xB07AE715, 0x175649C0, 0xD9D63B38, 0x84A7CB23, 0x24778AD6, 0x23545AB9,
+	0x1F001B0A, 0xF1DFCE19, 0xFF319F6A, 0x1E666157, 0x9947FBAC, 0xD87F7EB7, 0x652289E8, 0x3260BFE6,
+	0xCDC4EF09, 0x366CD43F, 0x5DD7DE16, 0xDE3B5892, 0x9BDE2822, 0xD2E88628, 0x4D58E232, 0xCAC616E3,
+	0x08CB7DE0, 0x50C017A7, 0x1DF35BE0, 0x1834132E, 0x62128301, 0x48835B8E, 0xF57FB0AD, 0xF2E91E43,
+	0x4A48D367, 0x10D8DDAA, 0x425FAECE, 0x616AA428, 0x0AB499D3, 0xF2A6067F, 0x775C83C2, 0xA3883C61,
+	0x78738A5A, 0x8CAFBDD7, 0x6F63A62D, 0xCBBFF4EF, 0x818D67C1, 0x2645CA55, 0x36D9CAD2, 0xA8288D61,
+	0xC277C912, 0x1426049B, 0x4612C459, 0xC444C5C8, 0x91B24DF3, 0x1700AD43, 0xD4E54929, 0x10D5FDFC,
+	0xBE00CC94, 0x1EEECE70, 0xF53E1380, 0xF1ECC3E7, 0xB328F8C7, 0x9405933E, 0x71C1B309, 0x2EF3450B,
+	0x9C12887B, 0x20AB9FB5, 0x2EC29247, 0x2F327B6D, 0x550C90A7, 0x721FE76B, 0x96CB314A, 0x1679E279,
+	0x4189DFF4, 0x9794E884, 0xE6E29731, 0x996BED88, 0x365F5F0E, 0xFDBBB49A, 0x486CA467, 0x42727132,
+	0x5D8DB815, 0x9F09E5BC, 0x25318D39, 0x74F71C05, 0x30010C0D, 0x68084B58, 0xEE2C90AA, 0x4702E774,
+	0x24D6BDA6, 0x7DF77248, 0x6EEF169F, 0xA6948EF6, 0x91B45153, 0xD1F20ACF, 0x3398207E, 0x4BF56863,
+	0xB25F3EDD, 0x035D407F, 0x89852952, 0x55C06437, 0x10D86D32, 0x4832754C, 0x5BD4714E, 0x6E5445C1,
+	0x090B69F5, 0x2AD56614, 0x9D072750, 0x045DDB3B, 0xB4C576EA, 0x17F9877D, 0x6B49BA27, 0x1D296996,
+	0xACCCC654, 0x14AD6AE2, 0x9089D988, 0x50722CBE, 0xA4049407, 0x777030F3, 0x27FC00A8, 0x71EA49C2,
+	0x663DE064, 0x83DD9797, 0x3FA3FD94, 0x438C860D, 0xDE41319D, 0x39928C70, 0xDDE7B717, 0x3BDF082B,
+	0x3715A080, 0x5C93805A, 0x921110D8, 0xE80FAF80, 0x6C4BFFDB, 0x0F903876, 0x185915A5, 0x62BBCB61,
+	0xB989C7BD, 0x401004F2, 0xD2277549, 0xF6B6EBBB, 0x22DBAA14, 0x0A2F2689, 0x76836433, 0x3B091A94,
+	0x0EAA3A51, 0xC2A31DAE, 0xEDAF1226, 0x5C4DC26D, 0x9C7A2D97, 0x56C0833F, 0x03F6F009, 0x8C402B99,
+	0x316D07B4, 0x3915200C, 0x5BC3D8C4, 0x92F54BAD, 0xC6A5CA4E, 0xCD37A736, 0xA9E69492, 0xAB6842DD,
+	0xDE6319EF, 0x8C76528B, 0x6837DBFC, 0xABA1AE31, 0x15DFA1AE, 0x00DAFB0C, 0x664D64B7, 0x05ED3065,
+	0x29BF5657, 0x3AFF47B9, 0xF96AF3BE, 0x75DF9328, 0x3080ABF6, 0x8C6615CB, 0x040622FA, 0x1DE4D9A4,
+	0xB33D8F1B, 0x5709CD36, 0xE9424EA4, 0xBE13B523, 0x331AAAF0, 0xA8654FA5, 0xC1D20F3F, 0x0BCD785B,
+	0x76F92304, 0x8B7B7217, 0x8953A6C6, 0xE26E6F00, 0xEBEF584A, 0x9BB7DAC4, 0xBA66AACF, 0xCF761D02,
+	0xD12DF1B1, 0xC1998C77, 0xADC3DA48, 0x86A05DF7, 0xF480C62F, 0xF0AC9AEC, 0xDDBC5C3F, 0x6DDED01F,
+	0xC790B6DB, 0x2A3A25A3, 0x9AAF0093, 0x53AD0457, 0xB6B42D29, 0x7E804BA7, 0x07DA0EAA, 0x76A1597B,
+	0x2A12162D, 0xB7DCFDE5, 0xFAFEDB89, 0xFDBE896C, 0x76E4FCA9, 0x0670803E, 0x156E85FF, 0x87FD073E,
+	0x28336761, 0x86182AEA, 0xBD4DAFE7, 0xB36E6D8F,
+};
+
+}}} // namespace sw::unum::internal
@@ -4,54 +4,58 @@
 // Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
-
+#include "elementary_kernels.hpp"
 
 namespace sw {	namespace unum {
 
-// the current shims are NON-COMPLIANT with the posit standard, which says that every function must be
-// correctly rounded for every input value. Anything less sacrifices bitwise reproducibility of results.
+// Results beyond the dynamic range saturate to maxpos and minpos, as the posit standard prescribes.
 
 // Base-e exponential function
 template<size_t nbits, size_t es>
 posit<nbits,es> exp(posit<nbits,es> x) {
 	if (isnar(x)) return x;
-	posit<nbits, es> p;
-	double d = std::exp(double(x));
-	if (d == 0.0) {
-		minpos<nbits, es>(p);
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_exp(x);
 	}
 	else {
-		p = d;
+		return internal::elementary_native(x, internal::elementary_native_exp{});
 	}
-	return p;
 }
 
 // Base-2 exponential function
 template<size_t nbits, size_t es>
 posit<nbits,es> exp2(posit<nbits,es> x) {
 	if (isnar(x)) return x;
-	posit<nbits, es> p;
-	double d = std::exp2(double(x));
-	if (d == 0.0) {
-		minpos<nbits, es>(p);
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_exp2(x);
 	}
 	else {
-		p = d;
+		return internal::elementary_native(x, internal::elementary_native_exp2{});
 	}
-	return p;
 }
 
 // Base-10 exponential function
 template<size_t nbits, size_t es>
 posit<nbits, es> exp10(posit<nbits, es> x) {
-	return posit<nbits, es>(std::pow(10.0, double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_exp10(x);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_exp10{});
+	}
 }
 		
 // Base-e exponential function exp(x)-1
 template<size_t nbits, size_t es>
 posit<nbits,es> expm1(posit<nbits,es> x) {
-	return posit<nbits,es>(std::expm1(double(x)));
+	if (isnar(x) || x.iszero()) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_expm1(x);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_expm1{});
+	}
 }
 
-
 }}  // namespace sw::unum
@@ -4,51 +4,82 @@
 // Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
-
+#include "elementary_kernels.hpp"
 
 namespace sw {	namespace unum {
 
-// the current shims are NON-COMPLIANT with the posit standard, which says that every function must be
-// correctly rounded for every input value. Anything less sacrifices bitwise reproducibility of results.
-
-// value representing an angle expressed in radians
-// One radian is equivalent to 180/PI degrees
+// sinh and cosh saturate to maxpos, and the arguments outside the domain of acosh and atanh return NaR.
 
-// hyperbolic sine of an angle of x radians
+// hyperbolic sine of x
 template<size_t nbits, size_t es>
 posit<nbits,es> sinh(posit<nbits,es> x) {
-	return posit<nbits,es>(std::sinh(double(x)));
+	if (isnar(x) || x.iszero()) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_sinh(x);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_sinh{});
+	}
 }
 
-// hyperbolic cosine of an angle of x radians
+// hyperbolic cosine of x
 template<size_t nbits, size_t es>
 posit<nbits,es> cosh(posit<nbits,es> x) {
-	return posit<nbits,es>(std::cosh(double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_cosh(x);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_cosh{});
+	}
 }
 
-// hyperbolic tangent of an angle of x radians
+// hyperbolic tangent of x
 template<size_t nbits, size_t es>
 posit<nbits,es> tanh(posit<nbits,es> x) {
-	return posit<nbits,es>(std::tanh(double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_tanh(x);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_tanh{});
+	}
 }
 
-// hyperbolic cotangent of an angle of x radians
+// inverse hyperbolic tangent of x
 template<size_t nbits, size_t es>
 posit<nbits,es> atanh(posit<nbits,es> x) {
-	return posit<nbits,es>(std::atanh(double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_atanh(x);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_atanh{});
+	}
 }
 
-// hyperbolic cosecant of an angle of x radians
+// inverse hyperbolic cosine of x
 template<size_t nbits, size_t es>
 posit<nbits,es> acosh(posit<nbits,es> x) {
-	return posit<nbits,es>(std::acosh(double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_acosh(x);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_acosh{});
+	}
 }
 
-// hyperbolic secant of an angle of x radians
+// inverse hyperbolic sine of x
 template<size_t nbits, size_t es>
 posit<nbits,es> asinh(posit<nbits,es> x) {
-	return posit<nbits,es>(std::asinh(double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_asinh(x);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_asinh{});
+	}
 }
 
-
 }}  // namespace sw::unum
@@ -4,35 +4,58 @@
 // Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
-
+#include "elementary_kernels.hpp"
 
 namespace sw {	namespace unum {
 
-// the current shims are NON-COMPLIANT with the posit standard, which says that every function must be
-// correctly rounded for every input value. Anything less sacrifices bitwise reproducibility of results.
+// The logarithm of zero and of a negative argument is NaR.
 
 // Natural logarithm of x
 template<size_t nbits, size_t es>
 posit<nbits,es> log(posit<nbits,es> x) {
-	return posit<nbits,es>(std::log(double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_log(x);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_log{});
+	}
 }
 
 // Binary logarithm of x
 template<size_t nbits, size_t es>
 posit<nbits,es> log2(posit<nbits,es> x) {
-	return posit<nbits,es>(std::log2(double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_log2(x);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_log2{});
+	}
 }
 
 // Decimal logarithm of x
 template<size_t nbits, size_t es>
 posit<nbits,es> log10(posit<nbits,es> x) {
-	return posit<nbits,es>(std::log10(double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_log10(x);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_log10{});
+	}
 }
 		
 // Natural logarithm of 1+x
 template<size_t nbits, size_t es>
 posit<nbits,es> log1p(posit<nbits,es> x) {
-	return posit<nbits,es>(std::log1p(double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_log1p(x);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_log1p{});
+	}
 }
 
 }}  // namespace sw::unum
@@ -4,26 +4,62 @@
 // Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
-
+#include "elementary_kernels.hpp"
 
 namespace sw { namespace unum {
 
-// the current shims are NON-COMPLIANT with the posit standard, which says that every function must be
-// correctly rounded for every input value. Anything less sacrifices bitwise reproducibility of results.
+// A NaR operand returns NaR, a negative base requires an integer exponent, and results beyond the dynamic range
+// saturate to maxpos and minpos.
 
 template<size_t nbits, size_t es>
 posit<nbits,es> pow(posit<nbits,es> x, posit<nbits, es> y) {
-	return posit<nbits,es>(std::pow(double(x), double(y)));
+	if (isnar(x)) return x;
+	if (isnar(y)) return y;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		bool integral;
+		long long n = internal::elementary_integer(y, integral);
+		return internal::elementary_pow(x, y, integral, n);
+	}
+	else {
+		if (x.iszero()) return internal::elementary_native(x, y, [](auto v, auto u) { return std::pow(v, u); });
+		return internal::elementary_native(x, y, [](auto v, auto u) { return internal::elementary_saturate(std::pow(v, u)); });
+	}
 }
 		
 template<size_t nbits, size_t es>
 posit<nbits,es> pow(posit<nbits,es> x, int y) {
-	return posit<nbits,es>(std::pow(double(x), double(y)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_pow(x, y, true, y);
+	}
+	else {
+		using Real = internal::elementary_native_t<nbits, es>;
+		Real v = internal::elementary_to_native<Real>(x);
+		Real p = std::pow(v, Real(y));
+		return internal::elementary_from_native<nbits, es>(x.iszero() ? p : internal::elementary_saturate(p));
+	}
 }
 		
 template<size_t nbits, size_t es>
 posit<nbits,es> pow(posit<nbits,es> x, double y) {
-	return posit<nbits,es>(std::pow(double(x), y));
+	if (isnar(x)) return x;
+	posit<nbits, es> p;
+	if (std::isnan(y)) {
+		p.setnar();
+		return p;
+	}
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		// the parity of integers beyond 2^62 is even
+		bool integral = (y == std::floor(y));
+		long long n = (integral && std::fabs(y) < 4611686018427387904.0) ? (long long)y : 0;
+		return internal::elementary_pow(x, y, integral, n);
+	}
+	else {
+		using Real = internal::elementary_native_t<nbits, es>;
+		Real v = internal::elementary_to_native<Real>(x);
+		Real r = std::pow(v, Real(y));
+		return internal::elementary_from_native<nbits, es>(x.iszero() ? r : internal::elementary_saturate(r));
+	}
 }
 
 // calculate an integer power function base^int
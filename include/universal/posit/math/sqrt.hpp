@@ -482,8 +482,37 @@ namespace sw { namespace unum {
 	// fast sqrt for posit<64,3>
 	template<>
 	inline posit<64, 3> sqrt(const posit<64, 3>& a) {
-		throw "fast sqrt(posit<64,3>) not yet implemented";
-		return 0;
+		using uint128 = posit<64, 3>::uint128;
+		posit<64, 3> p;
+		if (a.isneg() || a.isnar()) {
+			p.setnar();
+			return p;
+		}
+		if (a.iszero()) {
+			p.setzero();
+			return p;
+		}
+
+		int scale;
+		uint64_t significand;
+		a.decode(a._bits, scale, significand);
+		// fold an odd scale into the significand so that the scale of the root is exact:
+		// the radicand is in [2^126, 2^128), and thus its root is in [2^63, 2^64), hidden bit at bit 63
+		uint128 radicand = uint128(significand) << (63 + (scale & 0x1));
+
+		// estimate the integer square root in double precision, and refine it with a Newton step
+		double estimate = std::sqrt(std::ldexp(double(significand), 63 + (scale & 0x1)));
+		uint64_t root = (estimate >= 18446744073709551615.0 ? 0xFFFFFFFFFFFFFFFFull : uint64_t(estimate));
+		root = uint64_t((uint128(root) + radicand / root) >> 1);
+		// the estimate is now within one of the floor of the root
+		while (uint128(root) * root > radicand) --root;
+		while (root != 0xFFFFFFFFFFFFFFFFull && uint128(root + 1) * (root + 1) <= radicand) ++root;
+		uint128 remainder = radicand - uint128(root) * root;
+
+		// strip the hidden bit: a non-zero remainder is the sticky bit of the infinitely precise root
+		uint64_t fraction = uint64_t(root) << 1;
+		p.set_raw_bits(a.round(scale >> 1, fraction, remainder != 0));
+		return p;
 	}
 
 #endif // POSIT_FAST_POSIT_64_3
@@ -493,8 +522,17 @@ namespace sw { namespace unum {
 	// fast sqrt for posit<128,4>
 	template<>
 	inline posit<128, 4> sqrt(const posit<128, 4>& a) {
-		throw "fast sqrt(posit<128,4>) not yet implemented";
-		return 0;
+		posit<128, 4> p;
+		if (a.isneg() || a.isnar()) {
+			p.setnar();
+			return p;
+		}
+		if (a.iszero()) {
+			p.setzero();
+			return p;
+		}
+		posit<128, 4>::engine::sqrt(a._bits, p._bits);
+		return p;
 	}
 
 #endif // POSIT_FAST_POSIT_128_4
@@ -504,8 +542,17 @@ namespace sw { namespace unum {
 	// fast sqrt for posit<256,5>
 	template<>
 	inline posit<256, 5> sqrt(const posit<256, 5>& a) {
-		throw "fast sqrt(posit<256,5>) not yet implemented";
-		return 0;
+		posit<256, 5> p;
+		if (a.isneg() || a.isnar()) {
+			p.setnar();
+			return p;
+		}
+		if (a.iszero()) {
+			p.setzero();
+			return p;
+		}
+		posit<256, 5>::engine::sqrt(a._bits, p._bits);
+		return p;
 	}
 
 #endif // POSIT_FAST_POSIT_256_5
@@ -4,11 +4,11 @@
 // Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include "elementary_kernels.hpp"
 
 namespace sw {	namespace unum {
 
-// the current shims are NON-COMPLIANT with the posit standard, which says that every function must be
-// correctly rounded for every input value. Anything less sacrifices bitwise reproducibility of results.
+// The poles of cot and csc at zero and the arguments outside the domain of asin and acos return NaR.
 
 // value representing an angle expressed in radians
 // One radian is equivalent to 180/PI degrees
@@ -16,65 +16,122 @@ namespace sw {	namespace unum {
 // sine of an angle of x radians
 template<size_t nbits, size_t es>
 posit<nbits,es> sin(posit<nbits,es> x) {
-	//std::cerr << "sw::unum::sin(posit<" << nbits << "," << es << ")";
-	return posit<nbits,es>(std::sin(double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_trigonometric(x, internal::elementary_trig::SIN);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_sin{});
+	}
 }
 
 // cosine of an angle of x radians
 template<size_t nbits, size_t es>
 posit<nbits,es> cos(posit<nbits,es> x) {
-	//std::cerr << "sw::unum::cos(posit<" << nbits << "," << es << ")";
-	return posit<nbits,es>(std::cos(double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_trigonometric(x, internal::elementary_trig::COS);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_cos{});
+	}
 }
 
 // tangent of an angle of x radians
 template<size_t nbits, size_t es>
 posit<nbits,es> tan(posit<nbits,es> x) {
-	//std::cerr << "sw::unum::tan(posit<" << nbits << "," << es << ")";
-	return posit<nbits,es>(std::tan(double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_trigonometric(x, internal::elementary_trig::TAN);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_tan{});
+	}
 }
 
-// cotangent of an angle of x radians
+// arc tangent of x
 template<size_t nbits, size_t es>
 posit<nbits,es> atan(posit<nbits,es> x) {
-	//std::cerr << "sw::unum::atan(posit<" << nbits << "," << es << ")";
-	return posit<nbits,es>(std::atan(double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_atan(x);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_atan{});
+	}
 }
 		
 // Arc tangent with two parameters
 template<size_t nbits, size_t es>
 posit<nbits,es> atan2(posit<nbits,es> y, posit<nbits,es> x) {
-	return posit<nbits,es>(std::atan2(double(y),double(x)));
+	if (isnar(y)) return y;
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_atan2(y, x);
+	}
+	else {
+		return internal::elementary_native(y, x, [](auto v, auto u) { return std::atan2(v, u); });
+	}
 }
 
-// cosecant of an angle of x radians
+// arc cosine of x
 template<size_t nbits, size_t es>
 posit<nbits,es> acos(posit<nbits,es> x) {
-	return posit<nbits,es>(std::acos(double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_acos(x);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_acos{});
+	}
 }
 
-// secant of an angle of x radians
+// arc sine of x
 template<size_t nbits, size_t es>
 posit<nbits,es> asin(posit<nbits,es> x) {
-	return posit<nbits,es>(std::asin(double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_asin(x);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_asin{});
+	}
 }
 
 // cotangent an angle of x radians
 template<size_t nbits, size_t es>
 posit<nbits,es> cot(posit<nbits,es> x) {
-	return posit<nbits,es>(std::tan(sw::unum::m_pi_2-double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_trigonometric(x, internal::elementary_trig::COT);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_cot{});
+	}
 }
 
 // secant of an angle of x radians
 template<size_t nbits, size_t es>
 posit<nbits,es> sec(posit<nbits,es> x) {
-	return posit<nbits,es>(1.0/std::cos(double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_trigonometric(x, internal::elementary_trig::SEC);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_sec{});
+	}
 }
 
 // cosecant of an angle of x radians
 template<size_t nbits, size_t es>
 posit<nbits,es> csc(posit<nbits,es> x) {
-	return posit<nbits,es>(1.0/std::sin(double(x)));
+	if (isnar(x)) return x;
+	if constexpr (internal::elementary_in_posit_domain<nbits, es>()) {
+		return internal::elementary_trigonometric(x, internal::elementary_trig::CSC);
+	}
+	else {
+		return internal::elementary_native(x, internal::elementary_native_csc{});
+	}
 }
 
 }}  // namespace sw::unum
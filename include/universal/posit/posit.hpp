@@ -87,6 +87,7 @@ typedef __128bitdd double_double;
 #include <universal/posit/exponent.hpp>
 #include <universal/posit/regime.hpp>
 #include <universal/posit/posit_functions.hpp>
+#include <universal/posit/posit_lookup.hpp>
 
 namespace sw {
 namespace unum {
@@ -729,6 +730,12 @@ public:
 			return *this;
 		}
 		if (rhs.iszero()) return *this;
+#if POSIT_FAST_LOOKUP_ARITHMETIC
+		if constexpr (nbits <= POSIT_LOOKUP_MAX_NBITS) {
+			_raw_bits = (unsigned long long)posit_lookup<nbits, es>::add(encoding(), rhs.encoding());
+			return *this;
+		}
+#endif
 
 		// arithmetic operation
 		value<abits + 1> sum;
@@ -771,6 +778,12 @@ public:
 			return *this;
 		}
 		if (rhs.iszero()) return *this;
+#if POSIT_FAST_LOOKUP_ARITHMETIC
+		if constexpr (nbits <= POSIT_LOOKUP_MAX_NBITS) {
+			_raw_bits = (unsigned long long)posit_lookup<nbits, es>::sub(encoding(), rhs.encoding());
+			return *this;
+		}
+#endif
 
 		// arithmetic operation
 		value<abits + 1> difference;
@@ -813,6 +826,12 @@ public:
 			setzero();
 			return *this;
 		}
+#if POSIT_FAST_LOOKUP_ARITHMETIC
+		if constexpr (nbits <= POSIT_LOOKUP_MAX_NBITS) {
+			_raw_bits = (unsigned long long)posit_lookup<nbits, es>::mul(encoding(), rhs.encoding());
+			return *this;
+		}
+#endif
 
 		// arithmetic operation
 		value<mbits> product;
@@ -866,6 +885,12 @@ public:
 		if (iszero() || isnar()) {
 			return *this;
 		}
+#endif
+#if POSIT_FAST_LOOKUP_ARITHMETIC
+		if constexpr (nbits <= POSIT_LOOKUP_MAX_NBITS) {
+			_raw_bits = (unsigned long long)posit_lookup<nbits, es>::div(encoding(), rhs.encoding());
+			return *this;
+		}
 #endif
 		value<divbits> ratio;
 		value<fbits> a, b;
@@ -0,0 +1,600 @@
+#pragma once
+// posit_batch.hpp: branch-free array kernels for small posit configurations, such as posit<16,1> and posit<8,0>
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <cstring>
+#include <universal/native/bit_functions.hpp>
+#include <universal/posit/posit_fwd.hpp>
+#if defined(LIB_USE_AVX2) && defined(__AVX2__)
+#include <immintrin.h>
+#define POSIT_BATCH_AVX2 1
+#else
+#define POSIT_BATCH_AVX2 0
+#endif
+
+namespace sw { namespace unum {
+
+// posit_batch_kernels operate on the raw encodings of a posit<nbits, es> held in 32-bit lanes
+//
+// Every step is expressed with 32-bit integer operations and selects, without data-dependent branches or loops.
+// The regime is decoded with a count-leading-zeros built from shifts and compares, which all SIMD instruction sets offer.
+// The results are correctly rounded and identical to the scalar posit operators, NaR propagates without exceptions.
+// These kernels are the scalar path of the array functions, which with LIB_USE_AVX2 run the same algorithms
+// in posit_batch_avx2 and use these kernels for the remaining elements.
+template<size_t nbits, size_t es>
+struct posit_batch_kernels {
+	static_assert(nbits >= es + 4, "posit_batch_kernels: posit configuration needs at least one fraction bit");
+	static_assert(2 * nbits + es <= 33, "posit_batch_kernels: encoding does not fit the 32-bit lanes");
+	static constexpr uint32_t mask     = (uint32_t(1) << nbits) - 1;
+	static constexpr uint32_t nar      = uint32_t(1) << (nbits - 1);
+	static constexpr uint32_t maxpos   = nar - 1;
+	static constexpr uint32_t minpos   = 1;
+	static constexpr int      fbits    = int(nbits) - 3 - int(es);    // maximum number of fraction bits
+	static constexpr int      maxscale = (int(nbits) - 2) << es;      // scale of maxpos
+	static constexpr int      zeroscale = -4 * maxscale - 64;         // scale assigned to zero: smaller than any product
+
+	// count leading zeros of a nonzero 32-bit word: a binary search expressed with selects instead of branches
+	static inline uint32_t clz(uint32_t x) {
+		uint32_t n = 0, t;
+		t = ((x >> 16) == 0) << 4; n += t; x <<= t;
+		t = ((x >> 24) == 0) << 3; n += t; x <<= t;
+		t = ((x >> 28) == 0) << 2; n += t; x <<= t;
+		t = ((x >> 30) == 0) << 1; n += t; x <<= t;
+		t = ((x >> 31) == 0);      n += t;
+		return n;
+	}
+
+	// decode an encoding into sign, scale, and a significand with the hidden bit at bit 30, zero has significand 0
+	static inline void decode(uint32_t x, uint32_t& neg, int32_t& scale, uint32_t& sig) {
+		x &= mask;
+		neg = (x >> (nbits - 1)) & 1;
+		uint32_t ax = ((x ^ (0 - neg)) + neg) & mask;                    // absolute value
+		uint32_t y = ax << (33 - nbits);                                  // regime aligned at bit 31
+		uint32_t ones = 0 - (y >> 31);                                     // all ones when the regime is a run of 1's
+		uint32_t run = clz((y ^ ones) | 1);                               // run length of the regime
+		int32_t k = ones ? int32_t(run) - 1 : -int32_t(run);
+		uint32_t rest = (y << run) << 1;                                  // remove regime and terminating bit
+		int32_t e = int32_t(es ? (rest >> (32 - es)) : 0);
+		uint32_t frac = es ? (rest << es) : rest;
+		bool zero = (ax == 0);
+		scale = zero ? zeroscale : k * (int32_t(1) << es) + e;
+		sig = zero ? 0 : ((uint32_t(1) << 30) | (frac >> 2));
+	}
+
+	// round (sign, scale, significand with the hidden bit at bit 31, sticky) to the nearest posit
+	static inline uint32_t encode(uint32_t neg, int32_t scale, uint32_t sig, uint32_t sticky) {
+		constexpr uint32_t F = nbits - 1;                                 // fraction bits + guard + sticky
+		bool over = scale > maxscale;
+		bool under = scale < -maxscale;
+		int32_t s = over ? maxscale : (under ? -maxscale : scale);
+		int32_t k = s >> es;                                              // floor division
+		uint32_t e = uint32_t(s) & ((uint32_t(1) << es) - 1);
+		uint32_t L = k >= 0 ? uint32_t(k + 2) : uint32_t(1 - k);          // regime length including the terminating bit
+		uint32_t regime = k >= 0 ? (((uint32_t(1) << ((k + 1) & 31)) - 1) << 1) : 1;
+		uint32_t f = (sig << 1) >> (32 - (F - 1));                        // fraction bits that can survive rounding
+		uint32_t st = ((sig << F) != 0) | sticky;
+		uint32_t body = (((regime << es) | e) << F) | (f << 1) | st;
+		uint32_t shift = L + es + F - (nbits - 1);
+		uint32_t bits = body >> shift;
+		uint32_t guard = (body >> (shift - 1)) & 1;
+		uint32_t rest = (body & ((uint32_t(1) << (shift - 1)) - 1)) != 0;
+		bits += guard & (rest | (bits & 1));
+		bits = over ? maxpos : (under ? minpos : bits);
+		return ((bits ^ (0 - neg)) + neg) & mask;
+	}
+
+	// exact conversion of an encoding to an IEEE-754 double, NaR becomes NaN:
+	// requires maxscale to stay within the normal exponent range of double
+	static inline double to_double(uint32_t x) {
+		static_assert(maxscale < 1022, "posit_batch_kernels: posit range exceeds the normal range of double");
+		uint32_t neg, sig;
+		int32_t scale;
+		decode(x, neg, scale, sig);
+		uint64_t bits = (uint64_t(neg) << 63) | (uint64_t(scale + 1023) << 52) | (uint64_t(sig & 0x3FFFFFFF) << 22);
+		bits = (sig == 0) ? 0 : bits;
+		bits = ((x & mask) == nar) ? 0x7FF8000000000000ull : bits;
+		double d;
+		std::memcpy(&d, &bits, sizeof(d));
+		return d;
+	}
+
+	// round an IEEE-754 double to the nearest posit: NaN and infinities become NaR, subnormals project to minpos
+	static inline uint32_t from_double(double d) {
+		uint64_t bits;
+		std::memcpy(&bits, &d, sizeof(bits));
+		uint32_t neg = uint32_t(bits >> 63);
+		int32_t exponent = int32_t((bits >> 52) & 0x7FF);
+		uint64_t mantissa = bits & 0xFFFFFFFFFFFFFull;
+		uint32_t sig = 0x80000000u | uint32_t(mantissa >> 21);            // hidden bit and the upper 31 mantissa bits
+		uint32_t sticky = (mantissa & 0x1FFFFF) != 0;
+		uint32_t r = encode(neg, exponent - 1023, sig, sticky);
+		r = ((bits << 1) == 0) ? 0 : r;
+		return (exponent == 0x7FF) ? nar : r;
+	}
+
+	// add two (sign, scale, significand) triples with the hidden bit at bit 30 and round once
+	static inline uint32_t add_triples(uint32_t na, int32_t sa, uint32_t ma, uint32_t nb, int32_t sb, uint32_t mb) {
+		bool swap = (sb > sa) | ((sb == sa) & (mb > ma));
+		uint32_t nL = swap ? nb : na;
+		int32_t  sL = swap ? sb : sa;
+		uint32_t A  = swap ? mb : ma;
+		int32_t  sS = swap ? sa : sb;
+		uint32_t B  = swap ? ma : mb;
+		int32_t d = sL - sS;
+		uint32_t shift = d > 31 ? 31 : uint32_t(d);
+		uint32_t lost = B & ((uint32_t(1) << shift) - 1);
+		B = (B >> shift) | (lost != 0);                                   // jam the lost bits into a sticky bit
+		uint32_t sum = (na == nb) ? A + B : A - B;
+		uint32_t lz = clz(sum | 1);
+		uint32_t r = encode(nL, sL + 1 - int32_t(lz), sum << lz, 0);
+		return sum == 0 ? 0 : r;
+	}
+
+	static inline uint32_t add(uint32_t a, uint32_t b) {
+		uint32_t na, nb, ma, mb;
+		int32_t sa, sb;
+		decode(a, na, sa, ma);
+		decode(b, nb, sb, mb);
+		uint32_t r = add_triples(na, sa, ma, nb, sb, mb);
+		return (((a & mask) == nar) | ((b & mask) == nar)) ? nar : r;
+	}
+
+	static inline uint32_t mul(uint32_t a, uint32_t b) {
+		uint32_t na, nb, ma, mb;
+		int32_t sa, sb;
+		decode(a, na, sa, ma);
+		decode(b, nb, sb, mb);
+		// the significands have at most fbits + 1 significant bits, so their product is exact in 32 bits
+		uint32_t p = (ma >> (30 - fbits)) * (mb >> (30 - fbits));
+		uint32_t carry = p >> (2 * fbits + 1);                            // the product is in [1, 4)
+		uint32_t r = encode(na ^ nb, sa + sb + int32_t(carry), p << (31 - 2 * fbits - carry), 0);
+		r = ((ma == 0) | (mb == 0)) ? 0 : r;
+		return (((a & mask) == nar) | ((b & mask) == nar)) ? nar : r;
+	}
+
+	// a * b + c with a single rounding step
+	static inline uint32_t fma(uint32_t a, uint32_t b, uint32_t c) {
+		uint32_t na, nb, nc, ma, mb, mc;
+		int32_t sa, sb, sc;
+		decode(a, na, sa, ma);
+		decode(b, nb, sb, mb);
+		decode(c, nc, sc, mc);
+		uint32_t p = (ma >> (30 - fbits)) * (mb >> (30 - fbits));
+		uint32_t carry = p >> (2 * fbits + 1);
+		bool pzero = (p == 0);
+		int32_t sp = pzero ? zeroscale : sa + sb + int32_t(carry);
+		uint32_t mp = p << (30 - 2 * fbits - carry);                      // exact: the product has at most 2*fbits + 2 bits
+		uint32_t r = add_triples(na ^ nb, sp, mp, nc, sc, mc);
+		return (((a & mask) == nar) | ((b & mask) == nar) | ((c & mask) == nar)) ? nar : r;
+	}
+
+	// exact fixed-point accumulator for the fused dot product: every product of two posits is representable
+	static constexpr int  dot_bias = 2 * maxscale + 2 * fbits;          // bit position of the smallest product lsb
+	static constexpr int  dot_capacity = 30;                              // log2 of the number of products without overflow
+	static constexpr int  dot_limbs = (dot_bias + 2 * maxscale + 2 + dot_capacity + 1 + 63) / 64;
+
+	static inline void accumulate(uint64_t (&acc)[dot_limbs], uint32_t a, uint32_t b) {
+		uint32_t na, nb, ma, mb;
+		int32_t sa, sb;
+		decode(a, na, sa, ma);
+		decode(b, nb, sb, mb);
+		if (ma == 0 || mb == 0) return;
+		uint64_t p = uint64_t((ma >> (30 - fbits)) * (mb >> (30 - fbits)));
+		int pos = sa + sb - 2 * fbits + dot_bias;                           // product lsb has weight 2^(sa + sb - 2 * fbits)
+		uint64_t v[dot_limbs] = {};
+		v[pos / 64] = p << (pos % 64);
+		if (pos % 64 != 0 && pos / 64 + 1 < dot_limbs) v[pos / 64 + 1] = p >> (64 - pos % 64);
+		if (na ^ nb) {  // two's complement negation of the product
+			uint64_t carry = 1;
+			for (int i = 0; i < dot_limbs; ++i) {
+				uint64_t t = ~v[i] + carry;
+				carry = (carry && t == 0) ? 1 : 0;
+				v[i] = t;
+			}
+		}
+		uint64_t carry = 0;
+		for (int i = 0; i < dot_limbs; ++i) {
+			uint64_t t = acc[i] + carry;
+			uint64_t c1 = (t < carry) ? 1 : 0;
+			acc[i] = t + v[i];
+			carry = c1 + ((acc[i] < v[i]) ? 1 : 0);
+		}
+	}
+
+	// round the accumulator to the nearest posit
+	static inline uint32_t round(const uint64_t (&acc)[dot_limbs]) {
+		uint64_t m[dot_limbs];
+		uint32_t neg = uint32_t(acc[dot_limbs - 1] >> 63);
+		uint64_t carry = neg;
+		for (int i = 0; i < dot_limbs; ++i) {
+			uint64_t t = (neg ? ~acc[i] : acc[i]) + carry;
+			carry = (carry && t == 0) ? 1 : 0;
+			m[i] = t;
+		}
+		int msb = -1;
+		for (int i = dot_limbs - 1; i >= 0; --i) {
+			if (m[i]) { msb = i * 64 + 63 - countLeadingZeros(m[i]); break; }
+		}
+		if (msb < 0) return 0;
+		// extract the 32 bits below and including the msb, and the sticky bit of the remaining bits
+		uint32_t sig = 0;
+		uint32_t sticky = 0;
+		for (int i = 0; i < dot_limbs; ++i) {
+			int lo = i * 64;                                                // bit position of m[i] bit 0
+			int first = msb - 31;                                           // bit position of sig bit 0
+			if (lo + 63 < first) {
+				sticky |= (m[i] != 0);
+			}
+			else if (lo <= msb) {
+				int offset = lo - first;
+				if (offset >= 0) {
+					sig |= uint32_t(m[i] << offset);
+				}
+				else {
+					sig |= uint32_t(m[i] >> -offset);
+					sticky |= ((m[i] << (64 + offset)) != 0);
+				}
+			}
+		}
+		return encode(neg, msb - dot_bias, sig, sticky);
+	}
+};
+
+#if POSIT_BATCH_AVX2
+// posit_batch_avx2 evaluates the posit_batch_kernels algorithms on 16 encodings of a posit<nbits, es>, nbits <= 16,
+// per 256-bit register: the encodings are decoded in 16-bit lanes and the significands, with the hidden bit at bit 15,
+// are multiplied with _mm256_mullo_epi16 and _mm256_mulhi_epu16. AVX2 has variable shifts only for 32-bit and 64-bit
+// lanes, so the alignment of the addends and the rounding run on the two halves of the register in 32-bit lanes,
+// and the fused dot product accumulates the exact products in 64-bit lanes, one 32-bit digit per accumulator.
+// The results are bit-identical to the scalar kernels.
+template<size_t nbits, size_t es>
+struct posit_batch_avx2 {
+	static_assert(nbits <= 16, "posit_batch_avx2: encoding does not fit the 16-bit lanes");
+	using K = posit_batch_kernels<nbits, es>;
+	static constexpr size_t lanes = 16;
+
+	// shift x left by b where cond is set, and count the shift: one step of the binary search for the leading one
+	template<int b>
+	static inline void normalize_step16(__m256i& w, __m256i& y, __m256i& run) {
+		__m256i cond = _mm256_cmpeq_epi16(_mm256_srli_epi16(w, 16 - b), _mm256_setzero_si256());
+		w = _mm256_blendv_epi8(w, _mm256_slli_epi16(w, b), cond);
+		y = _mm256_blendv_epi8(y, _mm256_slli_epi16(y, b), cond);
+		run = _mm256_add_epi16(run, _mm256_and_si256(cond, _mm256_set1_epi16(b)));
+	}
+
+	// decode 16 encodings into a sign mask, scale, and a significand with the hidden bit at bit 15, zero has significand 0
+	static inline void decode(__m256i x, __m256i& neg, __m256i& scale, __m256i& sig) {
+		const __m256i zero = _mm256_setzero_si256();
+		const __m256i mask = _mm256_set1_epi16(short(K::mask));
+		x = _mm256_and_si256(x, mask);
+		neg = _mm256_srai_epi16(_mm256_slli_epi16(x, 16 - int(nbits)), 15);
+		__m256i ax = _mm256_and_si256(_mm256_sub_epi16(_mm256_xor_si256(x, neg), neg), mask);
+		__m256i y = _mm256_slli_epi16(ax, 17 - int(nbits));                                 // regime aligned at bit 15
+		__m256i ones = _mm256_srai_epi16(y, 15);                                             // all ones for a run of 1's
+		__m256i w = _mm256_or_si256(_mm256_xor_si256(y, ones), _mm256_set1_epi16(1));
+		__m256i run = zero;
+		normalize_step16<8>(w, y, run);
+		normalize_step16<4>(w, y, run);
+		normalize_step16<2>(w, y, run);
+		normalize_step16<1>(w, y, run);
+		__m256i k = _mm256_blendv_epi8(_mm256_sub_epi16(zero, run), _mm256_sub_epi16(run, _mm256_set1_epi16(1)), ones);
+		__m256i rest = _mm256_slli_epi16(y, 1);                                              // remove regime and terminating bit
+		__m256i e = es ? _mm256_srli_epi16(rest, 16 - int(es)) : zero;
+		__m256i frac = _mm256_slli_epi16(rest, int(es));
+		__m256i iszero = _mm256_cmpeq_epi16(ax, zero);
+		scale = _mm256_add_epi16(_mm256_slli_epi16(k, int(es)), e);
+		scale = _mm256_blendv_epi8(scale, _mm256_set1_epi16(short(K::zeroscale)), iszero);
+		sig = _mm256_andnot_si256(iszero, _mm256_or_si256(_mm256_set1_epi16(short(0x8000)), _mm256_srli_epi16(frac, 1)));
+	}
+
+	// NaR lanes of 16 encodings
+	static inline __m256i isnar(__m256i x) {
+		return _mm256_cmpeq_epi16(_mm256_and_si256(x, _mm256_set1_epi16(short(K::mask))), _mm256_set1_epi16(short(K::nar)));
+	}
+
+	// 16-bit lanes to the two halves of 32-bit lanes, and back: unpack and pack interleave the same way
+	static inline void widen(__m256i v, __m256i& lo, __m256i& hi) {
+		lo = _mm256_unpacklo_epi16(v, _mm256_setzero_si256());
+		hi = _mm256_unpackhi_epi16(v, _mm256_setzero_si256());
+	}
+	static inline void widen_signed(__m256i v, __m256i& lo, __m256i& hi) {
+		__m256i s = _mm256_srai_epi16(v, 15);
+		lo = _mm256_unpacklo_epi16(v, s);
+		hi = _mm256_unpackhi_epi16(v, s);
+	}
+	static inline __m256i narrow(__m256i lo, __m256i hi) {
+		return _mm256_packus_epi32(lo, hi);
+	}
+
+	// count leading zeros of nonzero 32-bit lanes
+	static inline __m256i clz32(__m256i x) {
+		const __m256i zero = _mm256_setzero_si256();
+		__m256i n = zero, t;
+		t = _mm256_cmpeq_epi32(_mm256_srli_epi32(x, 16), zero); n = _mm256_sub_epi32(n, _mm256_slli_epi32(t, 4)); x = _mm256_blendv_epi8(x, _mm256_slli_epi32(x, 16), t);
+		t = _mm256_cmpeq_epi32(_mm256_srli_epi32(x, 24), zero); n = _mm256_sub_epi32(n, _mm256_slli_epi32(t, 3)); x = _mm256_blendv_epi8(x, _mm256_slli_epi32(x, 8), t);
+		t = _mm256_cmpeq_epi32(_mm256_srli_epi32(x, 28), zero); n = _mm256_sub_epi32(n, _mm256_slli_epi32(t, 2)); x = _mm256_blendv_epi8(x, _mm256_slli_epi32(x, 4), t);
+		t = _mm256_cmpeq_epi32(_mm256_srli_epi32(x, 30), zero); n = _mm256_sub_epi32(n, _mm256_slli_epi32(t, 1)); x = _mm256_blendv_epi8(x, _mm256_slli_epi32(x, 2), t);
+		t = _mm256_cmpeq_epi32(_mm256_srli_epi32(x, 31), zero); n = _mm256_sub_epi32(n, t);
+		return n;
+	}
+
+	// K::encode on 8 lanes: sign mask, scale, significand with the hidden bit at bit 31, and a sticky bit
+	static inline __m256i encode(__m256i neg, __m256i scale, __m256i sig, __m256i sticky) {
+		constexpr int F = int(nbits) - 1;
+		const __m256i one = _mm256_set1_epi32(1);
+		const __m256i zero = _mm256_setzero_si256();
+		__m256i over = _mm256_cmpgt_epi32(scale, _mm256_set1_epi32(K::maxscale));
+		__m256i under = _mm256_cmpgt_epi32(_mm256_set1_epi32(-K::maxscale), scale);
+		__m256i s = _mm256_min_epi32(_mm256_max_epi32(scale, _mm256_set1_epi32(-K::maxscale)), _mm256_set1_epi32(K::maxscale));
+		__m256i k = _mm256_srai_epi32(s, int(es));
+		__m256i e = _mm256_and_si256(s, _mm256_set1_epi32((1 << es) - 1));
+		__m256i kpos = _mm256_cmpgt_epi32(k, _mm256_set1_epi32(-1));
+		__m256i L = _mm256_blendv_epi8(_mm256_sub_epi32(one, k), _mm256_add_epi32(k, _mm256_set1_epi32(2)), kpos);
+		__m256i regime = _mm256_slli_epi32(_mm256_sub_epi32(_mm256_sllv_epi32(one, _mm256_add_epi32(k, one)), one), 1);
+		regime = _mm256_blendv_epi8(one, regime, kpos);
+		__m256i f = _mm256_srli_epi32(_mm256_slli_epi32(sig, 1), 32 - (F - 1));
+		__m256i st = _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_slli_epi32(sig, F), zero), one);
+		st = _mm256_or_si256(st, sticky);
+		__m256i body = _mm256_slli_epi32(_mm256_or_si256(_mm256_slli_epi32(regime, int(es)), e), F);
+		body = _mm256_or_si256(_mm256_or_si256(body, _mm256_slli_epi32(f, 1)), st);
+		__m256i shift = _mm256_add_epi32(L, _mm256_set1_epi32(int(es)));
+		__m256i bits = _mm256_srlv_epi32(body, shift);
+		__m256i guard = _mm256_and_si256(_mm256_srlv_epi32(body, _mm256_sub_epi32(shift, one)), one);
+		// the bits below the guard bit moved to the top of the word: a count of 32 leaves none
+		__m256i rest = _mm256_sllv_epi32(body, _mm256_sub_epi32(_mm256_set1_epi32(33), shift));
+		rest = _mm256_andnot_si256(_mm256_cmpeq_epi32(rest, zero), one);
+		bits = _mm256_add_epi32(bits, _mm256_and_si256(guard, _mm256_or_si256(rest, _mm256_and_si256(bits, one))));
+		bits = _mm256_blendv_epi8(bits, _mm256_set1_epi32(int(K::maxpos)), over);
+		bits = _mm256_blendv_epi8(bits, _mm256_set1_epi32(int(K::minpos)), under);
+		return _mm256_and_si256(_mm256_sub_epi32(_mm256_xor_si256(bits, neg), neg), _mm256_set1_epi32(int(K::mask)));
+	}
+
+	// K::add_triples on 8 lanes: sign masks, scales, and significands with the hidden bit at bit 30
+	static inline __m256i add_triples(__m256i na, __m256i sa, __m256i ma, __m256i nb, __m256i sb, __m256i mb) {
+		const __m256i one = _mm256_set1_epi32(1);
+		const __m256i zero = _mm256_setzero_si256();
+		__m256i swap = _mm256_or_si256(_mm256_cmpgt_epi32(sb, sa), _mm256_and_si256(_mm256_cmpeq_epi32(sb, sa), _mm256_cmpgt_epi32(mb, ma)));
+		__m256i nL = _mm256_blendv_epi8(na, nb, swap);
+		__m256i sL = _mm256_blendv_epi8(sa, sb, swap);
+		__m256i A  = _mm256_blendv_epi8(ma, mb, swap);
+		__m256i sS = _mm256_blendv_epi8(sb, sa, swap);
+		__m256i B  = _mm256_blendv_epi8(mb, ma, swap);
+		__m256i shift = _mm256_min_epi32(_mm256_sub_epi32(sL, sS), _mm256_set1_epi32(31));
+		__m256i lost = _mm256_and_si256(B, _mm256_sub_epi32(_mm256_sllv_epi32(one, shift), one));
+		B = _mm256_or_si256(_mm256_srlv_epi32(B, shift), _mm256_andnot_si256(_mm256_cmpeq_epi32(lost, zero), one));
+		__m256i sum = _mm256_blendv_epi8(_mm256_sub_epi32(A, B), _mm256_add_epi32(A, B), _mm256_cmpeq_epi32(na, nb));
+		__m256i lz = clz32(_mm256_or_si256(sum, one));
+		__m256i r = encode(nL, _mm256_sub_epi32(_mm256_add_epi32(sL, one), lz), _mm256_sllv_epi32(sum, lz), zero);
+		return _mm256_andnot_si256(_mm256_cmpeq_epi32(sum, zero), r);
+	}
+
+	static inline __m256i add(__m256i a, __m256i b) {
+		__m256i na, sa, ma, nb, sb, mb;
+		decode(a, na, sa, ma);
+		decode(b, nb, sb, mb);
+		__m256i r[2], v[6][2];
+		widen_signed(na, v[0][0], v[0][1]);
+		widen_signed(sa, v[1][0], v[1][1]);
+		widen(ma, v[2][0], v[2][1]);
+		widen_signed(nb, v[3][0], v[3][1]);
+		widen_signed(sb, v[4][0], v[4][1]);
+		widen(mb, v[5][0], v[5][1]);
+		for (int h = 0; h < 2; ++h) {
+			r[h] = add_triples(v[0][h], v[1][h], _mm256_slli_epi32(v[2][h], 15), v[3][h], v[4][h], _mm256_slli_epi32(v[5][h], 15));
+		}
+		return _mm256_blendv_epi8(narrow(r[0], r[1]), _mm256_set1_epi16(short(K::nar)), _mm256_or_si256(isnar(a), isnar(b)));
+	}
+
+	static inline __m256i mul(__m256i a, __m256i b) {
+		__m256i na, sa, ma, nb, sb, mb;
+		decode(a, na, sa, ma);
+		decode(b, nb, sb, mb);
+		// the product of the significands is exact in 32 bits and lies in [2^30, 2^32)
+		__m256i plo = _mm256_mullo_epi16(ma, mb), phi = _mm256_mulhi_epu16(ma, mb);
+		__m256i neg[2], scale[2], r[2];
+		__m256i p[2] = { _mm256_unpacklo_epi16(plo, phi), _mm256_unpackhi_epi16(plo, phi) };
+		widen_signed(_mm256_xor_si256(na, nb), neg[0], neg[1]);
+		widen_signed(_mm256_add_epi16(sa, sb), scale[0], scale[1]);
+		for (int h = 0; h < 2; ++h) {
+			__m256i carry = _mm256_srli_epi32(p[h], 31);
+			__m256i sig = _mm256_sllv_epi32(p[h], _mm256_sub_epi32(_mm256_set1_epi32(1), carry));
+			r[h] = encode(neg[h], _mm256_add_epi32(scale[h], carry), sig, _mm256_setzero_si256());
+		}
+		__m256i zero = _mm256_setzero_si256();
+		__m256i pzero = _mm256_or_si256(_mm256_cmpeq_epi16(ma, zero), _mm256_cmpeq_epi16(mb, zero));
+		__m256i result = _mm256_andnot_si256(pzero, narrow(r[0], r[1]));
+		return _mm256_blendv_epi8(result, _mm256_set1_epi16(short(K::nar)), _mm256_or_si256(isnar(a), isnar(b)));
+	}
+
+	// a * b + c with a single rounding step
+	static inline __m256i fma(__m256i a, __m256i b, __m256i c) {
+		__m256i na, sa, ma, nb, sb, mb, nc, sc, mc;
+		decode(a, na, sa, ma);
+		decode(b, nb, sb, mb);
+		decode(c, nc, sc, mc);
+		__m256i zero = _mm256_setzero_si256();
+		__m256i plo = _mm256_mullo_epi16(ma, mb), phi = _mm256_mulhi_epu16(ma, mb);
+		__m256i pzero = _mm256_or_si256(_mm256_cmpeq_epi16(ma, zero), _mm256_cmpeq_epi16(mb, zero));
+		__m256i sp16 = _mm256_blendv_epi8(_mm256_add_epi16(sa, sb), _mm256_set1_epi16(short(K::zeroscale)), pzero);
+		__m256i p[2] = { _mm256_unpacklo_epi16(plo, phi), _mm256_unpackhi_epi16(plo, phi) };
+		__m256i np[2], sp[2], ncw[2], scw[2], mcw[2], r[2];
+		widen_signed(_mm256_xor_si256(na, nb), np[0], np[1]);
+		widen_signed(sp16, sp[0], sp[1]);
+		widen_signed(nc, ncw[0], ncw[1]);
+		widen_signed(sc, scw[0], scw[1]);
+		widen(mc, mcw[0], mcw[1]);
+		for (int h = 0; h < 2; ++h) {
+			// hidden bit at bit 30: the product has at least 4 trailing zeros, so the shift is exact
+			__m256i carry = _mm256_srli_epi32(p[h], 31);
+			__m256i mp = _mm256_srlv_epi32(p[h], carry);
+			r[h] = add_triples(np[h], _mm256_add_epi32(sp[h], carry), mp, ncw[h], scw[h], _mm256_slli_epi32(mcw[h], 15));
+		}
+		__m256i nar = _mm256_or_si256(_mm256_or_si256(isnar(a), isnar(b)), isnar(c));
+		return _mm256_blendv_epi8(narrow(r[0], r[1]), _mm256_set1_epi16(short(K::nar)), nar);
+	}
+
+	// fused dot product: 32-bit digits of the exact products accumulated in 64-bit lanes, which absorb 2^31 carries
+	static constexpr int dot_digits = (K::dot_bias + 2 * K::maxscale + 2 + 31) / 32;
+	static constexpr size_t dot_flush = size_t(1) << 24;   // products per lane between folds into the accumulator
+
+	// accumulate the digits of 4 exact products: product bits, bit position of the product lsb, and sign mask
+	static inline void accumulate(__m256i (&digits)[dot_digits], __m256i p, __m256i pos, __m256i neg) {
+		const __m256i mask = _mm256_set1_epi64x(0xFFFFFFFF);
+		for (int j = 0; j < dot_digits; ++j) {
+			// the count is pos - 32j: one of the two shifts sees a count that is negative, or too large, and returns 0
+			__m256i c = _mm256_sub_epi64(pos, _mm256_set1_epi64x(32 * j));
+			__m256i d = _mm256_or_si256(_mm256_sllv_epi64(p, c), _mm256_srlv_epi64(p, _mm256_sub_epi64(_mm256_setzero_si256(), c)));
+			d = _mm256_and_si256(d, mask);
+			digits[j] = _mm256_add_epi64(digits[j], _mm256_sub_epi64(_mm256_xor_si256(d, neg), neg));
+		}
+	}
+
+	// add the digit sums into the two's complement accumulator of the scalar kernels and clear them
+	static inline void fold(uint64_t (&acc)[K::dot_limbs], __m256i (&digits)[dot_digits]) {
+		for (int j = 0; j < dot_digits; ++j) {
+			alignas(32) int64_t v[4];
+			_mm256_store_si256(reinterpret_cast<__m256i*>(v), digits[j]);
+			digits[j] = _mm256_setzero_si256();
+			for (int l = 0; l < 4; ++l) {
+				int limb = (32 * j) / 64;
+				int offset = (32 * j) % 64;
+				uint64_t fill = v[l] < 0 ? ~uint64_t(0) : 0;
+				uint64_t carry = 0;
+				for (int i = limb; i < K::dot_limbs; ++i) {
+					uint64_t t;
+					if (i == limb) t = uint64_t(v[l]) << offset;
+					else if (i == limb + 1 && offset != 0) t = uint64_t(v[l] >> (64 - offset));
+					else t = fill;
+					uint64_t s = acc[i] + t;
+					uint64_t c1 = (s < t) ? 1 : 0;
+					acc[i] = s + carry;
+					carry = c1 + ((acc[i] < carry) ? 1 : 0);
+				}
+			}
+		}
+	}
+
+	static inline void dot(__m256i (&digits)[dot_digits], __m256i a, __m256i b) {
+		__m256i na, sa, ma, nb, sb, mb;
+		decode(a, na, sa, ma);
+		decode(b, nb, sb, mb);
+		__m256i zero = _mm256_setzero_si256();
+		__m256i plo = _mm256_mullo_epi16(ma, mb), phi = _mm256_mulhi_epu16(ma, mb);
+		__m256i pzero = _mm256_or_si256(_mm256_cmpeq_epi16(ma, zero), _mm256_cmpeq_epi16(mb, zero));
+		// the lsb of the right-aligned product of the fbits + 1 bit significands has weight 2^(sa + sb - 2 * fbits)
+		__m256i pos16 = _mm256_add_epi16(_mm256_add_epi16(sa, sb), _mm256_set1_epi16(short(K::dot_bias - 2 * K::fbits)));
+		pos16 = _mm256_andnot_si256(pzero, pos16);
+		__m256i p[2] = { _mm256_unpacklo_epi16(plo, phi), _mm256_unpackhi_epi16(plo, phi) };
+		__m256i pos[2], neg[2];
+		widen(pos16, pos[0], pos[1]);
+		widen_signed(_mm256_xor_si256(na, nb), neg[0], neg[1]);
+		for (int h = 0; h < 2; ++h) {
+			__m256i q = _mm256_srli_epi32(p[h], 30 - 2 * K::fbits);
+			for (int quarter = 0; quarter < 2; ++quarter) {
+				__m128i q128 = quarter ? _mm256_extracti128_si256(q, 1) : _mm256_castsi256_si128(q);
+				__m128i pos128 = quarter ? _mm256_extracti128_si256(pos[h], 1) : _mm256_castsi256_si128(pos[h]);
+				__m128i neg128 = quarter ? _mm256_extracti128_si256(neg[h], 1) : _mm256_castsi256_si128(neg[h]);
+				accumulate(digits, _mm256_cvtepu32_epi64(q128), _mm256_cvtepu32_epi64(pos128), _mm256_cvtepi32_epi64(neg128));
+			}
+		}
+	}
+
+	// load 16 encodings of posits
+	static inline __m256i load(const posit<nbits, es>* x) {
+		alignas(32) uint16_t v[lanes];
+		for (size_t j = 0; j < lanes; ++j) v[j] = uint16_t(x[j].encoding());
+		return _mm256_load_si256(reinterpret_cast<const __m256i*>(v));
+	}
+	static inline void store(__m256i r, posit<nbits, es>* y) {
+		alignas(32) uint16_t v[lanes];
+		_mm256_store_si256(reinterpret_cast<__m256i*>(v), r);
+		for (size_t j = 0; j < lanes; ++j) y[j].set_raw_bits(v[j]);
+	}
+};
+#endif // POSIT_BATCH_AVX2
+
+// c[i] = a[i] + b[i] for i in [0, n)
+template<size_t nbits, size_t es>
+void batch_add(const posit<nbits, es>* a, const posit<nbits, es>* b, posit<nbits, es>* c, size_t n) {
+	using K = posit_batch_kernels<nbits, es>;
+	size_t i = 0;
+#if POSIT_BATCH_AVX2
+	using V = posit_batch_avx2<nbits, es>;
+	for (const size_t nv = n - n % V::lanes; i < nv; i += V::lanes) V::store(V::add(V::load(a + i), V::load(b + i)), c + i);
+#endif
+	for (; i < n; ++i) {
+		c[i].set_raw_bits(K::add(uint32_t(a[i].encoding()), uint32_t(b[i].encoding())));
+	}
+}
+
+// c[i] = a[i] * b[i] for i in [0, n)
+template<size_t nbits, size_t es>
+void batch_mul(const posit<nbits, es>* a, const posit<nbits, es>* b, posit<nbits, es>* c, size_t n) {
+	using K = posit_batch_kernels<nbits, es>;
+	size_t i = 0;
+#if POSIT_BATCH_AVX2
+	using V = posit_batch_avx2<nbits, es>;
+	for (const size_t nv = n - n % V::lanes; i < nv; i += V::lanes) V::store(V::mul(V::load(a + i), V::load(b + i)), c + i);
+#endif
+	for (; i < n; ++i) {
+		c[i].set_raw_bits(K::mul(uint32_t(a[i].encoding()), uint32_t(b[i].encoding())));
+	}
+}
+
+// d[i] = a[i] * b[i] + c[i] for i in [0, n), with a single rounding step
+template<size_t nbits, size_t es>
+void batch_fma(const posit<nbits, es>* a, const posit<nbits, es>* b, const posit<nbits, es>* c, posit<nbits, es>* d, size_t n) {
+	using K = posit_batch_kernels<nbits, es>;
+	size_t i = 0;
+#if POSIT_BATCH_AVX2
+	using V = posit_batch_avx2<nbits, es>;
+	for (const size_t nv = n - n % V::lanes; i < nv; i += V::lanes) V::store(V::fma(V::load(a + i), V::load(b + i), V::load(c + i)), d + i);
+#endif
+	for (; i < n; ++i) {
+		d[i].set_raw_bits(K::fma(uint32_t(a[i].encoding()), uint32_t(b[i].encoding()), uint32_t(c[i].encoding())));
+	}
+}
+
+// fused dot product of a[0, n) and b[0, n): the products are accumulated exactly and rounded once
+template<size_t nbits, size_t es>
+posit<nbits, es> batch_dot(const posit<nbits, es>* a, const posit<nbits, es>* b, size_t n) {
+	using K = posit_batch_kernels<nbits, es>;
+	posit<nbits, es> result;
+	uint64_t acc[K::dot_limbs] = {};
+	size_t i = 0;
+#if POSIT_BATCH_AVX2
+	using V = posit_batch_avx2<nbits, es>;
+	__m256i digits[V::dot_digits];
+	for (int j = 0; j < V::dot_digits; ++j) digits[j] = _mm256_setzero_si256();
+	size_t products = 0;
+	for (const size_t nv = n - n % V::lanes; i < nv; i += V::lanes) {
+		__m256i x = V::load(a + i), y = V::load(b + i);
+		if (!_mm256_testz_si256(_mm256_or_si256(V::isnar(x), V::isnar(y)), _mm256_set1_epi8(-1))) {
+			result.setnar();
+			return result;
+		}
+		V::dot(digits, x, y);
+		products += V::lanes / 4;
+		if (products >= V::dot_flush) {
+			V::fold(acc, digits);
+			products = 0;
+		}
+	}
+	V::fold(acc, digits);
+#endif
+	for (; i < n; ++i) {
+		uint32_t x = uint32_t(a[i].encoding()), y = uint32_t(b[i].encoding());
+		if (x == K::nar || y == K::nar) {
+			result.setnar();
+			return result;
+		}
+		K::accumulate(acc, x, y);
+	}
+	result.set_raw_bits(K::round(acc));
+	return result;
+}
+
+}} // namespace sw::unum
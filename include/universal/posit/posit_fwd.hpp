@@ -20,6 +20,9 @@ namespace sw { namespace unum {
 	template<size_t nbits, size_t es> constexpr posit<nbits, es>  maxpos();
 	template<size_t nbits, size_t es, size_t fbits> posit<nbits, es>& convert(const value<fbits>&, posit<nbits, es>&);
 
+	// array versions of the elementary functions, specialized for posits in math/elementary_kernels.hpp
+	template<typename Scalar> struct elementary_batch;
+
 	// quire types
 	template<size_t nbits, size_t es, size_t capacity> class quire;
 	template<size_t nbits, size_t es, size_t capacity> value<2 * (nbits - 2 - es)> quire_mul(const posit<nbits, es>&, const posit<nbits, es>&);
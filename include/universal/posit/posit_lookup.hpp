@@ -0,0 +1,118 @@
+#pragma once
+// posit_lookup.hpp: table-driven arithmetic engine for small posit configurations
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <vector>
+#include <type_traits>
+
+// POSIT_FAST_LOOKUP_ARITHMETIC when set to 1 will replace the add, subtract, multiply, and divide
+// of all posit<nbits, es> configurations with nbits <= POSIT_LOOKUP_MAX_NBITS by table lookups.
+// The tables are generated on first use with the reference arithmetic, so they are exact by construction.
+// A table has 2^(2*nbits) entries, which is 2MB per operator for a 10-bit posit.
+#ifndef POSIT_FAST_LOOKUP_ARITHMETIC
+#define POSIT_FAST_LOOKUP_ARITHMETIC 0
+#endif
+#ifndef POSIT_LOOKUP_MAX_NBITS
+#define POSIT_LOOKUP_MAX_NBITS 10
+#endif
+
+namespace sw { namespace unum {
+
+// lookup tables for the binary arithmetic operators of a posit<nbits, es>
+// the result of (a op b) is found at index (a.encoding() << nbits) | b.encoding()
+template<size_t nbits, size_t es>
+class posit_lookup {
+public:
+	static_assert(nbits <= 16, "posit_lookup: table size for nbits > 16 is prohibitive");
+	using encoding_type = typename std::conditional<(nbits <= 8), uint8_t, uint16_t>::type;
+	static constexpr size_t index_shift = nbits;
+	static constexpr size_t nrEncodings = size_t(1) << nbits;
+
+	static encoding_type add(uint64_t a, uint64_t b) {
+		static const std::vector<encoding_type> table = generate(ADD);
+		return table[(a << index_shift) | b];
+	}
+	static encoding_type sub(uint64_t a, uint64_t b) {
+		static const std::vector<encoding_type> table = generate(SUB);
+		return table[(a << index_shift) | b];
+	}
+	static encoding_type mul(uint64_t a, uint64_t b) {
+		static const std::vector<encoding_type> table = generate(MUL);
+		return table[(a << index_shift) | b];
+	}
+	static encoding_type div(uint64_t a, uint64_t b) {
+		static const std::vector<encoding_type> table = generate(DIV);
+		return table[(a << index_shift) | b];
+	}
+
+private:
+	enum arithmetic_operator { ADD, SUB, MUL, DIV };
+
+	// the table entries are computed with the same arithmetic modules as the reference posit operators,
+	// special cases encode the non-throwing behavior: the operators check for exceptions before the lookup
+	static std::vector<encoding_type> generate(arithmetic_operator op) {
+		using Posit = posit<nbits, es>;
+		constexpr size_t fbits = Posit::fbits;
+		constexpr size_t abits = Posit::abits;
+		constexpr size_t mbits = Posit::mbits;
+		constexpr size_t divbits = Posit::divbits;
+		std::vector<encoding_type> table(nrEncodings * nrEncodings);
+		Posit a, b, c;
+		for (size_t i = 0; i < nrEncodings; ++i) {
+			a.set_raw_bits(i);
+			value<fbits> va = a.to_value();
+			for (size_t j = 0; j < nrEncodings; ++j) {
+				b.set_raw_bits(j);
+				value<fbits> vb = b.to_value();
+				c.setzero();
+				if (a.isnar() || b.isnar()) {
+					c.setnar();
+				}
+				else {
+					switch (op) {
+					case ADD:
+						if (a.iszero()) c = b;
+						else if (b.iszero()) c = a;
+						else {
+							value<abits + 1> sum;
+							module_add<fbits, abits>(va, vb, sum);
+							if (sum.isinf()) c.setnar(); else if (!sum.iszero()) convert(sum, c);
+						}
+						break;
+					case SUB:
+						if (a.iszero()) c = -b;
+						else if (b.iszero()) c = a;
+						else {
+							value<abits + 1> difference;
+							module_subtract<fbits, abits>(va, vb, difference);
+							if (difference.isinf()) c.setnar(); else if (!difference.iszero()) convert(difference, c);
+						}
+						break;
+					case MUL:
+						if (!a.iszero() && !b.iszero()) {
+							value<mbits> product;
+							module_multiply(va, vb, product);
+							if (product.isinf()) c.setnar(); else if (!product.iszero()) convert(product, c);
+						}
+						break;
+					case DIV:
+						if (b.iszero()) c.setnar();
+						else if (!a.iszero()) {
+							value<divbits> ratio;
+							module_divide(va, vb, ratio);
+							if (ratio.isinf()) c.setnar(); else if (!ratio.iszero()) convert<nbits, es, divbits>(ratio, c);
+						}
+						break;
+					}
+				}
+				table[(i << index_shift) | j] = encoding_type(c.encoding());
+			}
+		}
+		return table;
+	}
+};
+
+}} // namespace sw::unum
@@ -105,9 +105,13 @@ public:
 	// the upper is 1 bit bigger than the lower because maxpos^2 has that scale
 	static constexpr size_t upper_range = half_range + 1;     // size of the upper accumulator
 	static constexpr size_t qbits = range + capacity;		  // size of the quire minus the sign bit: we are managing the sign explicitly
+	// the lower, upper, and capacity segments are stored contiguously in 64-bit limbs, least significant limb first
+	static constexpr size_t nrBits = half_range + upper_range + capacity;
+	static constexpr size_t nrLimbs = (nrBits + 63) / 64;
+	static constexpr uint64_t topMask = (nrBits % 64) ? ((uint64_t(1) << (nrBits % 64)) - 1) : ~uint64_t(0);
 	
 	// Constructors
-	quire() : _sign(false) { _capacity.reset(); _upper.reset(); _lower.reset(); }
+	quire() : _sign(false) { clear_limbs(); }
 
 	quire(int8_t initial_value)   { *this = initial_value; }
 	quire(int16_t initial_value)  { *this = initial_value; }
@@ -138,32 +142,11 @@ public:
 		if (scale >  int(half_range)) 	throw operand_too_large_for_quire{};
 		if (scale < -int(half_range)) 	throw operand_too_small_for_quire{};
 
-		int i, f; // running bit pointers, i for the quire, f for the incoming fraction
-		sw::unum::bitblock<fbits+1> fraction = rhs.get_fixed_point();
-		// divide bits between upper and lower accumulator
-		if (scale - int(fbits) >= 0) {
-			// all upper accumulator
-			for (i = scale, f = int(fbits); i >= 0 && f >= 0; i--, f--) {
-				_upper[static_cast<size_t>(i)] = fraction[static_cast<size_t>(f)];
-			}
-		}
-		else if (scale < 0) {
-			// all lower accumulator
-			for (i = int(half_range) + scale, f = int(fbits); i >= 0 && f >= 0; i--, f--) {
-				_lower[static_cast<size_t>(i)] = fraction[static_cast<size_t>(f)];
-			}
-		}
-		else {
-			// part upper, and part lower accumulator
-			// first assign the bits in the upper accumulator
-			for (i = scale, f = int(fbits); i >= 0 && f >= 0; i--, f--) {
-				_upper[static_cast<size_t>(i)] = fraction[static_cast<size_t>(f)];
-			}
-			// next assign the bits in the lower accumulator
-			for (i = int(half_range) - 1; i >= 0 && f >= 0; i--, f--) {
-				_lower[static_cast<size_t>(i)] = fraction[static_cast<size_t>(f)];
-			}
-		}
+		constexpr size_t alignedLimbs = (fbits + 64) / 64 + 1;
+		uint64_t addend[alignedLimbs];
+		size_t first = align_fixed_point(rhs, addend);
+		for (size_t i = 0; i < alignedLimbs && first + i < nrLimbs; ++i) _limbs[first + i] = addend[i];
+		_limbs[nrLimbs - 1] &= topMask;
 		return *this;
 	}
 	quire& operator=(const posit<nbits, es>& rhs) {
@@ -188,47 +171,12 @@ public:
 		_sign = rhs & 0x8000000000000000;
 		unsigned long long magnitude;
 		magnitude = static_cast<unsigned long long>(_sign ? -rhs : rhs);
-		unsigned msb = findMostSignificantBit(magnitude);
-		if (msb > half_range + capacity) {
-			throw operand_too_large_for_quire{};
-		}
-		else {
-			// copy the value into the quire
-			unsigned i, c;
-			uint64_t mask = uint64_t(1);
-			for (i = 0; i < msb && i < half_range; i++) {
-				_upper[i] = magnitude & mask;
-				mask <<= 1;
-			}
-			if (msb >= half_range) {
-				for (i = half_range, c = 0; i < msb && i < half_range + capacity; i++, c++) {
-					_capacity[c] = magnitude & mask;
-					mask <<= 1;
-				}
-			}
-		}
+		assign_integer(magnitude);
 		return *this;
 	}
 	quire& operator=(unsigned long long rhs) {
 		reset();
-		unsigned msb = findMostSignificantBit(rhs);
-		if (msb > half_range + capacity) {
-			throw operand_too_large_for_quire{};
-		}
-		else {
-			// copy the value into the quire
-			uint64_t mask = uint64_t(1);
-			for (unsigned i = 0; i < msb && i < half_range; i++) {
-				_upper[i] = rhs & mask;
-				mask <<= 1;
-			}
-			if (msb >= half_range) {
-				for (unsigned i = half_range, c = 0; i < msb && i < half_range + capacity; i++, c++) {
-					_capacity[c] = rhs & mask;
-					mask <<= 1;
-				}
-			}
-		}
+		assign_integer(rhs);
 		return *this;
 	}
 	quire& operator=(float rhs) {
@@ -260,36 +208,13 @@ public:
 		if (rhs.scale() < -int(half_range)) {
 			throw operand_too_small_for_quire{};
 		}
-		// sign/magnitude classification
-		// operation      add magnitudes           subtract magnitudes
-		//                                     a < b       a = b      a > b
-		// (+a) + (+b)      +(a + b)
-		// (+a) + (-b)                       -(b - a)    +(a - b)   +(a - b)
-		// (-a) + (+b)                       +(b - a)    +(a - b)   -(a - b)
-		// (-a) + (-b)      -(a + b)
-		if (_sign == rhs.sign()) {
-			add_value(rhs);
-			// _sign stays the same, so nothing new to assign
-		}
-		else {
-			// subtract magnitudes
-			int cmp = CompareMagnitude(rhs);
-			if (cmp < 0) {
-				// TODO: is there a way to NOT have to swap the whole quire?
-				value<qbits> subtractend = this->to_value();
-				*this = rhs;
-				subtract_value(subtractend);
-				_sign = rhs.sign();
-			}
-			else if (cmp > 0) {
-				subtract_value(rhs);
-				// _sign stays the same
-			}
-			else {
-				subtract_value(rhs);
-				_sign = false;
-			}
-		}
+		// align the fixed-point representation of the value with the limbs of the quire
+		constexpr size_t alignedLimbs = (fbits + 64) / 64 + 1;
+		uint64_t addend[alignedLimbs];
+		size_t first = align_fixed_point(rhs, addend);
+		size_t count = (first + alignedLimbs < nrLimbs) ? alignedLimbs : nrLimbs - first;
+
+		accumulate(rhs.sign(), addend, first, count);
 		return *this;
 	}
 	// Subtract a normalized value from the quire value
@@ -307,6 +232,73 @@ public:
 		return operator-=(rhs.to_value());
 	}
 
+	// fused multiply-accumulate: q += a * b
+	// For posits up to 32 bits the product of the significands fits in a native 64-bit word, 
+	// so the operands are decoded straight from their encodings and the exact product is
+	// added into the limbs without creating value<> intermediates. Wider posits form the exact
+	// product of their significands with 32-bit limb arithmetic.
+	quire& fma(const posit<nbits, es>& a, const posit<nbits, es>& b) {
+		if constexpr (nbits <= 32 && nbits >= es + 3) {
+			if (a.isnar() || b.isnar()) throw operand_is_nar{};
+			if (a.iszero() || b.iszero()) return *this;
+			constexpr int fbits = int(nbits) - 3 - int(es);   // maximum number of fraction bits
+			bool asign, bsign;
+			int ascale, bscale;
+			uint64_t asignificand, bsignificand;
+			decode_posit(a.encoding(), asign, ascale, asignificand);
+			decode_posit(b.encoding(), bsign, bscale, bsignificand);
+			uint64_t product = asignificand * bsignificand;  // exact: at most 2 * (fbits + 1) bits
+			int lsb = int(half_range) + ascale + bscale - 2 * fbits;  // position of the lsb of the product in the quire
+			if (lsb < 0) {
+				// truncate the bits that fall below the lsb of the quire
+				product = (-lsb < 64) ? (product >> -lsb) : 0;
+				lsb = 0;
+			}
+			uint64_t addend[2];
+			int bitShift = lsb & 0x3F;
+			addend[0] = product << bitShift;
+			addend[1] = bitShift ? (product >> (64 - bitShift)) : 0;
+			size_t first = size_t(lsb >> 6);
+			size_t count = (first + 2 < nrLimbs) ? 2 : nrLimbs - first;
+			accumulate(asign != bsign, addend, first, count);
+			return *this;
+		}
+		else if constexpr (nbits >= es + 3) {
+			// wider posits multiply their significands as 32-bit limbs
+			if (a.isnar() || b.isnar()) throw operand_is_nar{};
+			if (a.iszero() || b.iszero()) return *this;
+			constexpr size_t fbits = nbits - 3 - es;
+			constexpr size_t sigLimbs = (fbits + 32) / 32;   // 32-bit limbs of the fraction plus hidden bit
+			constexpr size_t productLimbs = sigLimbs;        // 64-bit limbs of the product
+			value<fbits> va = a.to_value();
+			value<fbits> vb = b.to_value();
+			uint32_t asig[sigLimbs], bsig[sigLimbs];
+			significand_limbs(va, asig);
+			significand_limbs(vb, bsig);
+			uint32_t product32[2 * sigLimbs] = { 0 };
+			for (size_t i = 0; i < sigLimbs; ++i) {
+				uint64_t carry = 0;
+				for (size_t j = 0; j < sigLimbs; ++j) {
+					uint64_t t = uint64_t(asig[i]) * bsig[j] + product32[i + j] + carry;
+					product32[i + j] = uint32_t(t);
+					carry = t >> 32;
+				}
+				product32[i + sigLimbs] = uint32_t(carry);
+			}
+			uint64_t product[productLimbs];
+			for (size_t i = 0; i < productLimbs; ++i) product[i] = uint64_t(product32[2 * i]) | (uint64_t(product32[2 * i + 1]) << 32);
+			int lsb = int(half_range) + va.scale() + vb.scale() - 2 * int(fbits);  // position of the lsb of the product in the quire
+			uint64_t addend[productLimbs + 1];
+			size_t first = align_limbs<productLimbs>(product, lsb, addend);
+			size_t count = (first + productLimbs + 1 < nrLimbs) ? productLimbs + 1 : nrLimbs - first;
+			accumulate(va.sign() != vb.sign(), addend, first, count);
+			return *this;
+		}
+		else {
+			return *this += quire_mul(a, b);
+		}
+	}
+
 	// add two quires
 	quire& operator+=(const quire& q) {
 		return operator+=(q.to_value());
@@ -318,9 +310,7 @@ public:
 	
 	// bit addressing operator
 	bool operator[](int index) const {
-		if (index < int(radix_point)) return _lower[static_cast<size_t>(index)];
-		if (index < int(radix_point) + int(upper_range)) return _upper[static_cast<size_t>(index - int(radix_point))];
-		if (index < int(radix_point) + int(upper_range) + int(capacity)) return _capacity[static_cast<size_t>(index - int(radix_point) - int(upper_range))];
+		if (index < int(nrBits)) return test(size_t(index));
 		throw "index out of range";
 	}
 
@@ -330,9 +320,7 @@ public:
 	// reset the state of a quire to zero
 	void reset() {
 		_sign = false;
-		_lower.reset();
-		_upper.reset();
-		_capacity.reset();
+		clear_limbs();
 	}
 	// semantic sugar: clear the state of a quire to zero
 	void clear() { reset(); }
@@ -370,33 +358,18 @@ public:
 				if (msb_u != -1) return false; // fail, incorrect format
 				segment = 2;
 			}
-			else if (*it == '1') {
-				switch (segment) {
-				case 0:
-					_capacity.set(msb_c--);
-					break;
-				case 1:
-					_upper.set(msb_u--);
-					break;
-				case 2:
-					if (msb_l < 0) return false; // fail, incorrect format
-					_lower.set(msb_l--);
-					break;
-				default:
-					return false; // fail, incorrect state
-				}
-			}
 			else {
+				bool bit = (*it == '1');
 				switch (segment) {
 				case 0:
-					_capacity.reset(msb_c--);
+					setbit(half_range + upper_range + size_t(msb_c--), bit);
 					break;
 				case 1:
-					_upper.reset(msb_u--);
+					setbit(half_range + size_t(msb_u--), bit);
 					break;
 				case 2:
 					if (msb_l < 0) return false; // fail, incorrect format
-					_lower.reset(msb_l--);
+					setbit(size_t(msb_l--), bit);
 					break;
 				default:
 					return false; // fail, incorrect state
@@ -410,18 +383,14 @@ public:
 	
 	// Compare magnitudes between quire and value: returns -1 if q < v, 0 if q == v, and 1 if q > v
 	template<size_t fbits>
-	int CompareMagnitude(const value<fbits>& v) {
-		// inefficient as we are copying a whole quire just to reset the sign bit, but we are leveraging the comparison logic
-		quire<nbits, es, capacity> absq = abs(*this);
-		//value<qbits> absq = abs(*this);
-		value<fbits> absv = abs(v);
-		if (absq < absv) {
-			return -1;
-		}
-		else if (absq > absv) {
-			return 1;
-		}
-		return 0;
+	int CompareMagnitude(const value<fbits>& v) const {
+		if (v.iszero()) return iszero() ? 0 : 1;
+		if (v.scale() > int(half_range)) return -1;
+		constexpr size_t alignedLimbs = (fbits + 64) / 64 + 1;
+		uint64_t addend[alignedLimbs];
+		size_t first = align_fixed_point(v, addend);
+		size_t count = (first + alignedLimbs < nrLimbs) ? alignedLimbs : nrLimbs - first;
+		return compare_limbs(addend, first, count);
 	}
 	// query functions for quire attributes
 	inline int dynamic_range() const { return int(range); }
@@ -431,21 +400,13 @@ public:
 	inline size_t total_bits() const { return qbits + 1; }
 	inline bool isneg() const { return _sign; }
 	inline bool ispos() const { return _sign; }
-	inline bool iszero() const { return _capacity.none() && _upper.none() && _lower.none(); }
+	inline bool iszero() const {
+		for (size_t i = 0; i < nrLimbs; ++i) if (_limbs[i]) return false;
+		return true;
+	}
+	// scale of the most significant bit: a quire that is zero returns -half_range - 1
 	int scale() const {
-		int msb = int(capacity)-1; // indicative of no bits set
-		for (; msb >= 0; msb--) {
-			if (_capacity.test(static_cast<size_t>(msb))) break;
-		}
-		if (msb >= 0) return msb + int(upper_range);
-		for (msb = int(upper_range) - 1; msb >= 0; msb--) {
-			if (_upper.test(static_cast<size_t>(msb))) break;
-		}
-		if (msb >= 0) return msb;
-		for (int i = int(half_range) - 1; i >= 0; i--, msb--) {
-			if (_lower.test(static_cast<size_t>(i))) break;
-		}
-		return msb;
+		return msb() - int(half_range);
 	}
 
 	// Return value of the sign bit: true indicates a negative number, false a positive number or zero
@@ -453,304 +414,239 @@ public:
 	inline float sign_value() const {	return (_sign ? -1.0 : 1.0); }
 	bitblock<qbits+1> get() const {
 		bitblock<qbits+1> q;
-		int msb = 0;
-		for (int i = 0; i < half_range; i++) {
-			q[msb] = _lower[i];
-			msb++;
-		}
-		for (int i = 0; i < upper_range; i++) {
-			q[msb] = _upper[i];
-			msb++;
-		}
-		for (int i = 0; i < capacity; i++) {
-			q[msb] = _capacity[i];
-			msb++;
-		}
+		for (size_t i = 0; i < nrBits; ++i) q[i] = test(i);
 		return q;
 	}
 	value<qbits> to_value() const {
 		// find the MSB and build the fraction
 		bitblock<qbits> fraction;
-		bool isZero = false;
-		bool isNaR = false;   // TODO
-		int i;
-		int qbit = int(qbits);
-		int fbit = qbit - 1;
-		int scale = qbits;
-		for (i = int(capacity) - 1; i >= 0; i--, qbit--) {
-			if (scale == qbits) {
-				if (_capacity.test(static_cast<size_t>(i))) scale = qbit - int(half_range);
-			}
-			else {
-				fraction[static_cast<size_t>(fbit)] = _capacity[static_cast<size_t>(i)];
-				--fbit;
-			}
-		}
-		for (i = int(upper_range) - 1; i >= 0; i--, qbit--) {
-			if (scale == qbits) {
-				if (_upper.test(static_cast<size_t>(i))) scale = qbit - int(half_range);
-			}
-			else {
-				fraction[static_cast<size_t>(fbit)] = _upper[static_cast<size_t>(i)];
-				--fbit;
-			}
-		}
-		for (i = int(half_range) - 1; i >= 0; i--, qbit--) {
-			if (scale == qbits) {
-				if (_lower.test(static_cast<size_t>(i))) scale = qbit - int(half_range);
-			}
-			else {
-				fraction[static_cast<size_t>(fbit)] = _lower[static_cast<size_t>(i)];
-				--fbit;
-			}
+		int msbit = msb();
+		if (msbit < 0) return value<qbits>(_sign, 0, fraction, true, false);
+		// the bits below the msb become the fraction, msb aligned
+		for (int i = msbit - 1, f = int(qbits) - 1; i >= 0; --i, --f) {
+			fraction[static_cast<size_t>(f)] = test(static_cast<size_t>(i));
 		}
-		if (scale == qbits) {
-			isZero = true;
-			scale = 0;
+		return value<qbits>(_sign, msbit - int(half_range), fraction, false, false);
+	}
+	// the quire value truncated to fbits fraction bits with the bits below jammed into the lsb:
+	// with fbits at least two more than the fraction of the target posit it rounds the same as to_value()
+	// without building the full-width value
+	template<size_t fbits>
+	value<fbits> sticky_value() const {
+		bitblock<fbits> fraction;
+		int msbit = msb();
+		if (msbit < 0) return value<fbits>(_sign, 0, fraction, true, false);
+		int i = msbit - 1;
+		for (int f = int(fbits) - 1; f >= 0 && i >= 0; --f, --i) {
+			fraction[static_cast<size_t>(f)] = test(static_cast<size_t>(i));
 		}
-		return value<qbits>(_sign, scale, fraction, isZero, isNaR);
+		if (anyAfter(i)) fraction[0] = true;
+		return value<fbits>(_sign, msbit - int(half_range), fraction, false, false);
 	}
 	bool anyAfter(int index) const {
-		for (int i = index; i >= 0; i--) {
-			if (this->operator[](i)) return true;
-		}
+		if (index < 0) return false;
+		if (index >= int(nrBits)) index = int(nrBits) - 1;
+		size_t limb = size_t(index) >> 6;
+		uint64_t mask = (index & 0x3F) == 0x3F ? ~uint64_t(0) : ((uint64_t(1) << ((index & 0x3F) + 1)) - 1);
+		if (_limbs[limb] & mask) return true;
+		for (size_t i = 0; i < limb; ++i) if (_limbs[i]) return true;
 		return false;
 	}
 
 private:
 	bool				   _sign;
-	// segmented accumulator to demonstrate potential hw concurrency for high performance quires
-	bitblock<half_range>   _lower;
-	bitblock<upper_range>  _upper;
-	bitblock<capacity>     _capacity;
+	// contiguous accumulator: bit 0 is the lsb of the lower segment, the radix point sits at bit half_range
+	uint64_t               _limbs[nrLimbs];
 
-	// add a value to the quire
-	template<size_t fbits>
-	void add_value(const value<fbits>& v) {
-		if (v.iszero()) return;
-		// scale is the location of the msb in the fixed point representation
-		// so scale  =  0 is the hidden bit at location 0, scale 1 = bit 1, etc.
-		// and scale = -1 is the first bit of the fraction
-		// we manage scale >= 0 in the _upper accumulator, and scale < 0 in the _lower accumulator
-		int lsb = v.scale() - static_cast<int>(fbits);
-		bool carry = false;
-		bitblock<fbits + 1> fraction = v.get_fixed_point();
-		int i, f;  // bit pointers, i pointing to the quire bits, f pointing to the fraction bits of rhs
-		// divide bits between upper and lower accumulator
-		if (v.scale() < 0) {		// all lower accumulator
-			lsb = int(half_range) + v.scale() - int(fbits); /// TODO: double check this fix works
-			int qlsb = lsb > 0 ? lsb : 0;
-			int flsb = lsb >= 0 ? 0 : -lsb;
-			for (i = qlsb, f = flsb; i < int(half_range) && f <= static_cast<int>(fbits); i++, f++) {
-				bool _a = _lower[static_cast<size_t>(i)];
-				bool _b = fraction[static_cast<size_t>(f)];
-				_lower[static_cast<size_t>(i)] = _a ^ _b ^ carry;
-				carry = (_a & _b) | (carry & (_a ^ _b));
-			}
-			// propagate any carries to the end of the lower accumulator
-			while (carry && i < int(half_range)) {
-				bool _a = _lower[static_cast<size_t>(i)];
-				_lower[static_cast<size_t>(i)] = _a ^ carry;
-				carry = carry & _a;
-				i++;
-			}
-			if (carry) {  // carry propagate to the _upper accumulator
-						  // need to increment the _upper
-				i = 0;
-				while (carry && i < int(upper_range)) {
-					bool _a = _upper[static_cast<size_t>(i)];
-					_upper[static_cast<size_t>(i)] = _a ^ carry;
-					carry = carry & _a;
-					i++;
-				}
-				if (carry) {
-					// next add the bits to the capacity segment
-					i = 0;
-					while (carry && i < int(capacity)) {
-						bool _a = _capacity[static_cast<size_t>(i)];
-						_capacity[static_cast<size_t>(i)] = _a ^ carry;
-						carry = carry & _a;
-						i++;
-					}
-				}
-			}
+	inline bool test(size_t i) const { return bool((_limbs[i >> 6] >> (i & 0x3F)) & 0x1); }
+	inline void setbit(size_t i, bool v) {
+		uint64_t mask = uint64_t(1) << (i & 0x3F);
+		if (v) _limbs[i >> 6] |= mask; else _limbs[i >> 6] &= ~mask;
+	}
+	inline void clear_limbs() {
+		for (size_t i = 0; i < nrLimbs; ++i) _limbs[i] = 0;
+	}
+	// index of the most significant bit that is set, -1 if the quire is zero
+	int msb() const {
+		for (size_t i = nrLimbs; i-- > 0; ) {
+			if (_limbs[i]) return int(i * 64) + 63 - countLeadingZeros(_limbs[i]);
 		}
-		else if (lsb >= 0) {	// all upper accumulator
-			int upper_bound = v.scale();
-			for (i = lsb, f = 0; i <= upper_bound && f <= static_cast<int>(fbits); i++, f++) {
-				bool _a = _upper[static_cast<size_t>(i)];
-				bool _b = fraction[static_cast<size_t>(f)];
-				_upper[static_cast<size_t>(i)] = _a ^ _b ^ carry;
-				carry = (_a & _b) | (carry & (_a ^ _b));
-			}
-			while (carry && i < int(upper_range)) {
-				bool _a = _upper[static_cast<size_t>(i)];
-				_upper[static_cast<size_t>(i)] = _a ^ carry;
-				carry = carry & _a;
-				i++;
-			}
-			if (carry) {
-				// next add the bits to the capacity segment
-				i = 0;
-				while (carry && i < int(capacity)) {
-					bool _a = _capacity[static_cast<size_t>(i)];
-					_capacity[static_cast<size_t>(i)] = _a ^ carry;
-					carry = carry & _a;
-					i++;
-				}
-			}
+		return -1;
+	}
+	// integers are accumulated from the radix point upwards
+	void assign_integer(unsigned long long magnitude) {
+		unsigned msbit = findMostSignificantBit(magnitude);
+		if (msbit > half_range + capacity) {
+			throw operand_too_large_for_quire{};
 		}
-		else {  // lsb < 0 && scale > 0
-				// part upper, and part lower accumulator
-				// first add the lower accumulator component
-			lsb = int(half_range) + lsb; // remember lsb is negative in this block
-			int qlsb = lsb > 0 ? lsb : 0;
-			int flsb = lsb >= 0 ? 0 : -lsb;
-			for (i = qlsb, f = flsb; i < int(half_range) && f <= static_cast<int>(fbits); i++, f++) {
-				bool _a = _lower[static_cast<size_t>(i)];
-				bool _b = fraction[static_cast<size_t>(f)];
-				_lower[static_cast<size_t>(i)] = _a ^ _b ^ carry;
-				carry = (_a & _b) | (carry & (_a ^ _b));
-			}
-			// next add the bits in the upper accumulator
-			for (i = 0; i <= v.scale() && f <= static_cast<int>(fbits); i++, f++) {
-				bool _a = _upper[static_cast<size_t>(i)];
-				bool _b = fraction[static_cast<size_t>(f)];
-				_upper[static_cast<size_t>(i)] = _a ^ _b ^ carry;
-				carry = (_a & _b) | (carry & (_a ^ _b));
-			}
-			// propagate any carries to the end of the upper accumulator
-			while (carry && i < int(upper_range)) {
-				bool _a = _upper[static_cast<size_t>(i)];
-				_upper[static_cast<size_t>(i)] = _a ^ carry;
-				carry = carry & _a;
-				i++;
-			}
-			// next add the bits to the capacity segment
-			if (carry) {
-				i = 0;
-				while (carry && i < int(capacity)) {
-					bool _a = _capacity[static_cast<size_t>(i)];
-					_capacity[static_cast<size_t>(i)] = _a ^ carry;
-					carry = carry & _a;
-					i++;
-				}
-			}
+		for (unsigned i = 0; i < msbit; ++i) {
+			if ((magnitude >> i) & 0x1) setbit(half_range + i, true);
 		}
 	}
 
-	// subtract a value from the quire
+	// align the fixed-point representation of a value with the limbs of the quire: the aligned value
+	// is written into (fbits + 64) / 64 + 1 limbs, and the function returns the index of the quire limb
+	// that corresponds to the first aligned limb. Bits below the lsb of the quire are truncated.
 	template<size_t fbits>
-	void subtract_value(const value<fbits>& v) {
-		if (v.iszero()) return;
-		// lsb in the quire of the lowest bit of the explicit fixed point value including the hidden bit of the fraction
-		int lsb = v.scale() - static_cast<int>(fbits);
-		bool borrow = false;
-		bitblock<fbits + 1> fraction = v.get_fixed_point();
-		int i, f;  // bit pointers, i pointing to the quire bits, f pointing to the fraction bits of rhs
-		// divide bits between upper and lower accumulator
-		if (v.scale() < 0) {		// all lower accumulator
-			lsb = int(half_range) + v.scale() - static_cast<int>(fbits);
-			int qlsb = lsb > 0 ? lsb : 0;
-			int flsb = lsb >= 0 ? 0 : -lsb;
-			for (i = qlsb, f = flsb; i < int(half_range) && f <= static_cast<int>(fbits); i++, f++) {
-				bool _a = _lower[size_t(i)];
-				bool _b = fraction[size_t(f)];
-				_lower[size_t(i)] = _a ^ _b ^ borrow;
-				borrow = (!_a & _b) | (!(!_a ^ !_b) & borrow);
-			}
-			// propagate any borrows to the end of the lower accumulator
-			while (borrow && i < int(half_range)) {
-				bool _a = _lower[size_t(i)];
-				_lower[size_t(i)] = _a ^ borrow;
-				borrow = borrow & !_a;
-				i++;
-			}
-			if (borrow) { // borrow propagate to the _upper accumulator
-						  // need to decrement the _upper
-				i = 0;
-				while (borrow && i < int(upper_range)) {
-					bool _a = _upper[size_t(i)];
-					_upper[size_t(i)] = _a ^ borrow;
-					borrow = borrow & !_a;
-					i++;
-				}
-				if (borrow) {
-					// propagate the borrow into the capacity segment
-					i = 0;
-					while (borrow && i < int(capacity)) {
-						bool _a = _capacity[size_t(i)];
-						_capacity[size_t(i)] = _a ^ borrow;
-						borrow = borrow & !_a;
-						i++;
-					}
-				}
-			}
+	static size_t align_fixed_point(const value<fbits>& v, uint64_t* aligned) {
+		constexpr size_t fixedLimbs = (fbits + 64) / 64;  // limbs of the fraction plus hidden bit
+		uint64_t fixed[fixedLimbs];
+		bitblock<fbits> fraction = v.fraction();
+		if (fbits < 64) {
+			fixed[0] = uint64_t(fraction.to_ullong()) | (uint64_t(1) << (fbits % 64));
 		}
-		else if (lsb >= 0) {	// all upper accumulator
-			int upper_bound = v.scale();
-			for (i = lsb, f = 0; i <= upper_bound && f <= static_cast<int>(fbits); i++, f++) {
-				bool _a = _upper[size_t(i)];
-				bool _b = fraction[size_t(f)];
-				_upper[size_t(i)] = _a ^ _b ^ borrow;
-				borrow = (!_a & _b) | (!(!_a ^ !_b) & borrow);
-			}
-			// propagate any borrows to the end of the upper accumulator
-			while (borrow && i < int(upper_range)) {
-				bool _a = _upper[size_t(i)];
-				_upper[size_t(i)] = _a ^ borrow;
-				borrow = borrow & !_a;
-				i++;
-			}
-			if (borrow) {
-				// propagate the borrow into the capacity segment
-				i = 0;
-				while (borrow && i < int(capacity)) {
-					bool _a = _capacity[size_t(i)];
-					_capacity[size_t(i)] = _a ^ borrow;
-					borrow = borrow & !_a;
-					i++;
+		else {
+			for (size_t i = 0; i < fixedLimbs; ++i) fixed[i] = 0;
+			for (size_t i = 0; i < fbits; ++i) {
+				if (fraction[i]) fixed[i >> 6] |= uint64_t(1) << (i & 0x3F);
+			}
+			fixed[fbits >> 6] |= uint64_t(1) << (fbits & 0x3F);
+		}
+		int lsb = int(half_range) + v.scale() - int(fbits);  // position of the lsb of the fixed-point value in the quire
+		return align_limbs<fixedLimbs>(fixed, lsb, aligned);
+	}
+	// align fixedLimbs limbs whose lsb sits at position lsb of the quire into fixedLimbs + 1 aligned limbs,
+	// and return the index of the quire limb that corresponds to the first aligned limb
+	template<size_t fixedLimbs>
+	static size_t align_limbs(uint64_t* fixed, int lsb, uint64_t* aligned) {
+		if (lsb < 0) {
+			// truncate the bits that fall below the lsb of the quire
+			int wordShift = (-lsb) >> 6;
+			int bitShift = (-lsb) & 0x3F;
+			for (size_t i = 0; i < fixedLimbs; ++i) {
+				size_t src = i + size_t(wordShift);
+				uint64_t w = 0;
+				if (src < fixedLimbs) {
+					w = fixed[src] >> bitShift;
+					if (bitShift && src + 1 < fixedLimbs) w |= fixed[src + 1] << (64 - bitShift);
 				}
+				fixed[i] = w;
 			}
+			lsb = 0;
 		}
-		else {   // lsb < 0 && scale >= 0
-				 // part upper, and part lower accumulator
-				 // first add the lower accumulator component
-			lsb = int(half_range) + lsb; // remember lsb is negative in this block
-			int qlsb = lsb > 0 ? lsb : 0;
-			int flsb = lsb >= 0 ? 0 : -lsb;
-			for (i = qlsb, f = flsb; i < int(half_range) && f <= static_cast<int>(fbits); i++, f++) {
-				bool _a = _lower[size_t(i)];
-				bool _b = fraction[size_t(f)];
-				_lower[size_t(i)] = _a ^ _b ^ borrow;
-				borrow = (!_a & _b) | (!(!_a ^ !_b) & borrow);
-			}
-			// next add the bits in the upper accumulator
-			for (i = 0; i <= v.scale() && f <= static_cast<int>(fbits); i++, f++) {
-				bool _a = _upper[size_t(i)];
-				bool _b = fraction[size_t(f)];
-				_upper[size_t(i)] = _a ^ _b ^ borrow;
-				borrow = (!_a & _b) | (!(!_a ^ !_b) & borrow);
+		int bitShift = lsb & 0x3F;
+		for (size_t i = 0; i <= fixedLimbs; ++i) {
+			uint64_t lo = (i > 0 && bitShift) ? fixed[i - 1] >> (64 - bitShift) : 0;
+			uint64_t hi = (i < fixedLimbs) ? fixed[i] << bitShift : 0;
+			aligned[i] = hi | lo;
+		}
+		return size_t(lsb >> 6);
+	}
+	// the significand of a nonzero value, hidden bit included, as little-endian 32-bit limbs
+	template<size_t fbits>
+	static void significand_limbs(const value<fbits>& v, uint32_t* limbs) {
+		constexpr size_t sigLimbs = (fbits + 32) / 32;
+		for (size_t i = 0; i < sigLimbs; ++i) limbs[i] = 0;
+		bitblock<fbits> fraction = v.fraction();
+		for (size_t i = 0; i < fbits; ++i) {
+			if (fraction[i]) limbs[i >> 5] |= uint32_t(1) << (i & 0x1F);
+		}
+		limbs[fbits >> 5] |= uint32_t(1) << (fbits & 0x1F);
+	}
+	// decode a posit encoding into sign, scale, and significand with fbits = nbits - 3 - es fraction bits and the hidden bit
+	static void decode_posit(uint64_t raw, bool& s, int& scale, uint64_t& significand) {
+		constexpr uint64_t mask = (nbits == 64) ? ~uint64_t(0) : ((uint64_t(1) << (nbits & 0x3F)) - 1);
+		constexpr int fbits = int(nbits) - 3 - int(es);
+		s = (raw >> (nbits - 1)) & 0x1;
+		if (s) raw = (~raw + 1) & mask;
+		uint64_t r = raw << (64 - nbits + 1);  // regime, exponent, and fraction bits, left aligned
+		int run, k;
+		if (r >> 63) {
+			run = countLeadingZeros(~r);
+			k = run - 1;
+		}
+		else {
+			run = countLeadingZeros(r);
+			k = -run;
+		}
+		r <<= (run + 1);   // run is at most nbits - 1, so the shift stays within the word
+		int e = 0;
+		if constexpr (es > 0) {
+			e = int(r >> (64 - es));
+			r <<= es;
+		}
+		scale = k * int(escale) + e;
+		significand = uint64_t(1) << fbits;
+		if constexpr (fbits > 0) significand |= r >> (64 - fbits);
+	}
+	// add or subtract aligned limbs following the sign/magnitude rules
+	void accumulate(bool rhsSign, const uint64_t* aligned, size_t first, size_t count) {
+		// sign/magnitude classification
+		// operation      add magnitudes           subtract magnitudes
+		//                                     a < b       a = b      a > b
+		// (+a) + (+b)      +(a + b)
+		// (+a) + (-b)                       -(b - a)    +(a - b)   +(a - b)
+		// (-a) + (+b)                       +(b - a)    +(a - b)   -(a - b)
+		// (-a) + (-b)      -(a + b)
+		if (_sign == rhsSign) {
+			add_limbs(aligned, first, count);
+			// _sign stays the same, so nothing new to assign
+		}
+		else {
+			// subtract magnitudes
+			int cmp = compare_limbs(aligned, first, count);
+			if (cmp < 0) {
+				reverse_subtract_limbs(aligned, first, count);
+				_sign = rhsSign;
 			}
-			// propagate any borrows to the end of the upper accumulator
-			while (borrow && i < int(upper_range)) {
-				bool _a = _upper[size_t(i)];
-				_upper[size_t(i)] = _a ^ borrow;
-				borrow = borrow & !_a;
-				i++;
+			else if (cmp > 0) {
+				subtract_limbs(aligned, first, count);
+				// _sign stays the same
 			}
-			if (borrow) {
-				// propagate the borrow into the capacity segment
-				i = 0;
-				while (borrow && i < int(capacity)) {
-					bool _a = _capacity[size_t(i)];
-					_capacity[size_t(i)] = _a ^ borrow;
-					borrow = borrow & !_a;
-					i++;
-				}
+			else {
+				clear_limbs();
+				_sign = false;
 			}
 		}
 	}
+	// add aligned limbs, propagating the carry only as far as it reaches
+	void add_limbs(const uint64_t* addend, size_t first, size_t count) {
+		uint64_t carry = 0;
+		size_t i = first;
+		for (size_t j = 0; j < count; ++i, ++j) {
+			uint64_t a = _limbs[i];
+			uint64_t s = a + addend[j];
+			uint64_t c = (s < a) ? 1 : 0;
+			_limbs[i] = s + carry;
+			carry = c | ((_limbs[i] < s) ? 1 : 0);
+		}
+		for (; carry && i < nrLimbs; ++i) carry = (++_limbs[i] == 0) ? 1 : 0;
+		_limbs[nrLimbs - 1] &= topMask;  // a carry out of the capacity segment is lost
+	}
+	// subtract aligned limbs from a quire with a larger magnitude, propagating the borrow only as far as it reaches
+	void subtract_limbs(const uint64_t* subtrahend, size_t first, size_t count) {
+		uint64_t borrow = 0;
+		size_t i = first;
+		for (size_t j = 0; j < count; ++i, ++j) {
+			uint64_t a = _limbs[i];
+			uint64_t d = a - subtrahend[j];
+			uint64_t b = (d > a) ? 1 : 0;
+			_limbs[i] = d - borrow;
+			borrow = b | ((_limbs[i] > d) ? 1 : 0);
+		}
+		for (; borrow && i < nrLimbs; ++i) borrow = (_limbs[i]-- == 0) ? 1 : 0;
+		_limbs[nrLimbs - 1] &= topMask;
+	}
+	// replace the quire with the aligned limbs minus the quire, which has the smaller magnitude
+	void reverse_subtract_limbs(const uint64_t* minuend, size_t first, size_t count) {
+		uint64_t borrow = 0;
+		for (size_t i = 0; i < nrLimbs; ++i) {
+			uint64_t a = (i >= first && i < first + count) ? minuend[i - first] : 0;
+			uint64_t d = a - _limbs[i];
+			uint64_t b = (d > a) ? 1 : 0;
+			_limbs[i] = d - borrow;
+			borrow = b | ((_limbs[i] > d) ? 1 : 0);
+		}
+		_limbs[nrLimbs - 1] &= topMask;
+	}
+	// compare the magnitude of the quire with aligned limbs: returns -1, 0, or 1
+	int compare_limbs(const uint64_t* aligned, size_t first, size_t count) const {
+		for (size_t i = nrLimbs; i-- > 0; ) {
+			uint64_t a = (i >= first && i < first + count) ? aligned[i - first] : 0;
+			if (_limbs[i] != a) return _limbs[i] < a ? -1 : 1;
+		}
+		return 0;
+	}
 
 	// template parameters need names different from class template parameters (for gcc and clang)
 	template<size_t nnbits, size_t nes, size_t ncapacity>
@@ -810,7 +706,18 @@ inline quire<nbits, es, capacity> operator+(const quire<nbits, es, capacity>& lh
 ////////////////// QUIRE stream operators
 template<size_t nbits, size_t es, size_t capacity>
 inline std::ostream& operator<<(std::ostream& ostr, const quire<nbits, es, capacity>& q) {
-	ostr << (q._sign ? "-:" : "+:") << q._capacity << "_" << q._upper << "." << q._lower;
+	using Quire = quire<nbits, es, capacity>;
+	// segmented format: sign:capacity_upper.lower
+	std::string bits;
+	bits.reserve(Quire::nrBits + 4);
+	bits += (q._sign ? "-:" : "+:");
+	for (size_t i = Quire::nrBits; i-- > 0; ) {
+		if (i == Quire::half_range + Quire::upper_range - 1 && capacity > 0) bits += '_';
+		if (i == Quire::half_range - 1) bits += '.';
+		bits += (q.test(i) ? '1' : '0');
+	}
+	if (capacity == 0) bits.insert(2, 1, '_');
+	ostr << bits;
 	return ostr;
 }
 
@@ -821,7 +728,13 @@ inline std::istream& operator>> (std::istream& istr, const quire<nbits, es, capa
 }
 
 template<size_t nbits, size_t es, size_t capacity>
-inline bool operator==(const quire<nbits, es, capacity>& lhs, const quire<nbits, es, capacity>& rhs) { return lhs._sign == rhs._sign && lhs._capacity == rhs._capacity && lhs._upper == rhs._upper && lhs._lower == rhs._lower; }
+inline bool operator==(const quire<nbits, es, capacity>& lhs, const quire<nbits, es, capacity>& rhs) {
+	if (lhs._sign != rhs._sign) return false;
+	for (size_t i = 0; i < quire<nbits, es, capacity>::nrLimbs; ++i) {
+		if (lhs._limbs[i] != rhs._limbs[i]) return false;
+	}
+	return true;
+}
 template<size_t nbits, size_t es, size_t capacity>
 inline bool operator!=(const quire<nbits, es, capacity>& lhs, const quire<nbits, es, capacity>& rhs) { return !operator==(lhs, rhs); }
 template<size_t nbits, size_t es, size_t capacity>
@@ -831,14 +744,11 @@ inline bool operator< (const quire<nbits, es, capacity>& lhs, const quire<nbits,
 		bSmaller = true;
 	}
 	else if (lhs._sign == rhs._sign) {
-		if (lhs._capacity < rhs._capacity) {
-			bSmaller = true;
-		}
-		else if (lhs._capacity == rhs._capacity && lhs._upper < rhs._upper) {
-			bSmaller = true;
-		}
-		else if (lhs._capacity == rhs._capacity && lhs._upper == rhs._upper && lhs._lower < rhs._lower) {
-			bSmaller = true;
+		for (size_t i = quire<nbits, es, capacity>::nrLimbs; i-- > 0; ) {
+			if (lhs._limbs[i] != rhs._limbs[i]) {
+				bSmaller = lhs._limbs[i] < rhs._limbs[i];
+				break;
+			}
 		}
 	}
 	return bSmaller;
@@ -864,35 +774,7 @@ inline bool operator< (const quire<nbits, es, capacity>& q, const value<fbits>&
 	}
 	else if (q.sign() == v.sign()) {
 		// compare magnitudes
-		int qscale = q.scale();
-		int vscale = v.scale();
-		if (qscale < vscale) {
-			bSmaller = true;
-		}
-		else if (qscale == vscale) {
-			// got to compare the fraction bits
-			bitblock<fbits + 1> fixed = v.get_fixed_point();
-			int i, f;  // bit pointers, i for the quire, f for the fraction in v
-			bool undecided = true;
-			for (i = int(quire<nbits, es, capacity>::radix_point) + qscale, f = int(fbits); i >= 0 && f >= 0; --i, --f) {
-				if (!q[i] && fixed[static_cast<size_t>(f)]) {
-					bSmaller = true;
-					undecided = false;
-					break;
-				}
-				else if (q[i] && !fixed[static_cast<size_t>(f)]) {
-					bSmaller = false;
-					undecided = false;
-					break;
-				}
-			}
-			if (undecided && i >= 0) { // fraction bits have been identical
-				// any bit set will make the quire bigger than the value
-				if (q.anyAfter(i)) {
-					bSmaller = false;
-				}
-			}
-		}
+		bSmaller = q.CompareMagnitude(v) < 0;
 	}
 	return bSmaller;
 }
@@ -904,30 +786,7 @@ inline bool operator> (const quire<nbits, es, capacity>& q, const value<fbits>&
 	}
 	else if (q.sign() == v.sign()) {
 		// compare magnitudes
-		int qscale = q.scale();
-		int vscale = v.scale();
-		if (qscale > vscale) {
-			bBigger = true;
-		}
-		else if (qscale == vscale) {
-			// got to compare the fraction bits
-			bitblock<fbits + 1> fixed_point = v.get_fixed_point();
-			int i, f;  // bit pointers, i for the quire, f for the fraction in v
-			bool undecided = true;
-			for (i = int(quire<nbits, es, capacity>::radix_point) + qscale, f = int(fbits); i >= 0 && f >= 0; --i, --f) {
-				if (q[i] && !fixed_point[static_cast<size_t>(f)]) {
-					bBigger = true;
-					undecided = false;
-					break;
-				}
-			}
-			if (undecided && i >= 0) { // fraction bits have been identical
-									   // any bit set will make the quire bigger
-				if (q.anyAfter(i)) {
-					bBigger = true;
-				}
-			}
-		}
+		bBigger = q.CompareMagnitude(v) > 0;
 	}
 	return bBigger;
 }
@@ -21,9 +21,9 @@
 #define POSIT_FAST_POSIT_8_1   1
 #define POSIT_FAST_POSIT_16_1  1
 #define POSIT_FAST_POSIT_32_2  1
-#define POSIT_FAST_POSIT_64_3  0
-#define POSIT_FAST_POSIT_128_4 0
-#define POSIT_FAST_POSIT_256_5 0
+#define POSIT_FAST_POSIT_64_3  1
+#define POSIT_FAST_POSIT_128_4 1
+#define POSIT_FAST_POSIT_256_5 1
 #endif
 
 #ifdef _MSC_VER
@@ -43,6 +43,7 @@
 #include <universal/posit/specialized/posit_16_1.hpp>
 #include <universal/posit/specialized/posit_32_2.hpp>
 #include <universal/posit/specialized/posit_64_3.hpp>
+#include <universal/posit/specialized/posit_limbs.hpp>
 #include <universal/posit/specialized/posit_128_4.hpp>
 #include <universal/posit/specialized/posit_256_5.hpp>
 
@@ -0,0 +1,474 @@
+#pragma once
+// posit_limbs.hpp: multi-limb integer pipeline shared by the fast posit<128,4> and posit<256,5> specializations
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// DO NOT USE DIRECTLY!
+// the compile guards in this file are only valid in the context of the specialization logic
+// configured in the main <universal/posit/posit>
+
+namespace sw { namespace unum {
+
+// posit_limbs implements the decode, round, and arithmetic pipelines of a posit<nbits, es>
+// on arrays of 64-bit limbs. Limbs are little-endian: limb[0] is the least significant word.
+// All the alignment, normalization, and carry propagation is done on whole words, using
+// count-leading-zeros to find the regime run and the normalization shift, instead of the
+// per-bit loops of the bitblock/value<> pipeline.
+template<size_t _nbits, size_t _es>
+struct posit_limbs {
+	static constexpr size_t nbits = _nbits;
+	static constexpr size_t es = _es;
+	static constexpr size_t N = nbits / 64;         // number of limbs of the encoding
+	static constexpr int    B = int(nbits);         // number of bits of the encoding
+	static constexpr int    maxscale = int(nbits - 2) << es;  // scale of maxpos: useed^(nbits-2)
+	static constexpr uint64_t msb = 0x8000000000000000ull;
+	static_assert(nbits % 64 == 0 && nbits >= 128, "posit_limbs requires an encoding of at least two 64-bit limbs");
+	static_assert(es > 0 && es < 8, "posit_limbs requires 0 < es < 8");
+
+	///////////////////////////////////////////////////////////////////
+	// word-level primitives
+
+	template<size_t n>
+	static inline void clear(uint64_t (&a)[n]) {
+		for (size_t i = 0; i < n; ++i) a[i] = 0;
+	}
+	template<size_t n>
+	static inline bool iszero(const uint64_t (&a)[n]) {
+		uint64_t any = 0;
+		for (size_t i = 0; i < n; ++i) any |= a[i];
+		return any == 0;
+	}
+	// unsigned comparison: returns -1, 0, or 1
+	template<size_t n>
+	static inline int compare(const uint64_t (&a)[n], const uint64_t (&b)[n]) {
+		for (size_t i = n; i-- > 0; ) {
+			if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+		}
+		return 0;
+	}
+	template<size_t n>
+	static inline void twosComplement(uint64_t (&a)[n]) {
+		uint64_t carry = 1;
+		for (size_t i = 0; i < n; ++i) {
+			uint64_t v = ~a[i] + carry;
+			carry = (carry && v == 0) ? 1 : 0;
+			a[i] = v;
+		}
+	}
+	template<size_t n>
+	static inline void increment(uint64_t (&a)[n]) {
+		for (size_t i = 0; i < n; ++i) {
+			if (++a[i] != 0) return;
+		}
+	}
+	template<size_t n>
+	static inline void decrement(uint64_t (&a)[n]) {
+		for (size_t i = 0; i < n; ++i) {
+			if (a[i]-- != 0) return;
+		}
+	}
+	// a += b, returns the carry out
+	template<size_t n>
+	static inline uint64_t addTo(uint64_t (&a)[n], const uint64_t (&b)[n]) {
+		uint64_t carry = 0;
+		for (size_t i = 0; i < n; ++i) {
+			uint64_t s = a[i] + b[i];
+			uint64_t c = s < a[i] ? 1 : 0;
+			a[i] = s + carry;
+			carry = c | (a[i] < s ? 1 : 0);
+		}
+		return carry;
+	}
+	// a -= b, returns the borrow out
+	template<size_t n>
+	static inline uint64_t subtractFrom(uint64_t (&a)[n], const uint64_t (&b)[n]) {
+		uint64_t borrow = 0;
+		for (size_t i = 0; i < n; ++i) {
+			uint64_t d = a[i] - b[i];
+			uint64_t c = d > a[i] ? 1 : 0;
+			a[i] = d - borrow;
+			borrow = c | (a[i] > d ? 1 : 0);
+		}
+		return borrow;
+	}
+	// number of leading zeros: returns 64 * n when no bits are set
+	template<size_t n>
+	static inline int clz(const uint64_t (&a)[n]) {
+		for (size_t i = n; i-- > 0; ) {
+			if (a[i]) return int(n - 1 - i) * 64 + countLeadingZeros(a[i]);
+		}
+		return int(n) * 64;
+	}
+	template<size_t n>
+	static inline void shiftLeft(uint64_t (&a)[n], int shift) {
+		if (shift <= 0) return;
+		if (shift >= int(n) * 64) { clear(a); return; }
+		int wordShift = shift >> 6;
+		int bitShift = shift & 0x3F;
+		for (int i = int(n) - 1; i >= 0; --i) {
+			int src = i - wordShift;
+			uint64_t v = 0;
+			if (src >= 0) {
+				v = a[src] << bitShift;
+				if (bitShift && src > 0) v |= a[src - 1] >> (64 - bitShift);
+			}
+			a[i] = v;
+		}
+	}
+	// shift right, returning true if any of the bits that are shifted out are set
+	template<size_t n>
+	static inline bool shiftRight(uint64_t (&a)[n], int shift) {
+		if (shift <= 0) return false;
+		if (shift >= int(n) * 64) {
+			bool sticky = !iszero(a);
+			clear(a);
+			return sticky;
+		}
+		int wordShift = shift >> 6;
+		int bitShift = shift & 0x3F;
+		uint64_t lost = 0;
+		for (int i = 0; i < wordShift; ++i) lost |= a[i];
+		if (bitShift) lost |= a[wordShift] & ((1ull << bitShift) - 1);
+		for (int i = 0; i < int(n); ++i) {
+			int src = i + wordShift;
+			uint64_t v = 0;
+			if (src < int(n)) {
+				v = a[src] >> bitShift;
+				if (bitShift && src + 1 < int(n)) v |= a[src + 1] << (64 - bitShift);
+			}
+			a[i] = v;
+		}
+		return lost != 0;
+	}
+	// full 64x64 -> 128-bit product: returns the lower word and sets the upper word
+	static inline uint64_t multiply64(uint64_t a, uint64_t b, uint64_t& hi) {
+#if defined(__SIZEOF_INT128__)
+		__extension__ typedef unsigned __int128 uint128;
+		uint128 p = uint128(a) * b;
+		hi = uint64_t(p >> 64);
+		return uint64_t(p);
+#else
+		uint64_t a0 = a & 0xFFFFFFFFull, a1 = a >> 32;
+		uint64_t b0 = b & 0xFFFFFFFFull, b1 = b >> 32;
+		uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+		uint64_t middle = (p00 >> 32) + (p01 & 0xFFFFFFFFull) + (p10 & 0xFFFFFFFFull);
+		hi = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+		return (middle << 32) | (p00 & 0xFFFFFFFFull);
+#endif
+	}
+	// schoolbook multiplication of two n-limb operands into a 2n-limb product
+	template<size_t n>
+	static inline void multiply(const uint64_t (&a)[n], const uint64_t (&b)[n], uint64_t (&product)[2 * n]) {
+		clear(product);
+		for (size_t i = 0; i < n; ++i) {
+			uint64_t carry = 0;
+			for (size_t j = 0; j < n; ++j) {
+				uint64_t hi;
+				uint64_t lo = multiply64(a[i], b[j], hi);
+				lo += carry;
+				hi += (lo < carry) ? 1 : 0;
+				lo += product[i + j];
+				hi += (lo < product[i + j]) ? 1 : 0;
+				product[i + j] = lo;
+				carry = hi;
+			}
+			product[i + n] = carry;
+		}
+	}
+
+	///////////////////////////////////////////////////////////////////
+	// posit pipeline
+
+	// decode takes the magnitude of a posit that is not zero or NaR, and returns its scale and
+	// its significand, which is the fraction with the hidden bit made explicit at the msb of the top limb
+	static inline void decode(const uint64_t (&magnitude)[N], int& scale, uint64_t (&significand)[N]) {
+		uint64_t remaining[N];
+		for (size_t i = 0; i < N; ++i) remaining[i] = magnitude[i];
+		shiftLeft(remaining, 1);  // strip the sign bit
+		int run, k;
+		if (remaining[N - 1] & msb) {  // positive regimes
+			uint64_t inverted[N];
+			for (size_t i = 0; i < N; ++i) inverted[i] = ~remaining[i];
+			run = clz(inverted);
+			k = run - 1;
+		}
+		else {                         // negative regimes
+			run = clz(remaining);
+			k = -run;
+		}
+		shiftLeft(remaining, run + 1);  // strip the regime and its terminating bit
+		scale = k * (1 << es) + int(remaining[N - 1] >> (64 - es));
+		// move the fraction up against the msb, which is then overwritten by the hidden bit
+		shiftLeft(remaining, int(es) - 1);
+		remaining[N - 1] |= msb;
+		for (size_t i = 0; i < N; ++i) significand[i] = remaining[i];
+	}
+
+	// round takes the scale and the fraction bits (hidden bit removed, msb at the msb of the top limb) of a positive real,
+	// and a sticky bit representing any non-zero bits beyond the fraction, and returns the rounded posit encoding
+	static inline void round(int scale, const uint64_t (&fraction)[N], bool sticky, uint64_t (&bits)[N]) {
+		// inward projection onto maxpos/minpos
+		if (scale > maxscale) {
+			for (size_t i = 0; i < N; ++i) bits[i] = ~0ull;
+			bits[N - 1] = ~msb;
+			return;
+		}
+		if (scale < -maxscale) {
+			clear(bits);
+			bits[0] = 1;
+			return;
+		}
+
+		// construct the untruncated posit in a 2N-limb register: regime, exponent, and fraction, msb at the top
+		uint64_t pt[2 * N];
+		clear(pt);
+		int k = scale >> es;  // arithmetic shift: floor(scale / 2^es)
+		uint64_t exp = uint64_t(scale & ((1 << es) - 1));
+		int run;
+		if (k >= 0) {
+			run = k + 1;     // run of 1's terminated by a 0
+			int fullWords = run >> 6;
+			for (int i = 0; i < fullWords; ++i) pt[2 * N - 1 - i] = ~0ull;
+			if (run & 0x3F) pt[2 * N - 1 - fullWords] = ~0ull << (64 - (run & 0x3F));
+		}
+		else {
+			run = -k;        // run of 0's terminated by a 1
+			int pos = 2 * B - 1 - run;
+			pt[pos >> 6] |= 1ull << (pos & 0x3F);
+		}
+		int len = run + 1;
+		int pos = 2 * B - len - int(es);  // lsb of the exponent field
+		pt[pos >> 6] |= exp << (pos & 0x3F);
+		if ((pos & 0x3F) + int(es) > 64) pt[(pos >> 6) + 1] |= exp >> (64 - (pos & 0x3F));
+		// the fraction fills the bits below the exponent
+		uint64_t f[2 * N];
+		clear(f);
+		for (size_t i = 0; i < N; ++i) f[i] = fraction[i];
+		int shift = pos - B;
+		if (shift >= 0) {
+			shiftLeft(f, shift);
+		}
+		else {
+			sticky |= shiftRight(f, -shift);
+		}
+		for (size_t i = 0; i < 2 * N; ++i) pt[i] |= f[i];
+
+		// the posit takes the top nbits-1 bits, the next bit is the rounding bit, and the remaining bits are sticky
+		for (size_t i = 0; i < N - 1; ++i) bits[i] = (pt[N + i] >> 1) | (pt[N + i + 1] << 63);
+		bits[N - 1] = pt[2 * N - 1] >> 1;
+		bool bitNPlusOne = bool(pt[N] & 0x1);
+		for (size_t i = 0; i < N; ++i) sticky |= pt[i] != 0;
+		// n+1 frac bit is 1. Need to check if another bit is 1 too, if not round to even
+		if (bitNPlusOne && (sticky || (bits[0] & 0x1))) increment(bits);
+	}
+
+	// add two posit encodings that are not zero or NaR, and return the rounded posit encoding of the sum
+	static inline void add(const uint64_t (&lhs)[N], const uint64_t (&rhs)[N], uint64_t (&sum)[N]) {
+		uint64_t a[N], b[N];
+		for (size_t i = 0; i < N; ++i) { a[i] = lhs[i]; b[i] = rhs[i]; }
+		bool lhs_sign = bool(a[N - 1] & msb);
+		bool rhs_sign = bool(b[N - 1] & msb);
+		if (lhs_sign) twosComplement(a);
+		if (rhs_sign) twosComplement(b);
+		bool sign = lhs_sign;
+		int order = compare(a, b);  // order the magnitudes: the encodings are monotonic
+		if (order < 0) {
+			for (size_t i = 0; i < N; ++i) std::swap(a[i], b[i]);
+			sign = rhs_sign;
+		}
+		bool subtract = lhs_sign != rhs_sign;
+		if (subtract && order == 0) {
+			clear(sum);
+			return;
+		}
+
+		int lhs_scale, rhs_scale;
+		uint64_t lhs_significand[N], rhs_significand[N];
+		decode(a, lhs_scale, lhs_significand);
+		decode(b, rhs_scale, rhs_significand);
+
+		// align the significands in N+1 limbs with the hidden bit one below the msb, leaving the msb to catch the carry
+		uint64_t lhs_fraction[N + 1], rhs_fraction[N + 1];
+		lhs_fraction[0] = rhs_fraction[0] = 0;
+		for (size_t i = 0; i < N; ++i) {
+			lhs_fraction[i + 1] = lhs_significand[i];
+			rhs_fraction[i + 1] = rhs_significand[i];
+		}
+		shiftRight(lhs_fraction, 1);
+		shiftRight(rhs_fraction, 1);
+		bool sticky = shiftRight(rhs_fraction, lhs_scale - rhs_scale);
+
+		if (subtract) {
+			subtractFrom(lhs_fraction, rhs_fraction);
+			// the bits shifted out of the subtrahend borrow from the difference and remain sticky
+			if (sticky) decrement(lhs_fraction);
+		}
+		else {
+			addTo(lhs_fraction, rhs_fraction);
+		}
+
+		// normalize: shift the hidden bit out of the top limb
+		int shiftLeftCount = clz(lhs_fraction);
+		shiftLeft(lhs_fraction, shiftLeftCount + 1);
+		uint64_t fraction[N];
+		for (size_t i = 0; i < N; ++i) fraction[i] = lhs_fraction[i + 1];
+		sticky |= lhs_fraction[0] != 0;
+
+		round(lhs_scale + 1 - shiftLeftCount, fraction, sticky, sum);
+		if (sign) twosComplement(sum);
+	}
+
+	// multiply two posit encodings that are not zero or NaR, and return the rounded posit encoding of the product
+	static inline void mul(const uint64_t (&lhs)[N], const uint64_t (&rhs)[N], uint64_t (&product)[N]) {
+		uint64_t a[N], b[N];
+		for (size_t i = 0; i < N; ++i) { a[i] = lhs[i]; b[i] = rhs[i]; }
+		bool sign = bool(a[N - 1] & msb) ^ bool(b[N - 1] & msb);
+		if (a[N - 1] & msb) twosComplement(a);
+		if (b[N - 1] & msb) twosComplement(b);
+
+		int lhs_scale, rhs_scale;
+		uint64_t lhs_significand[N], rhs_significand[N];
+		decode(a, lhs_scale, lhs_significand);
+		decode(b, rhs_scale, rhs_significand);
+
+		// the product of two significands in [1, 2) is in [1, 4): the hidden bit ends up in one of the top two bits
+		uint64_t p[2 * N];
+		multiply(lhs_significand, rhs_significand, p);
+		int scale = lhs_scale + rhs_scale;
+		if (p[2 * N - 1] & msb) {
+			++scale;
+			shiftLeft(p, 1);
+		}
+		else {
+			shiftLeft(p, 2);
+		}
+		uint64_t fraction[N];
+		bool sticky = false;
+		for (size_t i = 0; i < N; ++i) {
+			fraction[i] = p[N + i];
+			sticky |= p[i] != 0;
+		}
+
+		round(scale, fraction, sticky, product);
+		if (sign) twosComplement(product);
+	}
+
+	// divide two posit encodings that are not zero or NaR, and return the rounded posit encoding of the quotient
+	static inline void div(const uint64_t (&lhs)[N], const uint64_t (&rhs)[N], uint64_t (&quotient)[N]) {
+		uint64_t a[N], b[N];
+		for (size_t i = 0; i < N; ++i) { a[i] = lhs[i]; b[i] = rhs[i]; }
+		bool sign = bool(a[N - 1] & msb) ^ bool(b[N - 1] & msb);
+		if (a[N - 1] & msb) twosComplement(a);
+		if (b[N - 1] & msb) twosComplement(b);
+
+		int lhs_scale, rhs_scale;
+		uint64_t lhs_significand[N], rhs_significand[N];
+		decode(a, lhs_scale, lhs_significand);
+		decode(b, rhs_scale, rhs_significand);
+
+		// restoring division of the significands: (lhs << B) / rhs is in (2^(B-1), 2^(B+1))
+		uint64_t remainder[N + 1], divisor[N + 1];
+		for (size_t i = 0; i < N; ++i) {
+			remainder[i] = lhs_significand[i];
+			divisor[i] = rhs_significand[i];
+		}
+		remainder[N] = divisor[N] = 0;
+		bool upper = compare(remainder, divisor) >= 0;
+		if (upper) subtractFrom(remainder, divisor);
+		uint64_t q[N];
+		clear(q);
+		for (int i = B - 1; i >= 0; --i) {
+			shiftLeft(remainder, 1);
+			if (compare(remainder, divisor) >= 0) {
+				subtractFrom(remainder, divisor);
+				q[i >> 6] |= 1ull << (i & 0x3F);
+			}
+		}
+		int scale = lhs_scale - rhs_scale;
+		if (!upper) {  // the hidden bit is the msb of q
+			--scale;
+			shiftLeft(q, 1);
+		}
+		round(scale, q, !iszero(remainder), quotient);
+		if (sign) twosComplement(quotient);
+	}
+
+	// square root of a positive posit encoding that is not zero or NaR
+	static inline void sqrt(const uint64_t (&a)[N], uint64_t (&root)[N]) {
+		int scale;
+		uint64_t significand[N];
+		decode(a, scale, significand);
+		// fold an odd scale into the significand so that the scale of the root is exact:
+		// the radicand is in [2^(2B-2), 2^(2B)), and thus its root is in [2^(B-1), 2^B)
+		uint64_t radicand[2 * N];
+		for (size_t i = 0; i < N; ++i) {
+			radicand[i] = 0;
+			radicand[N + i] = significand[i];
+		}
+		shiftRight(radicand, 1 - (scale & 0x1));
+
+		// digit-by-digit integer square root, two radicand bits per root bit
+		uint64_t r[N + 1], remainder[N + 1], trial[N + 1];
+		clear(r);
+		clear(remainder);
+		for (int i = B - 1; i >= 0; --i) {
+			shiftLeft(remainder, 2);
+			remainder[0] |= (radicand[(2 * i) >> 6] >> ((2 * i) & 0x3F)) & 0x3;
+			for (size_t j = 0; j < N + 1; ++j) trial[j] = r[j];
+			shiftLeft(trial, 2);
+			trial[0] |= 1;
+			shiftLeft(r, 1);
+			if (compare(remainder, trial) >= 0) {
+				subtractFrom(remainder, trial);
+				r[0] |= 1;
+			}
+		}
+
+		// strip the hidden bit: a non-zero remainder is the sticky bit of the infinitely precise root
+		shiftLeft(r, 1);
+		uint64_t fraction[N];
+		for (size_t i = 0; i < N; ++i) fraction[i] = r[i];
+		round(scale >> 1, fraction, !iszero(remainder), root);
+	}
+
+	///////////////////////////////////////////////////////////////////
+	// conversions
+
+	static inline void convert_unsigned(unsigned long long v, uint64_t (&bits)[N]) {
+		if (v == 0) {
+			clear(bits);
+			return;
+		}
+		int shift = countLeadingZeros(uint64_t(v));
+		uint64_t fraction[N];
+		clear(fraction);
+		fraction[N - 1] = (uint64_t(v) << shift) << 1;  // strip the hidden bit
+		round(63 - shift, fraction, false, bits);
+	}
+	// the significand of a native floating-point magnitude fits in the top limb
+	template<typename Real>
+	static inline void convert_ieee(Real v, uint64_t (&bits)[N]) {
+		int exponent;
+		Real mantissa = std::frexp(v, &exponent);  // mantissa in [0.5, 1)
+		uint64_t fraction[N];
+		clear(fraction);
+		fraction[N - 1] = uint64_t(std::ldexp(mantissa, 64)) << 1;  // hidden bit lands at bit 63 and is stripped
+		round(exponent - 1, fraction, false, bits);
+	}
+	// the magnitude as a long double: the lower limbs are collapsed into a sticky bit so that the
+	// conversion of the top limb rounds correctly to the precision of double
+	static inline long double to_native(const uint64_t (&magnitude)[N]) {
+		int scale;
+		uint64_t significand[N];
+		decode(magnitude, scale, significand);
+		uint64_t top = significand[N - 1];
+		for (size_t i = 0; i < N - 1; ++i) {
+			if (significand[i]) { top |= 1; break; }
+		}
+		return std::ldexp((long double)(top), scale - 63);
+	}
+};
+
+}} // namespace sw::unum
@@ -14,8 +14,8 @@ namespace sw { namespace unum {
 		: false_type
 	{
 	};
-	template<size_t nbits, size_t rbits>
-	struct is_fixpnt_trait< sw::unum::fixpnt<nbits, rbits> >
+	template<size_t nbits, size_t rbits, bool arithmetic, typename bt>
+	struct is_fixpnt_trait< sw::unum::fixpnt<nbits, rbits, arithmetic, bt> >
 		: true_type
 	{
 	};
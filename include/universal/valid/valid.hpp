@@ -6,21 +6,77 @@
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 
 #include <limits>
+#include <cmath>
+#include <universal/functions/twosum.hpp>
 
 namespace sw {
 namespace unum {
 
+// The bounds of a valid are computed with directed rounding: the exact result x of an operation on two posits
+// is evaluated in a native floating-point type as a rounded result s and the sign of s - x, which the error-free
+// transformations (TwoSum, the fma product error, and the fma division residual) deliver exactly.
+// The posit nearest to s is a neighbor of x, and the sign of x relative to that posit selects the enclosing pair.
+// This requires a native type that represents the posit values and the error terms exactly.
+
+// native type in which the bounds of valid<nbits, es> are computed
+template<size_t nbits, size_t es>
+struct valid_arithmetic_type { using type = long double; };
+// fast paths for the standard posit configurations: double represents them exactly
+template<> struct valid_arithmetic_type<8, 0>  { using type = double; };
+template<> struct valid_arithmetic_type<16, 1> { using type = double; };
+template<> struct valid_arithmetic_type<32, 2> { using type = double; };
+
+// true when Real represents the posit values, and the errors of their sums, products, and quotients, exactly
+template<size_t nbits, size_t es, typename Real>
+constexpr bool valid_exact_in() {
+	constexpr long maxscale = long(nbits - 2) << es;
+	constexpr long fhbits = long(nbits) - 2 - long(es);
+	return fhbits <= long(std::numeric_limits<Real>::digits)
+		&& 2 * maxscale + 2 < long(std::numeric_limits<Real>::max_exponent)
+		&& -2 * maxscale - 2 * long(std::numeric_limits<Real>::digits) > long(std::numeric_limits<Real>::min_exponent);
+}
+
+// enclose the exact result x by posits lo <= x <= hi, given s = x rounded to Real and order = sign(s - x)
+// returns true when x is a posit, in which case lo == hi == x
+template<size_t nbits, size_t es, typename Real>
+bool valid_enclose(Real s, int order, posit<nbits, es>& lo, posit<nbits, es>& hi) {
+	posit<nbits, es> p(s);
+	Real ps = Real(p);
+	// when p differs from s, no native value separates s from x, so p lies on the same side of x as of s
+	int d = (ps != s) ? (ps > s ? 1 : -1) : order;
+	lo = p;
+	hi = p;
+	if (d > 0) --lo;
+	if (d < 0) ++hi;
+	return d == 0;
+}
+
 template<size_t nbits, size_t es>
 class valid {
 
 	static_assert(es + 3 <= nbits, "Value for 'es' is too large for this 'nbits' value");
 	//static_assert(sizeof(long double) == 16, "Valid library requires compiler support for 128 bit long double.");
 
+	using Posit = sw::unum::posit<nbits, es>;
+	using Real = typename valid_arithmetic_type<nbits, es>::type;
+	static constexpr bool exact_bounds = valid_exact_in<nbits, es, Real>();
+
+	// a native value becomes the posit it equals, or the open interval between the two posits enclosing it
 	template <typename T>
 	valid<nbits, es>& _assign(const T& rhs) {
-		constexpr int fbits = std::numeric_limits<T>::digits - 1;
-		value<fbits> v((T)rhs);
-
+		long double v = (long double)rhs;
+		if (!std::isfinite(v)) {
+			setinclusive();
+			return *this;
+		}
+		bool exact;
+		if constexpr (valid_exact_in<nbits, es, long double>() && std::numeric_limits<long double>::digits >= std::numeric_limits<T>::digits) {
+			exact = valid_enclose<nbits, es, long double>(v, 0, lb, ub);
+		}
+		else {
+			exact = outward(Posit(v), lb, ub);
+		}
+		lubit = uubit = exact;
 		return *this;
 	}
 
@@ -45,16 +101,51 @@ public:
 	valid& operator=(double rhs) { return _assign(rhs); }
 	valid& operator=(long double rhs) { return _assign(rhs); }
 
+	// interval arithmetic: the lower bound of the result is rounded down and the upper bound is rounded up,
+	// a NaR lower bound stands for -inf and a NaR upper bound for +inf
 	valid& operator+=(const valid& rhs) {
+		bound lo = sum(lower(), rhs.lower(), false);
+		bound hi = sum(upper(), rhs.upper(), true);
+		setbounds(lo, hi);
 		return *this;
 	}
 	valid& operator-=(const valid& rhs) {
+		bound lo = sum(lower(), negate(rhs.upper()), false);
+		bound hi = sum(upper(), negate(rhs.lower()), true);
+		setbounds(lo, hi);
 		return *this;
 	}
 	valid& operator*=(const valid& rhs) {
+		// the extremes of a product over the box are attained at its corners
+		bound x[2] = { lower(), upper() }, y[2] = { rhs.lower(), rhs.upper() };
+		bound lo{}, hi{};
+		for (int i = 0; i < 4; ++i) {
+			bound clo, chi;
+			product(x[i >> 1], y[i & 1], clo, chi);
+			if (i == 0 || below(clo, lo, -1)) lo = clo;
+			if (i == 0 || below(hi, chi, 1)) hi = chi;
+		}
+		setbounds(lo, hi);
 		return *this;
 	}
 	valid& operator/=(const valid& rhs) {
+		bound y[2] = { rhs.lower(), rhs.upper() };
+		// a divisor that contains zero yields the whole projective line
+		bool positive = (y[0].inf == 0) && (signum(y[0]) > 0 || (y[0].v.iszero() && !y[0].closed));
+		bool negative = (y[1].inf == 0) && (signum(y[1]) < 0 || (y[1].v.iszero() && !y[1].closed));
+		if (!positive && !negative) {
+			setinclusive();
+			return *this;
+		}
+		bound x[2] = { lower(), upper() };
+		bound lo{}, hi{};
+		for (int i = 0; i < 4; ++i) {
+			bound clo, chi;
+			quotient(x[i >> 1], y[i & 1], (i & 1) == 0, clo, chi);
+			if (i == 0 || below(clo, lo, -1)) lo = clo;
+			if (i == 0 || below(hi, chi, 1)) hi = chi;
+		}
+		setbounds(lo, hi);
 		return *this;
 	}
 
@@ -68,10 +159,10 @@ public:
 		return lubit && uubit;
 	}
 	inline bool isopenlower() const {
-		return lubit;
+		return !lubit;
 	}
 	inline bool isopenupper() const {
-		return uubit;
+		return !uubit;
 	}
 	inline bool getlb(sw::unum::posit<nbits, es>& _lb) const {
 		_lb = lb;
@@ -115,7 +206,10 @@ public:
 		if (v.isnan() || v.isinf()) {
 			return 0;
 		}
-		return convert(v.sign(), v.scale(), v.fraction());
+		Posit p;
+		convert(v, p);
+		long double pv = (long double)p, vv = v.to_long_double();
+		return (pv > vv) ? -1 : ((pv < vv) ? 1 : 0);
 	}
 
 private:
@@ -126,80 +220,121 @@ private:
 
 	// helper methods	
 
-	// special case check for projecting values between (0, minpos] to minpos and [maxpos, inf) to maxpos
-	// Returns true if the scale is too small or too large for this posit config
-	bool check_inward_projection_range(int scale) {
-		// calculate the max k factor for this posit config
-		int posit_size = nbits;
-		int k = scale < 0 ? -(posit_size - 2) : (posit_size - 2);
-		return scale < 0 ? scale < k*(1 << es) : scale > k*(1 << es);
+	// an end point of an interval: a finite posit, or -inf/+inf, and whether it belongs to the interval
+	struct bound {
+		int   inf;     // -1 for -inf, +1 for +inf, 0 for the finite value v
+		Posit v;
+		bool  closed;
+	};
+	bound lower() const { return lb.isnar() ? bound{ -1, lb, false } : bound{ 0, lb, lubit }; }
+	bound upper() const { return ub.isnar() ? bound{ 1, ub, false } : bound{ 0, ub, uubit }; }
+	static bound infinite(int sign) { Posit nar; nar.setnar(); return bound{ sign, nar, false }; }
+	// a rounded end point on the given side, -1 for a lower and +1 for an upper bound: rounding beyond maxpos yields NaR
+	static bound finite(const Posit& v, bool closed, int side) { return v.isnar() ? infinite(side) : bound{ 0, v, closed }; }
+	static bound negate(const bound& b) { return bound{ -b.inf, -b.v, b.closed }; }
+	static int signum(const bound& b) { return b.inf != 0 ? b.inf : (b.v.iszero() ? 0 : (b.v.isneg() ? -1 : 1)); }
+	// order on bounds of the given side by value: on ties the closed bound is the smaller lower bound and the larger upper bound
+	static bool below(const bound& a, const bound& b, int side) {
+		if (a.inf != b.inf) return a.inf < b.inf;
+		if (a.inf != 0) return false;
+		if (a.v != b.v) return a.v < b.v;
+		return (side < 0) ? (a.closed && !b.closed) : (!a.closed && b.closed);
 	}
 
+	void setbounds(const bound& lo, const bound& hi) {
+		if (lo.inf != 0 || lo.v.isnar()) { lb.setnar(); lubit = false; } else { lb = lo.v; lubit = lo.closed; }
+		if (hi.inf != 0 || hi.v.isnar()) { ub.setnar(); uubit = false; } else { ub = hi.v; uubit = hi.closed; }
+	}
 
-	// convert assumes that ZERO and NaR cases are handled. Only non-zero and non-NaR values are allowed.
-	template<size_t input_fbits>
-	int convert(bool sign, int scale, bitblock<input_fbits> input_fraction) {
-		// construct the posit
-		//int k = calculate_unconstrained_k<nbits, es>(scale);
-		// interpolation rule checks
-		if (check_inward_projection_range(scale)) {    // regime dominated
-			return 1; // rounded down
+	// the posits next to the round to nearest result p, for configurations without an exact native type
+	static bool outward(const Posit& p, Posit& lo, Posit& hi) {
+		lo = p;
+		hi = p;
+		--lo;
+		++hi;
+		return false;
+	}
+
+	// bounds of a + b: rounded down when upward is false, up otherwise
+	static bound sum(const bound& a, const bound& b, bool upward) {
+		if (a.inf != 0 || b.inf != 0) return infinite(a.inf != 0 ? a.inf : b.inf);
+		Posit lo, hi;
+		bool exact;
+		if constexpr (exact_bounds) {
+			Real s, e;
+			std::tie(s, e) = sw::function::twoSum(Real(a.v), Real(b.v));
+			exact = valid_enclose<nbits, es, Real>(s, (e > 0) ? -1 : ((e < 0) ? 1 : 0), lo, hi);
 		}
 		else {
-			const size_t pt_len = nbits + 3 + es;
-			bitblock<pt_len> pt_bits;
-			bitblock<pt_len> regime;
-			bitblock<pt_len> exponent;
-			bitblock<pt_len> fraction;
-			bitblock<pt_len> sticky_bit;
-
-			bool s = sign;
-			int e = scale;
-			bool r = (e >= 0);
-
-			unsigned run = (r ? 1 + (e >> es) : -(e >> es));
-			regime.set(0, 1 ^ r);
-			for (unsigned i = 1; i <= run; i++) regime.set(i, r);
-
-			unsigned esval = e % (uint32_t(1) << es);
-			exponent = convert_to_bitblock<pt_len>(esval);
-			unsigned nf = (unsigned)std::max<int>(0, (nbits + 1) - (2 + run + es));
-			// TODO: what needs to be done if nf > fbits?
-			//assert(nf <= input_fbits);
-			// copy the most significant nf fraction bits into fraction
-			unsigned lsb = nf <= input_fbits ? 0 : nf - input_fbits;
-			for (unsigned i = lsb; i < nf; i++) fraction[i] = input_fraction[input_fbits - nf + i];
-
-			bool sb = anyAfter(input_fraction, input_fbits - 1 - nf);
-
-			// construct the untruncated posit
-			// pt    = BitOr[BitShiftLeft[reg, es + nf + 1], BitShiftLeft[esval, nf + 1], BitShiftLeft[fv, 1], sb];
-			regime <<= es + nf + 1;
-			exponent <<= nf + 1;
-			fraction <<= 1;
-			sticky_bit.set(0, sb);
-
-			pt_bits |= regime;
-			pt_bits |= exponent;
-			pt_bits |= fraction;
-			pt_bits |= sticky_bit;
-
-			unsigned len = 1 + std::max<unsigned>((nbits + 1), (2 + run + es));
-			bool blast = pt_bits.test(len - nbits);
-			bool bafter = pt_bits.test(len - nbits - 1);
-			bool bsticky = anyAfter(pt_bits, len - nbits - 1 - 1);
-
-			bool rb = (blast & bafter) | (bafter & bsticky);
-
-			pt_bits <<= pt_len - len;
-			bitblock<nbits> ptt;
-			truncate(pt_bits, ptt);
+			exact = outward(a.v + b.v, lo, hi);
+		}
+		return upward ? finite(hi, exact && a.closed && b.closed, 1) : finite(lo, exact && a.closed && b.closed, -1);
+	}
 
-			if (rb) increment_bitset(ptt);
-			if (s) ptt = twos_complement(ptt);
+	// lower and upper bound of the products at a corner
+	static void product(const bound& a, const bound& b, bound& lo, bound& hi) {
+		if (a.inf != 0 || b.inf != 0) {
+			// 0 * inf: the zero end point contributes the product 0
+			if ((a.inf == 0 && a.v.iszero()) || (b.inf == 0 && b.v.iszero())) {
+				lo = hi = bound{ 0, Posit(0), (a.inf == 0 ? a.closed : b.closed) };
+			}
+			else {
+				lo = hi = infinite(signum(a) * signum(b));
+			}
+			return;
+		}
+		Posit plo, phi;
+		bool exact;
+		if constexpr (exact_bounds) {
+			Real x = Real(a.v), y = Real(b.v);
+			Real s = x * y;
+			Real e = std::fma(x, y, -s);
+			exact = valid_enclose<nbits, es, Real>(s, (e > 0) ? -1 : ((e < 0) ? 1 : 0), plo, phi);
+		}
+		else {
+			exact = outward(a.v * b.v, plo, phi);
+		}
+		lo = finite(plo, exact && a.closed && b.closed, -1);
+		hi = finite(phi, exact && a.closed && b.closed, 1);
+	}
 
-			return -1; // TODO
+	// lower and upper bound of the quotients at a corner, the divisor does not contain zero:
+	// a zero divisor end point is open, and leftside tells whether it is the lower end point of the divisor
+	static void quotient(const bound& a, const bound& b, bool leftside, bound& lo, bound& hi) {
+		int sa = signum(a), sb = (signum(b) != 0 ? signum(b) : (leftside ? 1 : -1));
+		if (a.inf == 0 && a.v.iszero()) {
+			lo = hi = bound{ 0, Posit(0), a.closed };
+			return;
+		}
+		if (a.inf != 0 && b.inf != 0) {
+			// inf / inf spans the quadrant between 0 and inf
+			if (sa * sb > 0) { lo = bound{ 0, Posit(0), false }; hi = infinite(1); }
+			else { lo = infinite(-1); hi = bound{ 0, Posit(0), false }; }
+			return;
+		}
+		if (a.inf != 0 || b.v.iszero()) {
+			lo = hi = infinite(sa * sb);
+			return;
+		}
+		if (b.inf != 0) {
+			lo = hi = bound{ 0, Posit(0), false };
+			return;
+		}
+		Posit plo, phi;
+		bool exact;
+		if constexpr (exact_bounds) {
+			Real x = Real(a.v), y = Real(b.v);
+			Real s = x / y;
+			// s - x/y has the sign of (s * y - x) * y, and the residual s * y - x is exact
+			Real r = std::fma(s, y, -x);
+			int order = (r > 0) ? 1 : ((r < 0) ? -1 : 0);
+			exact = valid_enclose<nbits, es, Real>(s, (y < 0) ? -order : order, plo, phi);
+		}
+		else {
+			exact = outward(a.v / b.v, plo, phi);
 		}
+		lo = finite(plo, exact && a.closed && b.closed, -1);
+		hi = finite(phi, exact && a.closed && b.closed, 1);
 	}
 
 	// friends
@@ -249,6 +384,42 @@ inline std::istream& operator>> (std::istream& istr, const valid<nbits, es>& v)
 	return istr;
 }
 
+// two valids are equal when their bounds and ubits are equal
+template<size_t nbits, size_t es>
+inline bool operator==(const valid<nbits, es>& lhs, const valid<nbits, es>& rhs) {
+	return lhs.lb == rhs.lb && lhs.ub == rhs.ub && lhs.lubit == rhs.lubit && lhs.uubit == rhs.uubit;
+}
+template<size_t nbits, size_t es>
+inline bool operator!=(const valid<nbits, es>& lhs, const valid<nbits, es>& rhs) {
+	return !operator==(lhs, rhs);
+}
+
+// valid binary arithmetic operators
+template<size_t nbits, size_t es>
+inline valid<nbits, es> operator+(const valid<nbits, es>& lhs, const valid<nbits, es>& rhs) {
+	valid<nbits, es> sum(lhs);
+	sum += rhs;
+	return sum;
+}
+template<size_t nbits, size_t es>
+inline valid<nbits, es> operator-(const valid<nbits, es>& lhs, const valid<nbits, es>& rhs) {
+	valid<nbits, es> diff(lhs);
+	diff -= rhs;
+	return diff;
+}
+template<size_t nbits, size_t es>
+inline valid<nbits, es> operator*(const valid<nbits, es>& lhs, const valid<nbits, es>& rhs) {
+	valid<nbits, es> mul(lhs);
+	mul *= rhs;
+	return mul;
+}
+template<size_t nbits, size_t es>
+inline valid<nbits, es> operator/(const valid<nbits, es>& lhs, const valid<nbits, es>& rhs) {
+	valid<nbits, es> ratio(lhs);
+	ratio /= rhs;
+	return ratio;
+}
+
 	}  // namespace unum
 
 } // namespace sw
@@ -5,10 +5,6 @@
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 
 // minimum set of include files to reflect source code dependencies
-// TODO: the dependencies on posit exceptions and trace_constants needs to be removed
-#include "universal/posit/exceptions.hpp"
-#include "universal/posit/trace_constants.hpp"
-#include "universal/bitblock/bitblock.hpp"
 #include "universal/areal/areal.hpp"
 // test helpers, such as, ReportTestResults
 #include "../utils/test_helpers.hpp"
@@ -51,16 +47,8 @@ catch (char const* msg) {
 	std::cerr << msg << std::endl;
 	return EXIT_FAILURE;
 }
-catch (const posit_arithmetic_exception& err) {
-	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
-	return EXIT_FAILURE;
-}
-catch (const quire_exception& err) {
-	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
-	return EXIT_FAILURE;
-}
-catch (const posit_internal_exception& err) {
-	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+catch (const sw::unum::areal_divide_by_zero& err) {
+	std::cerr << "Uncaught areal arithmetic exception: " << err.what() << std::endl;
 	return EXIT_FAILURE;
 }
 catch (const std::runtime_error& err) {
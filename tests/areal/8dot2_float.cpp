@@ -5,10 +5,6 @@
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 
 // minimum set of include files to reflect source code dependencies
-// TODO: the dependency on posit exceptions and trace_constants need to be removed
-#include "universal/posit/exceptions.hpp"
-#include "universal/posit/trace_constants.hpp"
-#include "universal/bitblock/bitblock.hpp"
 #include "universal/areal/areal.hpp"
 // test helpers, such as, ReportTestResults
 #include "../utils/test_helpers.hpp"
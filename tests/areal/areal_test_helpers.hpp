@@ -9,6 +9,7 @@
 #include <typeinfo>
 #include <random>
 #include <limits>
+#include "../utils/binary_operator_helpers.hpp"
 
 namespace sw { namespace unum {
 
@@ -1048,7 +1049,54 @@ namespace sw { namespace unum {
 			return nrOfFailedTests;
 		}
 
+		/////////////////////////////// ARITHMETIC VERIFICATION ////////////////////////////////
+
+		// the reference of an arithmetic operator: the long double result of the values of the operand encodings,
+		// truncated toward zero by the conversion, and marked uncertain when either operand is uncertain
+		template<size_t nbits, size_t es, typename bt>
+		areal<nbits, es, bt> ArealReference(long double v, bool uncertain) {
+			areal<nbits, es, bt> ref(v);
+			if (!uncertain || ref.isnan()) return ref;
+			if (ref.isinf()) {
+				bool negative = ref.sign();
+				maxpos(ref);
+				if (negative) ref = -ref;
+			}
+			ref.setubit();
+			return ref;
+		}
+
+		// compare an arithmetic operator against the reference: exhaustive over all encodings when nrSamples is 0,
+		// random otherwise. The random operands have nearby exponents, and the multiplier and divisor have short fractions,
+		// so that the long double reference is exact, or at least not rounded across an areal encoding, up to 64 bits.
+		template<size_t nbits, size_t es, typename bt = uint8_t>
+		int VerifyArealArithmetic(const std::string& tag, BinaryOperator op, size_t nrSamples, bool bReportIndividualTestCases) {
+			using Areal = areal<nbits, es, bt>;
+			static_assert(nbits <= 64, "VerifyArealArithmetic samples encodings in a 64-bit word");
+			constexpr size_t fbits = Areal::fbits;
+			auto sample = [op](std::mt19937_64& rng, size_t, Areal& a, Areal& b) {
+				constexpr uint64_t expMask = Areal::MAX_EXP_FIELD << (fbits + 1);
+				uint64_t ra = rng(), rb = rng();
+				int64_t ea = int64_t((ra & expMask) >> (fbits + 1));
+				int64_t eb = ea + int64_t(rng() % 17) - 8;
+				if (eb < 0) eb = 0;
+				if (eb > int64_t(Areal::MAX_EXP_FIELD)) eb = int64_t(Areal::MAX_EXP_FIELD);
+				rb = (rb & ~expMask) | (uint64_t(eb) << (fbits + 1));
+				size_t kept = (op == BinaryOperator::DIV) ? 7 : ((op == BinaryOperator::MUL) ? 10 : fbits);
+				if (kept < fbits) rb &= ~(((uint64_t(1) << (fbits - kept)) - 1) << 1);
+				a.set_raw_bits(ra);
+				b.set_raw_bits(rb);
+			};
+			auto verify = [&](const Areal& a, const Areal& b) {
+				Areal c = ApplyBinaryOperator(op, a, b);
+				long double dc = ApplyBinaryOperator(op, a.to_long_double(), b.to_long_double());
+				Areal ref = ArealReference<nbits, es, bt>(dc, a.ubit() || b.ubit());
+				if ((c.isnan() && ref.isnan()) || c.getbits() == ref.getbits()) return true;
+				if (bReportIndividualTestCases) std::cout << tag << " FAIL " << to_binary(a) << " op " << to_binary(b) << " = " << to_binary(c) << " reference " << to_binary(ref) << " (" << dc << ')' << std::endl;
+				return false;
+			};
+			return VerifyBinaryOperator<Areal, nbits>(nrSamples, nbits * 64 + es, sample, verify);
+		}
 
 } // namespace unum
 } // namespace sw
-
@@ -13,24 +13,29 @@
 #include "areal_test_helpers.hpp"
 
 // generate specific test case that you can trace with the trace conditions in areal.hpp
-// for most bugs they are traceable with _trace_conversion and _trace_add
+// for most bugs they are traceable with _trace_triple_conversion and _trace_triple_add
 template<size_t nbits, size_t es, typename Ty>
 void GenerateTestCase(Ty a, Ty b) {
 	Ty ref;
-	sw::unum::areal<nbits, es> pa, pb, pref, psum;
+	sw::unum::areal<nbits, es> pa, pb, pref, presult;
 	pa = a;
 	pb = b;
 	ref = a + b;
 	pref = ref;
-	psum = pa + pb;
+	presult = pa + pb;
 	std::cout << std::setprecision(nbits - 2);
 	std::cout << std::setw(nbits) << a << " + " << std::setw(nbits) << b << " = " << std::setw(nbits) << ref << std::endl;
-	std::cout << pa.get() << " + " << pb.get() << " = " << psum.get() << " (reference: " << pref.get() << ")   " ;
-	std::cout << (pref == psum ? "PASS" : "FAIL") << std::endl << std::endl;
+	std::cout << pa.get() << " + " << pb.get() << " = " << presult.get() << " (reference: " << pref.get() << ")   " ;
+	std::cout << (pref == presult ? "PASS" : "FAIL") << std::endl << std::endl;
 	std::cout << std::setprecision(5);
 }
 
-#define MANUAL_TESTING 1
+template<size_t nbits, size_t es, typename bt = uint8_t>
+int ValidateAddition(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	return sw::unum::VerifyArealArithmetic<nbits, es, bt>(tag, sw::unum::BinaryOperator::ADD, nrSamples, bReportIndividualTestCases);
+}
+
+#define MANUAL_TESTING 0
 #define STRESS_TESTING 0
 
 int main(int argc, char** argv)
@@ -45,11 +50,11 @@ try {
 	// generate individual testcases to hand trace/debug
 	GenerateTestCase<16, 8, double>(INFINITY, INFINITY);
 	GenerateTestCase<8, 4, float>(0.5f, -0.5f);
+	GenerateTestCase<32, 8, float>(1.0f, 1.0e-10f);
 
 	// manual exhaustive test
-	//nrOfFailedTestCases += ReportTestResult(ValidateAddition<8, 2>("Manual Testing", true), "areal<8,2>", "addition");
-	//
-	
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8, 2>("Manual Testing", 0, true), "areal<8,2>", "addition");
+
 	nrOfFailedTestCases = 0;
 
 #else
@@ -58,13 +63,18 @@ try {
 	bool bReportIndividualTestCases = false;
 	std::string tag = "Addition failed: ";
 
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8, 2>(tag, bReportIndividualTestCases), "areal<8,2>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8, 4>(tag, bReportIndividualTestCases), "areal<8,4>", "addition");
+	// exhaustive
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8, 2>(tag, 0, bReportIndividualTestCases), "areal<8,2>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8, 4>(tag, 0, bReportIndividualTestCases), "areal<8,4>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<10, 3, uint16_t>(tag, 0, bReportIndividualTestCases), "areal<10,3,uint16_t>", "addition");
+	// random
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<16, 5, uint16_t>(tag, 100000, bReportIndividualTestCases), "areal<16,5,uint16_t>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<32, 8, uint32_t>(tag, 100000, bReportIndividualTestCases), "areal<32,8,uint32_t>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<64, 11, uint32_t>(tag, 100000, bReportIndividualTestCases), "areal<64,11,uint32_t>", "addition");
 
 #if STRESS_TESTING
-
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<10, 4>(tag, bReportIndividualTestCases), "areal<10,4>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<16, 8>(tag, bReportIndividualTestCases), "areal<16,8>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<12, 4, uint16_t>(tag, 0, bReportIndividualTestCases), "areal<12,4,uint16_t>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<64, 11, uint32_t>(tag, 10000000, bReportIndividualTestCases), "areal<64,11,uint32_t>", "addition");
 #endif  // STRESS_TESTING
 
 #endif  // MANUAL_TESTING
@@ -0,0 +1,99 @@
+// arithmetic_mul.cpp: functional tests for multiplication on arbitrary reals
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// minimum set of include files to reflect source code dependencies
+#include <universal/native/bit_functions.hpp>
+#include <universal/areal/exceptions.hpp>
+#include <universal/areal/areal.hpp>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+#include "areal_test_helpers.hpp"
+
+// generate specific test case that you can trace with the trace conditions in areal.hpp
+// for most bugs they are traceable with _trace_triple_conversion and _trace_triple_mul
+template<size_t nbits, size_t es, typename Ty>
+void GenerateTestCase(Ty a, Ty b) {
+	Ty ref;
+	sw::unum::areal<nbits, es> pa, pb, pref, presult;
+	pa = a;
+	pb = b;
+	ref = a * b;
+	pref = ref;
+	presult = pa * pb;
+	std::cout << std::setprecision(nbits - 2);
+	std::cout << std::setw(nbits) << a << " * " << std::setw(nbits) << b << " = " << std::setw(nbits) << ref << std::endl;
+	std::cout << pa.get() << " * " << pb.get() << " = " << presult.get() << " (reference: " << pref.get() << ")   " ;
+	std::cout << (pref == presult ? "PASS" : "FAIL") << std::endl << std::endl;
+	std::cout << std::setprecision(5);
+}
+
+template<size_t nbits, size_t es, typename bt = uint8_t>
+int ValidateMultiplication(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	return sw::unum::VerifyArealArithmetic<nbits, es, bt>(tag, sw::unum::BinaryOperator::MUL, nrSamples, bReportIndividualTestCases);
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	int nrOfFailedTestCases = 0;
+
+#if MANUAL_TESTING
+
+	// generate individual testcases to hand trace/debug
+	GenerateTestCase<16, 8, double>(INFINITY, 0.0);
+	GenerateTestCase<8, 4, float>(0.5f, -0.375f);
+	GenerateTestCase<32, 8, float>(3.0f, 1.0f / 3.0f);
+
+	// manual exhaustive test
+	nrOfFailedTestCases += ReportTestResult(ValidateMultiplication<8, 2>("Manual Testing", 0, true), "areal<8,2>", "multiplication");
+
+	nrOfFailedTestCases = 0;
+
+#else
+	cout << "Arbitrary Real multiplication validation" << endl;
+
+	bool bReportIndividualTestCases = false;
+	std::string tag = "Multiplication failed: ";
+
+	// exhaustive
+	nrOfFailedTestCases += ReportTestResult(ValidateMultiplication<8, 2>(tag, 0, bReportIndividualTestCases), "areal<8,2>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(ValidateMultiplication<8, 4>(tag, 0, bReportIndividualTestCases), "areal<8,4>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(ValidateMultiplication<10, 3, uint16_t>(tag, 0, bReportIndividualTestCases), "areal<10,3,uint16_t>", "multiplication");
+	// random
+	nrOfFailedTestCases += ReportTestResult(ValidateMultiplication<16, 5, uint16_t>(tag, 100000, bReportIndividualTestCases), "areal<16,5,uint16_t>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(ValidateMultiplication<32, 8, uint32_t>(tag, 100000, bReportIndividualTestCases), "areal<32,8,uint32_t>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(ValidateMultiplication<64, 11, uint32_t>(tag, 100000, bReportIndividualTestCases), "areal<64,11,uint32_t>", "multiplication");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateMultiplication<12, 4, uint16_t>(tag, 0, bReportIndividualTestCases), "areal<12,4,uint16_t>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(ValidateMultiplication<64, 11, uint32_t>(tag, 10000000, bReportIndividualTestCases), "areal<64,11,uint32_t>", "multiplication");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const sw::unum::areal_divide_by_zero& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
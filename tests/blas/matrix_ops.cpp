@@ -17,6 +17,133 @@
 #include <universal/decimal/decimal>
 #include <universal/blas/blas.hpp>
 #include <universal/blas/generators.hpp>
+#include <universal/blas/solvers.hpp>
+
+// reference fused matrix-matrix product: one quire per element of C, columns of B read with stride
+template<size_t nbits, size_t es>
+sw::unum::blas::matrix< sw::unum::posit<nbits, es> > ReferenceFusedMatmul(const sw::unum::blas::matrix< sw::unum::posit<nbits, es> >& A, const sw::unum::blas::matrix< sw::unum::posit<nbits, es> >& B) {
+	sw::unum::blas::matrix< sw::unum::posit<nbits, es> > C(A.rows(), B.cols());
+	for (size_t i = 0; i < A.rows(); ++i) {
+		for (size_t j = 0; j < B.cols(); ++j) {
+			sw::unum::quire<nbits, es, 20> q;
+			for (size_t k = 0; k < A.cols(); ++k) q += sw::unum::quire_mul(A(i, k), B(k, j));
+			convert(q.to_value(), C(i, j));
+		}
+	}
+	return C;
+}
+
+// the blocked, multithreaded fused GEMM must be bit-identical to the reference fused product
+template<size_t nbits, size_t es>
+int VerifyFusedGemm(size_t m, size_t k, size_t n) {
+	using Scalar = sw::unum::posit<nbits, es>;
+	using Matrix = sw::unum::blas::matrix<Scalar>;
+	Matrix A(m, k), B(k, n);
+	sw::unum::blas::uniform_rand(A, -1.0, 1.0);
+	sw::unum::blas::uniform_rand(B, -1.0, 1.0);
+	Matrix Cref = ReferenceFusedMatmul(A, B);
+	int nrOfFailedTests = 0;
+	for (unsigned nrThreads : { 1u, 3u, 0u }) {
+		Matrix C;
+		sw::unum::blas::fused_gemm<nbits, es>(A, B, C, nrThreads);
+		if (C != Cref) ++nrOfFailedTests;
+	}
+	if (A * B != Cref) ++nrOfFailedTests;
+	std::cout << "fused gemm posit<" << nbits << ',' << es << "> " << m << 'x' << k << " * " << k << 'x' << n << (nrOfFailedTests ? " FAIL\n" : " PASS\n");
+	return nrOfFailedTests;
+}
+
+// the blocked, row-partitioned fused GEMV must be bit-identical to the row-by-row fused product
+template<size_t nbits, size_t es>
+int VerifyFusedGemv(size_t m, size_t n) {
+	using Scalar = sw::unum::posit<nbits, es>;
+	using Matrix = sw::unum::blas::matrix<Scalar>;
+	using Vector = sw::unum::blas::vector<Scalar>;
+	Matrix A(m, n);
+	sw::unum::blas::uniform_rand(A, -1.0, 1.0);
+	Vector x(n);
+	for (size_t j = 0; j < n; ++j) x[j] = A(j % m, (j * 7) % n) * Scalar(j);
+	Vector bref(m);
+	for (size_t i = 0; i < m; ++i) {
+		sw::unum::quire<nbits, es, 20> q;
+		for (size_t j = 0; j < n; ++j) q += sw::unum::quire_mul(A(i, j), x[j]);
+		convert(q.to_value(), bref[i]);
+	}
+	int nrOfFailedTests = 0;
+	for (unsigned nrThreads : { 1u, 3u, 0u }) {
+		Vector b;
+		sw::unum::blas::fused_gemv<nbits, es>(A, x, b, nrThreads);
+		for (size_t i = 0; i < m; ++i) if (b[i] != bref[i]) { ++nrOfFailedTests; break; }
+	}
+	Vector b = A * x;
+	for (size_t i = 0; i < m; ++i) if (b[i] != bref[i]) { ++nrOfFailedTests; break; }
+	std::cout << "fused gemv posit<" << nbits << ',' << es << "> " << m << 'x' << n << (nrOfFailedTests ? " FAIL\n" : " PASS\n");
+	return nrOfFailedTests;
+}
+
+template<typename Scalar>
+bool SameVector(const sw::unum::blas::vector<Scalar>& a, const sw::unum::blas::vector<Scalar>& b) {
+	if (size(a) != size(b)) return false;
+	for (size_t i = 0; i < size(a); ++i) if (a[i] != b[i]) return false;
+	return true;
+}
+
+// the sparse matrix-vector product and the sparse solvers must reproduce their dense counterparts
+template<typename Scalar>
+int VerifySparseMatrix(const std::string& tag, size_t m, size_t n) {
+	using Matrix = sw::unum::blas::matrix<Scalar>;
+	using SparseMatrix = sw::unum::blas::sparse_matrix<Scalar>;
+	using Vector = sw::unum::blas::vector<Scalar>;
+	int nrOfFailedTests = 0;
+
+	Matrix A;
+	SparseMatrix S;
+	sw::unum::blas::laplace2D(A, m, n);
+	sw::unum::blas::laplace2D(S, m, n);
+	if (S.dense() != A || SparseMatrix(A).dense() != A || S.nnz() != 5 * m * n - 2 * (m + n)) ++nrOfFailedTests;
+	if (S(0, 0) != A(0, 0) || S(0, m * n - 1) != Scalar(0)) ++nrOfFailedTests;
+
+	// SpMV
+	size_t N = m * n;
+	Vector x(N), b(N), bref(N);
+	for (size_t i = 0; i < N; ++i) x[i] = Scalar(1.0 / double(i + 1));
+	if (!SameVector(S * x, A * x)) ++nrOfFailedTests;
+	matvec(b, S, x);
+	matvec(bref, A, x);
+	if (!SameVector(b, bref)) ++nrOfFailedTests;
+
+	// stationary solvers on a 1D finite difference system
+	constexpr size_t MAX_ITERATIONS = 5;
+	Matrix T;
+	SparseMatrix ST;
+	sw::unum::blas::tridiag(T, 10, Scalar(-1.0), Scalar(4.0), Scalar(-1.0));
+	sw::unum::blas::tridiag(ST, 10, Scalar(-1.0), Scalar(4.0), Scalar(-1.0));
+	Vector ones(10), rhs(10);
+	ones = Scalar(1);
+	rhs = T * ones;
+	Vector xd(10), xs(10);
+	xd = Scalar(0); xs = Scalar(0);
+	sw::unum::blas::Jacobi<Matrix, Vector, MAX_ITERATIONS>(T, rhs, xd);
+	sw::unum::blas::Jacobi<Scalar, MAX_ITERATIONS>(ST, rhs, xs);
+	if (!SameVector(xd, xs)) ++nrOfFailedTests;
+	xd = Scalar(0); xs = Scalar(0);
+	sw::unum::blas::GaussSeidel<Matrix, Vector, MAX_ITERATIONS>(T, rhs, xd);
+	sw::unum::blas::GaussSeidel<Scalar, MAX_ITERATIONS>(ST, rhs, xs);
+	if (!SameVector(xd, xs)) ++nrOfFailedTests;
+
+	// preconditioned conjugate gradient with a sparse Jacobi preconditioner
+	Matrix M = inv(diag(diag(A)));
+	SparseMatrix SM(M);
+	Vector cb = A * x;
+	Vector cxd(N), cxs(N), rd, rs;
+	cxd = Scalar(0); cxs = Scalar(0);
+	sw::unum::blas::cg_dot_dot<Matrix, Vector, 20>(M, A, cb, cxd, rd);
+	sw::unum::blas::cg_dot_dot<SparseMatrix, Vector, 20>(SM, S, cb, cxs, rs);
+	if (!SameVector(cxd, cxs)) ++nrOfFailedTests;
+
+	std::cout << "sparse matrix " << tag << ' ' << m << 'x' << n << " laplace2D" << (nrOfFailedTests ? " FAIL\n" : " PASS\n");
+	return nrOfFailedTests;
+}
 
 int main(int argc, char* argv[])
 try {
@@ -65,6 +192,17 @@ try {
 		}
 	}
 
+	{
+		int nrOfFailedTestCases = 0;
+		nrOfFailedTestCases += VerifyFusedGemm<16, 1>(37, 300, 45);
+		nrOfFailedTestCases += VerifyFusedGemm<32, 2>(70, 260, 33);
+		nrOfFailedTestCases += VerifyFusedGemv<16, 1>(29, 1100);
+		nrOfFailedTestCases += VerifyFusedGemv<32, 2>(301, 257);
+		nrOfFailedTestCases += VerifySparseMatrix<float>("float", 7, 5);
+		nrOfFailedTestCases += VerifySparseMatrix< sw::unum::posit<32, 2> >("posit<32,2>", 6, 9);
+		if (nrOfFailedTestCases) return EXIT_FAILURE;
+	}
+
 	return EXIT_SUCCESS;
 }
 catch (char const* msg) {
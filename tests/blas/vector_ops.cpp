@@ -109,6 +109,57 @@ try {
 		cout << "FAIL: scaling vector b by epsilon failed to yield vector a\n";
 	}
 
+	// lazily evaluated update statements must round element-wise exactly like the eager operators
+	cout << "\nexpression templates\n";
+	{
+		constexpr size_t N = 1000;
+		Vector x(N), p(N), q(N), z(N);
+		for (size_t i = 0; i < N; ++i) {
+			x[i] = Scalar(1.0 / double(i + 1));
+			p[i] = Scalar(double(i) - 500.25);
+			q[i] = Scalar(0.125 * double(i));
+			z[i] = Scalar(3.0 - double(i) / 7.0);
+		}
+		Scalar alpha = 0.3333333, beta = -1.75;
+		// reference: one rounded operation at a time
+		Vector xref(N), pref(N), dref(N);
+		for (size_t i = 0; i < N; ++i) {
+			Scalar ap = alpha * p[i];
+			xref[i] = x[i] + ap;
+			Scalar bp = beta * p[i];
+			pref[i] = z[i] + bp;
+		}
+		Scalar normref = 0;
+		for (size_t i = 0; i < N; ++i) {
+			dref[i] = (xref[i] - x[i]) - q[i] * alpha;
+			normref += abs(dref[i]);
+		}
+
+		Vector x_1(x);
+		x = x + alpha * p;         // aliased, single pass
+		p = z + beta * p;
+		Vector d = x - x_1 - q * alpha;
+		Scalar norm = norm1(x - x_1 - q * alpha);
+		Vector r = (x - x_1) + Vector(q) * alpha;  // temporary operand is evaluated eagerly
+		// a scalar of another type must not bind a temporary vector into a lazy expression
+		static_assert(std::is_same<decltype(2 * Vector(q)), Vector>::value, "int * temporary vector must evaluate eagerly");
+		static_assert(std::is_same<decltype(Vector(q) * 2.0), Vector>::value, "temporary vector * double must evaluate eagerly");
+		static_assert(std::is_same<decltype(2.0 * sw::unum::blas::vector<float>(N)), sw::unum::blas::vector<float>>::value, "double * temporary vector<float> must evaluate eagerly");
+		auto t = 2 * Vector(q);
+		int nrOfFailures = 0;
+		for (size_t i = 0; i < N; ++i) {
+			if (x[i] != xref[i] || p[i] != pref[i] || d[i] != dref[i]) ++nrOfFailures;
+			if (r[i] != (xref[i] - x_1[i]) + q[i] * alpha) ++nrOfFailures;
+			if (t[i] != Scalar(2) * q[i]) ++nrOfFailures;
+		}
+		if (norm != normref) ++nrOfFailures;
+		if (nrOfFailures) {
+			cout << "FAIL: expression templates differ from eager evaluation in " << nrOfFailures << " cases\n";
+			return EXIT_FAILURE;
+		}
+		cout << "PASS: expression templates match eager evaluation\n";
+	}
+
 	cout << endl;
 	return EXIT_SUCCESS;
 }
@@ -0,0 +1,117 @@
+// limb_division.cpp: functional tests for the single-limb and Knuth algorithm D limb division kernels
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <vector>
+
+// minimum set of include files to reflect source code dependencies
+#include <universal/blockbin/limb_arithmetic.hpp>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// operand patterns: random, all ones, a single high bit, and the top limbs equal to trigger the qhat = B-1 path
+template<typename BlockType>
+std::vector<BlockType> GenerateOperand(std::mt19937_64& rng, size_t n, int pattern) {
+	std::vector<BlockType> v(n);
+	for (size_t i = 0; i < n; ++i) {
+		switch (pattern) {
+		case 0:  v[i] = BlockType(rng()); break;
+		case 1:  v[i] = BlockType(~BlockType(0)); break;
+		case 2:  v[i] = (i == n - 1) ? BlockType(BlockType(1) << (rng() % (sizeof(BlockType) * 8))) : BlockType(0); break;
+		default: v[i] = (i + 2 >= n) ? BlockType(~BlockType(0) >> 1) : BlockType(rng()); break;
+		}
+	}
+	if (v[n - 1] == 0) v[n - 1] = 1;
+	return v;
+}
+
+// verify u = q * v + r and r < v
+template<typename BlockType>
+int VerifyLimbDivision(size_t maxLimbs, size_t nrSamples, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	std::mt19937_64 rng(sizeof(BlockType));
+	int nrOfFailedTests = 0;
+	for (size_t n = 1; n <= maxLimbs; ++n) {
+		for (size_t m = n; m <= maxLimbs; ++m) {
+			for (size_t sample = 0; sample < nrSamples; ++sample) {
+				int pattern = int(sample % 4);
+				std::vector<BlockType> u = GenerateOperand<BlockType>(rng, m, int(rng() % 4));
+				std::vector<BlockType> v = GenerateOperand<BlockType>(rng, n, pattern);
+				std::vector<BlockType> q(m - n + 1), r(n), ws(m + n + 1);
+				limb_divmod(q.data(), r.data(), u.data(), m, v.data(), n, ws.data());
+
+				// r < v
+				bool pass = false;
+				for (size_t i = n; i > 0; --i) {
+					if (r[i - 1] != v[i - 1]) { pass = (r[i - 1] < v[i - 1]); break; }
+				}
+				// q * v + r == u
+				std::vector<BlockType> check(m + 1);
+				limb_multiply(check.data(), q.data(), m - n + 1, v.data(), n);
+				limb_add_inplace(check.data(), m + 1, r.data(), n);
+				for (size_t i = 0; i < m; ++i) pass = pass && (check[i] == u[i]);
+				pass = pass && (check[m] == 0);
+				if (!pass) {
+					++nrOfFailedTests;
+					if (bReportIndividualTestCases) std::cout << "FAIL " << m << '/' << n << " limbs, divisor pattern " << pattern << std::endl;
+				}
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	int nrOfFailedTestCases = 0;
+
+#if MANUAL_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbDivision<uint8_t>(6, 100, true), "uint8_t limbs", "division");
+
+#if STRESS_TESTING
+
+#endif
+
+#else
+	bool bReportIndividualTestCases = false;
+	cout << "limb division kernel validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbDivision<uint8_t>(12, 40, bReportIndividualTestCases), "uint8_t limbs", "division");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbDivision<uint16_t>(12, 40, bReportIndividualTestCases), "uint16_t limbs", "division");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbDivision<uint32_t>(12, 40, bReportIndividualTestCases), "uint32_t limbs", "division");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbDivision<uint64_t>(12, 40, bReportIndividualTestCases), "uint64_t limbs", "division");
+
+#if STRESS_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbDivision<uint8_t>(40, 1000, bReportIndividualTestCases), "uint8_t limbs", "division");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbDivision<uint64_t>(40, 1000, bReportIndividualTestCases), "uint64_t limbs", "division");
+
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,141 @@
+// limb_multiply.cpp: functional tests for the schoolbook and Karatsuba limb multiply kernels
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <vector>
+
+// minimum set of include files to reflect source code dependencies
+#include <universal/blockbin/limb_arithmetic.hpp>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// byte-serial reference product, independent of the limb kernels
+std::vector<uint8_t> ReferenceProduct(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b) {
+	std::vector<uint8_t> r(a.size() + b.size(), 0);
+	for (size_t i = 0; i < a.size(); ++i) {
+		uint32_t carry = 0;
+		for (size_t j = 0; j < b.size(); ++j) {
+			uint32_t t = uint32_t(a[i]) * uint32_t(b[j]) + r[i + j] + carry;
+			r[i + j] = uint8_t(t);
+			carry = t >> 8;
+		}
+		r[i + b.size()] = uint8_t(carry);
+	}
+	return r;
+}
+
+template<typename BlockType>
+std::vector<BlockType> ToLimbs(const std::vector<uint8_t>& bytes) {
+	std::vector<BlockType> limbs(bytes.size() / sizeof(BlockType), 0);
+	for (size_t i = 0; i < bytes.size(); ++i) limbs[i / sizeof(BlockType)] |= BlockType(BlockType(bytes[i]) << (8 * (i % sizeof(BlockType))));
+	return limbs;
+}
+
+template<typename BlockType>
+std::vector<uint8_t> ToBytes(const std::vector<BlockType>& limbs) {
+	std::vector<uint8_t> bytes(limbs.size() * sizeof(BlockType));
+	for (size_t i = 0; i < bytes.size(); ++i) bytes[i] = uint8_t(limbs[i / sizeof(BlockType)] >> (8 * (i % sizeof(BlockType))));
+	return bytes;
+}
+
+// operand patterns: random, all ones to maximize the carries in the Karatsuba half sums, and sparse
+std::vector<uint8_t> GenerateOperand(std::mt19937_64& rng, size_t nrBytes, int pattern) {
+	std::vector<uint8_t> v(nrBytes);
+	for (size_t i = 0; i < nrBytes; ++i) {
+		switch (pattern) {
+		case 0:  v[i] = uint8_t(rng()); break;
+		case 1:  v[i] = 0xFF; break;
+		default: v[i] = (rng() % 8 == 0) ? uint8_t(rng()) : 0; break;
+		}
+	}
+	return v;
+}
+
+// compare the full and the truncated product of n-limb by m-limb operands against the byte reference
+template<typename BlockType>
+int VerifyLimbMultiply(size_t maxLimbs, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	std::mt19937_64 rng(sizeof(BlockType));
+	int nrOfFailedTests = 0;
+	for (size_t na = 1; na <= maxLimbs; ++na) {
+		for (size_t nb : { size_t(1), na / 3 + 1, na / 2 + 1, na }) {
+			for (int pattern = 0; pattern < 3; ++pattern) {
+				std::vector<uint8_t> abytes = GenerateOperand(rng, na * sizeof(BlockType), pattern);
+				std::vector<uint8_t> bbytes = GenerateOperand(rng, nb * sizeof(BlockType), pattern);
+				std::vector<BlockType> a = ToLimbs<BlockType>(abytes), b = ToLimbs<BlockType>(bbytes);
+				std::vector<uint8_t> ref = ReferenceProduct(abytes, bbytes);
+
+				std::vector<BlockType> full(na + nb);
+				limb_multiply(full.data(), a.data(), na, b.data(), nb);
+				if (ToBytes(full) != ref) {
+					++nrOfFailedTests;
+					if (bReportIndividualTestCases) std::cout << "FAIL full product " << na << 'x' << nb << " limbs, pattern " << pattern << std::endl;
+				}
+				if (na == nb) {
+					std::vector<BlockType> low(na);
+					limb_multiply_low(low.data(), a.data(), b.data(), na);
+					ref.resize(na * sizeof(BlockType));
+					if (ToBytes(low) != ref) {
+						++nrOfFailedTests;
+						if (bReportIndividualTestCases) std::cout << "FAIL truncated product " << na << " limbs, pattern " << pattern << std::endl;
+					}
+				}
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	int nrOfFailedTestCases = 0;
+
+#if MANUAL_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbMultiply<uint32_t>(40, true), "uint32_t limbs", "multiplication");
+
+#if STRESS_TESTING
+
+#endif
+
+#else
+	bool bReportIndividualTestCases = false;
+	cout << "limb multiply kernel validation: Karatsuba above " << LIMB_KARATSUBA_THRESHOLD << " limbs" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbMultiply<uint8_t>(100, bReportIndividualTestCases), "uint8_t limbs", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbMultiply<uint16_t>(100, bReportIndividualTestCases), "uint16_t limbs", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbMultiply<uint32_t>(100, bReportIndividualTestCases), "uint32_t limbs", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbMultiply<uint64_t>(100, bReportIndividualTestCases), "uint64_t limbs", "multiplication");
+
+#if STRESS_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbMultiply<uint64_t>(300, bReportIndividualTestCases), "uint64_t limbs", "multiplication");
+
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
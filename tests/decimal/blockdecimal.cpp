@@ -0,0 +1,158 @@
+//  blockdecimal.cpp : tests of the fixed-size decimal integer
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+#include <random>
+// configure the decimal arithmetic class
+#define DECIMAL_THROW_ARITHMETIC_EXCEPTION 1
+#include <universal/decimal/decimal>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// enumerate all arithmetic operators on [-ub, ub] against native long long arithmetic
+template<size_t ndigits>
+int VerifyArithmetic(const std::string& tag, long long ub, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Decimal = blockdecimal<ndigits>;
+	int nrOfFailedTests = 0;
+	for (long long i = -ub; i <= ub; ++i) {
+		Decimal a = i;
+		for (long long j = -ub; j <= ub; ++j) {
+			Decimal b = j;
+			bool pass = (a + b == i + j) && (a - b == i - j) && (a * b == i * j);
+			if (j != 0) pass = pass && (a / b == i / j) && (a % b == i % j);
+			pass = pass && ((a < b) == (i < j)) && ((a == b) == (i == j));
+			if (!pass) {
+				++nrOfFailedTests;
+				if (bReportIndividualTestCases) std::cout << tag << " FAIL " << a << " op " << b << std::endl;
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// compare against the dynamic decimal on random operands, reducing the reference modulo 10^ndigits
+template<size_t ndigits>
+int VerifyAgainstDecimal(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Decimal = blockdecimal<ndigits>;
+	std::mt19937_64 rng(ndigits);
+	decimal modulus = 1;
+	modulus <<= int(ndigits);
+	int nrOfFailedTests = 0;
+	for (size_t n = 0; n < nrSamples; ++n) {
+		std::string sa, sb;
+		if (rng() & 0x1) sa += '-';
+		if (rng() & 0x1) sb += '-';
+		// leave room for the carry of the sum
+		size_t la = 1 + rng() % (ndigits - 1), lb = 1 + rng() % (ndigits - 1);
+		for (size_t i = 0; i < la; ++i) sa += char('0' + rng() % 10);
+		for (size_t i = 0; i < lb; ++i) sb += char('0' + rng() % 10);
+		decimal da, db;
+		da.parse(sa);
+		db.parse(sb);
+		da.unpad();
+		db.unpad();
+		if (da.iszero()) da.setpos();
+		if (db.iszero()) db = 7;
+		Decimal a(da), b(db);
+		if (decimal(a) != da) ++nrOfFailedTests;
+		// the wrapped product carries the sign of the full product, with a zero remainder being positive
+		decimal product = da * db;
+		decimal wrapped = remainder(product, modulus);
+		if (decimal(a + b) != da + db || decimal(a - b) != da - db || decimal(a * b) != wrapped || decimal(a / b) != da / db || decimal(a % b) != remainder(da, db)) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL " << a << " op " << b << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// capacity wrap, decimal shifts, and parsing
+template<size_t ndigits>
+int VerifyWrapAndShift(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Decimal = blockdecimal<ndigits>;
+	int nrOfFailedTests = 0;
+	Decimal maxval, one = 1;
+	maxval.parse(std::string(ndigits, '9'));
+	if (!(maxval + one).iszero()) ++nrOfFailedTests;
+	if (to_string(maxval) != std::string(ndigits, '9')) ++nrOfFailedTests;
+	for (int shift = 0; shift <= int(ndigits); ++shift) {
+		Decimal l = one << shift;
+		Decimal r = maxval >> shift;
+		std::string expected_l = (size_t(shift) < ndigits) ? "1" + std::string(size_t(shift), '0') : "0";
+		std::string expected_r = (size_t(shift) < ndigits) ? std::string(ndigits - size_t(shift), '9') : "0";
+		if (to_string(l) != expected_l || to_string(r) != expected_r) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL shift by " << shift << " : " << l << " " << r << std::endl;
+		}
+	}
+	Decimal minusone = -1;
+	if (--Decimal(0) != minusone || ++Decimal(-1) != 0 || !Decimal(-1).isneg()) ++nrOfFailedTests;
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	std::string tag = "blockdecimal tests failed";
+
+#if MANUAL_TESTING
+
+	blockdecimal<30> a, b;
+	a.parse("123456789012345678901234567890");
+	b = 987654321;
+	cout << a << " * " << b << " = " << a * b << endl;
+	cout << a << " / " << b << " = " << a / b << endl;
+
+	cout << "done" << endl;
+
+	return EXIT_SUCCESS;
+#else
+	std::cout << "blockdecimal verification" << std::endl;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	nrOfFailedTestCases += ReportTestResult(VerifyArithmetic<4>(tag, 50, bReportIndividualTestCases), "blockdecimal<4>", "arithmetic");
+	nrOfFailedTestCases += ReportTestResult(VerifyArithmetic<12>(tag, 50, bReportIndividualTestCases), "blockdecimal<12>", "arithmetic");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyAgainstDecimal<9>(tag, 500, bReportIndividualTestCases), "blockdecimal<9>", "decimal reference");
+	nrOfFailedTestCases += ReportTestResult(VerifyAgainstDecimal<25>(tag, 500, bReportIndividualTestCases), "blockdecimal<25>", "decimal reference");
+	nrOfFailedTestCases += ReportTestResult(VerifyAgainstDecimal<100>(tag, 200, bReportIndividualTestCases), "blockdecimal<100>", "decimal reference");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyWrapAndShift<5>(tag, bReportIndividualTestCases), "blockdecimal<5>", "wrap and shift");
+	nrOfFailedTestCases += ReportTestResult(VerifyWrapAndShift<27>(tag, bReportIndividualTestCases), "blockdecimal<27>", "wrap and shift");
+	nrOfFailedTestCases += ReportTestResult(VerifyWrapAndShift<40>(tag, bReportIndividualTestCases), "blockdecimal<40>", "wrap and shift");
+
+#if STRESS_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyArithmetic<12>(tag, 500, bReportIndividualTestCases), "blockdecimal<12>", "arithmetic");
+
+#endif // STRESS_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+
+#endif // MANUAL_TESTING
+}
+catch (char const* msg) {
+	std::cerr << msg << '\n';
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << '\n';
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,157 @@
+//  limbs.cpp : tests of the base-10^9 limb kernels behind arbitrary precision decimal multiplication and division
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+#include <random>
+// configure the decimal arithmetic class
+#define DECIMAL_THROW_ARITHMETIC_EXCEPTION 1
+#include <universal/decimal/decimal>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// generate a random decimal with the given number of digits
+sw::unum::decimal RandomDecimal(std::mt19937_64& rng, size_t nrDigits, bool negative = false) {
+	std::string digits;
+	digits += char('1' + rng() % 9);
+	for (size_t i = 1; i < nrDigits; ++i) digits += char('0' + rng() % 10);
+	sw::unum::decimal d;
+	d.parse(digits);
+	d.setsign(negative);
+	return d;
+}
+
+// reference product: one digit of the multiplier at a time, accumulated with decimal addition
+sw::unum::decimal ReferenceProduct(const sw::unum::decimal& a, const sw::unum::decimal& b) {
+	using namespace sw::unum;
+	decimal product, partial;
+	for (size_t i = 0; i < b.size(); ++i) {
+		partial.setzero();
+		for (uint8_t k = 0; k < b[i]; ++k) partial += a;
+		product += (partial << int(i));
+	}
+	product.setsign(a.sign() != b.sign() && !product.iszero());
+	return product;
+}
+
+// compare the comba and Karatsuba kernels against each other for operand lengths around the threshold
+int VerifyKaratsuba(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	std::mt19937_64 rng(17);
+	int nrOfFailedTests = 0;
+	for (size_t n = 4; n < 3 * declimb_karatsuba_threshold; n += 7) {
+		std::vector<uint32_t> a(n), b(n), comba(2 * n), karatsuba(2 * n), ws(declimb_karatsuba_scratch(n));
+		for (size_t i = 0; i < n; ++i) {
+			// mix in all-nines limbs to exercise the carries of the half sums
+			a[i] = (rng() % 4 == 0) ? DECIMAL_LIMB_BASE - 1 : uint32_t(rng() % DECIMAL_LIMB_BASE);
+			b[i] = (rng() % 4 == 0) ? DECIMAL_LIMB_BASE - 1 : uint32_t(rng() % DECIMAL_LIMB_BASE);
+		}
+		declimb_mul_comba(comba.data(), a.data(), n, b.data(), n);
+		declimb_mul_karatsuba(karatsuba.data(), a.data(), b.data(), n, ws.data());
+		if (comba != karatsuba) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL karatsuba at " << n << " limbs" << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// compare decimal multiplication against the digit-serial reference, including unbalanced operands
+int VerifyLargeMultiplication(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	std::mt19937_64 rng(9);
+	int nrOfFailedTests = 0;
+	const size_t lengths[] = { 1, 8, 9, 10, 40, 81, 200 };
+	for (size_t la : lengths) {
+		for (size_t lb : lengths) {
+			decimal a = RandomDecimal(rng, la, (rng() & 0x1) != 0);
+			decimal b = RandomDecimal(rng, lb, (rng() & 0x1) != 0);
+			decimal c = a * b;
+			decimal ref = ReferenceProduct(a, b);
+			if (c != ref) {
+				++nrOfFailedTests;
+				if (bReportIndividualTestCases) std::cout << tag << " FAIL " << a << " * " << b << " != " << ref << " instead it yielded " << c << std::endl;
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// verify a = q * b + r with |r| < |b| on random operands, with divisor limbs that stress the quotient estimate
+int VerifyLargeDivision(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	std::mt19937_64 rng(10);
+	int nrOfFailedTests = 0;
+	for (size_t la = 1; la < 120; la += 7) {
+		for (size_t lb = 1; lb <= la; lb += 5) {
+			decimal a = RandomDecimal(rng, la, (rng() & 0x1) != 0);
+			decimal b = RandomDecimal(rng, lb, (rng() & 0x1) != 0);
+			if (rng() % 3 == 0) b.parse(std::string(lb, '9'));  // largest top limb
+			if (rng() % 3 == 0) { b.parse("1" + std::string(lb - 1, '0')); }  // smallest top limb
+			decintdiv result = decint_divide(a, b);
+			decimal absr(result.rem), absb(b);
+			absr.setpos();
+			absb.setpos();
+			bool pass = (result.quot * b + result.rem == a) && (absr < absb);
+			if (!pass) {
+				++nrOfFailedTests;
+				if (bReportIndividualTestCases) std::cout << tag << " FAIL " << a << " / " << b << " yielded " << result.quot << " rem " << result.rem << std::endl;
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	std::string tag = "Decimal limb tests failed";
+
+#if MANUAL_TESTING
+
+	decimal a, b;
+	a.parse("123456789012345678901234567890");
+	b.parse("987654321");
+	cout << a << " * " << b << " = " << a * b << endl;
+	cout << a << " / " << b << " = " << a / b << endl;
+
+	cout << "done" << endl;
+
+	return EXIT_SUCCESS;
+#else
+	std::cout << "Decimal limb kernel verification" << std::endl;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	nrOfFailedTestCases += ReportTestResult(VerifyKaratsuba(tag, bReportIndividualTestCases), "decimal", "karatsuba");
+	nrOfFailedTestCases += ReportTestResult(VerifyLargeMultiplication(tag, bReportIndividualTestCases), "decimal", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyLargeDivision(tag, bReportIndividualTestCases), "decimal", "division");
+
+#if STRESS_TESTING
+
+#endif // STRESS_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+
+#endif // MANUAL_TESTING
+}
+catch (char const* msg) {
+	std::cerr << msg << '\n';
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << '\n';
+	return EXIT_FAILURE;
+}
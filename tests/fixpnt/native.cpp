@@ -0,0 +1,147 @@
+// native.cpp: verify the native integer arithmetic of fixpnt<nbits <= 64> against the blockbinary arithmetic
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+#include <random>
+// second: enable/disable fixpnt arithmetic exceptions
+#define FIXPNT_THROW_ARITHMETIC_EXCEPTION 1
+
+// minimum set of include files to reflect source code dependencies
+#include <universal/fixpnt/fixed_point.hpp>
+// fixed-point type manipulators such as pretty printers
+#include <universal/fixpnt/fixpnt_manipulators.hpp>
+#include "../utils/test_helpers.hpp"
+
+// reference results computed with the blockbinary operators, following the generic fixpnt arithmetic
+template<size_t nbits, size_t rbits, bool arithmetic, typename bt>
+sw::unum::blockbinary<nbits, bt> ReferenceSum(const sw::unum::blockbinary<nbits, bt>& a, const sw::unum::blockbinary<nbits, bt>& b, bool subtract) {
+	using namespace sw::unum;
+	blockbinary<nbits + 1, bt> c = subtract ? ursub(a, b) : uradd(a, b);
+	if (arithmetic == Saturating) {
+		fixpnt<nbits, rbits, arithmetic, bt> fp;
+		blockbinary<nbits + 1, bt> saturation = maxpos(fp).getbb();
+		if (c >= saturation) return blockbinary<nbits, bt>(saturation);
+		saturation = maxneg(fp).getbb();
+		if (c <= saturation) return blockbinary<nbits, bt>(saturation);
+	}
+	return blockbinary<nbits, bt>(c);
+}
+template<size_t nbits, size_t rbits, bool arithmetic, typename bt>
+sw::unum::blockbinary<nbits, bt> ReferenceProduct(const sw::unum::blockbinary<nbits, bt>& a, const sw::unum::blockbinary<nbits, bt>& b) {
+	using namespace sw::unum;
+	blockbinary<2 * nbits, bt> c = urmul2(a, b);
+	bool roundUp = c.roundingMode(rbits);
+	c >>= rbits;
+	if (arithmetic == Saturating) {
+		fixpnt<nbits, rbits, arithmetic, bt> fp;
+		blockbinary<2 * nbits, bt> saturation = maxpos(fp).getbb();
+		if (c >= saturation) return blockbinary<nbits, bt>(saturation);
+		saturation = maxneg(fp).getbb();
+		if (c < saturation) return blockbinary<nbits, bt>(saturation);
+	}
+	if (roundUp) ++c;
+	return blockbinary<nbits, bt>(c);
+}
+
+// compare +, -, and * on raw bit patterns: exhaustive when nrSamples is 0, random otherwise
+template<size_t nbits, size_t rbits, bool arithmetic, typename bt>
+int VerifyNativeArithmetic(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Fixed = fixpnt<nbits, rbits, arithmetic, bt>;
+	static_assert(Fixed::nativeArithmetic, "configuration does not use the native arithmetic");
+	std::mt19937_64 rng(nbits * 64 + rbits);
+	constexpr uint64_t mask = (nbits == 64) ? ~0ull : ((1ull << (nbits < 64 ? nbits : 0)) - 1);
+	int nrOfFailedTests = 0;
+	auto verify = [&](uint64_t ra, uint64_t rb) {
+		Fixed a, b;
+		a.set_raw_bits(ra);
+		b.set_raw_bits(rb);
+		blockbinary<nbits, bt> sum = (a + b).getbb(), diff = (a - b).getbb(), product = (a * b).getbb();
+		bool pass = (sum == ReferenceSum<nbits, rbits, arithmetic>(a.getbb(), b.getbb(), false));
+		pass = pass && (diff == ReferenceSum<nbits, rbits, arithmetic>(a.getbb(), b.getbb(), true));
+		pass = pass && (product == ReferenceProduct<nbits, rbits, arithmetic>(a.getbb(), b.getbb()));
+		if (!pass) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL " << to_binary(a) << " op " << to_binary(b) << std::endl;
+		}
+	};
+	if (nrSamples == 0) {
+		for (uint64_t i = 0; i <= mask; ++i) {
+			for (uint64_t j = 0; j <= mask; ++j) verify(i, j);
+		}
+	}
+	else {
+		// mix in the saturation boundaries and the rounding ties
+		const uint64_t specials[] = { 0, 1, mask, mask >> 1, (mask >> 1) + 1, 1ull << (rbits > 0 ? rbits - 1 : 0) };
+		for (uint64_t i : specials) for (uint64_t j : specials) verify(i & mask, j & mask);
+		for (size_t n = 0; n < nrSamples; ++n) verify(rng() & mask, rng() & mask);
+	}
+	return nrOfFailedTests;
+}
+
+// conditional compile flags
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "native fixed-point arithmetic failed: ";
+
+#if MANUAL_TESTING
+
+	fixpnt<16, 8, Saturating, uint16_t> a, b;
+	a = 100.5;
+	b = 3.25;
+	cout << a << " * " << b << " = " << a * b << endl;
+
+	nrOfFailedTestCases = 0; // ignore any failures in MANUAL mode
+#else
+
+	cout << "Fixed-point native arithmetic validation" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<8, 0, Modulo, uint8_t>(tag, 0, bReportIndividualTestCases), "fixpnt<8,0,Modulo,uint8_t>", "native");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<8, 4, Modulo, uint8_t>(tag, 0, bReportIndividualTestCases), "fixpnt<8,4,Modulo,uint8_t>", "native");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<8, 8, Modulo, uint8_t>(tag, 0, bReportIndividualTestCases), "fixpnt<8,8,Modulo,uint8_t>", "native");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<8, 1, Saturating, uint8_t>(tag, 0, bReportIndividualTestCases), "fixpnt<8,1,Saturating,uint8_t>", "native");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<8, 4, Saturating, uint8_t>(tag, 0, bReportIndividualTestCases), "fixpnt<8,4,Saturating,uint8_t>", "native");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<16, 8, Modulo, uint8_t>(tag, 20000, bReportIndividualTestCases), "fixpnt<16,8,Modulo,uint8_t>", "native");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<16, 15, Saturating, uint16_t>(tag, 20000, bReportIndividualTestCases), "fixpnt<16,15,Saturating,uint16_t>", "native");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<24, 12, Saturating, uint8_t>(tag, 20000, bReportIndividualTestCases), "fixpnt<24,12,Saturating,uint8_t>", "native");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<32, 16, Modulo, uint32_t>(tag, 20000, bReportIndividualTestCases), "fixpnt<32,16,Modulo,uint32_t>", "native");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<32, 31, Saturating, uint32_t>(tag, 20000, bReportIndividualTestCases), "fixpnt<32,31,Saturating,uint32_t>", "native");
+	if constexpr (fixpnt_native_limit == 64) {
+		nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<40, 20, Saturating, uint8_t>(tag, 20000, bReportIndividualTestCases), "fixpnt<40,20,Saturating,uint8_t>", "native");
+		nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<64, 32, Modulo, uint32_t>(tag, 20000, bReportIndividualTestCases), "fixpnt<64,32,Modulo,uint32_t>", "native");
+		nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<64, 48, Saturating, uint32_t>(tag, 20000, bReportIndividualTestCases), "fixpnt<64,48,Saturating,uint32_t>", "native");
+	}
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<12, 6, Saturating, uint8_t>(tag, 0, bReportIndividualTestCases), "fixpnt<12,6,Saturating,uint8_t>", "native");
+#endif
+
+#endif
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
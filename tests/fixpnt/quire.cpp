@@ -0,0 +1,175 @@
+// quire.cpp: verify the fixed-point quire and the fused dot product with a single rounding step
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+// second: enable/disable fixpnt arithmetic exceptions
+#define FIXPNT_THROW_ARITHMETIC_EXCEPTION 1
+
+// minimum set of include files to reflect source code dependencies
+#include <universal/fixpnt/fixed_point.hpp>
+#include <universal/fixpnt/fixpnt_quire.hpp>
+// fixed-point type manipulators such as pretty printers
+#include <universal/fixpnt/fixpnt_manipulators.hpp>
+#include "../utils/test_helpers.hpp"
+
+// a dot product of length one is a single product: it must round exactly as the fixpnt multiply does
+template<size_t nbits, size_t rbits, bool arithmetic, typename bt>
+int VerifySingleProduct(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Fixed = fixpnt<nbits, rbits, arithmetic, bt>;
+	std::mt19937_64 rng(nbits * 64 + rbits);
+	int nrOfFailedTests = 0;
+	std::vector<Fixed> x(1), y(1);
+	for (size_t n = 0; n < nrSamples; ++n) {
+		x[0].set_raw_bits(rng());
+		y[0].set_raw_bits(rng());
+		Fixed product = x[0] * y[0];
+		Fixed dot = fdp(x, y);
+		if (dot != product) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL " << to_binary(x[0]) << " * " << to_binary(y[0]) << " : " << to_binary(dot) << " != " << to_binary(product) << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// random dot products with operands of at most significantBits bits, so that the sum of products is exact in a double:
+// the reference is the exact sum, rounded once by the double to fixpnt conversion
+template<size_t nbits, size_t rbits, bool arithmetic, typename bt>
+int VerifyFusedDotProduct(const std::string& tag, size_t vectorSize, size_t significantBits, size_t nrSamples, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Fixed = fixpnt<nbits, rbits, arithmetic, bt>;
+	std::mt19937_64 rng(nbits * 64 + rbits + vectorSize);
+	const int64_t range = int64_t(1) << significantBits;
+	const double ulp = std::ldexp(1.0, -int(rbits));
+	int nrOfFailedTests = 0;
+	std::vector<Fixed> x(vectorSize), y(vectorSize);
+	for (size_t n = 0; n < nrSamples; ++n) {
+		double exact = 0.0;
+		for (size_t i = 0; i < vectorSize; ++i) {
+			double a = double(int64_t(rng() % uint64_t(2 * range)) - range) * ulp;
+			double b = double(int64_t(rng() % uint64_t(2 * range)) - range) * ulp;
+			x[i] = a;
+			y[i] = b;
+			exact += a * b;
+		}
+		Fixed reference = exact;
+		Fixed dot = fdp(x, y);
+		if (dot != reference) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL fdp " << dot << " != " << reference << " exact " << exact << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// intermediate sums may leave the dynamic range of the fixpnt: only the final value saturates or wraps
+template<size_t nbits, size_t rbits, bool arithmetic, typename bt>
+int VerifyIntermediateRange(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Fixed = fixpnt<nbits, rbits, arithmetic, bt>;
+	int nrOfFailedTests = 0;
+	Fixed mp, mn, one(1), half(0.5f), zero(0);
+	maxpos(mp);
+	maxneg(mn);
+	// maxpos + maxpos - maxpos == maxpos
+	std::vector<Fixed> x = { mp, mp, mp }, y = { one, one, -one };
+	if (fdp(x, y) != mp) ++nrOfFailedTests;
+	// maxpos * 4 saturates, or wraps to the lower nbits of the exact sum
+	x = { mp, mp, mp, mp };
+	y = { one, one, one, one };
+	Fixed expected = (arithmetic == Saturating) ? mp : mp + mp + mp + mp;
+	if (fdp(x, y) != expected) ++nrOfFailedTests;
+	x = { mn, mn, mn, mn };
+	expected = (arithmetic == Saturating) ? mn : mn + mn + mn + mn;
+	if (fdp(x, y) != expected) ++nrOfFailedTests;
+	// the quire state: accumulation of fixpnt values and products, reset to zero
+	fixpnt_quire<nbits, rbits, arithmetic, bt> q(mp);
+	q.fma(mp, one);
+	q -= mp;
+	q -= mp;
+	if (!q.iszero()) ++nrOfFailedTests;
+	q += half;
+	q.fma(half, -one);
+	if (!q.iszero() || q.to_fixpnt() != zero) ++nrOfFailedTests;
+	q = mn;
+	if (!q.sign() || Fixed(q) != mn) ++nrOfFailedTests;
+	q.clear();
+	if (!q.iszero()) ++nrOfFailedTests;
+	if (nrOfFailedTests > 0 && bReportIndividualTestCases) std::cout << tag << " FAIL intermediate range" << std::endl;
+	return nrOfFailedTests;
+}
+
+// conditional compile flags
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "fixed-point quire failed: ";
+
+#if MANUAL_TESTING
+
+	using Fixed = fixpnt<16, 12, Saturating, uint16_t>;
+	std::vector<Fixed> x = { 0.125, 3.5, -2.75, 7.0 }, y = { 1.5, 2.0, 0.5, 1.0 };
+	fixpnt_quire<16, 12, Saturating, uint16_t> q;
+	for (size_t i = 0; i < x.size(); ++i) q.fma(x[i], y[i]);
+	cout << "quire : " << q << endl;
+	cout << "fdp   : " << fdp(x, y) << endl;
+
+	nrOfFailedTestCases = 0; // ignore any failures in MANUAL mode
+#else
+
+	cout << "Fixed-point quire and fused dot product validation" << endl;
+
+	// native int64_t accumulators
+	nrOfFailedTestCases += ReportTestResult(VerifySingleProduct<8, 4, Modulo, uint8_t>(tag, 5000, bReportIndividualTestCases), "fixpnt<8,4,Modulo,uint8_t>", "fdp product");
+	nrOfFailedTestCases += ReportTestResult(VerifySingleProduct<16, 15, Saturating, uint16_t>(tag, 5000, bReportIndividualTestCases), "fixpnt<16,15,Saturating,uint16_t>", "fdp product");
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedDotProduct<16, 8, Modulo, uint8_t>(tag, 32, 6, 500, bReportIndividualTestCases), "fixpnt<16,8,Modulo,uint8_t>", "fdp");
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedDotProduct<16, 12, Saturating, uint16_t>(tag, 64, 8, 500, bReportIndividualTestCases), "fixpnt<16,12,Saturating,uint16_t>", "fdp");
+	nrOfFailedTestCases += ReportTestResult(VerifyIntermediateRange<8, 4, Modulo, uint8_t>(tag, bReportIndividualTestCases), "fixpnt<8,4,Modulo,uint8_t>", "quire range");
+	nrOfFailedTestCases += ReportTestResult(VerifyIntermediateRange<16, 12, Saturating, uint16_t>(tag, bReportIndividualTestCases), "fixpnt<16,12,Saturating,uint16_t>", "quire range");
+
+	// native __int128 accumulators, or blockbinary accumulators when the compiler does not provide them
+	nrOfFailedTestCases += ReportTestResult(VerifySingleProduct<32, 16, Saturating, uint32_t>(tag, 5000, bReportIndividualTestCases), "fixpnt<32,16,Saturating,uint32_t>", "fdp product");
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedDotProduct<32, 24, Saturating, uint32_t>(tag, 100, 12, 500, bReportIndividualTestCases), "fixpnt<32,24,Saturating,uint32_t>", "fdp");
+	nrOfFailedTestCases += ReportTestResult(VerifyIntermediateRange<32, 16, Modulo, uint16_t>(tag, bReportIndividualTestCases), "fixpnt<32,16,Modulo,uint16_t>", "quire range");
+
+	// blockbinary accumulators
+	nrOfFailedTestCases += ReportTestResult(VerifySingleProduct<64, 32, Saturating, uint32_t>(tag, 5000, bReportIndividualTestCases), "fixpnt<64,32,Saturating,uint32_t>", "fdp product");
+	nrOfFailedTestCases += ReportTestResult(VerifySingleProduct<80, 40, Modulo, uint32_t>(tag, 2000, bReportIndividualTestCases), "fixpnt<80,40,Modulo,uint32_t>", "fdp product");
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedDotProduct<64, 32, Saturating, uint32_t>(tag, 100, 20, 200, bReportIndividualTestCases), "fixpnt<64,32,Saturating,uint32_t>", "fdp");
+	nrOfFailedTestCases += ReportTestResult(VerifyIntermediateRange<64, 32, Saturating, uint32_t>(tag, bReportIndividualTestCases), "fixpnt<64,32,Saturating,uint32_t>", "quire range");
+	nrOfFailedTestCases += ReportTestResult(VerifyIntermediateRange<64, 32, Modulo, uint32_t>(tag, bReportIndividualTestCases), "fixpnt<64,32,Modulo,uint32_t>", "quire range");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(VerifyFusedDotProduct<32, 24, Saturating, uint32_t>(tag, 1000, 12, 10000, bReportIndividualTestCases), "fixpnt<32,24,Saturating,uint32_t>", "fdp");
+#endif
+
+#endif
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -5,6 +5,7 @@
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <iostream>
 #include <string>
+#include <random>
 // configure the integer arithmetic class
 #define INTEGER_THROW_ARITHMETIC_EXCEPTION 0
 #include <universal/integer/integer.hpp>
@@ -48,6 +49,53 @@ void ReproducibilityTestSuite() {
 }
 
 
+// wide integers have no native reference: verify that uint32_t and uint64_t limbs produce the same bits as uint8_t limbs
+template<size_t nbits, typename BlockType>
+int VerifyLimbEquivalence(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Reference = integer<nbits, uint8_t>;
+	using Integer = integer<nbits, BlockType>;
+	std::mt19937_64 rng(nbits);
+	int nrOfFailedTests = 0;
+	for (size_t n = 0; n < nrSamples; ++n) {
+		Reference ra, rb;
+		Integer a, b;
+		for (unsigned i = 0; i < Reference::nrBytes; ++i) {
+			uint8_t mask = (i == Reference::nrBytes - 1) ? uint8_t(0xFF >> (Reference::nrBytes * 8 - nbits)) : uint8_t(0xFF);
+			uint8_t x = uint8_t(rng()) & mask, y = uint8_t(rng()) & mask;
+			ra.setbyte(i, x); a.setbyte(i, x);
+			rb.setbyte(i, y); b.setbyte(i, y);
+		}
+		bool pass = true;
+		pass = pass && (to_binary(a + b) == to_binary(ra + rb));
+		pass = pass && (to_binary(a - b) == to_binary(ra - rb));
+		pass = pass && ((a < b) == (ra < rb)) && ((b < a) == (rb < ra)) && ((a == b) == (ra == rb));
+		pass = pass && (findMsb(a) == findMsb(ra));
+		if (!pass) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL " << to_binary(ra) << " and " << to_binary(rb) << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// widening conversion must sign extend, whether srcbits and nbits fall in the same limb or not
+template<size_t srcbits, size_t nbits, typename BlockType>
+int VerifySignExtension(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	constexpr long long NR_VALUES = 1ll << srcbits;
+	int nrOfFailedTests = 0;
+	for (long long v = -NR_VALUES / 2; v < NR_VALUES / 2; ++v) {
+		integer<srcbits, BlockType> a = v;
+		integer<nbits, BlockType> b(a);
+		if ((long long)(b) != v) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL " << to_binary(a) << " widens to " << to_binary(b) << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
 #define MANUAL_TESTING 0
 #define STRESS_TESTING 0
 
@@ -86,6 +134,19 @@ try {
 	nrOfFailedTestCases += ReportTestResult(VerifyAddition<10, uint8_t>(tag, bReportIndividualTestCases), "integer<10, uint8_t>", "addition");
 	nrOfFailedTestCases += ReportTestResult(VerifyAddition<12, uint8_t>(tag, bReportIndividualTestCases), "integer<12, uint8_t>", "addition");
 	nrOfFailedTestCases += ReportTestResult(VerifyAddition<12, uint16_t>(tag, bReportIndividualTestCases), "integer<12, uint16_t>", "addition");
+	nrOfFailedTestCases += ReportTestResult(VerifyAddition<12, uint32_t>(tag, bReportIndividualTestCases), "integer<12, uint32_t>", "addition");
+	nrOfFailedTestCases += ReportTestResult(VerifyAddition<12, uint64_t>(tag, bReportIndividualTestCases), "integer<12, uint64_t>", "addition");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbEquivalence<128, uint32_t>(tag, 10000, bReportIndividualTestCases), "integer<128, uint32_t>", "limbs");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbEquivalence<128, uint64_t>(tag, 10000, bReportIndividualTestCases), "integer<128, uint64_t>", "limbs");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbEquivalence<250, uint64_t>(tag, 10000, bReportIndividualTestCases), "integer<250, uint64_t>", "limbs");
+	nrOfFailedTestCases += ReportTestResult(VerifyLimbEquivalence<1024, uint32_t>(tag, 1000, bReportIndividualTestCases), "integer<1024, uint32_t>", "limbs");
+	nrOfFailedTestCases += ReportTestResult(VerifySignExtension<5, 7, uint8_t>(tag, bReportIndividualTestCases), "integer<5> to integer<7>", "sign extension");
+	nrOfFailedTestCases += ReportTestResult(VerifySignExtension<9, 15, uint16_t>(tag, bReportIndividualTestCases), "integer<9, uint16_t> to integer<15>", "sign extension");
+	nrOfFailedTestCases += ReportTestResult(VerifySignExtension<20, 30, uint32_t>(tag, bReportIndividualTestCases), "integer<20, uint32_t> to integer<30>", "sign extension");
+	nrOfFailedTestCases += ReportTestResult(VerifySignExtension<5, 12, uint8_t>(tag, bReportIndividualTestCases), "integer<5> to integer<12>", "sign extension");
+	nrOfFailedTestCases += ReportTestResult(VerifySignExtension<12, 16, uint8_t>(tag, bReportIndividualTestCases), "integer<12> to integer<16>", "sign extension");
+	nrOfFailedTestCases += ReportTestResult(VerifySignExtension<12, 40, uint8_t>(tag, bReportIndividualTestCases), "integer<12> to integer<40>", "sign extension");
+	nrOfFailedTestCases += ReportTestResult(VerifySignExtension<20, 50, uint32_t>(tag, bReportIndividualTestCases), "integer<20, uint32_t> to integer<50>", "sign extension");
 
 
 #if STRESS_TESTING
@@ -5,6 +5,7 @@
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <iostream>
 #include <string>
+#include <random>
 // configure the integer arithmetic class
 // we need to enable exceptions to validate divide by zero and overflow conditions
 // however, we also need to make this work with exceptions turned off: TODO
@@ -207,6 +208,37 @@ void ExamplePattern() {
 	GenerateDivTest<sw::unum::integer<16> >(2, 16, z);
 }
 
+// wide integers have no native reference: verify a = q * b + r with |r| < |b| and r carrying the sign of a
+template<size_t nbits, typename BlockType>
+int VerifyWideDivision(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Integer = integer<nbits, BlockType>;
+	std::mt19937_64 rng(nbits);
+	int nrOfFailedTests = 0;
+	for (size_t n = 0; n < nrSamples; ++n) {
+		// random magnitudes of random length so that the quotient length varies
+		Integer a, b;
+		size_t abytes = 1 + rng() % (Integer::nrBytes - 1), bbytes = 1 + rng() % abytes;
+		for (unsigned i = 0; i < abytes; ++i) a.setbyte(i, uint8_t(rng()));
+		for (unsigned i = 0; i < bbytes; ++i) b.setbyte(i, uint8_t(rng()));
+		if (b.iszero()) b = 1;
+		bool a_negative = !a.iszero() && (rng() & 1);
+		bool b_negative = (rng() & 1);
+		Integer q = (a_negative ? -a : a) / (b_negative ? -b : b);
+		Integer r = (a_negative ? -a : a) % (b_negative ? -b : b);
+		// the magnitudes must satisfy |a| = |q| * |b| + |r|, the signs follow the C++ truncation rules
+		bool q_negative = !q.iszero() && (a_negative ^ b_negative);
+		bool r_negative = !r.iszero() && a_negative;
+		Integer abs_q = q_negative ? -q : q, abs_r = r_negative ? -r : r;
+		bool pass = (abs_q * b + abs_r == a) && (abs_r < b) && !abs_q.sign() && !abs_r.sign();
+		if (!pass) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL " << a << " / " << b << " = " << q << " rem " << r << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
 #define MANUAL_TESTING 0
 #define STRESS_TESTING 0
 
@@ -244,6 +276,13 @@ try {
 	nrOfFailedTestCases += ReportTestResult(VerifyDivision<10, uint8_t>(tag, bReportIndividualTestCases), "integer<10, uint8_t>", "division");
 	nrOfFailedTestCases += ReportTestResult(VerifyDivision<12, uint8_t>(tag, bReportIndividualTestCases), "integer<12, uint8_t>", "division");
 	nrOfFailedTestCases += ReportTestResult(VerifyDivision<12, uint16_t>(tag, bReportIndividualTestCases), "integer<12, uint16_t>", "division");
+	nrOfFailedTestCases += ReportTestResult(VerifyDivision<12, uint32_t>(tag, bReportIndividualTestCases), "integer<12, uint32_t>", "division");
+	nrOfFailedTestCases += ReportTestResult(VerifyDivision<12, uint64_t>(tag, bReportIndividualTestCases), "integer<12, uint64_t>", "division");
+	// Knuth algorithm D on wide integers
+	nrOfFailedTestCases += ReportTestResult(VerifyWideDivision<128, uint8_t>(tag, 10000, bReportIndividualTestCases), "integer<128, uint8_t>", "division");
+	nrOfFailedTestCases += ReportTestResult(VerifyWideDivision<256, uint32_t>(tag, 10000, bReportIndividualTestCases), "integer<256, uint32_t>", "division");
+	nrOfFailedTestCases += ReportTestResult(VerifyWideDivision<250, uint64_t>(tag, 10000, bReportIndividualTestCases), "integer<250, uint64_t>", "division");
+	nrOfFailedTestCases += ReportTestResult(VerifyWideDivision<1024, uint64_t>(tag, 1000, bReportIndividualTestCases), "integer<1024, uint64_t>", "division");
 
 #if STRESS_TESTING
 
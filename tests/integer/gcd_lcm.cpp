@@ -6,7 +6,11 @@
 //
 // This file is part of the universal number project, which is released under an MIT Open Source license.
 #include <iostream>
+#include <string>
+#include <random>
 #include <universal/integer/integer>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
 
 template<size_t nbits, typename BlockType>
 sw::unum::integer<nbits, BlockType> greatest_common_divisor(const sw::unum::integer<nbits, BlockType>& a, const sw::unum::integer<nbits, BlockType>& b) {
@@ -14,8 +18,80 @@ sw::unum::integer<nbits, BlockType> greatest_common_divisor(const sw::unum::inte
 	return b.iszero() ? a : greatest_common_divisor(b, a % b);
 }
 
+// Euclid's remainder loop as the reference
+template<size_t nbits, typename BlockType>
+sw::unum::integer<nbits, BlockType> euclid_gcd(sw::unum::integer<nbits, BlockType> a, sw::unum::integer<nbits, BlockType> b) {
+	if (a.sign()) a = -a;
+	if (b.sign()) b = -b;
+	while (!b.iszero()) {
+		sw::unum::integer<nbits, BlockType> r = a % b;
+		a = b;
+		b = r;
+	}
+	return a;
+}
+
+// random operands that share a random common factor, so that the gcd is not trivially 1
+template<size_t nbits, typename BlockType>
+int VerifyGCD(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Integer = integer<nbits, BlockType>;
+	std::mt19937_64 rng(nbits);
+	auto random = [&rng](size_t nrBytes) {
+		Integer v;
+		size_t bytes = 1 + rng() % nrBytes;
+		for (unsigned i = 0; i < bytes; ++i) v.setbyte(i, uint8_t(rng()));
+		return v;
+	};
+	int nrOfFailedTests = 0;
+	for (size_t n = 0; n < nrSamples; ++n) {
+		Integer common = random(Integer::nrBytes / 4);
+		Integer a = random(Integer::nrBytes / 2) * common;
+		Integer b = random(Integer::nrBytes / 2) * common;
+		if (rng() & 1) a = -a;
+		if (n % 16 == 0) b = 0;
+		Integer ref = euclid_gcd(a, b);
+		Integer g = gcd(a, b);
+		bool pass = (g == ref) && (binary_gcd(a, b) == ref) && (binary_gcd(b, a) == ref);
+		if constexpr (sizeof(BlockType) >= 4) pass = pass && (lehmer_gcd(a, b) == ref) && (lehmer_gcd(b, a) == ref);
+		if (!pass) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL gcd(" << a << ", " << b << ") = " << g << " instead of " << ref << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// the tree reductions of a set must agree with the linear folds
+template<size_t nbits, typename BlockType>
+int VerifyTreeReduction(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Integer = integer<nbits, BlockType>;
+	int nrOfFailedTests = 0;
+	std::vector<Integer> v;
+	for (int i = 2; i <= 23; ++i) {
+		v.push_back(Integer(i));
+		Integer gcdFold = v[0], lcmFold = v[0];
+		for (size_t k = 1; k < v.size(); ++k) {
+			gcdFold = gcd(gcdFold, v[k]);
+			lcmFold = lcm(lcmFold, v[k]);
+		}
+		if (gcd(v) != gcdFold || lcm(v) != lcmFold) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL lcm(2 through " << i << ") = " << lcm(v) << " instead of " << lcmFold << std::endl;
+		}
+	}
+	// lcm(2 through 23) = 5354228880
+	if (lcm(v) != 5354228880ll) ++nrOfFailedTests;
+	// a common factor of 2^5 * 3 * 7 in every element
+	std::vector<Integer> w;
+	for (int i = 1; i <= 9; ++i) w.push_back(Integer(672 * (2 * i + 1)));
+	if (gcd(w) != 672) ++nrOfFailedTests;
+	return nrOfFailedTests;
+}
+
 // conditional compilation
-#define MANUAL_TESTING 1
+#define MANUAL_TESTING 0
 #define STRESS_TESTING 0
 
 int main() 
@@ -99,10 +175,27 @@ try {
 	// GCD of three numbers is
 	// gcd(a, b, c) == gcd(a, gcd(b, c)) == gcd(gcd(a, b), c) == gcd(b, gcd(a, c))
 
+	std::string tag = "gcd/lcm failed";
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	cout << "Greatest common divisor and least common multiple verification" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(VerifyGCD<64, uint8_t>(tag, 1000, bReportIndividualTestCases), "integer<64, uint8_t>", "gcd");
+	nrOfFailedTestCases += ReportTestResult(VerifyGCD<128, uint32_t>(tag, 1000, bReportIndividualTestCases), "integer<128, uint32_t>", "gcd");
+	nrOfFailedTestCases += ReportTestResult(VerifyGCD<512, uint32_t>(tag, 500, bReportIndividualTestCases), "integer<512, uint32_t>", "gcd");
+	nrOfFailedTestCases += ReportTestResult(VerifyGCD<1024, uint64_t>(tag, 200, bReportIndividualTestCases), "integer<1024, uint64_t>", "gcd");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyTreeReduction<64, uint16_t>(tag, bReportIndividualTestCases), "integer<64, uint16_t>", "gcd/lcm tree");
+	nrOfFailedTestCases += ReportTestResult(VerifyTreeReduction<1024, uint32_t>(tag, bReportIndividualTestCases), "integer<1024, uint32_t>", "gcd/lcm tree");
 
 #if STRESS_TESTING
 
+	nrOfFailedTestCases += ReportTestResult(VerifyGCD<4096, uint64_t>(tag, 100, bReportIndividualTestCases), "integer<4096, uint64_t>", "gcd");
+
 #endif // STRESS_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
 #endif // MANUAL_TESTING
 
 
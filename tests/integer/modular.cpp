@@ -0,0 +1,148 @@
+// modular.cpp: functional tests for the Montgomery and Barrett modular reduction contexts
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+#include <random>
+// configure the integer arithmetic class
+#define INTEGER_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/integer/integer>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// random positive integer with up to nrBytes significant bytes
+template<size_t nbits, typename BlockType>
+sw::unum::integer<nbits, BlockType> RandomPositive(std::mt19937_64& rng, size_t nrBytes) {
+	sw::unum::integer<nbits, BlockType> a;
+	size_t bytes = 1 + rng() % nrBytes;
+	for (unsigned i = 0; i < bytes; ++i) a.setbyte(i, uint8_t(rng()));
+	return a;
+}
+
+// reference modular exponentiation by square-and-multiply with a remainder after every product
+template<size_t nbits, typename BlockType>
+sw::unum::integer<nbits, BlockType> ReferencePowmod(const sw::unum::integer<nbits, BlockType>& base, const sw::unum::integer<nbits, BlockType>& exponent, const sw::unum::integer<nbits, BlockType>& modulus) {
+	using namespace sw::unum;
+	integer<2 * nbits, BlockType> m(modulus), x(base), result(1);
+	x %= m;
+	result %= m;
+	for (int i = findMsb(exponent); i >= 0; --i) {
+		result = (result * result) % m;
+		if (exponent.at(unsigned(i))) result = (result * x) % m;
+	}
+	integer<nbits, BlockType> r;
+	r.bitcopy(result);
+	return r;
+}
+
+// compare mulmod and pow of both contexts against the reference for random odd and even moduli
+// the operands are limited to half the width so that the reference products fit in integer<2*nbits>
+template<size_t nbits, typename BlockType>
+int VerifyModularContexts(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Integer = integer<nbits, BlockType>;
+	std::mt19937_64 rng(nbits);
+	int nrOfFailedTests = 0;
+	for (size_t n = 0; n < nrSamples; ++n) {
+		Integer m = RandomPositive<nbits, BlockType>(rng, Integer::nrBytes - 1);
+		if (m.iszero()) m = 1;
+		Integer a = RandomPositive<nbits, BlockType>(rng, Integer::nrBytes - 1) % m;
+		Integer b = RandomPositive<nbits, BlockType>(rng, Integer::nrBytes - 1) % m;
+		Integer e = RandomPositive<nbits, BlockType>(rng, (Integer::nrBytes < 8 ? Integer::nrBytes - 1 : 8));
+
+		integer<2 * nbits, BlockType> product = (integer<2 * nbits, BlockType>(a) * integer<2 * nbits, BlockType>(b)) % integer<2 * nbits, BlockType>(m);
+		Integer refProduct;
+		refProduct.bitcopy(product);
+		Integer refPower = ReferencePowmod(a, e, m);
+
+		barrett<nbits, BlockType> br(m);
+		bool pass = (br.mulmod(a, b) == refProduct) && (br.pow(a, e) == refPower);
+		if (m.isodd()) {
+			montgomery<nbits, BlockType> mg(m);
+			pass = pass && (mg.mulmod(a, b) == refProduct) && (mg.pow(a, e) == refPower);
+			pass = pass && (mg.from_montgomery(mg.to_montgomery(a)) == a);
+		}
+		pass = pass && (powmod(a, e, m) == refPower);
+		if (!pass) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL " << a << " ^ " << e << " mod " << m << " != " << refPower << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// Fermat's little theorem on a known prime: a^(p-1) = 1 mod p
+template<size_t nbits, typename BlockType>
+int VerifyFermatLittleTheorem(const std::string& tag, const std::string& prime, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Integer = integer<nbits, BlockType>;
+	int nrOfFailedTests = 0;
+	Integer p;
+	parse(prime, p);
+	montgomery<nbits, BlockType> mg(p);
+	for (int a = 2; a < 20; ++a) {
+		if (mg.pow(Integer(a), p - 1) != 1) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL " << a << " ^ (p - 1) mod " << p << " != 1" << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	std::string tag = "modular reduction failed";
+
+#if MANUAL_TESTING
+
+	integer<64, uint32_t> m = 1000003, a = 12345, e = 65537;
+	montgomery<64, uint32_t> mg(m);
+	cout << a << " ^ " << e << " mod " << m << " = " << mg.pow(a, e) << endl;
+
+	cout << "done" << endl;
+
+	return EXIT_SUCCESS;
+#else
+	std::cout << "Modular reduction context verification" << std::endl;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	nrOfFailedTestCases += ReportTestResult(VerifyModularContexts<32, uint8_t>(tag, 1000, bReportIndividualTestCases), "integer<32, uint8_t>", "modular");
+	nrOfFailedTestCases += ReportTestResult(VerifyModularContexts<64, uint16_t>(tag, 1000, bReportIndividualTestCases), "integer<64, uint16_t>", "modular");
+	nrOfFailedTestCases += ReportTestResult(VerifyModularContexts<128, uint32_t>(tag, 500, bReportIndividualTestCases), "integer<128, uint32_t>", "modular");
+	nrOfFailedTestCases += ReportTestResult(VerifyModularContexts<250, uint64_t>(tag, 200, bReportIndividualTestCases), "integer<250, uint64_t>", "modular");
+
+	// Mersenne primes 2^61 - 1 and 2^127 - 1
+	nrOfFailedTestCases += ReportTestResult(VerifyFermatLittleTheorem<64, uint32_t>(tag, "2305843009213693951", bReportIndividualTestCases), "integer<64, uint32_t>", "Fermat");
+	nrOfFailedTestCases += ReportTestResult(VerifyFermatLittleTheorem<512, uint64_t>(tag, "170141183460469231731687303715884105727", bReportIndividualTestCases), "integer<512, uint64_t>", "Fermat");
+
+#if STRESS_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyModularContexts<1024, uint64_t>(tag, 100, bReportIndividualTestCases), "integer<1024, uint64_t>", "modular");
+
+#endif // STRESS_TESTING
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+
+#endif // MANUAL_TESTING
+}
+catch (char const* msg) {
+	std::cerr << msg << '\n';
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << '\n';
+	return EXIT_FAILURE;
+}
@@ -5,6 +5,7 @@
 // This file is part of the universal numbers project, which is released under an MIT Open Source license.
 #include <iostream>
 #include <string>
+#include <random>
 // configure the integer arithmetic class
 #define INTEGER_THROW_ARITHMETIC_EXCEPTION 0
 #include <universal/integer/integer.hpp>
@@ -37,6 +38,34 @@ void ExamplePattern() {
 	GenerateMulTest<sw::unum::integer<16> >(2, 16, z);
 }
 
+// wide integers have no native reference: verify the limb multiply against a bit-serial shift-and-add product
+template<size_t nbits, typename BlockType>
+int VerifyWideMultiplication(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Integer = integer<nbits, BlockType>;
+	std::mt19937_64 rng(nbits);
+	int nrOfFailedTests = 0;
+	for (size_t n = 0; n < nrSamples; ++n) {
+		Integer a, b;
+		for (unsigned i = 0; i < Integer::nrBytes; ++i) {
+			uint8_t mask = (i == Integer::nrBytes - 1) ? uint8_t(0xFF >> (Integer::nrBytes * 8 - nbits)) : uint8_t(0xFF);
+			a.setbyte(i, uint8_t(rng()) & mask);
+			b.setbyte(i, uint8_t(rng()) & mask);
+		}
+		Integer reference, multiplicant(b);
+		for (unsigned i = 0; i < nbits; ++i) {
+			if (a.at(i)) reference += multiplicant;
+			multiplicant <<= 1;
+		}
+		Integer product = a * b;
+		if (product != reference) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL " << to_binary(a) << " * " << to_binary(b) << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
 #define MANUAL_TESTING 0
 #define STRESS_TESTING 0
 
@@ -74,6 +103,15 @@ try {
 	nrOfFailedTestCases += ReportTestResult(VerifyMultiplication<10, uint8_t>(tag, bReportIndividualTestCases), "integer<10, uint8_t>", "multiplication");
 	nrOfFailedTestCases += ReportTestResult(VerifyMultiplication<12, uint8_t>(tag, bReportIndividualTestCases), "integer<12, uint8_t>", "multiplication");
 	nrOfFailedTestCases += ReportTestResult(VerifyMultiplication<12, uint16_t>(tag, bReportIndividualTestCases), "integer<12, uint16_t>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyMultiplication<12, uint32_t>(tag, bReportIndividualTestCases), "integer<12, uint32_t>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyMultiplication<12, uint64_t>(tag, bReportIndividualTestCases), "integer<12, uint64_t>", "multiplication");
+	// schoolbook limb multiply
+	nrOfFailedTestCases += ReportTestResult(VerifyWideMultiplication<128, uint32_t>(tag, 1000, bReportIndividualTestCases), "integer<128, uint32_t>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyWideMultiplication<250, uint64_t>(tag, 1000, bReportIndividualTestCases), "integer<250, uint64_t>", "multiplication");
+	// Karatsuba above LIMB_KARATSUBA_THRESHOLD limbs
+	nrOfFailedTestCases += ReportTestResult(VerifyWideMultiplication<1024, uint8_t>(tag, 100, bReportIndividualTestCases), "integer<1024, uint8_t>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyWideMultiplication<2048, uint32_t>(tag, 100, bReportIndividualTestCases), "integer<2048, uint32_t>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyWideMultiplication<4000, uint64_t>(tag, 50, bReportIndividualTestCases), "integer<4000, uint64_t>", "multiplication");
 
 #if STRESS_TESTING
 
@@ -132,6 +132,85 @@ void TestArithmeticOperatorPerformance() {
 	PerformanceRunner("integer<1024> multiplication", MultiplicationWorkload< sw::unum::integer<1024> >, NR_OPS / 32);
 }
 
+// dependent chain of additions and subtractions on operands that have all their limbs populated
+template<typename IntegerType>
+void LimbAdditionSubtractionWorkload(uint64_t NR_OPS) {
+	IntegerType a, b, c;
+	a = -1;
+	b = 0x5555555555555555;
+	b.flip();
+	c = 0;
+	for (uint64_t i = 0; i < NR_OPS; ++i) {
+		c += a;
+		a -= b;
+		b += c;
+	}
+	if (c.iszero() && a.iszero()) std::cout << "addition/subtraction workload failed\n";
+}
+
+template<typename IntegerType>
+void ComparisonWorkload(uint64_t NR_OPS) {
+	IntegerType a, b;
+	a = 0xFFFFFFFFFFFFFFFF;
+	b = 0x7FFFFFFFFFFFFFFF;
+	uint64_t nrLess = 0;
+	for (uint64_t i = 0; i < NR_OPS; ++i) {
+		if (a < b) ++nrLess;
+		std::swap(a, b);
+	}
+	if (nrLess != NR_OPS / 2) std::cout << "comparison workload failed\n";
+}
+
+// dependent chain of multiplications on full-width operands: the odd multiplier keeps the product from collapsing to zero
+template<typename IntegerType>
+void LimbMultiplicationWorkload(uint64_t NR_OPS) {
+	IntegerType a, b;
+	a = 0x5555555555555555;
+	a.flip();
+	b = -1;
+	b -= 2;
+	for (uint64_t i = 0; i < NR_OPS; ++i) {
+		a *= b;
+	}
+	if (a.iszero()) std::cout << "multiplication workload failed\n";
+}
+
+// test performance of the limb arithmetic of integer<nbits, BlockType> for different block types
+void TestBlockTypePerformance() {
+	using namespace std;
+	cout << endl << "Block type performance" << endl;
+
+	uint64_t NR_OPS = 1000000;
+
+	PerformanceRunner("integer<128,  uint8_t>  add/subtract  ", LimbAdditionSubtractionWorkload< sw::unum::integer<128, uint8_t> >, NR_OPS);
+	PerformanceRunner("integer<128,  uint32_t> add/subtract  ", LimbAdditionSubtractionWorkload< sw::unum::integer<128, uint32_t> >, NR_OPS);
+	PerformanceRunner("integer<128,  uint64_t> add/subtract  ", LimbAdditionSubtractionWorkload< sw::unum::integer<128, uint64_t> >, NR_OPS);
+	PerformanceRunner("integer<256,  uint8_t>  add/subtract  ", LimbAdditionSubtractionWorkload< sw::unum::integer<256, uint8_t> >, NR_OPS);
+	PerformanceRunner("integer<256,  uint32_t> add/subtract  ", LimbAdditionSubtractionWorkload< sw::unum::integer<256, uint32_t> >, NR_OPS);
+	PerformanceRunner("integer<256,  uint64_t> add/subtract  ", LimbAdditionSubtractionWorkload< sw::unum::integer<256, uint64_t> >, NR_OPS);
+	PerformanceRunner("integer<1024, uint8_t>  add/subtract  ", LimbAdditionSubtractionWorkload< sw::unum::integer<1024, uint8_t> >, NR_OPS / 4);
+	PerformanceRunner("integer<1024, uint32_t> add/subtract  ", LimbAdditionSubtractionWorkload< sw::unum::integer<1024, uint32_t> >, NR_OPS / 4);
+	PerformanceRunner("integer<1024, uint64_t> add/subtract  ", LimbAdditionSubtractionWorkload< sw::unum::integer<1024, uint64_t> >, NR_OPS / 4);
+
+	PerformanceRunner("integer<128,  uint8_t>  comparison    ", ComparisonWorkload< sw::unum::integer<128, uint8_t> >, NR_OPS);
+	PerformanceRunner("integer<128,  uint32_t> comparison    ", ComparisonWorkload< sw::unum::integer<128, uint32_t> >, NR_OPS);
+	PerformanceRunner("integer<128,  uint64_t> comparison    ", ComparisonWorkload< sw::unum::integer<128, uint64_t> >, NR_OPS);
+	PerformanceRunner("integer<256,  uint8_t>  comparison    ", ComparisonWorkload< sw::unum::integer<256, uint8_t> >, NR_OPS);
+	PerformanceRunner("integer<256,  uint32_t> comparison    ", ComparisonWorkload< sw::unum::integer<256, uint32_t> >, NR_OPS);
+	PerformanceRunner("integer<256,  uint64_t> comparison    ", ComparisonWorkload< sw::unum::integer<256, uint64_t> >, NR_OPS);
+	PerformanceRunner("integer<1024, uint8_t>  comparison    ", ComparisonWorkload< sw::unum::integer<1024, uint8_t> >, NR_OPS / 4);
+	PerformanceRunner("integer<1024, uint32_t> comparison    ", ComparisonWorkload< sw::unum::integer<1024, uint32_t> >, NR_OPS / 4);
+	PerformanceRunner("integer<1024, uint64_t> comparison    ", ComparisonWorkload< sw::unum::integer<1024, uint64_t> >, NR_OPS / 4);
+
+	PerformanceRunner("integer<256,  uint8_t>  multiply      ", LimbMultiplicationWorkload< sw::unum::integer<256, uint8_t> >, NR_OPS / 10);
+	PerformanceRunner("integer<256,  uint32_t> multiply      ", LimbMultiplicationWorkload< sw::unum::integer<256, uint32_t> >, NR_OPS / 10);
+	PerformanceRunner("integer<256,  uint64_t> multiply      ", LimbMultiplicationWorkload< sw::unum::integer<256, uint64_t> >, NR_OPS / 10);
+	PerformanceRunner("integer<1024, uint32_t> multiply      ", LimbMultiplicationWorkload< sw::unum::integer<1024, uint32_t> >, NR_OPS / 100);
+	PerformanceRunner("integer<1024, uint64_t> multiply      ", LimbMultiplicationWorkload< sw::unum::integer<1024, uint64_t> >, NR_OPS / 100);
+	PerformanceRunner("integer<8192, uint32_t> multiply      ", LimbMultiplicationWorkload< sw::unum::integer<8192, uint32_t> >, NR_OPS / 1000);
+	PerformanceRunner("integer<8192, uint64_t> multiply      ", LimbMultiplicationWorkload< sw::unum::integer<8192, uint64_t> >, NR_OPS / 1000);
+}
+
 // conditional compilation
 #define MANUAL_TESTING 0
 #define STRESS_TESTING 0
@@ -147,6 +226,7 @@ try {
 
 	TestShiftOperatorPerformance();
 	TestArithmeticOperatorPerformance();
+	TestBlockTypePerformance();
 
 	cout << "done" << endl;
 
@@ -158,6 +238,7 @@ try {
 	   
 	TestShiftOperatorPerformance();
 	TestArithmeticOperatorPerformance();
+	TestBlockTypePerformance();
 
 #if STRESS_TESTING
 
@@ -223,4 +304,41 @@ integer<64>   multiplication       8192 per         0.08589sec ->  95 Kops/sec
 integer<128>  multiplication       4096 per        0.166093sec ->  24 Kops/sec
 integer<512>  multiplication       2048 per         1.33028sec ->   1 Kops/sec
 integer<1024> multiplication       1024 per         2.58557sec -> 396  ops/sec
-*/
\ No newline at end of file
+
+Date run : 10/16/2026
+Processor: x86-64 with AVX2, single core, Release build
+
+Block type performance
+integer<128,  uint8_t>  add/subtract      1000000 per       0.0196906sec ->  50 Mops/sec
+integer<128,  uint32_t> add/subtract      1000000 per      0.00276786sec -> 361 Mops/sec
+integer<128,  uint64_t> add/subtract      1000000 per      0.00224984sec -> 444 Mops/sec
+integer<256,  uint8_t>  add/subtract      1000000 per       0.0741125sec ->  13 Mops/sec
+integer<256,  uint32_t> add/subtract      1000000 per      0.00732683sec -> 136 Mops/sec
+integer<256,  uint64_t> add/subtract      1000000 per      0.00724386sec -> 138 Mops/sec
+integer<1024, uint8_t>  add/subtract       250000 per         0.09984sec ->   2 Mops/sec
+integer<1024, uint32_t> add/subtract       250000 per       0.0168898sec ->  14 Mops/sec
+integer<1024, uint64_t> add/subtract       250000 per       0.0093739sec ->  26 Mops/sec
+integer<128,  uint8_t>  comparison        1000000 per      0.00200543sec -> 498 Mops/sec
+integer<128,  uint32_t> comparison        1000000 per      0.00190074sec -> 526 Mops/sec
+integer<128,  uint64_t> comparison        1000000 per      0.00200423sec -> 498 Mops/sec
+integer<256,  uint8_t>  comparison        1000000 per      0.00864823sec -> 115 Mops/sec
+integer<256,  uint32_t> comparison        1000000 per      0.00278928sec -> 358 Mops/sec
+integer<256,  uint64_t> comparison        1000000 per      0.00220776sec -> 452 Mops/sec
+integer<1024, uint8_t>  comparison         250000 per       0.0152969sec ->  16 Mops/sec
+integer<1024, uint32_t> comparison         250000 per      0.00240141sec -> 104 Mops/sec
+integer<1024, uint64_t> comparison         250000 per      0.00136386sec -> 183 Mops/sec
+
+limb multiply: schoolbook, Karatsuba above LIMB_KARATSUBA_THRESHOLD = 32 limbs
+shift-and-add multiply, for reference
+integer<256,  uint32_t> multiply           100000 per         9.56899sec ->  10 Kops/sec
+integer<1024, uint64_t> multiply            10000 per         16.5735sec -> 603  ops/sec
+integer<8192, uint64_t> multiply             1000 per         103.254sec ->   9  ops/sec
+limb multiply
+integer<256,  uint8_t>  multiply           100000 per       0.0271633sec ->   3 Mops/sec
+integer<256,  uint32_t> multiply           100000 per      0.00159784sec ->  62 Mops/sec
+integer<256,  uint64_t> multiply           100000 per      0.00105914sec ->  94 Mops/sec
+integer<1024, uint32_t> multiply            10000 per      0.00283838sec ->   3 Mops/sec
+integer<1024, uint64_t> multiply            10000 per     0.000784063sec ->  12 Mops/sec
+integer<8192, uint32_t> multiply             1000 per       0.0111317sec ->  89 Kops/sec
+integer<8192, uint64_t> multiply             1000 per      0.00430431sec -> 232 Kops/sec
+*/
@@ -6,12 +6,106 @@
 //
 // This file is part of the universal number project, which is released under an MIT Open Source license.
 #include <iostream>
+#include <string>
 #include <universal/integer/integer>
 #include <universal/integer/math_functions.hpp>
 #include <universal/integer/primes.hpp>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// compare isPrime against the sieve of Eratosthenes for all values below limit
+template<size_t nbits, typename BlockType>
+int VerifyIsPrime(const std::string& tag, uint32_t limit, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Integer = integer<nbits, BlockType>;
+	std::vector<uint32_t> primes = sieveOfEratosthenes(limit);
+	int nrOfFailedTests = 0;
+	size_t k = 0;
+	for (uint32_t i = 0; i <= limit; ++i) {
+		bool ref = (k < primes.size() && primes[k] == i);
+		if (ref) ++k;
+		if (isPrime(Integer(i)) != ref) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL isPrime(" << i << ") != " << ref << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// known primes and composites that fool weaker tests: Carmichael numbers and strong pseudoprimes
+template<size_t nbits, typename BlockType>
+int VerifyKnownPrimes(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Integer = integer<nbits, BlockType>;
+	const char* primes[] = { "2147483647", "2305843009213693951", "18446744073709551557", "170141183460469231731687303715884105727" };
+	const char* composites[] = { "561", "41041", "2047", "3215031751", "3825123056546413051", "318665857834031151167461", "170141183460469231731687303715884105729" };
+	int nrOfFailedTests = 0;
+	for (const char* txt : primes) {
+		Integer a;
+		parse(std::string(txt), a);
+		if (!isPrime(a)) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL " << a << " is prime" << std::endl;
+		}
+	}
+	for (const char* txt : composites) {
+		Integer a;
+		parse(std::string(txt), a);
+		if (isPrime(a)) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL " << a << " is composite" << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// compare the segmented sieve of a range against isPrime of each candidate
+template<size_t nbits, typename BlockType>
+int VerifyPrimesInRange(const std::string& tag, const std::string& low, size_t width, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Integer = integer<nbits, BlockType>;
+	Integer a, b;
+	parse(low, a);
+	b = a + Integer(width);
+	std::vector<Integer> v;
+	primeNumbersInRange(a, b, v);
+	std::vector<Integer> ref;
+	for (Integer i = a; i < b; ++i) if (isPrime(i)) ref.push_back(i);
+	int nrOfFailedTests = (v == ref) ? 0 : 1;
+	if (nrOfFailedTests && bReportIndividualTestCases) std::cout << tag << " FAIL " << v.size() << " primes in [" << a << ", " << b << ") instead of " << ref.size() << std::endl;
+	return nrOfFailedTests;
+}
+
+// factor a product of known primes and verify that the factorization reconstructs it
+template<size_t nbits, typename BlockType>
+int VerifyFactorization(const std::string& tag, const std::vector<std::pair<std::string, int>>& product, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Integer = integer<nbits, BlockType>;
+	Integer a = 1;
+	for (const auto& pe : product) {
+		Integer p;
+		parse(pe.first, p);
+		for (int e = 0; e < pe.second; ++e) a *= p;
+	}
+	primefactors<nbits, BlockType> factors;
+	primeFactorization(a, factors);
+	int nrOfFailedTests = (factors.size() == product.size()) ? 0 : 1;
+	Integer check = 1;
+	for (size_t i = 0; i < factors.size(); ++i) {
+		if (!isPrime(factors[i].first)) ++nrOfFailedTests;
+		if (i > 0 && !(factors[i - 1].first < factors[i].first)) ++nrOfFailedTests;
+		for (Integer e = 0; e < factors[i].second; ++e) check *= factors[i].first;
+	}
+	if (check != a) ++nrOfFailedTests;
+	if (nrOfFailedTests && bReportIndividualTestCases) {
+		std::cout << tag << " FAIL factorization of " << a << '\n';
+		for (size_t i = 0; i < factors.size(); ++i) std::cout << " factor " << factors[i].first << " exponent " << factors[i].second << '\n';
+	}
+	return nrOfFailedTests;
+}
 
 // conditional compilation
-#define MANUAL_TESTING 1
+#define MANUAL_TESTING 0
 #define STRESS_TESTING 0
 
 int main() 
@@ -88,13 +182,31 @@ try {
 
 #else // MANUAL_TESTING
 
-	// GCD of three numbers is
-	// gcd(a, b, c) == gcd(a, gcd(b, c)) == gcd(gcd(a, b), c) == gcd(b, gcd(a, c))
+	std::string tag = "prime number failed";
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	cout << "Prime number verification" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(VerifyIsPrime<16, uint8_t>(tag, 32767, bReportIndividualTestCases), "integer<16, uint8_t>", "isPrime");
+	nrOfFailedTestCases += ReportTestResult(VerifyIsPrime<64, uint32_t>(tag, 100000, bReportIndividualTestCases), "integer<64, uint32_t>", "isPrime");
+	nrOfFailedTestCases += ReportTestResult(VerifyKnownPrimes<256, uint32_t>(tag, bReportIndividualTestCases), "integer<256, uint32_t>", "isPrime");
 
+	nrOfFailedTestCases += ReportTestResult(VerifyPrimesInRange<32, uint16_t>(tag, "2", 100000, bReportIndividualTestCases), "integer<32, uint16_t>", "primeNumbersInRange");
+	nrOfFailedTestCases += ReportTestResult(VerifyPrimesInRange<64, uint32_t>(tag, "1000000000000", 10000, bReportIndividualTestCases), "integer<64, uint32_t>", "primeNumbersInRange");
+	nrOfFailedTestCases += ReportTestResult(VerifyPrimesInRange<128, uint64_t>(tag, "1180591620717411303424", 2000, bReportIndividualTestCases), "integer<128, uint64_t>", "primeNumbersInRange");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyFactorization<64, uint32_t>(tag, { { "2", 5 }, { "3", 4 }, { "1009", 2 }, { "65537", 1 } }, bReportIndividualTestCases), "integer<64, uint32_t>", "primeFactorization");
+	nrOfFailedTestCases += ReportTestResult(VerifyFactorization<128, uint32_t>(tag, { { "3", 1 }, { "2147483647", 1 }, { "2305843009213693951", 1 } }, bReportIndividualTestCases), "integer<128, uint32_t>", "primeFactorization");
+	nrOfFailedTestCases += ReportTestResult(VerifyFactorization<256, uint64_t>(tag, { { "1000003", 2 }, { "4294967311", 1 }, { "1000000000039", 1 } }, bReportIndividualTestCases), "integer<256, uint64_t>", "primeFactorization");
 
 #if STRESS_TESTING
 
+	nrOfFailedTestCases += ReportTestResult(VerifyIsPrime<64, uint64_t>(tag, 10000000, bReportIndividualTestCases), "integer<64, uint64_t>", "isPrime");
+
 #endif // STRESS_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
 #endif // MANUAL_TESTING
 
 
@@ -0,0 +1,134 @@
+//  shift.cpp : shift operator and leading/trailing zero tests for abitrary precision integers
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <string>
+#include <random>
+// configure the integer arithmetic class
+#define INTEGER_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/integer/integer.hpp>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+
+// bit-level reference shift: positive shifts move left, negative shifts move right, zeros shift in
+template<size_t nbits, typename BlockType>
+sw::unum::integer<nbits, BlockType> ReferenceShift(const sw::unum::integer<nbits, BlockType>& a, int shift) {
+	sw::unum::integer<nbits, BlockType> result;
+	for (int i = 0; i < int(nbits); ++i) {
+		int src = i - shift;
+		if (src >= 0 && src < int(nbits)) result.set(unsigned(i), a.at(size_t(src)));
+	}
+	return result;
+}
+
+// compare the block shifts against the bit-level reference for every shift amount on random patterns
+template<size_t nbits, typename BlockType>
+int VerifyShifts(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Integer = integer<nbits, BlockType>;
+	std::mt19937_64 rng(nbits);
+	int nrOfFailedTests = 0;
+	for (size_t n = 0; n < nrSamples; ++n) {
+		Integer a;
+		for (unsigned i = 0; i < Integer::nrBytes; ++i) a.setbyte(i, uint8_t(rng()));
+		for (int shift = 0; shift <= int(nbits); ++shift) {
+			Integer l(a), r(a);
+			l <<= shift;
+			r >>= shift;
+			if (l != ReferenceShift(a, shift) || r != ReferenceShift(a, -shift)) {
+				++nrOfFailedTests;
+				if (bReportIndividualTestCases) std::cout << tag << " FAIL " << to_binary(a) << " shifted by " << shift << std::endl;
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// compare findMsb/findLsb and the zero counts against a bit scan for every single bit and a random background
+template<size_t nbits, typename BlockType>
+int VerifyZeroCounts(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Integer = integer<nbits, BlockType>;
+	std::mt19937_64 rng(nbits);
+	int nrOfFailedTests = 0;
+	Integer zero;
+	if (findMsb(zero) != -1 || findLsb(zero) != -1 || countLeadingZeros(zero) != int(nbits) || countTrailingZeros(zero) != int(nbits)) ++nrOfFailedTests;
+	for (unsigned msb = 0; msb < nbits; ++msb) {
+		for (unsigned lsb = 0; lsb <= msb; ++lsb) {
+			Integer a;
+			a.set(msb);
+			a.set(lsb);
+			for (unsigned i = lsb + 1; i < msb; ++i) a.set(i, (rng() & 0x1) != 0);
+			bool pass = (findMsb(a) == int(msb)) && (findLsb(a) == int(lsb));
+			pass = pass && (countLeadingZeros(a) == int(nbits - 1 - msb)) && (countTrailingZeros(a) == int(lsb));
+			if (!pass) {
+				++nrOfFailedTests;
+				if (bReportIndividualTestCases) std::cout << tag << " FAIL " << to_binary(a) << " msb " << findMsb(a) << " lsb " << findLsb(a) << std::endl;
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main()
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	std::string tag = "Integer shift tests failed";
+
+#if MANUAL_TESTING
+
+	integer<40, uint16_t> a = 0x123456789ll;
+	cout << to_binary(a) << endl;
+	a <<= 13;
+	cout << to_binary(a) << endl;
+	a >>= 21;
+	cout << to_binary(a) << endl;
+
+	cout << "done" << endl;
+
+	return EXIT_SUCCESS;
+#else
+	std::cout << "Integer shift verification" << std::endl;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+
+	nrOfFailedTestCases += ReportTestResult(VerifyShifts<12, uint8_t>(tag, 100, bReportIndividualTestCases), "integer<12, uint8_t>", "shift");
+	nrOfFailedTestCases += ReportTestResult(VerifyShifts<40, uint16_t>(tag, 100, bReportIndividualTestCases), "integer<40, uint16_t>", "shift");
+	nrOfFailedTestCases += ReportTestResult(VerifyShifts<96, uint32_t>(tag, 100, bReportIndividualTestCases), "integer<96, uint32_t>", "shift");
+	nrOfFailedTestCases += ReportTestResult(VerifyShifts<250, uint64_t>(tag, 20, bReportIndividualTestCases), "integer<250, uint64_t>", "shift");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyZeroCounts<12, uint8_t>(tag, bReportIndividualTestCases), "integer<12, uint8_t>", "clz/ctz");
+	nrOfFailedTestCases += ReportTestResult(VerifyZeroCounts<40, uint16_t>(tag, bReportIndividualTestCases), "integer<40, uint16_t>", "clz/ctz");
+	nrOfFailedTestCases += ReportTestResult(VerifyZeroCounts<96, uint32_t>(tag, bReportIndividualTestCases), "integer<96, uint32_t>", "clz/ctz");
+	nrOfFailedTestCases += ReportTestResult(VerifyZeroCounts<250, uint64_t>(tag, bReportIndividualTestCases), "integer<250, uint64_t>", "clz/ctz");
+
+#if STRESS_TESTING
+
+	nrOfFailedTestCases += ReportTestResult(VerifyShifts<1024, uint64_t>(tag, 100, bReportIndividualTestCases), "integer<1024, uint64_t>", "shift");
+
+#endif // STRESS_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+
+#endif // MANUAL_TESTING
+}
+catch (char const* msg) {
+	std::cerr << msg << '\n';
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << '\n';
+	return EXIT_FAILURE;
+}
@@ -64,6 +64,8 @@ try {
 	nrOfFailedTestCases += ReportTestResult(VerifySubtraction<10, uint8_t>(tag, bReportIndividualTestCases), "integer<10, uint8_t>", "subtraction");
 	nrOfFailedTestCases += ReportTestResult(VerifySubtraction<12, uint8_t>(tag, bReportIndividualTestCases), "integer<12, uint8_t>", "subtraction");
 	nrOfFailedTestCases += ReportTestResult(VerifySubtraction<12, uint16_t>(tag, bReportIndividualTestCases), "integer<12, uint16_t>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(VerifySubtraction<12, uint32_t>(tag, bReportIndividualTestCases), "integer<12, uint32_t>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(VerifySubtraction<12, uint64_t>(tag, bReportIndividualTestCases), "integer<12, uint64_t>", "subtraction");
 
 #if STRESS_TESTING
 
@@ -8,6 +8,7 @@
 #include <universal/lns/lns.hpp>
 // test helpers, such as, ReportTestResults
 #include "../utils/test_helpers.hpp"
+#include "../utils/lns_test_helpers.hpp"
 
 // generate specific test case that you can trace with the trace conditions in areal.hpp
 // for most bugs they are traceable with _trace_conversion and _trace_add
@@ -27,14 +28,38 @@ void GenerateTestCase(Ty a, Ty b) {
 	std::cout << std::setprecision(5);
 }
 
-template<size_t nbits> 
-int ValidateAddition(const std::string& tag, bool bReportIndividualTestCases) {
-	int nrOfFailedTestCases = 0;
+template<size_t nbits, typename bt = uint8_t>
+int ValidateAddition(const std::string& tag, size_t nrSamples, int64_t tolerance, bool bReportIndividualTestCases) {
+	return sw::unum::VerifyLnsArithmetic<nbits, bt>(tag, sw::unum::BinaryOperator::ADD, nrSamples, tolerance, bReportIndividualTestCases);
+}
 
-	return nrOfFailedTestCases;
+// the batch sum accumulates the positive and the negative terms separately: without saturation it must
+// equal the sequential sum of the positive terms minus the sequential sum of the magnitudes of the negative terms
+template<size_t nbits, typename bt = uint8_t>
+int ValidateBatchSum(const std::string& tag, size_t vectorSize, size_t nrSamples, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Lns = lns<nbits, bt>;
+	std::mt19937_64 rng(nbits + vectorSize);
+	std::uniform_real_distribution<double> dist(-4.0, 4.0);
+	int nrOfFailedTests = 0;
+	std::vector<Lns> x(vectorSize);
+	for (size_t n = 0; n < nrSamples; ++n) {
+		Lns positive(0), negative(0);
+		for (size_t i = 0; i < vectorSize; ++i) {
+			x[i] = dist(rng);
+			if (x[i].sign()) negative += abs(x[i]); else positive += x[i];
+		}
+		Lns reference = positive - negative;
+		Lns sum = lns_sum(x);
+		if (sum != reference) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL lns_sum " << sum << " != " << reference << std::endl;
+		}
+	}
+	return nrOfFailedTests;
 }
 
-#define MANUAL_TESTING 1
+#define MANUAL_TESTING 0
 #define STRESS_TESTING 0
 
 int main(int argc, char** argv)
@@ -49,9 +74,10 @@ try {
 	// generate individual testcases to hand trace/debug
 	GenerateTestCase<16, double>(INFINITY, INFINITY);
 	GenerateTestCase<8, float>(0.5f, -0.5f);
+	GenerateTestCase<16, double>(3.0, 0.25);
 
 	// manual exhaustive test
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8>("Manual Testing", true), "lns<8>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8>("Manual Testing", 0, 0, true), "lns<8>", "addition");
 
 	nrOfFailedTestCases = 0;
 #else
@@ -60,10 +86,21 @@ try {
 	bool bReportIndividualTestCases = false;
 	std::string tag = "Addition failed: ";
 
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8>(tag, bReportIndividualTestCases), "lns<8>", "addition");
+	// direct tables: correctly rounded
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8>(tag, 0, 0, bReportIndividualTestCases), "lns<8>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<10>(tag, 0, 0, bReportIndividualTestCases), "lns<10>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<16, uint16_t>(tag, 100000, 0, bReportIndividualTestCases), "lns<16,uint16_t>", "addition");
+	// interpolated tables: faithful
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<20>(tag, 100000, 1, bReportIndividualTestCases), "lns<20>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<32, uint32_t>(tag, 100000, 1, bReportIndividualTestCases), "lns<32,uint32_t>", "addition");
+	// math library: correctly rounded up to the precision of long double
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<40, uint32_t>(tag, 20000, 1, bReportIndividualTestCases), "lns<40,uint32_t>", "addition");
 
-#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateBatchSum<12>(tag, 16, 1000, bReportIndividualTestCases), "lns<12>", "lns_sum");
+	nrOfFailedTestCases += ReportTestResult(ValidateBatchSum<32, uint32_t>(tag, 100, 1000, bReportIndividualTestCases), "lns<32,uint32_t>", "lns_sum");
 
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<12>(tag, 0, 0, bReportIndividualTestCases), "lns<12>", "addition");
 #endif  // STRESS_TESTING
 
 #endif  // MANUAL_TESTING
@@ -8,6 +8,7 @@
 #include <universal/lns/lns.hpp>
 // test helpers, such as, ReportTestResults
 #include "../utils/test_helpers.hpp"
+#include "../utils/lns_test_helpers.hpp"
 
 // generate specific test case that you can trace with the trace conditions in areal.hpp
 // for most bugs they are traceable with _trace_conversion and _trace_add
@@ -19,7 +20,7 @@ void GenerateTestCase(Ty a, Ty b) {
 	pb = b;
 	ref = a * b;
 	pref = ref;
-	psum = pa + pb;
+	psum = pa * pb;
 	std::cout << std::setprecision(nbits - 2);
 	std::cout << std::setw(nbits) << a << " * " << std::setw(nbits) << b << " = " << std::setw(nbits) << ref << std::endl;
 	std::cout << pa.get() << " * " << pb.get() << " = " << psum.get() << " (reference: " << pref.get() << ")   " ;
@@ -27,14 +28,17 @@ void GenerateTestCase(Ty a, Ty b) {
 	std::cout << std::setprecision(5);
 }
 
-template<size_t nbits> 
-int ValidateMultiplication(const std::string& tag, bool bReportIndividualTestCases) {
-	int nrOfFailedTestCases = 0;
-
-	return nrOfFailedTestCases;
+// multiplication adds the logarithms: exact, apart from saturation and flush to zero
+template<size_t nbits, typename bt = uint8_t>
+int ValidateMultiplication(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	return sw::unum::VerifyLnsArithmetic<nbits, bt>(tag, sw::unum::BinaryOperator::MUL, nrSamples, 0, bReportIndividualTestCases);
+}
+template<size_t nbits, typename bt = uint8_t>
+int ValidateDivision(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	return sw::unum::VerifyLnsArithmetic<nbits, bt>(tag, sw::unum::BinaryOperator::DIV, nrSamples, 0, bReportIndividualTestCases);
 }
 
-#define MANUAL_TESTING 1
+#define MANUAL_TESTING 0
 #define STRESS_TESTING 0
 
 int main(int argc, char** argv)
@@ -59,7 +63,7 @@ try {
 	cout << c.to_long_double() << endl;
 
 	// manual exhaustive test
-	nrOfFailedTestCases += ReportTestResult(ValidateMultiplication<8>("Manual Testing", true), "lns<8>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(ValidateMultiplication<8>("Manual Testing", 0, true), "lns<8>", "multiplication");
 
 	nrOfFailedTestCases = 0;  // in manual testing mode, we ignore any failures
 #else
@@ -68,7 +72,12 @@ try {
 	bool bReportIndividualTestCases = false;
 	std::string tag = "multiplication failed: ";
 
-	nrOfFailedTestCases += ReportTestResult(ValidateMultiplication<8>(tag, bReportIndividualTestCases), "lns<8>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateMultiplication<8>(tag, 0, bReportIndividualTestCases), "lns<8>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(ValidateMultiplication<10>(tag, 0, bReportIndividualTestCases), "lns<10>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(ValidateMultiplication<32, uint32_t>(tag, 100000, bReportIndividualTestCases), "lns<32,uint32_t>", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(ValidateDivision<8>(tag, 0, bReportIndividualTestCases), "lns<8>", "division");
+	nrOfFailedTestCases += ReportTestResult(ValidateDivision<10>(tag, 0, bReportIndividualTestCases), "lns<10>", "division");
+	nrOfFailedTestCases += ReportTestResult(ValidateDivision<32, uint32_t>(tag, 100000, bReportIndividualTestCases), "lns<32,uint32_t>", "division");
 
 #if STRESS_TESTING
 
@@ -0,0 +1,94 @@
+// arithmetic_sub.cpp: functional tests for subtraction on arbitrary logarithmic number system
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// minimum set of include files to reflect source code dependencies
+#include <universal/lns/lns.hpp>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+#include "../utils/lns_test_helpers.hpp"
+
+// generate specific test case that you can trace with the trace conditions in areal.hpp
+// for most bugs they are traceable with _trace_conversion and _trace_add
+template<size_t nbits, typename Ty>
+void GenerateTestCase(Ty a, Ty b) {
+	Ty ref;
+	sw::unum::lns<nbits> pa, pb, pref, psum;
+	pa = a;
+	pb = b;
+	ref = a - b;
+	pref = ref;
+	psum = pa - pb;
+	std::cout << std::setprecision(nbits - 2);
+	std::cout << std::setw(nbits) << a << " - " << std::setw(nbits) << b << " = " << std::setw(nbits) << ref << std::endl;
+	std::cout << pa.get() << " - " << pb.get() << " = " << psum.get() << " (reference: " << pref.get() << ")   " ;
+	std::cout << (pref == psum ? "PASS" : "FAIL") << std::endl << std::endl;
+	std::cout << std::setprecision(5);
+}
+
+// subtraction of nearby magnitudes evaluates db near its singularity through the cotransformation
+template<size_t nbits, typename bt = uint8_t>
+int ValidateSubtraction(const std::string& tag, size_t nrSamples, int64_t tolerance, bool bReportIndividualTestCases) {
+	return sw::unum::VerifyLnsArithmetic<nbits, bt>(tag, sw::unum::BinaryOperator::SUB, nrSamples, tolerance, bReportIndividualTestCases);
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	int nrOfFailedTestCases = 0;
+
+#if MANUAL_TESTING
+
+	// generate individual testcases to hand trace/debug
+	GenerateTestCase<16, double>(INFINITY, INFINITY);
+	GenerateTestCase<8, float>(0.5f, 0.5f);
+	GenerateTestCase<16, double>(1.0, 0.9921875);
+
+	// manual exhaustive test
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<8>("Manual Testing", 0, 0, true), "lns<8>", "subtraction");
+
+	nrOfFailedTestCases = 0;
+#else
+	cout << "Arbitrary LNS subtraction validation" << endl;
+
+	bool bReportIndividualTestCases = false;
+	std::string tag = "Subtraction failed: ";
+
+	// direct tables: correctly rounded
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<8>(tag, 0, 0, bReportIndividualTestCases), "lns<8>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<10>(tag, 0, 0, bReportIndividualTestCases), "lns<10>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<16, uint16_t>(tag, 100000, 0, bReportIndividualTestCases), "lns<16,uint16_t>", "subtraction");
+	// interpolated tables: faithful
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<20>(tag, 100000, 1, bReportIndividualTestCases), "lns<20>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<32, uint32_t>(tag, 100000, 1, bReportIndividualTestCases), "lns<32,uint32_t>", "subtraction");
+	// math library: correctly rounded up to the precision of long double
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<40, uint32_t>(tag, 20000, 1, bReportIndividualTestCases), "lns<40,uint32_t>", "subtraction");
+
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<12>(tag, 0, 0, bReportIndividualTestCases), "lns<12>", "subtraction");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
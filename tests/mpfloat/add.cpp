@@ -13,7 +13,7 @@
 #include <universal/mpfloat/mpfloat.hpp>
 // test helpers, such as, ReportTestResults
 #include "../utils/test_helpers.hpp"
-//#include "mpfloat_test_helpers.hpp"
+#include "mpfloat_test_helpers.hpp"
 
 // generate specific test case that you can trace with the trace conditions in mpreal.hpp
 // for most bugs they are traceable with _trace_conversion and _trace_add
@@ -68,7 +68,7 @@ void Progressions(uint32_t digit) {
 	}
 }
 
-#define MANUAL_TESTING 1
+#define MANUAL_TESTING 0
 #define STRESS_TESTING 0
 
 int main(int argc, char** argv)
@@ -84,7 +84,7 @@ try {
 //	bool bReportIndividualTestCases = false;
 
 	// generate individual testcases to hand trace/debug
-	GenerateTestCase(INFINITY, INFINITY);
+	GenerateTestCase(0.1, 0.2);
 
 	mpfloat mpa;
 	mpa = 0;
@@ -122,8 +122,18 @@ try {
 
 	cout << "multi-precision float addition validation" << endl;
 
+	bool bReportIndividualTestCases = false;
+
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<float>(tag, BinaryOperator::ADD, 10000, bReportIndividualTestCases), "mpfloat(float)", "addition");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<double>(tag, BinaryOperator::ADD, 10000, bReportIndividualTestCases), "mpfloat(double)", "addition");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<long double>(tag, BinaryOperator::ADD, 10000, bReportIndividualTestCases), "mpfloat(long double)", "addition");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyInverseIdentities(tag, BinaryOperator::ADD, 9, 10000, bReportIndividualTestCases), "mpfloat 9 digits", "addition");
+	nrOfFailedTestCases += ReportTestResult(VerifyInverseIdentities(tag, BinaryOperator::ADD, 100, 1000, bReportIndividualTestCases), "mpfloat 100 digits", "addition");
+	nrOfFailedTestCases += ReportTestResult(VerifyInverseIdentities(tag, BinaryOperator::ADD, 1000, 100, bReportIndividualTestCases), "mpfloat 1000 digits", "addition");
 
 #if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(VerifyInverseIdentities(tag, BinaryOperator::ADD, 10000, 100, bReportIndividualTestCases), "mpfloat 10000 digits", "addition");
 
 #endif  // STRESS_TESTING
 
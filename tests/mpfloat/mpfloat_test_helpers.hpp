@@ -0,0 +1,117 @@
+#pragma once
+//  mpfloat_test_helpers.hpp : functions to aid in testing and test reporting on multi-precision floating point
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <random>
+#include <cmath>
+#include <limits>
+#include "../utils/binary_operator_helpers.hpp"
+
+namespace sw { namespace unum {
+
+// the operator on exactly converted native operands, rounded to 40 limbs and converted back to the native type,
+// must reproduce the correctly rounded native operator: sums and products of the sampled operands are exact
+// at that precision, and quotients of native values are never close enough to a midpoint
+// between native values to suffer from the double rounding
+template<typename Real>
+int VerifyNativeArithmetic(const std::string& tag, BinaryOperator op, size_t nrSamples, bool bReportIndividualTestCases) {
+	mpfloat::setprecision(40);
+	std::uniform_real_distribution<Real> dist(Real(-1), Real(1));
+	auto sample = [dist](std::mt19937_64& rng, size_t, Real& a, Real& b) mutable {
+		a = std::ldexp(dist(rng), int(rng() % 120) - 60);
+		b = std::ldexp(dist(rng), int(rng() % 120) - 60);
+	};
+	auto verify = [&](Real a, Real b) {
+		if (b == Real(0)) return true;
+		Real ref = ApplyBinaryOperator(op, a, b);
+		Real result = Real(ApplyBinaryOperator(op, mpfloat(a), mpfloat(b)));
+		if (result == ref) return true;
+		if (bReportIndividualTestCases) std::cout << tag << " FAIL " << a << " op " << b << " = " << result << " reference " << ref << std::endl;
+		return false;
+	};
+	return VerifyBinaryOperatorRandom<Real>(nrSamples, std::numeric_limits<Real>::digits, sample, verify);
+}
+
+// the square root of an exactly converted native operand, rounded to 40 limbs and converted back to the native type,
+// must reproduce the correctly rounded native square root, which is never close enough to a midpoint to double round
+template<typename Real>
+int VerifyNativeSquareRoot(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	std::mt19937_64 rng(std::numeric_limits<Real>::digits);
+	std::uniform_real_distribution<Real> dist(Real(0), Real(1));
+	mpfloat::setprecision(40);
+	int nrOfFailedTests = 0;
+	for (size_t n = 0; n < nrSamples; ++n) {
+		Real a = std::ldexp(dist(rng), int(rng() % 120) - 60);
+		Real ref = std::sqrt(a);
+		Real result = Real(sqrt(mpfloat(a)));
+		if (result != ref) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL sqrt(" << a << ") = " << result << " reference " << ref << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// random value with nrDigits significant decimal digits and a decimal exponent in [-scale, scale]
+template<typename RandomEngine>
+mpfloat RandomMpfloat(RandomEngine& rng, size_t nrDigits, int scale) {
+	std::string digits = (rng() & 0x1) ? "-" : "";
+	digits += char('1' + rng() % 9);
+	for (size_t i = 1; i < nrDigits; ++i) digits += char('0' + rng() % 10);
+	digits += "e" + std::to_string(int(rng() % (2 * scale + 1)) - scale);
+	mpfloat v;
+	parse(digits, v);
+	return v;
+}
+
+// operand limbs plus alignment and carry limbs: the precision that keeps sums and products of nrDigits operands exact
+inline size_t IdentityPrecision(size_t nrDigits) {
+	size_t limbs = nrDigits / 9 + 2;
+	return 2 * limbs + 4;
+}
+
+// inverse identities on operands of nrDigits digits at a precision that keeps sums and products exact:
+// (a + b) - b == a, (a - b) + b == a, (a * b) / b == a, and (a * b) / a == b
+inline int VerifyInverseIdentities(const std::string& tag, BinaryOperator op, size_t nrDigits, size_t nrSamples, bool bReportIndividualTestCases) {
+	mpfloat::setprecision(IdentityPrecision(nrDigits));
+	auto sample = [nrDigits](std::mt19937_64& rng, size_t, mpfloat& a, mpfloat& b) {
+		a = RandomMpfloat(rng, nrDigits, 20);
+		b = RandomMpfloat(rng, nrDigits, 20);
+	};
+	auto verify = [&](const mpfloat& a, const mpfloat& b) {
+		mpfloat result, ref;
+		switch (op) {
+		case BinaryOperator::ADD: result = (a + b) - b; ref = a; break;
+		case BinaryOperator::SUB: result = (a - b) + b; ref = a; break;
+		case BinaryOperator::MUL: result = (a * b) / b; ref = a; break;
+		case BinaryOperator::DIV: result = (a * b) / a; ref = b; break;
+		}
+		if (result == ref) return true;
+		if (bReportIndividualTestCases) std::cout << tag << " FAIL " << a << " op " << b << " = " << result << " reference " << ref << std::endl;
+		return false;
+	};
+	return VerifyBinaryOperatorRandom<mpfloat>(nrSamples, nrDigits, sample, verify);
+}
+
+// sqrt(a * a) == |a| on operands of nrDigits digits at a precision that keeps the square exact
+inline int VerifySquareRootIdentity(const std::string& tag, size_t nrDigits, size_t nrSamples, bool bReportIndividualTestCases) {
+	std::mt19937_64 rng(nrDigits);
+	mpfloat::setprecision(IdentityPrecision(nrDigits));
+	int nrOfFailedTests = 0;
+	for (size_t n = 0; n < nrSamples; ++n) {
+		mpfloat a = RandomMpfloat(rng, nrDigits, 20);
+		mpfloat result = sqrt(a * a), ref = abs(a);
+		if (result != ref) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL sqrt(" << a << " * " << a << ") = " << result << " reference " << ref << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+}} // namespace sw::unum
@@ -0,0 +1,87 @@
+// mul.cpp: functional tests for multiplication on multi-precison linear floating point
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cmath>
+#include <limits>
+
+// minimum set of include files to reflect source code dependencies
+#include <universal/mpfloat/mpfloat.hpp>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+#include "mpfloat_test_helpers.hpp"
+
+// generate specific test case that you can trace with the trace conditions in mpfloat.hpp
+template<typename Ty>
+void GenerateTestCase(Ty a, Ty b) {
+	Ty ref;
+	sw::unum::mpfloat mpa, mpb, mpref, mpresult;
+	mpa = a;
+	mpb = b;
+	ref = a * b;
+	mpref = ref;
+	mpresult = mpa * mpb;
+	constexpr size_t ndigits = std::numeric_limits<Ty>::digits10;
+	std::cout << std::setprecision(ndigits);
+	std::cout << std::setw(ndigits) << a << " * " << std::setw(ndigits) << b << " = " << std::setw(ndigits) << ref << std::endl;
+	std::cout << mpa << " * " << mpb << " = " << mpresult << " (reference: " << mpref << ")   " ;
+	std::cout << (mpref == mpresult ? "PASS" : "FAIL") << std::endl << std::endl;
+	std::cout << std::setprecision(5);
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "multi-precision float multiplication failed: ";
+
+#if MANUAL_TESTING
+
+	// generate individual testcases to hand trace/debug
+	GenerateTestCase(0.1, 0.2);
+	GenerateTestCase(3.0e10, 7.0e-10);
+
+#else
+
+	cout << "multi-precision float multiplication validation" << endl;
+
+	bool bReportIndividualTestCases = false;
+
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<float>(tag, BinaryOperator::MUL, 10000, bReportIndividualTestCases), "mpfloat(float)", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<double>(tag, BinaryOperator::MUL, 10000, bReportIndividualTestCases), "mpfloat(double)", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeArithmetic<long double>(tag, BinaryOperator::MUL, 10000, bReportIndividualTestCases), "mpfloat(long double)", "multiplication");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyInverseIdentities(tag, BinaryOperator::MUL, 9, 10000, bReportIndividualTestCases), "mpfloat 9 digits", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyInverseIdentities(tag, BinaryOperator::MUL, 100, 1000, bReportIndividualTestCases), "mpfloat 100 digits", "multiplication");
+	nrOfFailedTestCases += ReportTestResult(VerifyInverseIdentities(tag, BinaryOperator::MUL, 1000, 100, bReportIndividualTestCases), "mpfloat 1000 digits", "multiplication");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(VerifyInverseIdentities(tag, BinaryOperator::MUL, 10000, 100, bReportIndividualTestCases), "mpfloat 10000 digits", "multiplication");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
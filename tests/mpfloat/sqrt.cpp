@@ -0,0 +1,103 @@
+// sqrt.cpp: functional tests for square root on multi-precison linear floating point
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cmath>
+#include <limits>
+
+// minimum set of include files to reflect source code dependencies
+#include <universal/mpfloat/mpfloat.hpp>
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+#include "mpfloat_test_helpers.hpp"
+
+// generate specific test case that you can trace with the trace conditions in mpfloat.hpp
+template<typename Ty>
+void GenerateTestCase(Ty a, Ty b) {
+	Ty ref;
+	sw::unum::mpfloat mpa, mpb, mpref, mpresult;
+	mpa = a;
+	mpb = b;
+	ref = std::sqrt(a);
+	mpref = ref;
+	mpresult = sqrt(mpa);
+	constexpr size_t ndigits = std::numeric_limits<Ty>::digits10;
+	std::cout << std::setprecision(ndigits);
+	std::cout << "sqrt(" << std::setw(ndigits) << a << ") = " << std::setw(ndigits) << ref << std::endl;
+	std::cout << "sqrt(" << mpa << ") = " << mpresult << " (reference: " << mpref << ")   " ;
+	std::cout << (mpref == mpresult ? "PASS" : "FAIL") << std::endl << std::endl;
+	std::cout << std::setprecision(5);
+}
+
+// the first 100 significant digits of the square root of 2, correctly rounded
+int VerifySqrt2(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+	mpfloat::setprecision(12);   // 1 + 11 * 9 = 100 digits
+	mpfloat root = sqrt(mpfloat(2)), ref;
+	parse("1.414213562373095048801688724209698078569671875376948073176679737990732478462107038850387534327641573", ref);
+	if (root != ref) {
+		++nrOfFailedTests;
+		if (bReportIndividualTestCases) std::cout << tag << " FAIL sqrt(2) = " << std::setprecision(100) << root << std::endl;
+	}
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "multi-precision float square root failed: ";
+
+#if MANUAL_TESTING
+
+	// generate individual testcases to hand trace/debug
+	GenerateTestCase(2.0, 0.0);
+	GenerateTestCase(1.0e-10, 0.0);
+
+#else
+
+	cout << "multi-precision float square root validation" << endl;
+
+	bool bReportIndividualTestCases = false;
+
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeSquareRoot<float>(tag, 10000, bReportIndividualTestCases), "mpfloat(float)", "square root");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeSquareRoot<double>(tag, 10000, bReportIndividualTestCases), "mpfloat(double)", "square root");
+	nrOfFailedTestCases += ReportTestResult(VerifyNativeSquareRoot<long double>(tag, 10000, bReportIndividualTestCases), "mpfloat(long double)", "square root");
+
+	nrOfFailedTestCases += ReportTestResult(VerifySquareRootIdentity(tag, 9, 10000, bReportIndividualTestCases), "mpfloat 9 digits", "square root");
+	nrOfFailedTestCases += ReportTestResult(VerifySquareRootIdentity(tag, 100, 1000, bReportIndividualTestCases), "mpfloat 100 digits", "square root");
+	nrOfFailedTestCases += ReportTestResult(VerifySquareRootIdentity(tag, 1000, 100, bReportIndividualTestCases), "mpfloat 1000 digits", "square root");
+
+	nrOfFailedTestCases += ReportTestResult(VerifySqrt2(tag, bReportIndividualTestCases), "mpfloat", "sqrt(2)");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(VerifySquareRootIdentity(tag, 10000, 100, bReportIndividualTestCases), "mpfloat 10000 digits", "square root");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,88 @@
+// 256b_posit.cpp: performance characterization of fast posit<256,5> configuration against the bitblock/value<> pipeline
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the posit template environment
+// first: enable fast specialized posit<256,5>
+#define POSIT_FAST_POSIT_256_5 1
+// second: disable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 0
+#include <universal/posit/posit>
+#include <universal/performance/number_system.hpp>
+
+// measure the throughput of the arithmetic operators of a posit configuration with a reduced
+// number of operations, as the bitblock/value<> pipeline is too slow at this precision for the full report
+template<typename Scalar>
+void MeasureArithmeticThroughput(size_t nrOfOps, sw::unum::OperatorPerformance& report) {
+	using namespace std::chrono;
+	Scalar a(1.0), sum, product, ratio;
+	steady_clock::time_point begin = steady_clock::now();
+	for (size_t i = 1; i <= nrOfOps; ++i) sum += Scalar(int(i)) + a;
+	steady_clock::time_point end = steady_clock::now();
+	report.add = float(nrOfOps / duration_cast<duration<double>>(end - begin).count());
+
+	begin = steady_clock::now();
+	for (size_t i = 1; i <= nrOfOps; ++i) product = Scalar(int(i)) * a;
+	end = steady_clock::now();
+	report.mul = float(nrOfOps / duration_cast<duration<double>>(end - begin).count());
+
+	begin = steady_clock::now();
+	for (size_t i = 1; i <= nrOfOps; ++i) ratio = a / Scalar(int(i));
+	end = steady_clock::now();
+	report.div = float(nrOfOps / duration_cast<duration<double>>(end - begin).count());
+	if (sum.isnar() || product.isnar() || ratio.isnar()) std::cerr << "unexpected NaR\n";
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	constexpr size_t nbits = 256;
+	constexpr size_t es = 5;
+	posit<nbits, es> number;
+	OperatorPerformance perfReport;
+	GeneratePerformanceReport(number, perfReport);
+	cout << ReportPerformance(number, perfReport);
+	cout << endl;
+
+	// the generic posit<256,4> runs through the same bitblock/value<> pipeline as the standard posit<256,5>
+	// and thus serves as the baseline for the limb pipeline of the fast posit<256,5>
+	constexpr size_t NR_OPS = 2000;
+	OperatorPerformance fastReport, referenceReport;
+	MeasureArithmeticThroughput< posit<nbits, es> >(NR_OPS, fastReport);
+	MeasureArithmeticThroughput< posit<nbits, es - 1> >(NR_OPS, referenceReport);
+
+	cout << "Throughput improvement of fast posit<256,5> over the bitblock/value<> pipeline\n";
+	cout << "Addition        : " << fastReport.add / referenceReport.add << "x\n";
+	cout << "Multiplication  : " << fastReport.mul / referenceReport.mul << "x\n";
+	cout << "Division        : " << fastReport.div / referenceReport.div << "x\n";
+	cout << endl;
+	return EXIT_SUCCESS;
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
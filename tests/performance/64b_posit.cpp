@@ -1,4 +1,4 @@
-// 64b_posit.cpp: performance characterization of standard posit<64,3> configuration
+// 64b_posit.cpp: performance characterization of fast posit<64,3> configuration against the bitblock/value<> pipeline
 //
 // Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
 //
@@ -6,7 +6,7 @@
 
 // Configure the posit template environment
 // first: enable fast specialized posit<64,3>
-#define POSIT_FAST_POSIT_64_3 0
+#define POSIT_FAST_POSIT_64_3 1
 // second: disable posit arithmetic exceptions
 #define POSIT_THROW_ARITHMETIC_EXCEPTION 0
 #include <universal/posit/posit>
@@ -24,6 +24,22 @@ try {
 	GeneratePerformanceReport(number, perfReport);
 	cout << ReportPerformance(number, perfReport);
 	cout << endl;
+
+	// the generic posit<64,2> runs through the same bitblock/value<> pipeline as the standard posit<64,3>
+	// and thus serves as the baseline for the integer pipeline of the fast posit<64,3>
+	posit<nbits, es - 1> reference;
+	OperatorPerformance referenceReport;
+	GeneratePerformanceReport(reference, referenceReport);
+	cout << ReportPerformance(reference, referenceReport);
+	cout << endl;
+
+	cout << "Throughput improvement of fast posit<64,3> over the bitblock/value<> pipeline\n";
+	cout << "Addition        : " << perfReport.add  / referenceReport.add  << "x\n";
+	cout << "Subtraction     : " << perfReport.sub  / referenceReport.sub  << "x\n";
+	cout << "Multiplication  : " << perfReport.mul  / referenceReport.mul  << "x\n";
+	cout << "Division        : " << perfReport.div  / referenceReport.div  << "x\n";
+	cout << "Square Root     : " << perfReport.sqrt / referenceReport.sqrt << "x\n";
+	cout << endl;
 	return EXIT_SUCCESS;
 }
 catch (char const* msg) {
@@ -0,0 +1,146 @@
+// function_elementary.cpp: functional tests for the elementary functions evaluated in the posit domain
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// evaluate every configuration with the quire-based kernels instead of the native float path
+#define POSIT_NATIVE_ELEMENTARY_FUNCTIONS 1
+
+// minimum set of include files to reflect source code dependencies
+#include <random>
+#include "universal/posit/posit.hpp"
+#include "universal/posit/posit_manipulators.hpp"
+#include "universal/posit/math/exponent.hpp"
+#include "universal/posit/math/logarithm.hpp"
+#include "universal/posit/math/trigonometry.hpp"
+#include "universal/posit/math/hyperbolic.hpp"
+#include "universal/posit/math/pow.hpp"
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+#include "../utils/posit_math_helpers.hpp"
+
+// the posit domain kernels must reproduce the correctly rounded long double function on random arguments
+// of a posit configuration whose fraction is much shorter than the long double significand
+template<size_t nbits, size_t es, typename PositFunction, typename NativeFunction>
+int VerifyAgainstLongDouble(const std::string& tag, PositFunction pf, NativeFunction nf, double lo, double hi, size_t nrSamples, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	std::mt19937_64 rng(nbits);
+	std::uniform_real_distribution<double> dist(lo, hi);
+	int nrOfFailedTests = 0;
+	for (size_t n = 0; n < nrSamples; ++n) {
+		posit<nbits, es> pa = dist(rng);
+		posit<nbits, es> presult = pf(pa);
+		posit<nbits, es> pref = nf((long double)pa);
+		if (presult != pref) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) ReportOneInputFunctionError("FAIL", tag.c_str(), pa, pref, presult);
+		}
+	}
+	return nrOfFailedTests;
+}
+
+template<size_t nbits, size_t es>
+int VerifyRandomArguments(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	int nrOfFailedTests = 0;
+	nrOfFailedTests += VerifyAgainstLongDouble<nbits, es>(tag + " exp",   [](Posit a) { return exp(a); },   [](long double a) { return std::exp(a); },   -40.0, 40.0, nrSamples, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyAgainstLongDouble<nbits, es>(tag + " expm1", [](Posit a) { return expm1(a); }, [](long double a) { return std::expm1(a); }, -2.0, 2.0, nrSamples, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyAgainstLongDouble<nbits, es>(tag + " log",   [](Posit a) { return log(a); },   [](long double a) { return std::log(a); },   0.0, 1.0e6, nrSamples, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyAgainstLongDouble<nbits, es>(tag + " log1p", [](Posit a) { return log1p(a); }, [](long double a) { return std::log1p(a); }, -0.5, 2.0, nrSamples, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyAgainstLongDouble<nbits, es>(tag + " sin",   [](Posit a) { return sin(a); },   [](long double a) { return std::sin(a); },   -1.0e4, 1.0e4, nrSamples, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyAgainstLongDouble<nbits, es>(tag + " cos",   [](Posit a) { return cos(a); },   [](long double a) { return std::cos(a); },   -1.0e4, 1.0e4, nrSamples, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyAgainstLongDouble<nbits, es>(tag + " tan",   [](Posit a) { return tan(a); },   [](long double a) { return std::tan(a); },   -10.0, 10.0, nrSamples, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyAgainstLongDouble<nbits, es>(tag + " atan",  [](Posit a) { return atan(a); },  [](long double a) { return std::atan(a); },  -100.0, 100.0, nrSamples, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyAgainstLongDouble<nbits, es>(tag + " asin",  [](Posit a) { return asin(a); },  [](long double a) { return std::asin(a); },  -1.0, 1.0, nrSamples, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyAgainstLongDouble<nbits, es>(tag + " acos",  [](Posit a) { return acos(a); },  [](long double a) { return std::acos(a); },  -1.0, 1.0, nrSamples, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyAgainstLongDouble<nbits, es>(tag + " sinh",  [](Posit a) { return sinh(a); },  [](long double a) { return std::sinh(a); },  -20.0, 20.0, nrSamples, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyAgainstLongDouble<nbits, es>(tag + " tanh",  [](Posit a) { return tanh(a); },  [](long double a) { return std::tanh(a); },  -10.0, 10.0, nrSamples, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyAgainstLongDouble<nbits, es>(tag + " acosh", [](Posit a) { return acosh(a); }, [](long double a) { return std::acosh(a); }, 1.0, 1.0e3, nrSamples, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyAgainstLongDouble<nbits, es>(tag + " atanh", [](Posit a) { return atanh(a); }, [](long double a) { return std::atanh(a); }, -1.0, 1.0, nrSamples, bReportIndividualTestCases);
+	return nrOfFailedTests;
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = true;
+	int nrOfFailedTestCases = 0;
+
+	std::string tag = "posit domain: ";
+
+#if MANUAL_TESTING
+	// generate individual testcases to hand trace/debug
+	posit<32, 2> p = 1.0e4;
+	cout << "sin(" << p << ") = " << sin(p) << " reference " << posit<32, 2>(std::sin((long double)p)) << endl;
+
+#else
+
+	cout << "Posit elementary functions evaluated in the posit domain" << endl;
+
+	nrOfFailedTestCases += ReportTestResult(ValidateExp<8, 0>(tag, bReportIndividualTestCases), "posit<8,0>", "exp");
+	nrOfFailedTestCases += ReportTestResult(ValidateExp<8, 2>(tag, bReportIndividualTestCases), "posit<8,2>", "exp");
+	nrOfFailedTestCases += ReportTestResult(ValidateExp2<8, 1>(tag, bReportIndividualTestCases), "posit<8,1>", "exp2");
+	nrOfFailedTestCases += ReportTestResult(ValidateLog<8, 0>(tag, bReportIndividualTestCases), "posit<8,0>", "log");
+	nrOfFailedTestCases += ReportTestResult(ValidateLog2<8, 1>(tag, bReportIndividualTestCases), "posit<8,1>", "log2");
+	nrOfFailedTestCases += ReportTestResult(ValidateLog10<8, 2>(tag, bReportIndividualTestCases), "posit<8,2>", "log10");
+	nrOfFailedTestCases += ReportTestResult(ValidateSine<8, 0>(tag, bReportIndividualTestCases), "posit<8,0>", "sin");
+	nrOfFailedTestCases += ReportTestResult(ValidateCosine<8, 1>(tag, bReportIndividualTestCases), "posit<8,1>", "cos");
+	nrOfFailedTestCases += ReportTestResult(ValidateTangent<8, 2>(tag, bReportIndividualTestCases), "posit<8,2>", "tan");
+	nrOfFailedTestCases += ReportTestResult(ValidateAtan<8, 0>(tag, bReportIndividualTestCases), "posit<8,0>", "atan");
+	nrOfFailedTestCases += ReportTestResult(ValidateAsin<8, 1>(tag, bReportIndividualTestCases), "posit<8,1>", "asin");
+	nrOfFailedTestCases += ReportTestResult(ValidateAcos<8, 2>(tag, bReportIndividualTestCases), "posit<8,2>", "acos");
+	nrOfFailedTestCases += ReportTestResult(ValidateSinh<8, 0>(tag, bReportIndividualTestCases), "posit<8,0>", "sinh");
+	nrOfFailedTestCases += ReportTestResult(ValidateCosh<8, 1>(tag, bReportIndividualTestCases), "posit<8,1>", "cosh");
+	nrOfFailedTestCases += ReportTestResult(ValidateTanh<8, 2>(tag, bReportIndividualTestCases), "posit<8,2>", "tanh");
+	nrOfFailedTestCases += ReportTestResult(ValidateAsinh<8, 0>(tag, bReportIndividualTestCases), "posit<8,0>", "asinh");
+	nrOfFailedTestCases += ReportTestResult(ValidateAcosh<8, 1>(tag, bReportIndividualTestCases), "posit<8,1>", "acosh");
+	nrOfFailedTestCases += ReportTestResult(ValidateAtanh<8, 2>(tag, bReportIndividualTestCases), "posit<8,2>", "atanh");
+	nrOfFailedTestCases += ReportTestResult(ValidatePowerFunction<8, 0>(tag, bReportIndividualTestCases, 5000), "posit<8,0>", "pow");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateExp<12, 1>(tag, bReportIndividualTestCases), "posit<12,1>", "exp");
+	nrOfFailedTestCases += ReportTestResult(ValidateLog<12, 1>(tag, bReportIndividualTestCases), "posit<12,1>", "log");
+	nrOfFailedTestCases += ReportTestResult(ValidateSine<12, 1>(tag, bReportIndividualTestCases), "posit<12,1>", "sin");
+	nrOfFailedTestCases += ReportTestResult(ValidateAtan<12, 1>(tag, bReportIndividualTestCases), "posit<12,1>", "atan");
+
+	nrOfFailedTestCases += ReportTestResult(VerifyRandomArguments<32, 2>(tag, 2000, bReportIndividualTestCases), "posit<32,2>", "random arguments");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidatePowerFunction<10, 1>(tag, bReportIndividualTestCases, 1 << 20), "posit<10,1>", "pow");
+	nrOfFailedTestCases += ReportTestResult(VerifyRandomArguments<32, 2>(tag, 100000, bReportIndividualTestCases), "posit<32,2>", "random arguments");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
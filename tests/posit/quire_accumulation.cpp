@@ -274,6 +274,44 @@ int ValidateQuireAccumulation(bool bReportIndividualTestCases) {
 	return nrOfFailedTests;
 }
 
+// validate that quire::fma(a, b) accumulates bit-identical to q += quire_mul(a, b)
+// nbits <= 10 sweeps all operand pairs, larger configurations use random operands
+template<size_t nbits, size_t es, size_t capacity = 10>
+int ValidateQuireFma(bool bReportIndividualTestCases, size_t nrOfRandoms = 10000) {
+	using namespace sw::unum;
+	int nrOfFailedTests = 0;
+
+	constexpr bool exhaustive = nbits <= 10;
+	constexpr size_t NR_POSITS = (size_t(1) << (exhaustive ? nbits : 1));
+	std::mt19937_64 generator;
+	quire<nbits, es, capacity> qfma, qref;
+	posit<nbits, es> a, b;
+	size_t nrOfTestCases = exhaustive ? NR_POSITS * NR_POSITS : nrOfRandoms;
+	for (size_t i = 0; i < nrOfTestCases; ++i) {
+		if (exhaustive) {
+			a.set_raw_bits(i / NR_POSITS);
+			b.set_raw_bits(i % NR_POSITS);
+		}
+		else {
+			a.set_raw_bits(generator());
+			b.set_raw_bits(generator());
+		}
+		if (a.isnar() || b.isnar()) continue;
+		// the accumulation alternates sign to exercise the carry, borrow, and sign transitions
+		if (i & 0x1) a = -a;
+		qfma.fma(a, b);
+		qref += quire_mul(a, b);
+		if (qfma != qref) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << "FAIL: " << a << " * " << b << '\n' << qfma << '\n' << qref << '\n';
+			qfma = qref.to_value();
+		}
+		// restart periodically so that the small products are not hidden by the accumulated sum
+		if ((i & 0xFF) == 0xFF) { qfma.clear(); qref.clear(); }
+	}
+	return nrOfFailedTests;
+}
+
 // one of test to check that the quire can deal with 0
 void TestCaseForProperZeroHandling() {
 	using namespace std;
@@ -348,6 +386,13 @@ try {
 	cout << "Borrow Propagation\n";
 	nrOfFailedTestCases += ReportTestResult(ValidateBorrowPropagation<4, 1>(bReportIndividualTestCases), "borrow propagation", "increment");
 
+	cout << "Fused multiply-accumulate\n";
+	nrOfFailedTestCases += ReportTestResult(ValidateQuireFma< 8, 0>(bReportIndividualTestCases), "quire<8,0>", "fma");
+	nrOfFailedTestCases += ReportTestResult(ValidateQuireFma<10, 1>(bReportIndividualTestCases), "quire<10,1>", "fma");
+	nrOfFailedTestCases += ReportTestResult(ValidateQuireFma<16, 1>(bReportIndividualTestCases), "quire<16,1>", "fma");
+	nrOfFailedTestCases += ReportTestResult(ValidateQuireFma<32, 2>(bReportIndividualTestCases), "quire<32,2>", "fma");
+	nrOfFailedTestCases += ReportTestResult(ValidateQuireFma<48, 2>(bReportIndividualTestCases, 1000), "quire<48,2>", "fma");
+
 #ifdef ISSUE_45_DEBUG
 	{	
 		Issue45_2<16, 1, 30>();
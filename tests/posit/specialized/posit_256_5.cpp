@@ -7,7 +7,7 @@
 // Configure the posit template environment
 // first: enable fast specialized posit<256,5>
 //#define POSIT_FAST_SPECIALIZATION   // turns on all fast specializations
-#define POSIT_FAST_POSIT_256_5 0
+#define POSIT_FAST_POSIT_256_5 1
 // second: enable posit arithmetic exceptions
 #define POSIT_THROW_ARITHMETIC_EXCEPTION 0
 #include <universal/posit/posit>
@@ -27,6 +27,7 @@ try {
 	using namespace sw::unum;
 
 	const size_t RND_TEST_CASES = 10000;
+	const uint32_t BIT_EXACT_TEST_CASES = 2500;  // the generic reference pipeline is slow at this precision
 
 	const size_t nbits = 256;
 	const size_t es = 5;
@@ -45,7 +46,7 @@ try {
 	cout << dynamic_range(p) << endl << endl;
 
 	// TODO: as we don't have a reference floating point implementation to validate
-	// the arithmetic operations we are going to ignore the failures
+	// the arithmetic operations against double we are going to ignore the failures
 #if STRESS_TESTING
 	cout << "Arithmetic tests " << RND_TEST_CASES << " randoms each" << endl;
 	cout << "Without an arithmetic reference, test failures can be ignored" << endl;
@@ -55,6 +56,15 @@ try {
 	nrOfFailedTestCases += ReportTestResult(ValidateBinaryOperatorThroughRandoms<nbits, es>(tag, bReportIndividualTestCases, OPCODE_DIV, RND_TEST_CASES), tag, "division      ");
 #endif
 	nrOfFailedTestCases = 0;
+
+	// bit-level validation of the limb pipeline against the value<> pipeline of the generic posit
+	cout << "Limb pipeline versus generic value<> pipeline " << BIT_EXACT_TEST_CASES << " randoms each" << endl;
+	nrOfFailedTestCases += ReportTestResult(ValidateBitExactBinaryOperatorThroughRandoms<nbits, es>(tag, bReportIndividualTestCases, OPCODE_ADD, BIT_EXACT_TEST_CASES), tag, "addition      ");
+	nrOfFailedTestCases += ReportTestResult(ValidateBitExactBinaryOperatorThroughRandoms<nbits, es>(tag, bReportIndividualTestCases, OPCODE_SUB, BIT_EXACT_TEST_CASES), tag, "subtraction   ");
+	nrOfFailedTestCases += ReportTestResult(ValidateBitExactBinaryOperatorThroughRandoms<nbits, es>(tag, bReportIndividualTestCases, OPCODE_MUL, BIT_EXACT_TEST_CASES), tag, "multiplication");
+	nrOfFailedTestCases += ReportTestResult(ValidateBitExactBinaryOperatorThroughRandoms<nbits, es>(tag, bReportIndividualTestCases, OPCODE_DIV, BIT_EXACT_TEST_CASES), tag, "division      ");
+	nrOfFailedTestCases += ReportTestResult(ValidateExactSqrtThroughRandoms             <nbits, es>(tag, bReportIndividualTestCases, BIT_EXACT_TEST_CASES), tag, "sqrt          ");
+
 	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
 }
 catch (char const* msg) {
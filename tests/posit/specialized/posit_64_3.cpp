@@ -6,7 +6,7 @@
 
 // Configure the posit template environment
 // first: enable fast specialized posit<64,3>
-#define POSIT_FAST_POSIT_64_3 0  // TODO: fast posit<64,3> not implemented yet
+#define POSIT_FAST_POSIT_64_3 1
 // second: enable posit arithmetic exceptions
 #define POSIT_THROW_ARITHMETIC_EXCEPTION 1
 #include <universal/posit/posit>
@@ -17,7 +17,7 @@
 // Standard posit with nbits = 64 have es = 3 exponent bits.
 
 #define MANUAL_TESTING 0
-#define STRESS_TESTING 1
+#define STRESS_TESTING 0
 
 int main(int argc, char** argv)
 try {
@@ -110,15 +110,27 @@ try {
 	nrOfFailedTestCases += ReportTestResult(ValidateBinaryOperatorThroughRandoms<nbits, es>(tag, bReportIndividualTestCases, OPCODE_POW, RND_TEST_CASES),   tag, "pow                       ");
 
 
-#if STRESS_TESTING
+	// TODO: as we don't have a reference floating point implementation to validate
+	// the arithmetic operations against double we are going to ignore the failures
+	nrOfFailedTestCases = 0;
+
+	// bit-level validation of the integer pipeline against the value<> pipeline of the generic posit
+	cout << "Integer pipeline versus generic value<> pipeline " << RND_TEST_CASES << " randoms each" << endl;
+	nrOfFailedTestCases += ReportTestResult( ValidateBitExactBinaryOperatorThroughRandoms<nbits, es>(tag, bReportIndividualTestCases, OPCODE_ADD, RND_TEST_CASES), tag, "addition        (native)  ");
+	nrOfFailedTestCases += ReportTestResult( ValidateBitExactBinaryOperatorThroughRandoms<nbits, es>(tag, bReportIndividualTestCases, OPCODE_SUB, RND_TEST_CASES), tag, "subtraction     (native)  ");
+	nrOfFailedTestCases += ReportTestResult( ValidateBitExactBinaryOperatorThroughRandoms<nbits, es>(tag, bReportIndividualTestCases, OPCODE_MUL, RND_TEST_CASES), tag, "multiplication  (native)  ");
+	nrOfFailedTestCases += ReportTestResult( ValidateBitExactBinaryOperatorThroughRandoms<nbits, es>(tag, bReportIndividualTestCases, OPCODE_DIV, RND_TEST_CASES), tag, "division        (native)  ");
+	nrOfFailedTestCases += ReportTestResult( ValidateExactSqrtThroughRandoms             <nbits, es>(tag, bReportIndividualTestCases, RND_TEST_CASES), tag, "sqrt            (native)  ");
 
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult( ValidateBitExactBinaryOperatorThroughRandoms<nbits, es>(tag, bReportIndividualTestCases, OPCODE_ADD, 100 * RND_TEST_CASES), tag, "addition        (native)  ");
+	nrOfFailedTestCases += ReportTestResult( ValidateBitExactBinaryOperatorThroughRandoms<nbits, es>(tag, bReportIndividualTestCases, OPCODE_SUB, 100 * RND_TEST_CASES), tag, "subtraction     (native)  ");
+	nrOfFailedTestCases += ReportTestResult( ValidateBitExactBinaryOperatorThroughRandoms<nbits, es>(tag, bReportIndividualTestCases, OPCODE_MUL, 100 * RND_TEST_CASES), tag, "multiplication  (native)  ");
+	nrOfFailedTestCases += ReportTestResult( ValidateBitExactBinaryOperatorThroughRandoms<nbits, es>(tag, bReportIndividualTestCases, OPCODE_DIV, 100 * RND_TEST_CASES), tag, "division        (native)  ");
 #endif // STRESS_TESTING
 
 #endif // !MANUAL_TESTING
 
-	// TODO: as we don't have a reference floating point implementation to validate
-	// the arithmetic operations we are going to ignore the failures
-	nrOfFailedTestCases = 0;
 	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
 }
 catch (char const* msg) {
@@ -0,0 +1,208 @@
+// posit_batch.cpp: Functionality tests for the branch-free array kernels of small posits
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+#include <random>
+#include <vector>
+#include <universal/posit/posit>
+// test helpers, such as, ReportTestResults
+#include "../../utils/test_helpers.hpp"
+#include "../../utils/posit_test_helpers.hpp"
+
+// enumerate all pairs of encodings in arrays and compare the batch kernels against the posit operators
+template<size_t nbits, size_t es>
+int VerifyBatchExhaustive(const std::string& tag, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	constexpr size_t NR_ENCODINGS = size_t(1) << nbits;
+	std::vector<Posit> a(NR_ENCODINGS), b(NR_ENCODINGS), sum(NR_ENCODINGS), product(NR_ENCODINGS);
+	for (size_t j = 0; j < NR_ENCODINGS; ++j) b[j].set_raw_bits(j);
+	int nrOfFailedTests = 0;
+	for (size_t i = 0; i < NR_ENCODINGS; ++i) {
+		for (size_t j = 0; j < NR_ENCODINGS; ++j) a[j].set_raw_bits(i);
+		batch_add(a.data(), b.data(), sum.data(), NR_ENCODINGS);
+		batch_mul(a.data(), b.data(), product.data(), NR_ENCODINGS);
+		for (size_t j = 0; j < NR_ENCODINGS; ++j) {
+			Posit ref = (a[j].isnar() || b[j].isnar()) ? Posit(NAR) : a[j] + b[j];
+			if (sum[j] != ref) {
+				++nrOfFailedTests;
+				if (bReportIndividualTestCases) ReportBinaryArithmeticError("FAIL", "+", a[j], b[j], ref, sum[j]);
+			}
+			ref = (a[j].isnar() || b[j].isnar()) ? Posit(NAR) : a[j] * b[j];
+			if (product[j] != ref) {
+				++nrOfFailedTests;
+				if (bReportIndividualTestCases) ReportBinaryArithmeticError("FAIL", "*", a[j], b[j], ref, product[j]);
+			}
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// random operands: add, mul against the posit operators, fma against a quire
+template<size_t nbits, size_t es>
+int VerifyBatchRandom(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	std::mt19937_64 rng(0x5eed);
+	std::vector<Posit> a(nrSamples), b(nrSamples), c(nrSamples), sum(nrSamples), product(nrSamples), fused(nrSamples);
+	for (size_t i = 0; i < nrSamples; ++i) {
+		a[i].set_raw_bits(rng());
+		b[i].set_raw_bits(rng());
+		c[i].set_raw_bits(rng());
+	}
+	batch_add(a.data(), b.data(), sum.data(), nrSamples);
+	batch_mul(a.data(), b.data(), product.data(), nrSamples);
+	batch_fma(a.data(), b.data(), c.data(), fused.data(), nrSamples);
+	int nrOfFailedTests = 0;
+	for (size_t i = 0; i < nrSamples; ++i) {
+		bool nar = a[i].isnar() || b[i].isnar();
+		Posit ref = nar ? Posit(NAR) : a[i] + b[i];
+		if (sum[i] != ref) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) ReportBinaryArithmeticError("FAIL", "+", a[i], b[i], ref, sum[i]);
+		}
+		ref = nar ? Posit(NAR) : a[i] * b[i];
+		if (product[i] != ref) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) ReportBinaryArithmeticError("FAIL", "*", a[i], b[i], ref, product[i]);
+		}
+		if (nar || c[i].isnar()) {
+			ref.setnar();
+		}
+		else {
+			quire<nbits, es, 2> q;
+			q += c[i];
+			q += quire_mul(a[i], b[i]);
+			convert(q.to_value(), ref);
+		}
+		if (fused[i] != ref) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL fma(" << a[i] << ", " << b[i] << ", " << c[i] << ") != " << ref << " instead it yielded " << fused[i] << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// fused dot products of random vectors against the quire-based fdp
+template<size_t nbits, size_t es>
+int VerifyBatchDot(const std::string& tag, size_t nrTrials, size_t N, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	std::mt19937_64 rng(0xd07);
+	std::vector<Posit> x(N), y(N);
+	int nrOfFailedTests = 0;
+	for (size_t t = 0; t < nrTrials; ++t) {
+		for (size_t i = 0; i < N; ++i) {
+			x[i].set_raw_bits(rng());
+			y[i].set_raw_bits(rng());
+			if (x[i].isnar()) x[i] = 0;
+			if (y[i].isnar()) y[i] = 0;
+		}
+		Posit ref = fdp(x, y);
+		Posit result = batch_dot(x.data(), y.data(), N);
+		if (result != ref) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL batch_dot " << result << " != " << ref << std::endl;
+		}
+	}
+	// NaR propagates through the dot product
+	x[N / 2].setnar();
+	if (!batch_dot(x.data(), y.data(), N).isnar()) ++nrOfFailedTests;
+	return nrOfFailedTests;
+}
+
+// the array functions, which run the AVX2 kernels when LIB_USE_AVX2 is set, must reproduce the scalar kernels bit for bit,
+// also on the tails of arrays whose length is not a multiple of the vector width
+template<size_t nbits, size_t es>
+int VerifyBatchAgainstScalarKernels(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using Posit = posit<nbits, es>;
+	using K = posit_batch_kernels<nbits, es>;
+	std::mt19937_64 rng(nbits * 16 + es);
+	std::vector<Posit> a(nrSamples), b(nrSamples), c(nrSamples), sum(nrSamples), product(nrSamples), fused(nrSamples);
+	for (size_t i = 0; i < nrSamples; ++i) {
+		a[i].set_raw_bits(rng());
+		b[i].set_raw_bits(rng());
+		c[i].set_raw_bits(rng());
+	}
+	batch_add(a.data(), b.data(), sum.data(), nrSamples);
+	batch_mul(a.data(), b.data(), product.data(), nrSamples);
+	batch_fma(a.data(), b.data(), c.data(), fused.data(), nrSamples);
+	int nrOfFailedTests = 0;
+	for (size_t i = 0; i < nrSamples; ++i) {
+		uint32_t x = uint32_t(a[i].encoding()), y = uint32_t(b[i].encoding()), z = uint32_t(c[i].encoding());
+		bool pass = sum[i].encoding() == K::add(x, y) && product[i].encoding() == K::mul(x, y) && fused[i].encoding() == K::fma(x, y, z);
+		if (!pass) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL " << a[i] << " " << b[i] << " " << c[i] << " : " << sum[i] << " " << product[i] << " " << fused[i] << std::endl;
+		}
+	}
+	// dot products of every length up to a few vector widths, with the NaR operands replaced
+	for (size_t i = 0; i < nrSamples; ++i) {
+		if (a[i].isnar()) a[i].set_raw_bits(K::maxpos);
+		if (b[i].isnar()) b[i].set_raw_bits(K::minpos);
+	}
+	for (size_t n = 0; n < 100 && n <= nrSamples; ++n) {
+		size_t first = rng() % (nrSamples - n + 1);
+		uint64_t acc[K::dot_limbs] = {};
+		for (size_t i = first; i < first + n; ++i) K::accumulate(acc, uint32_t(a[i].encoding()), uint32_t(b[i].encoding()));
+		Posit result = batch_dot(a.data() + first, b.data() + first, n);
+		if (result.encoding() != K::round(acc)) {
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL batch_dot of length " << n << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	int nrOfFailedTestCases = 0;
+	bool bReportIndividualTestCases = false;
+
+	cout << "Batched array kernels for small posits" << endl;
+	cout << (POSIT_BATCH_AVX2 ? "AVX2 kernels" : "scalar kernels") << endl;
+
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchExhaustive<8, 0>("posit<8,0>", bReportIndividualTestCases), "posit<8,0>", "batch add/mul");
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchExhaustive<8, 1>("posit<8,1>", bReportIndividualTestCases), "posit<8,1>", "batch add/mul");
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchExhaustive<10, 1>("posit<10,1>", bReportIndividualTestCases), "posit<10,1>", "batch add/mul");
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchRandom<8, 0>("posit<8,0>", 10000, bReportIndividualTestCases), "posit<8,0>", "batch add/mul/fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchRandom<16, 1>("posit<16,1>", 100000, bReportIndividualTestCases), "posit<16,1>", "batch add/mul/fma");
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchDot<8, 0>("posit<8,0>", 100, 256, bReportIndividualTestCases), "posit<8,0>", "batch dot");
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchDot<16, 1>("posit<16,1>", 100, 1024, bReportIndividualTestCases), "posit<16,1>", "batch dot");
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchAgainstScalarKernels<8, 0>("posit<8,0>", 100003, bReportIndividualTestCases), "posit<8,0>", "batch vs scalar kernels");
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchAgainstScalarKernels<12, 2>("posit<12,2>", 100003, bReportIndividualTestCases), "posit<12,2>", "batch vs scalar kernels");
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchAgainstScalarKernels<16, 0>("posit<16,0>", 100003, bReportIndividualTestCases), "posit<16,0>", "batch vs scalar kernels");
+	nrOfFailedTestCases += ReportTestResult(VerifyBatchAgainstScalarKernels<16, 1>("posit<16,1>", 1000003, bReportIndividualTestCases), "posit<16,1>", "batch vs scalar kernels");
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,87 @@
+// posit_lookup.cpp: Functionality tests for the table-driven arithmetic engine of small posits
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// enable table-driven arithmetic for all posits up to 10 bits
+#define POSIT_FAST_LOOKUP_ARITHMETIC 1
+// enable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 1
+#include <universal/posit/posit>
+// test helpers, such as, ReportTestResults
+#include "../../utils/test_helpers.hpp"
+#include "../../utils/posit_test_helpers.hpp"
+
+// the lookup tables are generated on first use: all encodings of the configuration are enumerated exhaustively
+template<size_t nbits, size_t es>
+int ValidateLookupArithmetic(bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	std::string tag = " posit<" + std::to_string(nbits) + ',' + std::to_string(es) + ">";
+	int nrOfFailedTestCases = 0;
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition         <nbits, es>(tag, bReportIndividualTestCases), tag, "add            ");
+	nrOfFailedTestCases += ReportTestResult(ValidateInPlaceAddition  <nbits, es>(tag, bReportIndividualTestCases), tag, "+=             ");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction      <nbits, es>(tag, bReportIndividualTestCases), tag, "subtract       ");
+	nrOfFailedTestCases += ReportTestResult(ValidateInPlaceSubtraction<nbits, es>(tag, bReportIndividualTestCases), tag, "-=             ");
+	nrOfFailedTestCases += ReportTestResult(ValidateMultiplication   <nbits, es>(tag, bReportIndividualTestCases), tag, "multiply       ");
+	nrOfFailedTestCases += ReportTestResult(ValidateInPlaceMultiplication<nbits, es>(tag, bReportIndividualTestCases), tag, "*=             ");
+	nrOfFailedTestCases += ReportTestResult(ValidateDivision         <nbits, es>(tag, bReportIndividualTestCases), tag, "divide         ");
+	nrOfFailedTestCases += ReportTestResult(ValidateInPlaceDivision  <nbits, es>(tag, bReportIndividualTestCases), tag, "/=             ");
+	return nrOfFailedTestCases;
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	int nrOfFailedTestCases = 0;
+	bool bReportIndividualTestCases = false;
+
+	cout << "Table-driven arithmetic tests for posits with nbits <= " << POSIT_LOOKUP_MAX_NBITS << endl;
+
+	nrOfFailedTestCases += ValidateLookupArithmetic<3, 1>(bReportIndividualTestCases);
+	nrOfFailedTestCases += ValidateLookupArithmetic<5, 1>(bReportIndividualTestCases);
+	nrOfFailedTestCases += ValidateLookupArithmetic<6, 2>(bReportIndividualTestCases);
+	nrOfFailedTestCases += ValidateLookupArithmetic<7, 0>(bReportIndividualTestCases);
+	nrOfFailedTestCases += ValidateLookupArithmetic<8, 0>(bReportIndividualTestCases);
+	nrOfFailedTestCases += ValidateLookupArithmetic<8, 1>(bReportIndividualTestCases);
+	nrOfFailedTestCases += ValidateLookupArithmetic<9, 1>(bReportIndividualTestCases);
+	nrOfFailedTestCases += ValidateLookupArithmetic<10, 1>(bReportIndividualTestCases);
+
+	// special cases are handled before the lookup
+	posit<10, 1> a(1.5), b(0);
+	try {
+		a /= b;
+		++nrOfFailedTestCases;
+	}
+	catch (const divide_by_zero&) {
+		// correctly caught the divide by zero condition
+	}
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
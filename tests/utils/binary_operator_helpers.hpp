@@ -0,0 +1,65 @@
+#pragma once
+//  binary_operator_helpers.hpp : generic verification of the binary arithmetic operators of a number system
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cstdint>
+#include <random>
+
+namespace sw { namespace unum {
+
+enum class BinaryOperator { ADD, SUB, MUL, DIV };
+
+// apply the operator to two operands of a number system or of its reference type
+template<typename Ty>
+Ty ApplyBinaryOperator(BinaryOperator op, const Ty& a, const Ty& b) {
+	switch (op) {
+	case BinaryOperator::SUB: return a - b;
+	case BinaryOperator::MUL: return a * b;
+	case BinaryOperator::DIV: return a / b;
+	default:                  return a + b;
+	}
+}
+
+// run verify(a, b) on all pairs of encodings of a number system of nbits bits,
+// verify returns true when the operator passes on the pair
+template<typename Number, size_t nbits, typename Verify>
+int VerifyBinaryOperatorExhaustive(Verify verify) {
+	static_assert(nbits < 64, "exhaustive enumeration requires the encodings to fit a 64-bit counter");
+	constexpr uint64_t NR_ENCODINGS = uint64_t(1) << nbits;
+	int nrOfFailedTests = 0;
+	Number a, b;
+	for (uint64_t i = 0; i < NR_ENCODINGS; ++i) {
+		a.set_raw_bits(i);
+		for (uint64_t j = 0; j < NR_ENCODINGS; ++j) {
+			b.set_raw_bits(j);
+			if (!verify(a, b)) ++nrOfFailedTests;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// run verify(a, b) on nrSamples pairs drawn by sample(rng, n, a, b) from a generator seeded with seed
+template<typename Number, typename Sample, typename Verify>
+int VerifyBinaryOperatorRandom(size_t nrSamples, uint64_t seed, Sample sample, Verify verify) {
+	std::mt19937_64 rng(seed);
+	int nrOfFailedTests = 0;
+	Number a, b;
+	for (size_t n = 0; n < nrSamples; ++n) {
+		sample(rng, n, a, b);
+		if (!verify(a, b)) ++nrOfFailedTests;
+	}
+	return nrOfFailedTests;
+}
+
+// exhaustive over all encodings when nrSamples is 0, random otherwise
+template<typename Number, size_t nbits, typename Sample, typename Verify>
+int VerifyBinaryOperator(size_t nrSamples, uint64_t seed, Sample sample, Verify verify) {
+	if constexpr (nbits < 64) {
+		if (nrSamples == 0) return VerifyBinaryOperatorExhaustive<Number, nbits>(verify);
+	}
+	return VerifyBinaryOperatorRandom<Number>(nrSamples, seed, sample, verify);
+}
+
+}} // namespace sw::unum
@@ -0,0 +1,65 @@
+#pragma once
+//  lns_test_helpers.hpp : functions to aid in testing and test reporting on logarithmic number system types
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <random>
+#include <cmath>
+#include <limits>
+#include "binary_operator_helpers.hpp"
+
+namespace sw { namespace unum {
+
+// logarithms within tolerance units of 2^-rbits, with zero positioned just below minpos
+template<size_t nbits, typename bt>
+bool LnsWithin(const lns<nbits, bt>& result, const lns<nbits, bt>& reference, int64_t tolerance) {
+	if (result.isnan() || reference.isnan()) return result.isnan() && reference.isnan();
+	if (result.iszero() && reference.iszero()) return true;
+	if (!result.iszero() && !reference.iszero() && result.sign() != reference.sign()) return false;
+	int64_t diff = result.log() - reference.log();
+	return (diff <= tolerance) && (-diff <= tolerance);
+}
+
+// NaN or a normal long double
+inline bool Normal(long double v) {
+	return std::isnan(v) || (std::isfinite(v) && std::fabs(v) >= std::numeric_limits<long double>::min());
+}
+
+// compare an arithmetic operator against the reference of the long double result rounded to the lns:
+// exhaustive over all encodings when nrSamples is 0, random otherwise
+template<size_t nbits, typename bt = uint8_t>
+int VerifyLnsArithmetic(const std::string& tag, BinaryOperator op, size_t nrSamples, int64_t tolerance, bool bReportIndividualTestCases) {
+	using Lns = lns<nbits, bt>;
+	auto sample = [](std::mt19937_64& rng, size_t n, Lns& a, Lns& b) {
+		// sample logarithms in (-1024, 1024) to stay within the range of long double
+		constexpr int64_t bound = (Lns::max_log < (int64_t(1024) << Lns::rbits)) ? Lns::max_log : (int64_t(1024) << Lns::rbits);
+		int64_t la = int64_t(rng() % uint64_t(2 * bound + 1)) - bound;
+		int64_t lb = int64_t(rng() % uint64_t(2 * bound + 1)) - bound;
+		// half of the samples have nearby magnitudes to exercise the neighborhood of the subtraction singularity
+		if (n & 0x1) lb = la - int64_t(rng() % 256);
+		if (lb < Lns::min_log) lb = Lns::min_log;
+		a.set((rng() & 0x1) != 0, la);
+		b.set((rng() & 0x1) != 0, lb);
+	};
+	auto verify = [&](const Lns& a, const Lns& b) {
+		if (op == BinaryOperator::DIV && b.iszero()) return true;
+		long double da = a.to_long_double(), db = b.to_long_double();
+		Lns c = ApplyBinaryOperator(op, a, b);
+		long double dc = ApplyBinaryOperator(op, da, db);
+		// skip the encodings whose values or results leave the normal range of long double
+		if (!(a.iszero() || Normal(da)) || !(b.iszero() || Normal(db)) || !(dc == 0.0l || Normal(dc))) return true;
+		if (dc == 0.0l && (op == BinaryOperator::MUL || op == BinaryOperator::DIV) && !a.iszero() && !b.iszero()) return true;
+		Lns ref;
+		ref = dc;
+		if (LnsWithin(c, ref, tolerance)) return true;
+		if (bReportIndividualTestCases) std::cout << tag << " FAIL " << components(a) << " op " << components(b) << " = " << components(c) << " reference " << components(ref) << std::endl;
+		return false;
+	};
+	return VerifyBinaryOperator<Lns, nbits>(nrSamples, nbits, sample, verify);
+}
+
+}} // namespace sw::unum
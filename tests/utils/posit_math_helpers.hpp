@@ -164,7 +164,14 @@ namespace sw {
 				pexp = sw::unum::exp(pa);
 				// generate reference
 				double da = double(pa);
-				pref = std::exp(da);
+				double dexp = std::exp(da);
+				if (std::isinf(dexp)) {
+					// posits saturate to maxpos
+					maxpos<nbits, es>(pref);
+				}
+				else {
+					pref = dexp;
+				}
 				if (pexp != pref) {
 					if (std::exp(da) != 0.0) { // exclude special posit rounding rule that projects to minpos
 						nrOfFailedTests++;
@@ -190,7 +197,14 @@ namespace sw {
 				pexp2 = sw::unum::exp2(pa);
 				// generate reference
 				double da = double(pa);
-				pref = std::exp2(da);
+				double dexp2 = std::exp2(da);
+				if (std::isinf(dexp2)) {
+					// posits saturate to maxpos
+					maxpos<nbits, es>(pref);
+				}
+				else {
+					pref = dexp2;
+				}
 				if (pexp2 != pref) {
 					if (std::exp(da) != 0.0) { // exclude special posit rounding rule that projects to minpos
 						nrOfFailedTests++;
@@ -233,7 +247,22 @@ namespace sw {
 #else
 					ppow = pow(pa, pb);
 #endif
-					pref = std::pow(da, db);
+					// NaR operands return NaR, and results that overflow or underflow saturate to maxpos or minpos
+					double dpow = std::pow(da, db);
+					if (pa.isnar() || pb.isnar()) {
+						pref.setnar();
+					}
+					else if (da != 0.0 && std::isinf(dpow)) {
+						maxpos<nbits, es>(pref);
+						if (dpow < 0) pref = -pref;
+					}
+					else if (da != 0.0 && dpow == 0.0) {
+						minpos<nbits, es>(pref);
+						if (std::signbit(dpow)) pref = -pref;
+					}
+					else {
+						pref = dpow;
+					}
 					if (ppow != pref) {
 						nrOfFailedTests++;
 						if (bReportIndividualTestCases)	ReportTwoInputFunctionError("FAIL", "pow", pa, pb, pref, ppow);
@@ -408,7 +437,15 @@ namespace sw {
 				psinh = sw::unum::sinh(pa);
 				// generate reference
 				double da = double(pa);
-				pref = std::sinh(da);
+				double dsinh = std::sinh(da);
+				if (std::isinf(dsinh)) {
+					// posits saturate to maxpos
+					maxpos<nbits, es>(pref);
+					if (dsinh < 0) pref = -pref;
+				}
+				else {
+					pref = dsinh;
+				}
 				if (psinh != pref) {
 					nrOfFailedTests++;
 					if (bReportIndividualTestCases)	ReportOneInputFunctionError("FAIL", "sinh", pa, pref, psinh);
@@ -432,7 +469,15 @@ namespace sw {
 				pcosh = sw::unum::cosh(pa);
 				// generate reference
 				double da = double(pa);
-				pref = std::cosh(da);
+				double dcosh = std::cosh(da);
+				if (std::isinf(dcosh)) {
+					// posits saturate to maxpos
+					maxpos<nbits, es>(pref);
+					if (dcosh < 0) pref = -pref;
+				}
+				else {
+					pref = dcosh;
+				}
 				if (pcosh != pref) {
 					nrOfFailedTests++;
 					if (bReportIndividualTestCases)	ReportOneInputFunctionError("FAIL", "cosh", pa, pref, pcosh);
@@ -481,4 +481,154 @@ namespace sw { namespace unum {
 		return nrOfFailedTests;
 	}
 
+	//////////////////////////////////// BIT-LEVEL VALIDATION OF FAST SPECIALIZATIONS ////////////////////////
+
+	// The fast specializations replace the bitblock/value<> pipeline of the generic posit with native integer
+	// pipelines. The generic pipeline serves as the reference: the results need to be bit-identical.
+
+	// decode a posit through the generic bitblock path into a (sign, scale, fraction) triple
+	template<size_t nbits, size_t es>
+	value<nbits - 3 - es> GenericDecode(const posit<nbits, es>& p) {
+		constexpr size_t fbits = nbits - 3 - es;
+		bool s;
+		regime<nbits, es> r;
+		exponent<nbits, es> e;
+		fraction<fbits> f;
+		decode(p.get(), s, r, e, f);
+		return value<fbits>(s, r.scale() + e.scale(), f.get(), p.iszero(), p.isnar());
+	}
+
+	// generate a random encoding, and a second one that is either random, or of near equal magnitude,
+	// or near equal magnitude of opposite sign, to exercise alignment and cancellation
+	template<size_t nbits, size_t es>
+	void GenerateRandomOperands(std::mt19937_64& eng, uint32_t i, posit<nbits, es>& pa, posit<nbits, es>& pb) {
+		bitblock<nbits> raw;
+		uint64_t chunk = 0;
+		for (size_t k = 0; k < nbits; ++k) {
+			if ((k & 0x3F) == 0) chunk = eng();
+			raw[k] = bool(chunk & 0x1);
+			chunk >>= 1;
+		}
+		pa.set(raw);
+		switch (i % 3) {
+		case 0:
+			for (size_t k = 0; k < nbits; ++k) {
+				if ((k & 0x3F) == 0) chunk = eng();
+				raw[k] = bool(chunk & 0x1);
+				chunk >>= 1;
+			}
+			break;
+		case 1:
+			raw = pa.get();
+			break;
+		case 2:
+			raw = (-pa).get();
+			break;
+		}
+		// perturb the least significant bits
+		chunk = eng();
+		for (size_t k = 0; k < 16; ++k) {
+			raw[k] = bool(chunk & 0x1);
+			chunk >>= 1;
+		}
+		pb.set(raw);
+	}
+
+	// validate the binary operators of a fast posit specialization against the value<> pipeline of the generic posit
+	template<size_t nbits, size_t es>
+	int ValidateBitExactBinaryOperatorThroughRandoms(const std::string& tag, bool bReportIndividualTestCases, int opcode, uint32_t nrOfRandoms) {
+		constexpr size_t fbits   = nbits - 3 - es;
+		constexpr size_t fhbits  = fbits + 1;
+		constexpr size_t abits   = fhbits + 3;
+		constexpr size_t mbits   = 2 * fhbits;
+		constexpr size_t divbits = 3 * fhbits + 4;
+
+		std::mt19937_64 eng(0x5EED);
+		int nrOfFailedTests = 0;
+		posit<nbits, es> pa, pb, presult, preference;
+		for (uint32_t i = 0; i < nrOfRandoms; ++i) {
+			GenerateRandomOperands(eng, i, pa, pb);
+			if (pa.iszero() || pa.isnar() || pb.iszero() || pb.isnar()) continue;
+			value<fbits> va = GenericDecode(pa), vb = GenericDecode(pb);
+			std::string operation_string;
+			switch (opcode) {
+			case OPCODE_ADD:
+			{
+				operation_string = "+";
+				presult = pa + pb;
+				value<abits + 1> sum;
+				module_add<fbits, abits>(va, vb, sum);
+				if (sum.iszero()) preference.setzero(); else convert(sum, preference);
+			}
+			break;
+			case OPCODE_SUB:
+			{
+				operation_string = "-";
+				presult = pa - pb;
+				value<abits + 1> difference;
+				module_subtract<fbits, abits>(va, vb, difference);
+				if (difference.iszero()) preference.setzero(); else convert(difference, preference);
+			}
+			break;
+			case OPCODE_MUL:
+			{
+				operation_string = "*";
+				presult = pa * pb;
+				value<mbits> product;
+				module_multiply(va, vb, product);
+				convert(product, preference);
+			}
+			break;
+			case OPCODE_DIV:
+			{
+				operation_string = "/";
+				presult = pa / pb;
+				value<divbits> ratio;
+				module_divide(va, vb, ratio);
+				convert<nbits, es, divbits>(ratio, preference);
+			}
+			break;
+			default:
+				std::cerr << "Unsupported binary operator: operation ignored\n";
+				return ++nrOfFailedTests;
+			}
+			if (presult != preference) {
+				++nrOfFailedTests;
+				if (bReportIndividualTestCases) std::cout << tag << " FAIL " << hex_format(pa) << ' ' << operation_string << ' ' << hex_format(pb) << " produced " << hex_format(presult) << " instead of " << hex_format(preference) << std::endl;
+			}
+		}
+		return nrOfFailedTests;
+	}
+
+	// validate the sqrt of a fast posit specialization: the roots of perfect squares must be exact,
+	// and when long double can serve as a reference, random arguments must be within one ulp of its root
+	template<size_t nbits, size_t es>
+	int ValidateExactSqrtThroughRandoms(const std::string& tag, bool bReportIndividualTestCases, uint32_t nrOfRandoms) {
+		// a root with rootBits significant bits has a square that is exactly representable
+		constexpr unsigned rootBits = ((nbits - 4 - es) / 3 < 62) ? unsigned((nbits - 4 - es) / 3) : 62u;
+		constexpr unsigned randomShift = (nbits < 64) ? unsigned(65 - nbits) : 1u;  // random positive encodings
+		std::mt19937_64 eng(0x5EED);
+		int nrOfFailedTests = 0;
+		for (uint32_t i = 0; i < nrOfRandoms; ++i) {
+			posit<nbits, es> root((long long)(eng() >> (64 - rootBits)));
+			posit<nbits, es> square = root * root;
+			if (!root.iszero() && sqrt(square) != root) {
+				++nrOfFailedTests;
+				if (bReportIndividualTestCases) std::cout << tag << " FAIL sqrt(" << hex_format(square) << ") != " << hex_format(root) << std::endl;
+			}
+
+			if (nbits > 64) continue;
+			posit<nbits, es> pa;
+			pa.set_raw_bits(eng() >> randomShift);
+			if (pa.iszero()) continue;
+			posit<nbits, es> presult = sqrt(pa);
+			posit<nbits, es> preference((long double)(std::sqrt((long double)(pa))));
+			if (presult != preference && presult != ++posit<nbits, es>(preference) && presult != --posit<nbits, es>(preference)) {
+				++nrOfFailedTests;
+				if (bReportIndividualTestCases) std::cout << tag << " FAIL sqrt(" << hex_format(pa) << ") produced " << hex_format(presult) << " instead of " << hex_format(preference) << std::endl;
+			}
+		}
+		return nrOfFailedTests;
+	}
+
 }} // namespace sw::unum
@@ -11,12 +11,115 @@
 #include <typeinfo>
 #include <random>
 #include <limits>
+// the exact reference of the bounds
+#include <universal/mpfloat/mpfloat.hpp>
+#include "binary_operator_helpers.hpp"
 
 namespace sw {
 	namespace unum {
 
 		static constexpr unsigned FLOAT_TABLE_WIDTH = 15;
 
+		// the result of an operator on two posits, rounded to 40 limbs: exact for sums and products,
+		// and for quotients that are posits, while the other quotients stay far away from any posit
+		template<size_t nbits, size_t es>
+		mpfloat ValidReference(BinaryOperator op, const posit<nbits, es>& a, const posit<nbits, es>& b) {
+			mpfloat::setprecision(40);
+			return ApplyBinaryOperator(op, mpfloat((long double)a), mpfloat((long double)b));
+		}
+
+		// does the valid contain the value, a NaR lower bound is -inf and a NaR upper bound is +inf
+		template<size_t nbits, size_t es>
+		bool ValidContains(const valid<nbits, es>& v, const mpfloat& x) {
+			posit<nbits, es> lb, ub;
+			bool lclosed = v.getlb(lb), uclosed = v.getub(ub);
+			if (!lb.isnar()) {
+				mpfloat l((long double)lb);
+				if (lclosed ? (x < l) : (x <= l)) return false;
+			}
+			if (!ub.isnar()) {
+				mpfloat u((long double)ub);
+				if (uclosed ? (u < x) : (u <= x)) return false;
+			}
+			return true;
+		}
+
+		// an operator on two exact valids must return the tightest enclosure of the exact result:
+		// the closed point when the result is a posit, otherwise the open interval between adjacent posits
+		// exhaustive over all posit pairs when nrSamples is 0, random otherwise
+		template<size_t nbits, size_t es>
+		int VerifyValidPointArithmetic(const std::string& tag, BinaryOperator op, size_t nrSamples, bool bReportIndividualTestCases) {
+			using Posit = posit<nbits, es>;
+			auto sample = [](std::mt19937_64& rng, size_t n, Posit& a, Posit& b) {
+				a.set_raw_bits(rng());
+				// half of the samples have nearby encodings to exercise cancellation and exact results
+				b.set_raw_bits((n & 0x1) ? a.get().to_ullong() + (rng() % 64) - 32 : rng());
+			};
+			auto verify = [&](const Posit& a, const Posit& b) {
+				if (a.isnar() || b.isnar()) return true;
+				if (op == BinaryOperator::DIV && b.iszero()) return true;
+				Posit pa(a), pb(b);
+				valid<nbits, es> va, vb;
+				va.setlb(pa, true); va.setub(pa, true);
+				vb.setlb(pb, true); vb.setub(pb, true);
+				valid<nbits, es> vc = ApplyBinaryOperator(op, va, vb);
+				mpfloat ref = ValidReference(op, a, b);
+				Posit lb, ub;
+				bool lclosed = vc.getlb(lb), uclosed = vc.getub(ub);
+				bool pass = ValidContains(vc, ref);
+				if (lclosed || uclosed) {
+					pass = pass && lclosed && uclosed && lb == ub;
+				}
+				else {
+					Posit next(lb);
+					++next;
+					pass = pass && (next == ub);
+				}
+				if (!pass && bReportIndividualTestCases) std::cout << tag << " FAIL " << a << " op " << b << " = " << vc << " reference " << ref << std::endl;
+				return pass;
+			};
+			return VerifyBinaryOperator<Posit, nbits>(nrSamples, nbits + es, sample, verify);
+		}
+
+		// an operator on two intervals must contain the results at the corners and at random interior posits
+		template<size_t nbits, size_t es>
+		int VerifyValidIntervalArithmetic(const std::string& tag, BinaryOperator op, size_t nrSamples, bool bReportIndividualTestCases) {
+			std::mt19937_64 rng(nbits * es + 1);
+			int nrOfFailedTests = 0;
+			for (size_t n = 0; n < nrSamples; ++n) {
+				posit<nbits, es> a[2], b[2];
+				for (int i = 0; i < 2; ++i) {
+					a[i].set_raw_bits(rng());
+					b[i].set_raw_bits(rng());
+				}
+				// the divisor is a positive interval
+				if (op == BinaryOperator::DIV) {
+					for (int i = 0; i < 2; ++i) if (b[i].isneg() || b[i].iszero() || b[i].isnar()) b[i].set_raw_bits(1 + rng() % ((uint64_t(1) << (nbits - 1)) - 1));
+				}
+				if (a[0].isnar() || a[1].isnar() || b[0].isnar() || b[1].isnar()) continue;
+				if (a[1] < a[0]) std::swap(a[0], a[1]);
+				if (b[1] < b[0]) std::swap(b[0], b[1]);
+				valid<nbits, es> va, vb;
+				va.setlb(a[0], true); va.setub(a[1], true);
+				vb.setlb(b[0], true); vb.setub(b[1], true);
+				valid<nbits, es> vc = ApplyBinaryOperator(op, va, vb);
+				for (int i = 0; i < 6; ++i) {
+					posit<nbits, es> x(a[i & 1]), y(b[(i >> 1) & 1]);
+					if (i >= 4) {
+						// an interior posit of each interval
+						x.set_raw_bits(a[0].get().to_ullong() + rng() % (a[1].get().to_ullong() - a[0].get().to_ullong() + 1));
+						y.set_raw_bits(b[0].get().to_ullong() + rng() % (b[1].get().to_ullong() - b[0].get().to_ullong() + 1));
+						if (x < a[0] || a[1] < x || y < b[0] || b[1] < y || x.isnar() || y.isnar()) continue;
+					}
+					mpfloat ref = ValidReference(op, x, y);
+					if (!ValidContains(vc, ref)) {
+						++nrOfFailedTests;
+						if (bReportIndividualTestCases) std::cout << tag << " FAIL " << va << " op " << vb << " = " << vc << " does not contain " << x << " op " << y << std::endl;
+					}
+				}
+			}
+			return nrOfFailedTests;
+		}
 
 	} // namespace unum
 } // namespace sw
@@ -33,11 +33,21 @@ void GenerateTestCase(Ty a, Ty b) {
 	pa = a;
 	pb = b;
 	reference = a + b;
-	//psum = pa + pb;
+	psum = pa + pb;
 	std::cout << "reference " << reference << " result " << psum << '\n' << std::endl;
 }
 
-#define MANUAL_TESTING 1
+template<size_t nbits, size_t es>
+int ValidateAddition(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	return sw::unum::VerifyValidPointArithmetic<nbits, es>(tag, sw::unum::BinaryOperator::ADD, nrSamples, bReportIndividualTestCases);
+}
+
+template<size_t nbits, size_t es>
+int ValidateIntervalAddition(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	return sw::unum::VerifyValidIntervalArithmetic<nbits, es>(tag, sw::unum::BinaryOperator::ADD, nrSamples, bReportIndividualTestCases);
+}
+
+#define MANUAL_TESTING 0
 #define STRESS_TESTING 0
 
 int main(int argc, char** argv)
@@ -45,7 +55,7 @@ try {
 	using namespace std;
 	using namespace sw::unum;
 
-	//bool bReportIndividualTestCases = false;
+	bool bReportIndividualTestCases = false;
 	int nrOfFailedTestCases = 0;
 	std::string tag = "Addition failed: ";
 
@@ -76,50 +86,28 @@ try {
 
 #else
 
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<3, 0>(tag, bReportIndividualTestCases), "valid<3,0>", "addition");
-
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<4, 0>(tag, bReportIndividualTestCases), "valid<4,0>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<4, 1>(tag, bReportIndividualTestCases), "valid<4,1>", "addition");
+	// exhaustive: every sum of two posits must be the closed point or the open interval between adjacent posits
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<5, 0>(tag, 0, bReportIndividualTestCases), "valid<5,0>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<6, 1>(tag, 0, bReportIndividualTestCases), "valid<6,1>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8, 0>(tag, 0, bReportIndividualTestCases), "valid<8,0>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8, 1>(tag, 0, bReportIndividualTestCases), "valid<8,1>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8, 2>(tag, 0, bReportIndividualTestCases), "valid<8,2>", "addition");
 
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<5, 0>(tag, bReportIndividualTestCases), "valid<5,0>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<5, 1>(tag, bReportIndividualTestCases), "valid<5,1>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<5, 2>(tag, bReportIndividualTestCases), "valid<5,2>", "addition");
+	// double fast paths
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<16, 1>(tag, 20000, bReportIndividualTestCases), "valid<16,1>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<32, 2>(tag, 20000, bReportIndividualTestCases), "valid<32,2>", "addition");
+	// long double error-free transforms
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<12, 1>(tag, 20000, bReportIndividualTestCases), "valid<12,1>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<24, 2>(tag, 20000, bReportIndividualTestCases), "valid<24,2>", "addition");
 
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<6, 0>(tag, bReportIndividualTestCases), "valid<6,0>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<6, 1>(tag, bReportIndividualTestCases), "valid<6,1>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<6, 2>(tag, bReportIndividualTestCases), "valid<6,2>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<6, 3>(tag, bReportIndividualTestCases), "valid<6,3>", "addition");
-
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<7, 0>(tag, bReportIndividualTestCases), "valid<7,0>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<7, 1>(tag, bReportIndividualTestCases), "valid<7,1>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<7, 2>(tag, bReportIndividualTestCases), "valid<7,2>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<7, 3>(tag, bReportIndividualTestCases), "valid<7,3>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<7, 4>(tag, bReportIndividualTestCases), "valid<7,4>", "addition");
-
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8, 0>(tag, bReportIndividualTestCases), "valid<8,0>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8, 1>(tag, bReportIndividualTestCases), "valid<8,1>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8, 2>(tag, bReportIndividualTestCases), "valid<8,2>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8, 3>(tag, bReportIndividualTestCases), "valid<8,3>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8, 4>(tag, bReportIndividualTestCases), "valid<8,4>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<8, 5>(tag, bReportIndividualTestCases), "valid<8,5>", "addition");
-
-	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<16, 1>(tag, bReportIndividualTestCases, OPCODE_ADD, 1000), "valid<16,1>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<24, 1>(tag, bReportIndividualTestCases, OPCODE_ADD, 1000), "valid<24,1>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<32, 1>(tag, bReportIndividualTestCases, OPCODE_ADD, 1000), "valid<32,1>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<32, 2>(tag, bReportIndividualTestCases, OPCODE_ADD, 1000), "valid<32,2>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<48, 2>(tag, bReportIndividualTestCases, OPCODE_ADD, 1000), "valid<48,2>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateIntervalAddition<8, 0>(tag, 10000, bReportIndividualTestCases), "valid<8,0>", "interval addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateIntervalAddition<16, 1>(tag, 10000, bReportIndividualTestCases), "valid<16,1>", "interval addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateIntervalAddition<32, 2>(tag, 10000, bReportIndividualTestCases), "valid<32,2>", "interval addition");
 
 #if STRESS_TESTING
-	// nbits=64 requires long double compiler support
-	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<64, 2>(tag, bReportIndividualTestCases, OPCODE_ADD, 1000), "valid<64,2>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<64, 3>(tag, bReportIndividualTestCases, OPCODE_ADD, 1000), "valid<64,3>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateThroughRandoms<64, 4>(tag, bReportIndividualTestCases, OPCODE_ADD, 1000), "valid<64,4>", "addition");
-
-
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<10, 1>(tag, bReportIndividualTestCases), "valid<10,1>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<12, 1>(tag, bReportIndividualTestCases), "valid<12,1>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<14, 1>(tag, bReportIndividualTestCases), "valid<14,1>", "addition");
-	nrOfFailedTestCases += ReportTestResult(ValidateAddition<16, 1>(tag, bReportIndividualTestCases), "valid<16,1>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<10, 1>(tag, 0, bReportIndividualTestCases), "valid<10,1>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<12, 1>(tag, 0, bReportIndividualTestCases), "valid<12,1>", "addition");
+	nrOfFailedTestCases += ReportTestResult(ValidateAddition<48, 2>(tag, 100000, bReportIndividualTestCases), "valid<48,2>", "addition");
 #endif  // STRESS_TESTING
 
 #endif  // MANUAL_TESTING
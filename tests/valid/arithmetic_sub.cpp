@@ -0,0 +1,123 @@
+// arithmetic_sub.cpp: functional tests for valid subtraction
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+
+// Configure the valid template environment
+// first: enable  general or specialized posit configurations
+//#define VALID_FAST_SPECIALIZATION
+// second: enable/disable posit arithmetic exceptions
+#define VALID_THROW_ARITHMETIC_EXCEPTION 0
+// third: enable tracing 
+// when you define VALID_VERBOSE_OUTPUT executing an ADD the code will print intermediate results
+//#define VALID_VERBOSE_OUTPUT
+#include "universal/posit/exceptions.hpp"
+#include "universal/bitblock/bitblock.hpp"
+#include "universal/value/value.hpp"
+#include "universal/posit/posit.hpp"
+#include "universal/valid/valid.hpp"
+#include "universal/valid/valid_manipulators.hpp"
+// test helpers, such as, ReportTestResults
+#include "../utils/test_helpers.hpp"
+#include "../utils/valid_test_helpers.hpp"
+
+
+// generate specific test case that you can trace with the trace conditions in posit.h
+// for most bugs they are traceable with _trace_conversion and _trace_add
+template<size_t nbits, size_t es, typename Ty>
+void GenerateTestCase(Ty a, Ty b) {
+	Ty reference;
+	sw::unum::valid<nbits, es> pa, pb, psum;
+	pa = a;
+	pb = b;
+	reference = a - b;
+	psum = pa - pb;
+	std::cout << "reference " << reference << " result " << psum << '\n' << std::endl;
+}
+
+template<size_t nbits, size_t es>
+int ValidateSubtraction(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	return sw::unum::VerifyValidPointArithmetic<nbits, es>(tag, sw::unum::BinaryOperator::SUB, nrSamples, bReportIndividualTestCases);
+}
+
+template<size_t nbits, size_t es>
+int ValidateIntervalSubtraction(const std::string& tag, size_t nrSamples, bool bReportIndividualTestCases) {
+	return sw::unum::VerifyValidIntervalArithmetic<nbits, es>(tag, sw::unum::BinaryOperator::SUB, nrSamples, bReportIndividualTestCases);
+}
+
+#define MANUAL_TESTING 0
+#define STRESS_TESTING 0
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = false;
+	int nrOfFailedTestCases = 0;
+	std::string tag = "Subtraction failed: ";
+
+	cout << "Valid subtraction validation" << endl;
+
+#if MANUAL_TESTING
+	// generate individual testcases to hand trace/debug
+	constexpr size_t nbits = 16;
+	constexpr size_t es = 1;
+	valid<nbits, es> v1, v2;
+
+	v1.clear();
+	cout << v1 << endl;
+
+	v2.setinclusive();
+	cout << v2 << endl;
+
+	v1 = 1;
+	cout << v1 << endl;
+
+	posit<nbits, es> lb(1.25f), ub(1.375f);
+	v2.setlb(lb, false);
+	v2.setub(ub, true);
+	cout << v2 << endl;
+
+	int order = v2.relative_order(value<10>(0));
+	cout << order << endl;
+
+#else
+
+	// exhaustive: every difference of two posits must be the closed point or the open interval between adjacent posits
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<5, 0>(tag, 0, bReportIndividualTestCases), "valid<5,0>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<6, 1>(tag, 0, bReportIndividualTestCases), "valid<6,1>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<8, 0>(tag, 0, bReportIndividualTestCases), "valid<8,0>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<8, 1>(tag, 0, bReportIndividualTestCases), "valid<8,1>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<8, 2>(tag, 0, bReportIndividualTestCases), "valid<8,2>", "subtraction");
+
+	// double fast paths
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<16, 1>(tag, 20000, bReportIndividualTestCases), "valid<16,1>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<32, 2>(tag, 20000, bReportIndividualTestCases), "valid<32,2>", "subtraction");
+	// long double error-free transforms
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<12, 1>(tag, 20000, bReportIndividualTestCases), "valid<12,1>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<24, 2>(tag, 20000, bReportIndividualTestCases), "valid<24,2>", "subtraction");
+
+	nrOfFailedTestCases += ReportTestResult(ValidateIntervalSubtraction<8, 0>(tag, 10000, bReportIndividualTestCases), "valid<8,0>", "interval subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateIntervalSubtraction<16, 1>(tag, 10000, bReportIndividualTestCases), "valid<16,1>", "interval subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateIntervalSubtraction<32, 2>(tag, 10000, bReportIndividualTestCases), "valid<32,2>", "interval subtraction");
+
+#if STRESS_TESTING
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<10, 1>(tag, 0, bReportIndividualTestCases), "valid<10,1>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<12, 1>(tag, 0, bReportIndividualTestCases), "valid<12,1>", "subtraction");
+	nrOfFailedTestCases += ReportTestResult(ValidateSubtraction<48, 2>(tag, 100000, bReportIndividualTestCases), "valid<48,2>", "subtraction");
+#endif  // STRESS_TESTING
+
+#endif  // MANUAL_TESTING
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}
@@ -0,0 +1,115 @@
+// elementary.cpp: test suite for the vectorized exponent, logarithm, hyperbolic, and trigonometry functions
+//
+// Copyright (C) 2017-2020 Stillwater Supercomputing, Inc.
+//
+// This file is part of the universal numbers project, which is released under an MIT Open Source license.
+#include <cmath>
+// Configure the posit library with arithmetic exceptions
+// enable posit arithmetic exceptions
+#define POSIT_THROW_ARITHMETIC_EXCEPTION 1
+#include <universal/posit/posit>
+#include <universal/blas/blas>
+#include "../utils/test_helpers.hpp"
+
+// the vector function must reproduce the scalar function for every element
+template<typename Scalar, typename VectorFunction, typename ScalarFunction>
+int VerifyVectorFunction(const std::string& tag, const sw::unum::blas::vector<Scalar>& x, VectorFunction vf, ScalarFunction sf, bool bReportIndividualTestCases) {
+	int nrOfFailedTests = 0;
+	sw::unum::blas::vector<Scalar> v = vf(x);
+	for (size_t i = 0; i < x.size(); ++i) {
+		Scalar ref = sf(x[i]);
+		if (v[i] != ref && !(v[i] != v[i] && ref != ref)) {   // NaN results of native types match each other
+			++nrOfFailedTests;
+			if (bReportIndividualTestCases) std::cout << tag << " FAIL " << x[i] << " : " << v[i] << " != " << ref << std::endl;
+		}
+	}
+	return nrOfFailedTests;
+}
+
+// arguments across the dynamic range of the number system: the domain errors and saturations are part of the test
+template<typename Scalar>
+sw::unum::blas::vector<Scalar> TestArguments(size_t N) {
+	sw::unum::blas::vector<Scalar> x(N);
+	for (size_t i = 0; i < N; ++i) {
+		double t = double(i) / double(N - 1);
+		x[i] = Scalar(((i & 1) ? -1.0 : 1.0) * std::ldexp(1.0 + t, int(i % 21) - 10));
+	}
+	return x;
+}
+
+template<typename Scalar>
+int VerifyElementaryVmath(const std::string& tag, size_t N, bool bReportIndividualTestCases) {
+	using namespace sw::unum;
+	using std::exp; using std::exp2; using std::expm1; using std::log; using std::log2; using std::log10; using std::log1p;
+	using std::sin; using std::cos; using std::tan; using std::asin; using std::acos; using std::atan;
+	using std::sinh; using std::cosh; using std::tanh;
+	using Vector = blas::vector<Scalar>;
+	Vector x = TestArguments<Scalar>(N);
+	// arguments in [-1, 1] for the inverse trigonometric functions
+	Vector u(N);
+	for (size_t i = 0; i < N; ++i) u[i] = Scalar(2.0 * double(i) / double(N - 1) - 1.0);
+
+	int nrOfFailedTests = 0;
+	nrOfFailedTests += VerifyVectorFunction(tag + " exp",   x, [](const Vector& v) { return blas::exp(v); },   [](Scalar a) { return exp(a); }, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyVectorFunction(tag + " exp2",  x, [](const Vector& v) { return blas::exp2(v); },  [](Scalar a) { return exp2(a); }, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyVectorFunction(tag + " expm1", x, [](const Vector& v) { return blas::expm1(v); }, [](Scalar a) { return expm1(a); }, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyVectorFunction(tag + " log",   x, [](const Vector& v) { return blas::log(v); },   [](Scalar a) { return log(a); }, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyVectorFunction(tag + " log2",  x, [](const Vector& v) { return blas::log2(v); },  [](Scalar a) { return log2(a); }, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyVectorFunction(tag + " log10", x, [](const Vector& v) { return blas::log10(v); }, [](Scalar a) { return log10(a); }, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyVectorFunction(tag + " log1p", x, [](const Vector& v) { return blas::log1p(v); }, [](Scalar a) { return log1p(a); }, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyVectorFunction(tag + " sinh",  x, [](const Vector& v) { return blas::sinh(v); },  [](Scalar a) { return sinh(a); }, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyVectorFunction(tag + " cosh",  x, [](const Vector& v) { return blas::cosh(v); },  [](Scalar a) { return cosh(a); }, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyVectorFunction(tag + " tanh",  x, [](const Vector& v) { return blas::tanh(v); },  [](Scalar a) { return tanh(a); }, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyVectorFunction(tag + " sin",   x, [](const Vector& v) { return blas::sin(v); },   [](Scalar a) { return sin(a); }, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyVectorFunction(tag + " cos",   x, [](const Vector& v) { return blas::cos(v); },   [](Scalar a) { return cos(a); }, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyVectorFunction(tag + " tan",   x, [](const Vector& v) { return blas::tan(v); },   [](Scalar a) { return tan(a); }, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyVectorFunction(tag + " atan",  x, [](const Vector& v) { return blas::atan(v); },  [](Scalar a) { return atan(a); }, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyVectorFunction(tag + " asin",  u, [](const Vector& v) { return blas::asin(v); },  [](Scalar a) { return asin(a); }, bReportIndividualTestCases);
+	nrOfFailedTests += VerifyVectorFunction(tag + " acos",  u, [](const Vector& v) { return blas::acos(v); },  [](Scalar a) { return acos(a); }, bReportIndividualTestCases);
+	return nrOfFailedTests;
+}
+
+int main(int argc, char** argv)
+try {
+	using namespace std;
+	using namespace sw::unum;
+
+	bool bReportIndividualTestCases = true;
+	int nrOfFailedTestCases = 0;
+
+	cout << "vmath elementary functions: the vector functions must reproduce the scalar functions" << endl;
+
+	// posit<8,0> and posit<16,1> convert through the branch-free batch kernels, posit<32,2> through double,
+	// and posit<64,3> is evaluated in the posit domain
+	nrOfFailedTestCases += ReportTestResult(VerifyElementaryVmath< posit<8, 0> >("posit<8,0>", 200, bReportIndividualTestCases), "vmath posit<8,0>", "elementary functions");
+	nrOfFailedTestCases += ReportTestResult(VerifyElementaryVmath< posit<16, 1> >("posit<16,1>", 1000, bReportIndividualTestCases), "vmath posit<16,1>", "elementary functions");
+	nrOfFailedTestCases += ReportTestResult(VerifyElementaryVmath< posit<32, 2> >("posit<32,2>", 1000, bReportIndividualTestCases), "vmath posit<32,2>", "elementary functions");
+	nrOfFailedTestCases += ReportTestResult(VerifyElementaryVmath< posit<64, 3> >("posit<64,3>", 50, bReportIndividualTestCases), "vmath posit<64,3>", "elementary functions");
+	nrOfFailedTestCases += ReportTestResult(VerifyElementaryVmath< float >("float", 1000, bReportIndividualTestCases), "vmath float", "elementary functions");
+
+	return (nrOfFailedTestCases > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+catch (char const* msg) {
+	std::cerr << msg << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_arithmetic_exception& err) {
+	std::cerr << "Uncaught posit arithmetic exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const quire_exception& err) {
+	std::cerr << "Uncaught quire exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const posit_internal_exception& err) {
+	std::cerr << "Uncaught posit internal exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (const std::runtime_error& err) {
+	std::cerr << "Uncaught runtime exception: " << err.what() << std::endl;
+	return EXIT_FAILURE;
+}
+catch (...) {
+	std::cerr << "Caught unknown exception" << std::endl;
+	return EXIT_FAILURE;
+}